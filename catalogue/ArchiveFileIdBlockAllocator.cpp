@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/ArchiveFileIdBlockAllocator.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/LogContext.hpp"
+#include "common/process/threading/MutexLocker.hpp"
+#include "common/telemetry/metrics/instruments/RdbmsInstruments.hpp"
+#include "common/utils/Timer.hpp"
+
+namespace cta::catalogue {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+ArchiveFileIdBlockAllocator::ArchiveFileIdBlockAllocator(log::Logger& log, FetchIds fetchIds, uint64_t blockSize)
+    : m_log(log),
+      m_fetchIds(std::move(fetchIds)),
+      m_blockSize(blockSize),
+      m_lowWatermark(blockSize / 4) {
+  if (m_blockSize < 2) {
+    throw exception::Exception(
+      "In ArchiveFileIdBlockAllocator::ArchiveFileIdBlockAllocator(): block size must be at least 2");
+  }
+  threading::Thread::start();
+}
+
+//------------------------------------------------------------------------------
+// destructor
+//------------------------------------------------------------------------------
+ArchiveFileIdBlockAllocator::~ArchiveFileIdBlockAllocator() {
+  {
+    threading::MutexLocker locker(m_mutex);
+    m_stopRequested = true;
+    m_condVar.broadcast();
+  }
+  threading::Thread::wait();
+
+  const uint64_t nbWastedIds = m_ids.size();
+  cta::telemetry::metrics::ctaCatalogueArchiveFileIdWastedCount->Add(nbWastedIds);
+  if (nbWastedIds > 0) {
+    log::LogContext lc(m_log);
+    log::ScopedParamContainer params(lc);
+    params.add("nbWastedIds", nbWastedIds).add("firstWastedId", m_ids.front());
+    lc.log(log::INFO, "In ArchiveFileIdBlockAllocator::~ArchiveFileIdBlockAllocator(): unused archive file IDs dropped");
+  }
+}
+
+//------------------------------------------------------------------------------
+// getNextArchiveFileId
+//------------------------------------------------------------------------------
+uint64_t ArchiveFileIdBlockAllocator::getNextArchiveFileId() {
+  threading::MutexLocker locker(m_mutex);
+  while (m_ids.empty()) {
+    if (m_refilling) {
+      m_condVar.wait(locker);
+      continue;
+    }
+    // Nobody is fetching identifiers: fetch the next block synchronously so that errors reach the caller
+    m_refilling = true;
+    locker.unlock();
+    refill();
+    locker.lock();
+  }
+  const uint64_t archiveFileId = m_ids.front();
+  m_ids.pop_front();
+  if (m_ids.size() <= m_lowWatermark && !m_refilling) {
+    m_refilling = true;
+    m_refillRequested = true;
+    m_condVar.broadcast();
+  }
+  return archiveFileId;
+}
+
+//------------------------------------------------------------------------------
+// refill
+//------------------------------------------------------------------------------
+void ArchiveFileIdBlockAllocator::refill() {
+  std::list<uint64_t> ids;
+  utils::Timer t;
+  try {
+    ids = m_fetchIds(m_blockSize);
+  } catch (...) {
+    threading::MutexLocker locker(m_mutex);
+    m_refilling = false;
+    m_condVar.broadcast();
+    throw;
+  }
+  const double fetchTime = t.secs();
+  cta::telemetry::metrics::ctaCatalogueArchiveFileIdRefillCount->Add(1);
+
+  threading::MutexLocker locker(m_mutex);
+  m_ids.insert(m_ids.end(), ids.begin(), ids.end());
+  m_refilling = false;
+  m_condVar.broadcast();
+
+  log::LogContext lc(m_log);
+  log::ScopedParamContainer params(lc);
+  params.add("nbFetchedIds", ids.size()).add("nbAvailableIds", m_ids.size()).add("fetchTime", fetchTime);
+  lc.log(log::DEBUG, "In ArchiveFileIdBlockAllocator::refill(): fetched a block of archive file IDs");
+}
+
+//------------------------------------------------------------------------------
+// run
+//------------------------------------------------------------------------------
+void ArchiveFileIdBlockAllocator::run() {
+  threading::MutexLocker locker(m_mutex);
+  while (true) {
+    while (!m_refillRequested && !m_stopRequested) {
+      m_condVar.wait(locker);
+    }
+    if (m_stopRequested) {
+      return;
+    }
+    m_refillRequested = false;
+    locker.unlock();
+    try {
+      refill();
+    } catch (exception::Exception& ex) {
+      // The next caller finding no identifier left will retry synchronously and get the error
+      log::LogContext lc(m_log);
+      log::ScopedParamContainer params(lc);
+      params.add("exceptionMessage", ex.getMessageValue());
+      lc.log(log::ERR, "In ArchiveFileIdBlockAllocator::run(): failed to fetch a block of archive file IDs");
+    } catch (std::exception& ex) {
+      log::LogContext lc(m_log);
+      log::ScopedParamContainer params(lc);
+      params.add("exceptionMessage", ex.what());
+      lc.log(log::ERR, "In ArchiveFileIdBlockAllocator::run(): failed to fetch a block of archive file IDs");
+    } catch (...) {
+      log::LogContext lc(m_log);
+      lc.log(log::ERR,
+             "In ArchiveFileIdBlockAllocator::run(): failed to fetch a block of archive file IDs: unknown exception");
+    }
+    locker.lock();
+  }
+}
+
+}  // namespace cta::catalogue
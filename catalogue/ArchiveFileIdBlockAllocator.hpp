@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/Logger.hpp"
+#include "common/process/threading/CondVar.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "common/process/threading/Thread.hpp"
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <stdint.h>
+
+namespace cta::catalogue {
+
+/**
+ * Hands out archive file identifiers from blocks leased from the catalogue.
+ *
+ * Instead of one round trip to the archive file identifier sequence per new
+ * archive file, identifiers are fetched by blocks and kept in memory. A
+ * background thread fetches the next block as soon as the number of
+ * identifiers left falls to the low watermark, so that callers normally never
+ * wait for the database. Identifiers still in memory when the allocator is
+ * destroyed are lost: they leave holes in the sequence of archive file
+ * identifiers, which is harmless because identifiers only have to be unique.
+ */
+class ArchiveFileIdBlockAllocator : private threading::Thread {
+public:
+  /**
+   * Function fetching the specified number of new and unique archive file
+   * identifiers from the catalogue.
+   */
+  using FetchIds = std::function<std::list<uint64_t>(uint64_t nbIds)>;
+
+  /**
+   * Constructor. Starts the refill thread.
+   *
+   * @param log Object representing the API to the CTA logging system.
+   * @param fetchIds Function fetching a block of identifiers.
+   * @param blockSize The number of identifiers fetched at once.
+   */
+  ArchiveFileIdBlockAllocator(log::Logger& log, FetchIds fetchIds, uint64_t blockSize);
+
+  /**
+   * Destructor. Stops the refill thread and accounts for the unused
+   * identifiers.
+   */
+  ~ArchiveFileIdBlockAllocator() override;
+
+  ArchiveFileIdBlockAllocator(const ArchiveFileIdBlockAllocator&) = delete;
+  ArchiveFileIdBlockAllocator& operator=(const ArchiveFileIdBlockAllocator&) = delete;
+
+  /**
+   * Returns a new and unique archive file identifier.
+   *
+   * If no identifier is left in memory, the calling thread either waits for
+   * the refill in progress or fetches the next block itself, in which case
+   * any exception thrown by the fetch function is propagated.
+   */
+  uint64_t getNextArchiveFileId();
+
+  /**
+   * @return The number of identifiers fetched at once.
+   */
+  uint64_t getBlockSize() const { return m_blockSize; }
+
+private:
+  /**
+   * The refill thread: fetches a block each time it is requested.
+   */
+  void run() override;
+
+  /**
+   * Fetches a block of identifiers and appends it to the available ones.
+   * Must be called without holding m_mutex, with m_refilling set by the caller.
+   */
+  void refill();
+
+  log::Logger& m_log;
+  const FetchIds m_fetchIds;
+  const uint64_t m_blockSize;
+
+  /**
+   * A refill is requested when the number of available identifiers falls to
+   * this value.
+   */
+  const uint64_t m_lowWatermark;
+
+  /** Protects the members below */
+  threading::Mutex m_mutex;
+  threading::CondVar m_condVar;
+  std::deque<uint64_t> m_ids;
+  bool m_refilling = false;
+  bool m_refillRequested = false;
+  bool m_stopRequested = false;
+};
+
+}  // namespace cta::catalogue
@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/ArchiveFileIdBlockAllocator.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/DummyLogger.hpp"
+#include "common/process/threading/MutexLocker.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace unitTests {
+
+namespace {
+/**
+ * Emulates a database sequence handing out consecutive identifiers
+ */
+class FakeSequence {
+public:
+  std::list<uint64_t> fetch(const uint64_t nbIds) {
+    if (failing) {
+      throw cta::exception::Exception("Sequence unavailable");
+    }
+    if (failingWithUnknownException) {
+      nbUnknownExceptions++;
+      throw 1;
+    }
+    cta::threading::MutexLocker locker(m_mutex);
+    std::list<uint64_t> ids;
+    for (uint64_t i = 0; i < nbIds; i++) {
+      ids.push_back(m_next++);
+    }
+    nbFetches++;
+    return ids;
+  }
+
+  std::atomic<bool> failing {false};
+  std::atomic<bool> failingWithUnknownException {false};
+  std::atomic<uint64_t> nbUnknownExceptions {0};
+  std::atomic<uint64_t> nbFetches {0};
+
+private:
+  cta::threading::Mutex m_mutex;
+  uint64_t m_next = 1;
+};
+
+class IdConsumer : private cta::threading::Thread {
+public:
+  IdConsumer(cta::catalogue::ArchiveFileIdBlockAllocator& allocator, uint64_t nbIds)
+      : m_allocator(allocator),
+        m_nbIds(nbIds) {}
+
+  void start() { cta::threading::Thread::start(); }
+
+  void wait() { cta::threading::Thread::wait(); }
+
+  std::vector<uint64_t> ids;
+
+private:
+  void run() override {
+    for (uint64_t i = 0; i < m_nbIds; i++) {
+      ids.push_back(m_allocator.getNextArchiveFileId());
+    }
+  }
+
+  cta::catalogue::ArchiveFileIdBlockAllocator& m_allocator;
+  const uint64_t m_nbIds;
+};
+}  // namespace
+
+TEST(cta_catalogue_ArchiveFileIdBlockAllocatorTest, hands_out_unique_ids_by_blocks) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  FakeSequence sequence;
+  std::set<uint64_t> ids;
+  {
+    cta::catalogue::ArchiveFileIdBlockAllocator allocator(
+      dl,
+      [&sequence](const uint64_t nbIds) { return sequence.fetch(nbIds); },
+      10);
+    for (uint64_t i = 0; i < 100; i++) {
+      ASSERT_TRUE(ids.insert(allocator.getNextArchiveFileId()).second);
+    }
+  }
+  // One fetch per block, plus possibly one block prefetched and never used
+  ASSERT_GE(sequence.nbFetches, 10);
+  ASSERT_LE(sequence.nbFetches, 11);
+}
+
+TEST(cta_catalogue_ArchiveFileIdBlockAllocatorTest, fetch_error_reaches_caller) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  FakeSequence sequence;
+  sequence.failing = true;
+  cta::catalogue::ArchiveFileIdBlockAllocator allocator(
+    dl,
+    [&sequence](const uint64_t nbIds) { return sequence.fetch(nbIds); },
+    4);
+  ASSERT_THROW(allocator.getNextArchiveFileId(), cta::exception::Exception);
+  sequence.failing = false;
+  ASSERT_EQ(1, allocator.getNextArchiveFileId());
+}
+
+TEST(cta_catalogue_ArchiveFileIdBlockAllocatorTest, background_refill_survives_unknown_exception) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  FakeSequence sequence;
+  cta::catalogue::ArchiveFileIdBlockAllocator allocator(
+    dl,
+    [&sequence](const uint64_t nbIds) { return sequence.fetch(nbIds); },
+    4);
+  ASSERT_EQ(1, allocator.getNextArchiveFileId());
+  sequence.failingWithUnknownException = true;
+  ASSERT_EQ(2, allocator.getNextArchiveFileId());
+  // Reaching the low watermark triggers a background refill, which fails
+  ASSERT_EQ(3, allocator.getNextArchiveFileId());
+  while (sequence.nbUnknownExceptions == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  sequence.failingWithUnknownException = false;
+  // The next background refill is served by the same thread
+  ASSERT_EQ(4, allocator.getNextArchiveFileId());
+  ASSERT_EQ(5, allocator.getNextArchiveFileId());
+}
+
+TEST(cta_catalogue_ArchiveFileIdBlockAllocatorTest, concurrent_callers) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  FakeSequence sequence;
+  const uint64_t nbThreads = 8;
+  const uint64_t idsPerThread = 1000;
+  cta::catalogue::ArchiveFileIdBlockAllocator allocator(
+    dl,
+    [&sequence](const uint64_t nbIds) { return sequence.fetch(nbIds); },
+    64);
+  std::vector<std::unique_ptr<IdConsumer>> consumers;
+  for (uint64_t i = 0; i < nbThreads; i++) {
+    consumers.emplace_back(std::make_unique<IdConsumer>(allocator, idsPerThread));
+  }
+  for (auto& consumer : consumers) {
+    consumer->start();
+  }
+  std::set<uint64_t> ids;
+  for (auto& consumer : consumers) {
+    consumer->wait();
+    ids.insert(consumer->ids.begin(), consumer->ids.end());
+  }
+  ASSERT_EQ(nbThreads * idsPerThread, ids.size());
+}
+
+TEST(cta_catalogue_ArchiveFileIdBlockAllocatorTest, block_size_too_small) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  ASSERT_THROW(cta::catalogue::ArchiveFileIdBlockAllocator(
+                 dl,
+                 [](const uint64_t) { return std::list<uint64_t>(); },
+                 1),
+               cta::exception::Exception);
+}
+
+}  // namespace unitTests
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "catalogue/ReadReplicaQuery.hpp"
 #include "catalogue/interfaces/AdminUserCatalogue.hpp"
 #include "catalogue/interfaces/ArchiveFileCatalogue.hpp"
 #include "catalogue/interfaces/ArchiveRouteCatalogue.hpp"
@@ -29,6 +30,13 @@
 #include "catalogue/interfaces/VirtualOrganizationCatalogue.hpp"
 
 #include <memory>
+#include <set>
+#include <stdint.h>
+#include <time.h>
+
+namespace cta::rdbms {
+class Login;
+}
 
 namespace cta::catalogue {
 
@@ -66,6 +74,41 @@ public:
   virtual const std::unique_ptr<DriveConfigCatalogue>& DriveConfig() const = 0;
   virtual const std::unique_ptr<DriveStateCatalogue>& DriveState() const = 0;
   virtual const std::unique_ptr<ArchiveFileCatalogue>& ArchiveFile() const = 0;
+
+  /**
+   * Routes the specified read-only queries to a read replica of the catalogue
+   * database, as long as the replication lag of the replica does not exceed
+   * the specified staleness bound.  The queries are run on the primary
+   * database while the replica is too far behind or its lag is unknown.
+   *
+   * This method is meant to be called once, before the catalogue is used.
+   * Catalogues which are not backed by a database ignore it.
+   *
+   * @param login The database login details of the replica.
+   * @param nbConns The maximum number of concurrent connections to the replica.
+   * @param maxLagSecs The maximum replication lag in seconds.
+   * @param queries The queries to be run on the replica.
+   */
+  virtual void setReadReplica(const rdbms::Login& login,
+                              const uint64_t nbConns,
+                              const uint64_t maxLagSecs,
+                              const std::set<ReadReplicaQuery>& queries) = 0;
+
+  /**
+   * Keeps the cached mount policies, virtual organizations, archive routes,
+   * storage classes and admin users until another process notifies that it
+   * modified them, instead of re-reading them from the database after a fixed
+   * time of the order of ten seconds.  The values
+   * are still re-read after the specified maximum age, as a safety net for
+   * modifications made without notification, and after a fixed time while
+   * the notifications cannot be received.
+   *
+   * This method is meant to be called once, before the catalogue is used.
+   * Catalogues whose database cannot send notifications ignore it.
+   *
+   * @param maxAgeSecs The maximum age in seconds of a cached value.
+   */
+  virtual void enableCacheInvalidationEvents(const time_t maxAgeSecs) = 0;
 };  // class Catalogue
 
 }  // namespace cta::catalogue
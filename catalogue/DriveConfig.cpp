@@ -31,9 +31,14 @@ void DriveConfig::setTapedConfiguration(const tape::daemon::TapedConfiguration&
   setConfigToDB(tapedConfiguration.archiveFetchBytesFiles, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.archiveDismountPolicy, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.archiveFlushBytesFiles, catalogue, tapeDriveName);
+  setConfigToDB(tapedConfiguration.archiveMaxInFlightFlushReports, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.retrieveFetchBytesFiles, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.mountCriteria, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.nbDiskThreads, catalogue, tapeDriveName);
+  setConfigToDB(tapedConfiguration.minNbDiskThreads, catalogue, tapeDriveName);
+  setConfigToDB(tapedConfiguration.useLocalDiskDirectIO, catalogue, tapeDriveName);
+  setConfigToDB(tapedConfiguration.sessionTraceDirectory, catalogue, tapeDriveName);
+  setConfigToDB(tapedConfiguration.sessionTraceMaxEvents, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.rmcHost, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.useRAO, catalogue, tapeDriveName);
   setConfigToDB(tapedConfiguration.raoLtoAlgorithm, catalogue, tapeDriveName);
@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/rdbms/RdbmsCacheInvalidationListener.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/DummyLogger.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "common/process/threading/MutexLocker.hpp"
+#include "rdbms/Login.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <list>
+#include <thread>
+
+namespace unitTests {
+
+using cta::catalogue::RdbmsCacheInvalidationListener;
+
+namespace {
+/**
+ * Records the calls made by the listener to its callbacks
+ */
+class ListenerCallbacks {
+public:
+  void onListening(const bool listening) {
+    cta::threading::MutexLocker locker(m_mutex);
+    m_listeningChanges.push_back(listening);
+  }
+
+  std::list<bool> waitForListeningChanges(const size_t nbChanges) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline) {
+      {
+        cta::threading::MutexLocker locker(m_mutex);
+        if (m_listeningChanges.size() >= nbChanges) {
+          return m_listeningChanges;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    cta::threading::MutexLocker locker(m_mutex);
+    return m_listeningChanges;
+  }
+
+  std::atomic<uint64_t> nbSubscriptions {0};
+  std::atomic<uint64_t> nbInvalidations {0};
+
+private:
+  cta::threading::Mutex m_mutex;
+  std::list<bool> m_listeningChanges;
+};
+}  // namespace
+
+TEST(cta_catalogue_RdbmsCacheInvalidationListenerTest, stops_listening_when_notifications_are_not_delivered) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  ListenerCallbacks callbacks;
+  {
+    // SQLite does not deliver notifications to connections
+    RdbmsCacheInvalidationListener listener(
+      dl,
+      cta::rdbms::Login::getInMemory(),
+      [&callbacks](cta::rdbms::Conn&) { callbacks.nbSubscriptions++; },
+      [&callbacks](const std::set<std::string>&) { callbacks.nbInvalidations++; },
+      [&callbacks](const bool listening) { callbacks.onListening(listening); },
+      10,
+      3600);
+    ASSERT_EQ(std::list<bool>({true, false}), callbacks.waitForListeningChanges(2));
+    ASSERT_FALSE(listener.isListening());
+  }
+  ASSERT_EQ(1, callbacks.nbSubscriptions);
+  ASSERT_EQ(0, callbacks.nbInvalidations);
+}
+
+TEST(cta_catalogue_RdbmsCacheInvalidationListenerTest, retries_failed_subscriptions) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  ListenerCallbacks callbacks;
+  RdbmsCacheInvalidationListener listener(
+    dl,
+    cta::rdbms::Login::getInMemory(),
+    [&callbacks](cta::rdbms::Conn&) {
+      callbacks.nbSubscriptions++;
+      throw cta::exception::Exception("Database unreachable");
+    },
+    [&callbacks](const std::set<std::string>&) { callbacks.nbInvalidations++; },
+    [&callbacks](const bool listening) { callbacks.onListening(listening); },
+    10,
+    0);
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (callbacks.nbSubscriptions < 3 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_LE(3, callbacks.nbSubscriptions);
+  ASSERT_TRUE(callbacks.waitForListeningChanges(0).empty());
+  ASSERT_FALSE(listener.isListening());
+}
+
+}  // namespace unitTests
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/rdbms/RdbmsCatalogueTapeContentsItor.hpp"
+
+#include "common/log/DummyLogger.hpp"
+#include "rdbms/ConnPool.hpp"
+#include "rdbms/Login.hpp"
+
+#include <gtest/gtest.h>
+#include <list>
+#include <memory>
+
+namespace unitTests {
+
+namespace {
+/**
+ * In-memory database holding the subset of the catalogue schema read by the
+ * tape contents iterator.  The pool has a single connection so that every
+ * connection taken from it sees the same in-memory database.
+ */
+class TapeContentsDb {
+public:
+  TapeContentsDb() : m_connPool(cta::rdbms::Login::getInMemory(), 1) {
+    auto conn = m_connPool.getConn();
+    conn.executeNonQuery("CREATE TABLE STORAGE_CLASS(STORAGE_CLASS_ID INTEGER, STORAGE_CLASS_NAME VARCHAR(100))");
+    conn.executeNonQuery("CREATE TABLE TAPE_POOL(TAPE_POOL_ID INTEGER, TAPE_POOL_NAME VARCHAR(100))");
+    conn.executeNonQuery("CREATE TABLE TAPE(VID VARCHAR(100), TAPE_POOL_ID INTEGER)");
+    conn.executeNonQuery(R"SQL(
+      CREATE TABLE ARCHIVE_FILE(
+        ARCHIVE_FILE_ID INTEGER,
+        DISK_INSTANCE_NAME VARCHAR(100),
+        DISK_FILE_ID VARCHAR(100),
+        DISK_FILE_UID INTEGER,
+        DISK_FILE_GID INTEGER,
+        SIZE_IN_BYTES INTEGER,
+        CHECKSUM_BLOB BLOB,
+        CHECKSUM_ADLER32 INTEGER,
+        STORAGE_CLASS_ID INTEGER,
+        CREATION_TIME INTEGER,
+        RECONCILIATION_TIME INTEGER))SQL");
+    conn.executeNonQuery(R"SQL(
+      CREATE TABLE TAPE_FILE(
+        VID VARCHAR(100),
+        FSEQ INTEGER,
+        BLOCK_ID INTEGER,
+        LOGICAL_SIZE_IN_BYTES INTEGER,
+        COPY_NB INTEGER,
+        CREATION_TIME INTEGER,
+        ARCHIVE_FILE_ID INTEGER,
+        CONSTRAINT TAPE_FILE_PK PRIMARY KEY(VID, FSEQ)))SQL");
+    conn.executeNonQuery("INSERT INTO STORAGE_CLASS VALUES(1, 'storage_class')");
+    conn.executeNonQuery("INSERT INTO TAPE_POOL VALUES(1, 'tape_pool')");
+    conn.executeNonQuery("INSERT INTO TAPE VALUES('VID1', 1)");
+    conn.executeNonQuery("INSERT INTO TAPE VALUES('VID2', 1)");
+  }
+
+  void addTapeFile(const std::string& vid, const uint64_t fSeq) {
+    const uint64_t archiveFileId = m_nextArchiveFileId++;
+    auto conn = m_connPool.getConn();
+    auto afStmt = conn.createStmt(R"SQL(
+      INSERT INTO ARCHIVE_FILE VALUES(
+        :ARCHIVE_FILE_ID, 'disk_instance', :DISK_FILE_ID, 1, 2, 10, NULL, 1, 1, 3, 4))SQL");
+    afStmt.bindUint64(":ARCHIVE_FILE_ID", archiveFileId);
+    afStmt.bindString(":DISK_FILE_ID", std::to_string(archiveFileId));
+    afStmt.executeNonQuery();
+    auto tfStmt = conn.createStmt(R"SQL(
+      INSERT INTO TAPE_FILE VALUES(:VID, :FSEQ, :BLOCK_ID, 10, 1, 5, :ARCHIVE_FILE_ID))SQL");
+    tfStmt.bindString(":VID", vid);
+    tfStmt.bindUint64(":FSEQ", fSeq);
+    tfStmt.bindUint64(":BLOCK_ID", fSeq * 10);
+    tfStmt.bindUint64(":ARCHIVE_FILE_ID", archiveFileId);
+    tfStmt.executeNonQuery();
+  }
+
+  std::list<uint64_t> listFSeqs(const std::string& vid, const uint64_t pageSize) {
+    cta::log::DummyLogger dl("dummy", "unitTest");
+    cta::catalogue::RdbmsCatalogueTapeContentsItor itor(dl, m_connPool, vid, pageSize);
+    std::list<uint64_t> fSeqs;
+    while (itor.hasMore()) {
+      // No connection is held while the listing is being consumed
+      EXPECT_EQ(0, m_connPool.getNbConnsOnLoan());
+      const auto archiveFile = itor.next();
+      EXPECT_EQ(1, archiveFile.tapeFiles.size());
+      EXPECT_EQ(vid, archiveFile.tapeFiles.front().vid);
+      EXPECT_EQ(archiveFile.tapeFiles.front().fSeq * 10, archiveFile.tapeFiles.front().blockId);
+      fSeqs.push_back(archiveFile.tapeFiles.front().fSeq);
+    }
+    return fSeqs;
+  }
+
+  cta::rdbms::ConnPool m_connPool;
+
+private:
+  uint64_t m_nextArchiveFileId = 1;
+};
+}  // namespace
+
+TEST(cta_catalogue_RdbmsCatalogueTapeContentsItorTest, empty_tape) {
+  TapeContentsDb db;
+  db.addTapeFile("VID2", 1);
+  ASSERT_TRUE(db.listFSeqs("VID1", 3).empty());
+}
+
+TEST(cta_catalogue_RdbmsCatalogueTapeContentsItorTest, lists_across_pages) {
+  TapeContentsDb db;
+  std::list<uint64_t> expectedFSeqs;
+  for (uint64_t fSeq = 1; fSeq <= 10; fSeq++) {
+    db.addTapeFile("VID1", fSeq);
+    db.addTapeFile("VID2", fSeq);
+    expectedFSeqs.push_back(fSeq);
+  }
+  ASSERT_EQ(expectedFSeqs, db.listFSeqs("VID1", 3));
+  ASSERT_EQ(expectedFSeqs, db.listFSeqs("VID1", 10));
+  ASSERT_EQ(expectedFSeqs, db.listFSeqs("VID1", 1000));
+}
+
+TEST(cta_catalogue_RdbmsCatalogueTapeContentsItorTest, skips_gaps_larger_than_a_page) {
+  TapeContentsDb db;
+  const std::list<uint64_t> expectedFSeqs = {2, 3, 20, 21, 22, 23, 500};
+  for (const auto fSeq : expectedFSeqs) {
+    db.addTapeFile("VID1", fSeq);
+  }
+  ASSERT_EQ(expectedFSeqs, db.listFSeqs("VID1", 3));
+}
+
+TEST(cta_catalogue_RdbmsCatalogueTapeContentsItorTest, next_requires_hasMore) {
+  TapeContentsDb db;
+  db.addTapeFile("VID1", 1);
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  cta::catalogue::RdbmsCatalogueTapeContentsItor itor(dl, db.m_connPool, "VID1", 3);
+  ASSERT_THROW(itor.next(), cta::exception::Exception);
+  ASSERT_TRUE(itor.hasMore());
+  itor.next();
+  ASSERT_FALSE(itor.hasMore());
+  ASSERT_THROW(itor.next(), cta::exception::Exception);
+}
+
+}  // namespace unitTests
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/rdbms/RdbmsReadReplica.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/exception/UserError.hpp"
+#include "common/log/DummyLogger.hpp"
+#include "rdbms/Login.hpp"
+
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+
+namespace unitTests {
+
+using cta::catalogue::ReadReplicaQuery;
+using cta::catalogue::RdbmsReadReplica;
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, routes_only_the_selected_queries) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  RdbmsReadReplica replica(dl,
+                           cta::rdbms::Login::getInMemory(),
+                           1,
+                           60,
+                           {ReadReplicaQuery::TAPE_LISTING},
+                           [](cta::rdbms::Conn&) { return 0; });
+  ASSERT_NE(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+  ASSERT_EQ(nullptr, replica.getConnPool(ReadReplicaQuery::ARCHIVE_FILE_LISTING));
+  ASSERT_EQ(nullptr, replica.getConnPool(ReadReplicaQuery::FILE_RECYCLE_LOG_LISTING));
+}
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, falls_back_to_primary_when_stale) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  std::optional<uint64_t> lagSecs = 61;
+  RdbmsReadReplica replica(dl,
+                           cta::rdbms::Login::getInMemory(),
+                           1,
+                           60,
+                           {ReadReplicaQuery::TAPE_LISTING},
+                           [&lagSecs](cta::rdbms::Conn&) { return lagSecs; },
+                           0);
+  ASSERT_EQ(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+  lagSecs = 60;
+  ASSERT_NE(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+  lagSecs = std::nullopt;
+  ASSERT_EQ(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+}
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, falls_back_to_primary_when_lag_check_fails) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  RdbmsReadReplica replica(dl,
+                           cta::rdbms::Login::getInMemory(),
+                           1,
+                           60,
+                           {ReadReplicaQuery::TAPE_LISTING},
+                           [](cta::rdbms::Conn&) -> std::optional<uint64_t> {
+                             throw cta::exception::Exception("Replica unreachable");
+                           });
+  ASSERT_EQ(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+}
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, lag_checked_once_per_period) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  uint64_t nbLagChecks = 0;
+  RdbmsReadReplica replica(dl,
+                           cta::rdbms::Login::getInMemory(),
+                           1,
+                           60,
+                           cta::catalogue::allReadReplicaQueries(),
+                           [&nbLagChecks](cta::rdbms::Conn&) {
+                             nbLagChecks++;
+                             return 0;
+                           },
+                           3600);
+  for (int i = 0; i < 10; i++) {
+    ASSERT_NE(nullptr, replica.getConnPool(ReadReplicaQuery::ARCHIVE_FILE_LISTING));
+  }
+  ASSERT_EQ(1, nbLagChecks);
+}
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, callers_not_blocked_by_lag_check) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  std::atomic<bool> blockLagCheck = false;
+  std::promise<void> lagCheckStarted;
+  std::promise<void> lagCheckReleased;
+  auto lagCheckReleasedFuture = lagCheckReleased.get_future().share();
+  RdbmsReadReplica replica(dl,
+                           cta::rdbms::Login::getInMemory(),
+                           1,
+                           60,
+                           {ReadReplicaQuery::TAPE_LISTING},
+                           [&](cta::rdbms::Conn&) {
+                             if (blockLagCheck) {
+                               lagCheckStarted.set_value();
+                               lagCheckReleasedFuture.wait();
+                             }
+                             return 0;
+                           },
+                           0);
+  ASSERT_NE(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+
+  blockLagCheck = true;
+  auto checkingCaller =
+    std::async(std::launch::async, [&replica] { return replica.getConnPool(ReadReplicaQuery::TAPE_LISTING); });
+  lagCheckStarted.get_future().wait();
+  // The lag is being checked: the result of the previous check is used without waiting
+  blockLagCheck = false;
+  ASSERT_NE(nullptr, replica.getConnPool(ReadReplicaQuery::TAPE_LISTING));
+  lagCheckReleased.set_value();
+  ASSERT_NE(nullptr, checkingCaller.get());
+}
+
+TEST(cta_catalogue_RdbmsReadReplicaTest, query_names) {
+  for (const auto query : cta::catalogue::allReadReplicaQueries()) {
+    ASSERT_EQ(query, cta::catalogue::readReplicaQueryFromString(cta::catalogue::toString(query)));
+  }
+  ASSERT_THROW(cta::catalogue::readReplicaQueryFromString("archive_file_summary"), cta::exception::UserError);
+}
+
+}  // namespace unitTests
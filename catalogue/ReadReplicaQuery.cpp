@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/ReadReplicaQuery.hpp"
+
+#include "common/exception/UserError.hpp"
+
+#include <map>
+
+namespace cta::catalogue {
+
+namespace {
+const std::map<ReadReplicaQuery, std::string> kQueryNames {
+  {ReadReplicaQuery::ARCHIVE_FILE_LISTING,     "archive_file_listing"    },
+  {ReadReplicaQuery::TAPE_LISTING,             "tape_listing"            },
+  {ReadReplicaQuery::FILE_RECYCLE_LOG_LISTING, "file_recycle_log_listing"}
+};
+}  // namespace
+
+//------------------------------------------------------------------------------
+// toString
+//------------------------------------------------------------------------------
+std::string toString(ReadReplicaQuery query) {
+  return kQueryNames.at(query);
+}
+
+//------------------------------------------------------------------------------
+// readReplicaQueryFromString
+//------------------------------------------------------------------------------
+ReadReplicaQuery readReplicaQueryFromString(const std::string& name) {
+  for (const auto& [query, queryName] : kQueryNames) {
+    if (queryName == name) {
+      return query;
+    }
+  }
+  throw exception::UserError("Unknown catalogue read replica query: " + name);
+}
+
+//------------------------------------------------------------------------------
+// allReadReplicaQueries
+//------------------------------------------------------------------------------
+std::set<ReadReplicaQuery> allReadReplicaQueries() {
+  std::set<ReadReplicaQuery> queries;
+  for (const auto& [query, queryName] : kQueryNames) {
+    queries.insert(query);
+  }
+  return queries;
+}
+
+}  // namespace cta::catalogue
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <set>
+#include <string>
+
+namespace cta::catalogue {
+
+/**
+ * The read-only catalogue queries which can be routed to a read replica of the
+ * catalogue database.
+ */
+enum class ReadReplicaQuery {
+  ARCHIVE_FILE_LISTING,     ///< ArchiveFileCatalogue::getArchiveFilesItor(), e.g. "tapefile ls"
+  TAPE_LISTING,             ///< TapeCatalogue::getTapesItor(), e.g. "tape ls"
+  FILE_RECYCLE_LOG_LISTING  ///< FileRecycleLogCatalogue::getFileRecycleLogItor(), e.g. "recycletf ls"
+};
+
+/**
+ * @return The configuration name of the specified query.
+ */
+std::string toString(ReadReplicaQuery query);
+
+/**
+ * Returns the query with the specified configuration name.
+ *
+ * @param name The name of the query, for example "tape_listing".
+ * @throw exception::UserError if there is no such query.
+ */
+ReadReplicaQuery readReplicaQueryFromString(const std::string& name);
+
+/**
+ * @return All the queries which can be routed to a read replica.
+ */
+std::set<ReadReplicaQuery> allReadReplicaQueries();
+
+}  // namespace cta::catalogue
@@ -0,0 +1,35 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/dataStructures/RetrieveFileQueueCriteria.hpp"
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+namespace cta::catalogue {
+
+/**
+ * The queueing criteria returned by the catalogue for several file retrieve
+ * requests prepared together.
+ */
+struct RetrieveFilesQueueCriteria {
+  /**
+   * The queueing criteria of the files which can be retrieved, by archive file
+   * ID.
+   */
+  std::map<uint64_t, common::dataStructures::RetrieveFileQueueCriteria> criteria;
+
+  /**
+   * The reasons why the other files cannot be retrieved, by archive file ID.
+   * These are the messages of the user errors which prepareToRetrieveFile()
+   * would have thrown for the files.
+   */
+  std::map<uint64_t, std::string> errors;
+};  // struct RetrieveFilesQueueCriteria
+
+}  // namespace cta::catalogue
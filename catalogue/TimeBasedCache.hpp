@@ -6,57 +6,104 @@
 #pragma once
 
 #include "catalogue/ValueAndTimeBasedCacheInfo.hpp"
+#include "common/process/threading/CondVar.hpp"
 #include "common/process/threading/Mutex.hpp"
 #include "common/process/threading/MutexLocker.hpp"
+#include "common/semconv/Attributes.hpp"
+#include "common/telemetry/metrics/instruments/RdbmsInstruments.hpp"
 
-#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
+#include <stdint.h>
+#include <string>
 
 namespace cta::catalogue {
 
+/**
+ * A cache of values which expire after a maximum age.
+ *
+ * Refreshes are single-flight: when a value is missing or stale, only one
+ * thread at a time calls the function getting the non-cached value for a
+ * given key.  While the value is being refreshed, the other threads are served
+ * the stale value if it is not older than the maximum age plus the stale grace
+ * period, otherwise they wait for the refresh to end.  Values which have been
+ * invalidated are never served stale.
+ */
 template<typename Key, typename Value>
 class TimeBasedCache {
 public:
   /**
    * Constructor
    *
+   * @param name The name of the cache as reported in the telemetry.
    * @param m Maximum age of a cached value in seconds
+   * @param staleGraceSecs The time in seconds after the maximum age during
+   * which a stale value is served while another thread is refreshing it.
    */
-  explicit TimeBasedCache(const time_t m) : m_maxAgeSecs(m) {}
+  TimeBasedCache(const std::string& name, const time_t m, const time_t staleGraceSecs)
+      : m_name(name),
+        m_defaultMaxAgeSecs(m),
+        m_maxAgeSecs(m),
+        m_staleGraceSecs(staleGraceSecs) {}
 
   /**
    * Get the cached value corresponding to the specified key.
    *
-   * This method updates the cache when necessary.
+   * This method updates the cache when necessary.  The specified function is
+   * called without holding the lock of the cache.
    */
   template<typename Callable>
   ValueAndTimeBasedCacheInfo<Value> getCachedValue(const Key& key, const Callable& getNonCachedValue) {
-    const time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-    threading::MutexLocker cacheLock(m_mutex);
-    const auto cacheItor = m_cache.find(key);
-    const bool cacheHit = m_cache.end() != cacheItor;
-
-    if (cacheHit) {
-      auto& cachedValue = *(cacheItor->second);
-      const time_t ageSecs = now - cachedValue.timestamp;
-
-      if (m_maxAgeSecs >= ageSecs) {  // Cached value is fresh
-        return ValueAndTimeBasedCacheInfo<Value>(cachedValue.value, "Fresh value found in cache");
-      } else {  // Cached value is stale
-        cachedValue.value = getNonCachedValue();
-        cachedValue.timestamp = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-        return ValueAndTimeBasedCacheInfo<Value>(cachedValue.value, "Stale value found and replaced in cache");
+    std::optional<ValueAndTimeBasedCacheInfo<Value>> valueAndCacheInfo;
+    const char* lookupResult = nullptr;
+    {
+      threading::MutexLocker cacheLock(m_mutex);
+      bool waitedForRefresh = false;
+      while (!valueAndCacheInfo.has_value()) {
+        const auto cacheItor = m_cache.find(key);
+
+        if (m_cache.end() == cacheItor) {  // No cache hit
+          auto& entry = *(m_cache.emplace(key, std::make_unique<CacheEntry>()).first->second);
+          valueAndCacheInfo.emplace(refresh(cacheLock, key, entry, getNonCachedValue),
+                                    "First time value entered into cache");
+          lookupResult = semconv::attr::CtaCatalogueCacheResultValues::kMiss;
+          break;
+        }
+
+        auto& entry = *(cacheItor->second);
+        const time_t ageSecs = now() - entry.timestamp;
+
+        if (entry.value.has_value() && m_maxAgeSecs >= ageSecs) {  // Cached value is fresh
+          if (waitedForRefresh) {
+            valueAndCacheInfo.emplace(entry.value.value(), "Fresh value found in cache after waiting for its refresh");
+            lookupResult = semconv::attr::CtaCatalogueCacheResultValues::kCoalesced;
+          } else {
+            valueAndCacheInfo.emplace(entry.value.value(), "Fresh value found in cache");
+            lookupResult = semconv::attr::CtaCatalogueCacheResultValues::kHit;
+          }
+        } else if (!entry.refreshing) {  // Cached value is stale and nobody is refreshing it
+          valueAndCacheInfo.emplace(refresh(cacheLock, key, entry, getNonCachedValue),
+                                    "Stale value found and replaced in cache");
+          lookupResult = semconv::attr::CtaCatalogueCacheResultValues::kRefresh;
+        } else if (entry.value.has_value() && m_maxAgeSecs + m_staleGraceSecs >= ageSecs) {
+          valueAndCacheInfo.emplace(entry.value.value(), "Stale value served from cache while being refreshed");
+          lookupResult = semconv::attr::CtaCatalogueCacheResultValues::kStaleHit;
+        } else {  // Wait for the thread refreshing the value
+          m_refreshDone.wait(cacheLock);
+          waitedForRefresh = true;
+        }
       }
-    } else {  // No cache hit
-      const auto emplaceResult =
-        m_cache.emplace(std::make_pair(key, std::make_unique<TimestampedValue>(now, getNonCachedValue())));
-      return ValueAndTimeBasedCacheInfo<Value>(emplaceResult.first->second->value,
-                                               "First time value entered into cache");
     }
+
+    telemetry::metrics::ctaCatalogueCacheLookupCount->Add(
+      1,
+      {
+        {semconv::attr::kCtaCatalogueCacheName,   m_name      },
+        {semconv::attr::kCtaCatalogueCacheResult, lookupResult}
+    });
+    return valueAndCacheInfo.value();
   }
 
   /**
@@ -71,51 +118,134 @@ public:
       auto& cachedValue = *(cacheMaplet.second);
       cachedValue.timestamp = 0;
     }
+    m_nbInvalidations++;
   }
 
-private:
   /**
-   * Maximum age of a cached value in seconds.
+   * Sets the maximum age of a cached value.  This is used to keep values for
+   * longer while the cache is invalidated by notifications of changes.
+   *
+   * @param maxAgeSecs Maximum age of a cached value in seconds.
    */
-  time_t m_maxAgeSecs;
+  void setMaxAgeSecs(const time_t maxAgeSecs) {
+    threading::MutexLocker cacheLock(m_mutex);
+    m_maxAgeSecs = maxAgeSecs;
+  }
 
   /**
-   * Mutex to protect the cache.
+   * Restores the maximum age of a cached value given to the constructor.
    */
-  threading::Mutex m_mutex;
+  void resetMaxAgeSecs() { setMaxAgeSecs(m_defaultMaxAgeSecs); }
 
+private:
   /**
-   * A timestamped value.
+   * An entry of the cache.
    */
-  struct TimestampedValue {
+  struct CacheEntry {
     /**
-     * Constructor.
+     * The time at which the value was got, 0 if the value has been invalidated.
      */
-    TimestampedValue() : timestamp(0) {}
+    time_t timestamp = 0;
 
     /**
-     * Constructor.
-     *
-     * @param t The timestamp.
-     * @param v The value.
+     * The value, empty until it has been got for the first time.
      */
-    TimestampedValue(const time_t t, const Value& v) : timestamp(t), value(v) {}
+    std::optional<Value> value;
 
     /**
-     * The timestamp.
+     * True while a thread is getting a new value.
      */
-    time_t timestamp;
+    bool refreshing = false;
+  };  // struct CacheEntry
 
-    /**
-     * The value.
-     */
-    Value value;
-  };  // struct TimestampedValue
+  /**
+   * @return The current time in seconds since the epoch.
+   */
+  static time_t now() { return std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()); }
+
+  /**
+   * Gets a new value for the specified entry with the lock of the cache
+   * released, so that the other threads can be served while waiting for the
+   * database.  A value got while the cache was invalidated is returned to the
+   * caller but is left stale in the cache.  If getting the value fails, the
+   * entry is left as it was, or removed if it has never had a value.
+   *
+   * @param cacheLock The lock of the cache which must be held.
+   * @param key The key of the entry.
+   * @param entry The entry.
+   * @param getNonCachedValue Function getting the new value.
+   * @return The new value.
+   */
+  template<typename Callable>
+  Value refresh(threading::MutexLocker& cacheLock,
+                const Key& key,
+                CacheEntry& entry,
+                const Callable& getNonCachedValue) {
+    entry.refreshing = true;
+    const uint64_t nbInvalidationsBeforeRefresh = m_nbInvalidations;
+    cacheLock.unlock();
+
+    std::optional<Value> value;
+    try {
+      value.emplace(getNonCachedValue());
+    } catch (...) {
+      cacheLock.lock();
+      entry.refreshing = false;
+      if (!entry.value.has_value()) {
+        m_cache.erase(key);
+      }
+      m_refreshDone.broadcast();
+      throw;
+    }
+
+    cacheLock.lock();
+    entry.value = value;
+    entry.timestamp = m_nbInvalidations == nbInvalidationsBeforeRefresh ? now() : 0;
+    entry.refreshing = false;
+    m_refreshDone.broadcast();
+    return value.value();
+  }
+
+  /**
+   * The name of the cache as reported in the telemetry.
+   */
+  const std::string m_name;
+
+  /**
+   * Maximum age of a cached value in seconds given to the constructor.
+   */
+  const time_t m_defaultMaxAgeSecs;
+
+  /**
+   * Maximum age of a cached value in seconds.
+   */
+  time_t m_maxAgeSecs;
+
+  /**
+   * The time in seconds after the maximum age during which a stale value is
+   * served while another thread is refreshing it.
+   */
+  const time_t m_staleGraceSecs;
+
+  /**
+   * Mutex to protect the cache.
+   */
+  threading::Mutex m_mutex;
+
+  /**
+   * Signalled each time a thread has finished refreshing an entry.
+   */
+  threading::CondVar m_refreshDone;
+
+  /**
+   * The number of times the cache has been invalidated.
+   */
+  uint64_t m_nbInvalidations = 0;
 
   /**
    * The cache.
    */
-  std::map<Key, std::unique_ptr<TimestampedValue>> m_cache;
+  std::map<Key, std::unique_ptr<CacheEntry>> m_cache;
 };  // class TimeBasedCache
 
 }  // namespace cta::catalogue
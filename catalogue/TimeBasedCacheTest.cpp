@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/TimeBasedCache.hpp"
+
+#include "common/exception/Exception.hpp"
+
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+#include <list>
+#include <string>
+
+namespace unitTests {
+
+TEST(cta_catalogue_TimeBasedCacheTest, invalidate) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", 3600, 0);
+  int nbQueries = 0;
+  auto getNonCachedValue = [&nbQueries] { return ++nbQueries; };
+  ASSERT_EQ(1, cache.getCachedValue("key", getNonCachedValue).value);
+  ASSERT_EQ(1, cache.getCachedValue("key", getNonCachedValue).value);
+  cache.invalidate();
+  ASSERT_EQ(2, cache.getCachedValue("key", getNonCachedValue).value);
+  ASSERT_EQ(2, cache.getCachedValue("key", getNonCachedValue).value);
+}
+
+TEST(cta_catalogue_TimeBasedCacheTest, setMaxAgeSecs) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", -1, 0);
+  int nbQueries = 0;
+  auto getNonCachedValue = [&nbQueries] { return ++nbQueries; };
+  ASSERT_EQ(1, cache.getCachedValue("key", getNonCachedValue).value);
+  ASSERT_EQ(2, cache.getCachedValue("key", getNonCachedValue).value);
+
+  cache.setMaxAgeSecs(3600);
+  ASSERT_EQ(2, cache.getCachedValue("key", getNonCachedValue).value);
+
+  cache.resetMaxAgeSecs();
+  ASSERT_EQ(3, cache.getCachedValue("key", getNonCachedValue).value);
+}
+
+TEST(cta_catalogue_TimeBasedCacheTest, concurrent_misses_are_coalesced) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", 3600, 0);
+  std::atomic<int> nbQueries = 0;
+  std::promise<void> releaseQuery;
+  std::shared_future<void> queryReleased = releaseQuery.get_future().share();
+  auto getNonCachedValue = [&nbQueries, queryReleased] {
+    queryReleased.wait();
+    return ++nbQueries;
+  };
+
+  std::list<std::future<int>> lookups;
+  for (int i = 0; i < 10; i++) {
+    lookups.push_back(std::async(std::launch::async, [&cache, &getNonCachedValue] {
+      return cache.getCachedValue("key", getNonCachedValue).value;
+    }));
+  }
+  releaseQuery.set_value();
+  for (auto& lookup : lookups) {
+    ASSERT_EQ(1, lookup.get());
+  }
+  ASSERT_EQ(1, nbQueries);
+}
+
+TEST(cta_catalogue_TimeBasedCacheTest, stale_value_served_during_refresh) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", 3600, 3600);
+  ASSERT_EQ(1, cache.getCachedValue("key", [] { return 1; }).value);
+  cache.setMaxAgeSecs(-1);
+
+  std::promise<void> refreshStarted;
+  std::promise<void> releaseRefresh;
+  auto refresh = std::async(std::launch::async, [&] {
+    return cache
+      .getCachedValue("key",
+                      [&] {
+                        refreshStarted.set_value();
+                        releaseRefresh.get_future().wait();
+                        return 2;
+                      })
+      .value;
+  });
+  refreshStarted.get_future().wait();
+
+  const auto staleValue = cache.getCachedValue("key", [] { return 3; });
+  ASSERT_EQ(1, staleValue.value);
+  ASSERT_EQ("Stale value served from cache while being refreshed", staleValue.cacheInfo);
+
+  releaseRefresh.set_value();
+  ASSERT_EQ(2, refresh.get());
+}
+
+TEST(cta_catalogue_TimeBasedCacheTest, invalidated_value_not_served_during_refresh) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", 3600, 3600);
+  ASSERT_EQ(1, cache.getCachedValue("key", [] { return 1; }).value);
+  cache.invalidate();
+
+  std::promise<void> refreshStarted;
+  std::promise<void> releaseRefresh;
+  auto refresh = std::async(std::launch::async, [&] {
+    return cache
+      .getCachedValue("key",
+                      [&] {
+                        refreshStarted.set_value();
+                        releaseRefresh.get_future().wait();
+                        return 2;
+                      })
+      .value;
+  });
+  refreshStarted.get_future().wait();
+
+  auto waitingLookup = std::async(std::launch::async, [&cache] { return cache.getCachedValue("key", [] { return 3; }); });
+  releaseRefresh.set_value();
+  ASSERT_EQ(2, refresh.get());
+  const auto freshValue = waitingLookup.get();
+  ASSERT_EQ(2, freshValue.value);
+}
+
+TEST(cta_catalogue_TimeBasedCacheTest, failed_refresh) {
+  cta::catalogue::TimeBasedCache<std::string, int> cache("test", 3600, 0);
+  auto failingGetNonCachedValue = []() -> int { throw cta::exception::Exception("Database unreachable"); };
+  ASSERT_THROW(cache.getCachedValue("key", failingGetNonCachedValue), cta::exception::Exception);
+  ASSERT_EQ(1, cache.getCachedValue("key", [] { return 1; }).value);
+
+  cache.invalidate();
+  ASSERT_THROW(cache.getCachedValue("key", failingGetNonCachedValue), cta::exception::Exception);
+  ASSERT_EQ(2, cache.getCachedValue("key", [] { return 2; }).value);
+}
+
+}  // namespace unitTests
@@ -21,6 +21,18 @@ DummyArchiveFileCatalogue::checkAndGetNextArchiveFileId(const std::string& diskI
   throw exception::NotImplementedException();
 }
 
+std::list<uint64_t>
+DummyArchiveFileCatalogue::checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                         const std::string& storageClassName,
+                                                         const common::dataStructures::RequesterIdentity& user,
+                                                         const uint64_t nbIds) {
+  throw exception::NotImplementedException();
+}
+
+void DummyArchiveFileCatalogue::setArchiveFileIdBlockSize(const uint64_t blockSize) {
+  throw exception::NotImplementedException();
+}
+
 common::dataStructures::ArchiveFileQueueCriteria
 DummyArchiveFileCatalogue::getArchiveFileQueueCriteria(const std::string& diskInstanceName,
                                                        const std::string& storageClassName,
@@ -99,4 +99,12 @@ const std::unique_ptr<DriveStateCatalogue>& DummyCatalogue::DriveState() const {
   return m_driveState;
 }
 
+void DummyCatalogue::setReadReplica(const rdbms::Login& login,
+                                    const uint64_t nbConns,
+                                    const uint64_t maxLagSecs,
+                                    const std::set<ReadReplicaQuery>& queries) {
+}
+
+void DummyCatalogue::enableCacheInvalidationEvents(const time_t maxAgeSecs) {}
+
 }  // namespace cta::catalogue
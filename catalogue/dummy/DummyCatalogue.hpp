@@ -64,6 +64,13 @@ public:
   const std::unique_ptr<DriveConfigCatalogue>& DriveConfig() const override;
   const std::unique_ptr<DriveStateCatalogue>& DriveState() const override;
 
+  void setReadReplica(const rdbms::Login& login,
+                      const uint64_t nbConns,
+                      const uint64_t maxLagSecs,
+                      const std::set<ReadReplicaQuery>& queries) override;
+
+  void enableCacheInvalidationEvents(const time_t maxAgeSecs) override;
+
 protected:
   std::unique_ptr<SchemaCatalogue> m_schema = std::make_unique<DummySchemaCatalogue>();
   std::unique_ptr<AdminUserCatalogue> m_adminUser = std::make_unique<DummyAdminUserCatalogue>();
@@ -5,6 +5,7 @@
 
 #include "catalogue/dummy/DummyTapeFileCatalogue.hpp"
 
+#include "catalogue/RetrieveFilesQueueCriteria.hpp"
 #include "common/dataStructures/ArchiveFile.hpp"
 #include "common/dataStructures/RetrieveFileQueueCriteria.hpp"
 #include "common/exception/Exception.hpp"
@@ -36,4 +37,14 @@ DummyTapeFileCatalogue::prepareToRetrieveFile(const std::string& diskInstanceNam
   throw exception::NotImplementedException();
 }
 
+RetrieveFilesQueueCriteria
+DummyTapeFileCatalogue::prepareToRetrieveFiles(const std::string& diskInstanceName,
+                                               const std::set<uint64_t>& archiveFileIds,
+                                               const common::dataStructures::RequesterIdentity& user,
+                                               const std::optional<std::string>& activity,
+                                               log::LogContext& lc,
+                                               const std::optional<std::string>& mountPolicyName) {
+  throw exception::NotImplementedException();
+}
+
 }  // namespace cta::catalogue
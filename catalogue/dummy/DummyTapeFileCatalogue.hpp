@@ -25,6 +25,14 @@ public:
                         const std::optional<std::string>& activity,
                         log::LogContext& lc,
                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
+
+  RetrieveFilesQueueCriteria
+  prepareToRetrieveFiles(const std::string& diskInstanceName,
+                         const std::set<uint64_t>& archiveFileIds,
+                         const common::dataStructures::RequesterIdentity& user,
+                         const std::optional<std::string>& activity,
+                         log::LogContext& lc,
+                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
 };
 
 }  // namespace cta::catalogue
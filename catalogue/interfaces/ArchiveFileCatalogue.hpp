@@ -58,6 +58,40 @@ public:
                                                 const std::string& storageClassName,
                                                 const common::dataStructures::RequesterIdentity& user) = 0;
 
+  /**
+   * Checks the specified archivals could take place and returns the
+   * specified number of new and unique archive file identifiers, for example
+   * for a batch of files of the same storage class and requester.  The
+   * archivals are checked once for all the identifiers.
+   *
+   * @param diskInstanceName The name of the disk instance to which the
+   * storage class belongs.
+   * @param storageClassName The name of the storage class of the files to be
+   * archived.
+   * @param user The user for whom the files are to be archived.
+   * @param nbIds The number of archive file identifiers to return.
+   * @return The new archive file identifiers.
+   * @throw UserErrorWithCacheInfo if there was a user error.
+   */
+  virtual std::list<uint64_t> checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                            const std::string& storageClassName,
+                                                            const common::dataStructures::RequesterIdentity& user,
+                                                            const uint64_t nbIds) = 0;
+
+  /**
+   * Makes checkAndGetNextArchiveFileId() hand out archive file identifiers
+   * from blocks fetched in advance from the catalogue, instead of fetching
+   * one identifier per call.
+   *
+   * This method is meant to be called once, before any call to
+   * checkAndGetNextArchiveFileId().  Identifiers fetched but not handed out
+   * before the catalogue object is destroyed are never used.
+   *
+   * @param blockSize The number of identifiers fetched at once.  A value of
+   * 0 or 1 disables block allocation.
+   */
+  virtual void setArchiveFileIdBlockSize(const uint64_t blockSize) = 0;
+
   /**
    * Returns the information required to queue an archive request.
    *
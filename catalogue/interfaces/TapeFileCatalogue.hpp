@@ -28,6 +28,7 @@ namespace catalogue {
 CTA_GENERATE_USER_EXCEPTION_CLASS(UserSpecifiedExistingDeletedFileCopy);
 
 class TapeItemWrittenPointer;
+struct RetrieveFilesQueueCriteria;
 
 /**
  * Specifies the interface to a factory Catalogue objects.
@@ -77,6 +78,32 @@ public:
                         const std::optional<std::string>& activity,
                         log::LogContext& lc,
                         const std::optional<std::string>& mountPolicyName = std::nullopt) = 0;
+
+  /**
+   * Prepares for the retrieval of several files requested by the same user
+   * under the same activity.  This is equivalent to calling
+   * prepareToRetrieveFile() for each file, except that the archive files are
+   * looked up together and the mount policy is determined once for all of
+   * them.
+   *
+   * @param diskInstanceName The name of the instance from where the retrieval
+   * requests originated
+   * @param archiveFileIds The unique identifiers of the archived files that are
+   * to be retrieved.
+   * @param user The user for whom the files are to be retrieved.
+   * @param activity The activity under which the user wants to start the retrieves
+   * @param lc The log context.
+   *
+   * @return The information required to queue the retrieve requests of the
+   * files which can be retrieved, and the reasons why the other files cannot be.
+   */
+  virtual RetrieveFilesQueueCriteria
+  prepareToRetrieveFiles(const std::string& diskInstanceName,
+                         const std::set<uint64_t>& archiveFileIds,
+                         const common::dataStructures::RequesterIdentity& user,
+                         const std::optional<std::string>& activity,
+                         log::LogContext& lc,
+                         const std::optional<std::string>& mountPolicyName = std::nullopt) = 0;
 };  // class FileRecyleLogCatalogue
 
 }  // namespace catalogue
@@ -6,6 +6,7 @@
 #include "catalogue/rdbms/RdbmsAdminUserCatalogue.hpp"
 
 #include "catalogue/rdbms/CommonExceptions.hpp"
+#include "catalogue/rdbms/RdbmsCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsCatalogueUtils.hpp"
 #include "common/dataStructures/AdminUser.hpp"
 #include "common/dataStructures/SecurityIdentity.hpp"
@@ -19,9 +20,12 @@
 
 namespace cta::catalogue {
 
-RdbmsAdminUserCatalogue::RdbmsAdminUserCatalogue(log::Logger& log, std::shared_ptr<rdbms::ConnPool> connPool)
+RdbmsAdminUserCatalogue::RdbmsAdminUserCatalogue(log::Logger& log,
+                                                 std::shared_ptr<rdbms::ConnPool> connPool,
+                                                 RdbmsCatalogue* rdbmsCatalogue)
     : m_log(log),
-      m_connPool(connPool) {}
+      m_connPool(connPool),
+      m_rdbmsCatalogue(rdbmsCatalogue) {}
 
 void RdbmsAdminUserCatalogue::createAdminUser(const common::dataStructures::SecurityIdentity& admin,
                                               const std::string& username,
@@ -82,6 +86,8 @@ void RdbmsAdminUserCatalogue::createAdminUser(const common::dataStructures::Secu
   stmt.bindUint64(":LAST_UPDATE_TIME", now);
 
   stmt.executeNonQuery();
+
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ADMIN_USERS);
 }
 
 bool RdbmsAdminUserCatalogue::adminUserExists(rdbms::Conn& conn, const std::string& adminUsername) const {
@@ -111,6 +117,8 @@ void RdbmsAdminUserCatalogue::deleteAdminUser(const std::string& username) {
   if (0 == stmt.getNbAffectedRows()) {
     throw exception::UserError(std::string("Cannot delete admin-user ") + username + " because they do not exist");
   }
+
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ADMIN_USERS);
 }
 
 std::vector<common::dataStructures::AdminUser> RdbmsAdminUserCatalogue::getAdminUsers() const {
@@ -20,9 +20,13 @@ class ConnPool;
 
 namespace catalogue {
 
+class RdbmsCatalogue;
+
 class RdbmsAdminUserCatalogue : public AdminUserCatalogue {
 public:
-  RdbmsAdminUserCatalogue(log::Logger& log, std::shared_ptr<rdbms::ConnPool> connPool);
+  RdbmsAdminUserCatalogue(log::Logger& log,
+                          std::shared_ptr<rdbms::ConnPool> connPool,
+                          RdbmsCatalogue* rdbmsCatalogue);
   ~RdbmsAdminUserCatalogue() override = default;
 
   void createAdminUser(const common::dataStructures::SecurityIdentity& admin,
@@ -69,11 +73,14 @@ private:
 
   log::Logger& m_log;
   std::shared_ptr<rdbms::ConnPool> m_connPool;
+  RdbmsCatalogue* m_rdbmsCatalogue;
 
   /**
    * Cached version of isAdmin() results.
    */
-  mutable TimeBasedCache<common::dataStructures::SecurityIdentity, bool> m_isAdminCache {10};
+  mutable TimeBasedCache<common::dataStructures::SecurityIdentity, bool> m_isAdminCache {"is_admin", 10, 10};
+
+  friend class RdbmsCatalogue;
 };
 
 }  // namespace catalogue
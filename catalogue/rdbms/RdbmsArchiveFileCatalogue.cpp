@@ -32,10 +32,52 @@
 #include "rdbms/AutoRollback.hpp"
 #include "rdbms/ConnPool.hpp"
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cta::catalogue {
 
+namespace {
+//------------------------------------------------------------------------------
+// addArchiveFileToRetrieveRow
+//
+// Adds a row of a query of archive files to retrieve to the specified archive
+// file, filling in the archive file columns on the first row.
+//------------------------------------------------------------------------------
+void addArchiveFileToRetrieveRow(const rdbms::Rset& rset, common::dataStructures::ArchiveFile& archiveFile) {
+  if (archiveFile.tapeFiles.empty()) {
+    archiveFile.archiveFileID = rset.columnUint64("ARCHIVE_FILE_ID");
+    archiveFile.diskInstance = rset.columnString("DISK_INSTANCE_NAME");
+    archiveFile.diskFileId = rset.columnString("DISK_FILE_ID");
+    archiveFile.diskFileInfo.owner_uid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_UID"));
+    archiveFile.diskFileInfo.gid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_GID"));
+    archiveFile.fileSize = rset.columnUint64("SIZE_IN_BYTES");
+    archiveFile.checksumBlob.deserializeOrSetAdler32(rset.columnBlob("CHECKSUM_BLOB"),
+                                                     static_cast<uint32_t>(rset.columnUint64("CHECKSUM_ADLER32")));
+    archiveFile.storageClass = rset.columnString("STORAGE_CLASS_NAME");
+    archiveFile.creationTime = rset.columnUint64("ARCHIVE_FILE_CREATION_TIME");
+    archiveFile.reconciliationTime = rset.columnUint64("RECONCILIATION_TIME");
+  }
+
+  // If there is a tape file we add it to the archiveFile's list of tape files
+  if (!rset.columnIsNull("VID")) {
+    // Add the tape file to the archive file's in-memory structure
+    common::dataStructures::TapeFile tapeFile;
+    tapeFile.vid = rset.columnString("VID");
+    tapeFile.fSeq = rset.columnUint64("FSEQ");
+    tapeFile.blockId = rset.columnUint64("BLOCK_ID");
+    tapeFile.fileSize = rset.columnUint64("LOGICAL_SIZE_IN_BYTES");
+    tapeFile.copyNb = static_cast<uint8_t>(rset.columnUint64("COPY_NB"));
+    tapeFile.creationTime = rset.columnUint64("TAPE_FILE_CREATION_TIME");
+    tapeFile.checksumBlob = archiveFile.checksumBlob;  // Duplicated for convenience
+
+    archiveFile.tapeFiles.push_back(tapeFile);
+  }
+}
+}  // namespace
+
 RdbmsArchiveFileCatalogue::RdbmsArchiveFileCatalogue(log::Logger& log,
                                                      std::shared_ptr<rdbms::ConnPool> connPool,
                                                      RdbmsCatalogue* rdbmsCatalogue)
@@ -48,47 +90,13 @@ RdbmsArchiveFileCatalogue::checkAndGetNextArchiveFileId(const std::string& diskI
                                                         const std::string& storageClassName,
                                                         const common::dataStructures::RequesterIdentity& user) {
   try {
-    const auto storageClass = catalogue::StorageClass(storageClassName);
-    const auto copyToPoolMap = getCachedTapeCopyToPoolMap(storageClass, false);
-    const auto expectedNbRoutes = getCachedExpectedNbArchiveRoutes(storageClass, false);
-
-    // Check that the number of archive routes is correct
-    if (copyToPoolMap.empty()) {
-      exception::UserError ue;
-      ue.getMessage() << "Storage class " << storageClassName << " has no archive routes";
-      throw ue;
-    }
-    if (copyToPoolMap.size() != expectedNbRoutes) {
-      exception::UserError ue;
-      ue.getMessage() << "Storage class " << storageClassName
-                      << " does not have the"
-                         " expected number of archive routes routes: expected="
-                      << expectedNbRoutes << ", actual=" << copyToPoolMap.size();
-      throw ue;
-    }
-
-    // Only consider the requester's group if there is no user mount policy
-    if (const auto userMountPolicyAndCacheInfo = getCachedRequesterMountPolicy(User(diskInstanceName, user.name));
-        !userMountPolicyAndCacheInfo.value) {
-      const auto groupMountPolicyAndCacheInfo = getCachedRequesterGroupMountPolicy(Group(diskInstanceName, user.group));
-      const auto& groupMountPolicy = groupMountPolicyAndCacheInfo.value;
-
-      if (!groupMountPolicy) {
-        const auto defaultUserMountPolicyAndCacheInfo =
-          getCachedRequesterMountPolicy(User(diskInstanceName, "default"));
-
-        if (!defaultUserMountPolicyAndCacheInfo.value) {
-          exception::UserErrorWithCacheInfo ue(userMountPolicyAndCacheInfo.cacheInfo);
-          ue.getMessage() << "Failed to check and get next archive file ID: No mount rules: storageClass="
-                          << storageClassName << " requester=" << diskInstanceName << ":" << user.name << ":"
-                          << user.group;
-          throw ue;
-        }
-      }
-    }
+    checkArchivalIsPossible(diskInstanceName, storageClassName, user);
 
     // Now that we have found both the archive routes and the mount policy it's
     // safe to consume an archive file identifier
+    if (m_archiveFileIdAllocator) {
+      return m_archiveFileIdAllocator->getNextArchiveFileId();
+    }
     auto conn = m_connPool->getConn();
     return getNextArchiveFileId(conn);
   } catch (exception::UserErrorWithCacheInfo& ue) {
@@ -100,6 +108,96 @@ RdbmsArchiveFileCatalogue::checkAndGetNextArchiveFileId(const std::string& diskI
   }
 }
 
+std::list<uint64_t>
+RdbmsArchiveFileCatalogue::checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                         const std::string& storageClassName,
+                                                         const common::dataStructures::RequesterIdentity& user,
+                                                         const uint64_t nbIds) {
+  try {
+    checkArchivalIsPossible(diskInstanceName, storageClassName, user);
+
+    if (m_archiveFileIdAllocator) {
+      std::list<uint64_t> archiveFileIds;
+      for (uint64_t i = 0; i < nbIds; i++) {
+        archiveFileIds.push_back(m_archiveFileIdAllocator->getNextArchiveFileId());
+      }
+      return archiveFileIds;
+    }
+    auto conn = m_connPool->getConn();
+    return getNextArchiveFileIds(conn, nbIds);
+  } catch (exception::UserErrorWithCacheInfo& ue) {
+    log::LogContext lc(m_log);
+    log::ScopedParamContainer spc(lc);
+    spc.add("cacheInfo", ue.cacheInfo).add("userError", ue.getMessage().str());
+    lc.log(log::INFO, "Catalogue::checkAndGetNextArchiveFileIds caught a UserErrorWithCacheInfo");
+    throw;
+  }
+}
+
+void RdbmsArchiveFileCatalogue::checkArchivalIsPossible(const std::string& diskInstanceName,
+                                                        const std::string& storageClassName,
+                                                        const common::dataStructures::RequesterIdentity& user) const {
+  const auto storageClass = catalogue::StorageClass(storageClassName);
+  const auto copyToPoolMap = getCachedTapeCopyToPoolMap(storageClass, false);
+  const auto expectedNbRoutes = getCachedExpectedNbArchiveRoutes(storageClass, false);
+
+  // Check that the number of archive routes is correct
+  if (copyToPoolMap.empty()) {
+    exception::UserError ue;
+    ue.getMessage() << "Storage class " << storageClassName << " has no archive routes";
+    throw ue;
+  }
+  if (copyToPoolMap.size() != expectedNbRoutes) {
+    exception::UserError ue;
+    ue.getMessage() << "Storage class " << storageClassName
+                    << " does not have the"
+                       " expected number of archive routes routes: expected="
+                    << expectedNbRoutes << ", actual=" << copyToPoolMap.size();
+    throw ue;
+  }
+
+  // Only consider the requester's group if there is no user mount policy
+  if (const auto userMountPolicyAndCacheInfo = getCachedRequesterMountPolicy(User(diskInstanceName, user.name));
+      !userMountPolicyAndCacheInfo.value) {
+    const auto groupMountPolicyAndCacheInfo = getCachedRequesterGroupMountPolicy(Group(diskInstanceName, user.group));
+    const auto& groupMountPolicy = groupMountPolicyAndCacheInfo.value;
+
+    if (!groupMountPolicy) {
+      const auto defaultUserMountPolicyAndCacheInfo = getCachedRequesterMountPolicy(User(diskInstanceName, "default"));
+
+      if (!defaultUserMountPolicyAndCacheInfo.value) {
+        exception::UserErrorWithCacheInfo ue(userMountPolicyAndCacheInfo.cacheInfo);
+        ue.getMessage() << "Failed to check and get next archive file ID: No mount rules: storageClass="
+                        << storageClassName << " requester=" << diskInstanceName << ":" << user.name << ":"
+                        << user.group;
+        throw ue;
+      }
+    }
+  }
+}
+
+void RdbmsArchiveFileCatalogue::setArchiveFileIdBlockSize(const uint64_t blockSize) {
+  if (blockSize < 2) {
+    m_archiveFileIdAllocator.reset();
+    return;
+  }
+  m_archiveFileIdAllocator = std::make_unique<ArchiveFileIdBlockAllocator>(
+    m_log,
+    [this](const uint64_t nbIds) {
+      auto conn = m_connPool->getConn();
+      return getNextArchiveFileIds(conn, nbIds);
+    },
+    blockSize);
+}
+
+std::list<uint64_t> RdbmsArchiveFileCatalogue::getNextArchiveFileIds(rdbms::Conn& conn, const uint64_t nbIds) {
+  std::list<uint64_t> archiveFileIds;
+  for (uint64_t i = 0; i < nbIds; i++) {
+    archiveFileIds.push_back(getNextArchiveFileId(conn));
+  }
+  return archiveFileIds;
+}
+
 common::dataStructures::ArchiveFileQueueCriteria
 RdbmsArchiveFileCatalogue::getArchiveFileQueueCriteria(const std::string& diskInstanceName,
                                                        const std::string& storageClassName,
@@ -150,17 +248,28 @@ RdbmsArchiveFileCatalogue::getArchiveFileQueueCriteria(const std::string& diskIn
 }
 
 ArchiveFileItor RdbmsArchiveFileCatalogue::getArchiveFilesItor(const TapeFileSearchCriteria& searchCriteria) const {
+  return getArchiveFilesItor(searchCriteria, true);
+}
+
+ArchiveFileItor RdbmsArchiveFileCatalogue::getArchiveFilesItor(const TapeFileSearchCriteria& searchCriteria,
+                                                               const bool allowReadReplica) const {
   checkTapeFileSearchCriteria(searchCriteria);
 
   // If this is the listing of the contents of a tape
   if (!searchCriteria.archiveFileId.has_value() && !searchCriteria.diskInstance.has_value()
       && !searchCriteria.diskFileIds.has_value() && !searchCriteria.fSeq.has_value()
       && searchCriteria.vid.has_value()) {
-    return getTapeContentsItor(searchCriteria.vid.value());
+    return getTapeContentsItor(searchCriteria.vid.value(), allowReadReplica);
   }
 
+  // Populating the temporary table of disk file IDs requires a writable database
+  auto& primaryConnPool = *m_rdbmsCatalogue->m_archiveFileListingConnPool;
+  auto& connPool = allowReadReplica && !searchCriteria.diskFileIds.has_value() ?
+                     m_rdbmsCatalogue->getReadOnlyConnPool(ReadReplicaQuery::ARCHIVE_FILE_LISTING, primaryConnPool) :
+                     primaryConnPool;
+
   // Create a connection to populate the temporary table (specialised by database type)
-  auto conn = m_rdbmsCatalogue->m_archiveFileListingConnPool->getConn();
+  auto conn = connPool.getConn();
   const auto tempDiskFxidsTableName =
     m_rdbmsCatalogue->createAndPopulateTempTableFxid(conn, searchCriteria.diskFileIds);
   // Pass ownership of the connection to the Iterator object
@@ -199,7 +308,8 @@ RdbmsArchiveFileCatalogue::getArchiveFileCopyForDeletion(const TapeFileSearchCri
   TapeFileSearchCriteria searchCriteria = criteria;
   searchCriteria.vid = std::
     nullopt;  //unset vid, we want to get all copies of the archive file so we can check that it is not a one copy file
-  auto itor = getArchiveFilesItor(searchCriteria);
+  // The file copy is about to be deleted, so read it from the primary rather than from a possibly stale replica
+  auto itor = getArchiveFilesItor(searchCriteria, false);
 
   // itor should have at most one archive file since we always search on unique attributes
   if (!itor.hasMore()) {
@@ -558,7 +668,7 @@ ArchiveFileItor RdbmsArchiveFileCatalogue::getArchiveFilesItor(rdbms::Conn& conn
   // If this is the listing of the contents of a tape
   if (!searchCriteria.archiveFileId.has_value() && !searchCriteria.diskInstance.has_value()
       && !searchCriteria.diskFileIds.has_value() && searchCriteria.vid.has_value()) {
-    return getTapeContentsItor(searchCriteria.vid.value());
+    return getTapeContentsItor(searchCriteria.vid.value(), false);
   }
 
   auto archiveListingConn = m_rdbmsCatalogue->m_archiveFileListingConnPool->getConn();
@@ -598,9 +708,12 @@ void RdbmsArchiveFileCatalogue::checkTapeFileSearchCriteria(rdbms::Conn& conn,
   }
 }
 
-ArchiveFileItor RdbmsArchiveFileCatalogue::getTapeContentsItor(const std::string& vid) const {
-  // Create a connection to populate the temporary table (specialised by database type)
-  auto impl = std::make_unique<RdbmsCatalogueTapeContentsItor>(m_log, *m_connPool, vid);
+ArchiveFileItor RdbmsArchiveFileCatalogue::getTapeContentsItor(const std::string& vid,
+                                                               const bool allowReadReplica) const {
+  auto& connPool = allowReadReplica ?
+                     m_rdbmsCatalogue->getReadOnlyConnPool(ReadReplicaQuery::ARCHIVE_FILE_LISTING, *m_connPool) :
+                     *m_connPool;
+  auto impl = std::make_unique<RdbmsCatalogueTapeContentsItor>(m_log, connPool, vid);
   return ArchiveFileItor(impl.release());
 }
 
@@ -1048,34 +1161,8 @@ RdbmsArchiveFileCatalogue::getArchiveFileToRetrieveByArchiveFileId(rdbms::Conn&
   while (rset.next()) {
     if (nullptr == archiveFile.get()) {
       archiveFile = std::make_unique<common::dataStructures::ArchiveFile>();
-
-      archiveFile->archiveFileID = rset.columnUint64("ARCHIVE_FILE_ID");
-      archiveFile->diskInstance = rset.columnString("DISK_INSTANCE_NAME");
-      archiveFile->diskFileId = rset.columnString("DISK_FILE_ID");
-      archiveFile->diskFileInfo.owner_uid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_UID"));
-      archiveFile->diskFileInfo.gid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_GID"));
-      archiveFile->fileSize = rset.columnUint64("SIZE_IN_BYTES");
-      archiveFile->checksumBlob.deserializeOrSetAdler32(rset.columnBlob("CHECKSUM_BLOB"),
-                                                        static_cast<uint32_t>(rset.columnUint64("CHECKSUM_ADLER32")));
-      archiveFile->storageClass = rset.columnString("STORAGE_CLASS_NAME");
-      archiveFile->creationTime = rset.columnUint64("ARCHIVE_FILE_CREATION_TIME");
-      archiveFile->reconciliationTime = rset.columnUint64("RECONCILIATION_TIME");
-    }
-
-    // If there is a tape file we add it to the archiveFile's list of tape files
-    if (!rset.columnIsNull("VID")) {
-      // Add the tape file to the archive file's in-memory structure
-      common::dataStructures::TapeFile tapeFile;
-      tapeFile.vid = rset.columnString("VID");
-      tapeFile.fSeq = rset.columnUint64("FSEQ");
-      tapeFile.blockId = rset.columnUint64("BLOCK_ID");
-      tapeFile.fileSize = rset.columnUint64("LOGICAL_SIZE_IN_BYTES");
-      tapeFile.copyNb = static_cast<uint8_t>(rset.columnUint64("COPY_NB"));
-      tapeFile.creationTime = rset.columnUint64("TAPE_FILE_CREATION_TIME");
-      tapeFile.checksumBlob = archiveFile->checksumBlob;  // Duplicated for convenience
-
-      archiveFile->tapeFiles.push_back(tapeFile);
     }
+    addArchiveFileToRetrieveRow(rset, *archiveFile);
   }
 
   //If there are no tape files that belong to the archive file, then return a nullptr.
@@ -1117,4 +1204,87 @@ RdbmsArchiveFileCatalogue::getTapeFileStatesForArchiveFileId(rdbms::Conn& conn,
   return ret;
 }
 
+//------------------------------------------------------------------------------
+// getArchiveFilesToRetrieveByArchiveFileIds
+//------------------------------------------------------------------------------
+std::map<uint64_t, common::dataStructures::ArchiveFile>
+RdbmsArchiveFileCatalogue::getArchiveFilesToRetrieveByArchiveFileIds(
+  rdbms::Conn& conn,
+  const std::string& tempArchiveFileIdsTableName) const {
+  const std::string sql = R"SQL(
+    SELECT
+      ARCHIVE_FILE.ARCHIVE_FILE_ID AS ARCHIVE_FILE_ID,
+      ARCHIVE_FILE.DISK_INSTANCE_NAME AS DISK_INSTANCE_NAME,
+      ARCHIVE_FILE.DISK_FILE_ID AS DISK_FILE_ID,
+      ARCHIVE_FILE.DISK_FILE_UID AS DISK_FILE_UID,
+      ARCHIVE_FILE.DISK_FILE_GID AS DISK_FILE_GID,
+      ARCHIVE_FILE.SIZE_IN_BYTES AS SIZE_IN_BYTES,
+      ARCHIVE_FILE.CHECKSUM_BLOB AS CHECKSUM_BLOB,
+      ARCHIVE_FILE.CHECKSUM_ADLER32 AS CHECKSUM_ADLER32,
+      STORAGE_CLASS.STORAGE_CLASS_NAME AS STORAGE_CLASS_NAME,
+      ARCHIVE_FILE.CREATION_TIME AS ARCHIVE_FILE_CREATION_TIME,
+      ARCHIVE_FILE.RECONCILIATION_TIME AS RECONCILIATION_TIME,
+      TAPE_FILE.VID AS VID,
+      TAPE_FILE.FSEQ AS FSEQ,
+      TAPE_FILE.BLOCK_ID AS BLOCK_ID,
+      TAPE_FILE.LOGICAL_SIZE_IN_BYTES AS LOGICAL_SIZE_IN_BYTES,
+      TAPE_FILE.COPY_NB AS COPY_NB,
+      TAPE_FILE.CREATION_TIME AS TAPE_FILE_CREATION_TIME
+    FROM
+      ARCHIVE_FILE
+    INNER JOIN STORAGE_CLASS ON
+      ARCHIVE_FILE.STORAGE_CLASS_ID = STORAGE_CLASS.STORAGE_CLASS_ID
+    INNER JOIN TAPE_FILE ON
+      ARCHIVE_FILE.ARCHIVE_FILE_ID = TAPE_FILE.ARCHIVE_FILE_ID
+    INNER JOIN TAPE ON
+      TAPE_FILE.VID = TAPE.VID
+    WHERE
+      ARCHIVE_FILE.ARCHIVE_FILE_ID IN (SELECT ARCHIVE_FILE_ID FROM )SQL"
+                          + tempArchiveFileIdsTableName + R"SQL() AND
+      TAPE.TAPE_STATE IN ('ACTIVE', 'DISABLED')
+    ORDER BY
+      ARCHIVE_FILE.ARCHIVE_FILE_ID,
+      TAPE_FILE.CREATION_TIME ASC
+  )SQL";
+  auto stmt = conn.createStmt(sql);
+  auto rset = stmt.executeQuery();
+  std::map<uint64_t, common::dataStructures::ArchiveFile> archiveFiles;
+  while (rset.next()) {
+    addArchiveFileToRetrieveRow(rset, archiveFiles[rset.columnUint64("ARCHIVE_FILE_ID")]);
+  }
+  return archiveFiles;
+}
+
+//------------------------------------------------------------------------------
+// getTapeFileStatesForArchiveFileIds
+//------------------------------------------------------------------------------
+std::map<uint64_t, std::vector<std::pair<std::string, std::string>>>
+RdbmsArchiveFileCatalogue::getTapeFileStatesForArchiveFileIds(rdbms::Conn& conn,
+                                                              const std::string& tempArchiveFileIdsTableName) const {
+  const std::string sql = R"SQL(
+    SELECT
+      TAPE_FILE.ARCHIVE_FILE_ID AS ARCHIVE_FILE_ID,
+      TAPE_FILE.VID AS VID,
+      TAPE.TAPE_STATE AS STATE
+    FROM
+      TAPE_FILE
+    INNER JOIN TAPE ON
+      TAPE_FILE.VID = TAPE.VID
+    WHERE
+      TAPE_FILE.ARCHIVE_FILE_ID IN (SELECT ARCHIVE_FILE_ID FROM )SQL"
+                          + tempArchiveFileIdsTableName + R"SQL()
+  )SQL";
+
+  auto stmt = conn.createStmt(sql);
+  auto rset = stmt.executeQuery();
+  std::map<uint64_t, std::vector<std::pair<std::string, std::string>>> ret;
+  while (rset.next()) {
+    const auto archiveFileId = rset.columnUint64("ARCHIVE_FILE_ID");
+    const auto& vid = rset.columnString("VID");
+    const auto& state = rset.columnString("STATE");
+    ret[archiveFileId].emplace_back(vid, state);
+  }
+  return ret;
+}
+
 }  // namespace cta::catalogue
@@ -5,12 +5,15 @@
 
 #pragma once
 
+#include "catalogue/ArchiveFileIdBlockAllocator.hpp"
 #include "catalogue/TimeBasedCache.hpp"
 #include "catalogue/interfaces/ArchiveFileCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsStorageClassCatalogue.hpp"
 #include "common/dataStructures/TapeCopyToPoolMap.hpp"
 #include "common/log/Logger.hpp"
 
+#include <list>
+#include <map>
 #include <memory>
 
 namespace cta {
@@ -47,6 +50,13 @@ public:
                                         const std::string& storageClassName,
                                         const common::dataStructures::RequesterIdentity& user) override;
 
+  std::list<uint64_t> checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                    const std::string& storageClassName,
+                                                    const common::dataStructures::RequesterIdentity& user,
+                                                    const uint64_t nbIds) override;
+
+  void setArchiveFileIdBlockSize(const uint64_t blockSize) override;
+
   common::dataStructures::ArchiveFileQueueCriteria
   getArchiveFileQueueCriteria(const std::string& diskInstanceName,
                               const std::string& storageClassName,
@@ -100,6 +110,20 @@ protected:
    */
   virtual uint64_t getNextArchiveFileId(rdbms::Conn& conn) = 0;
 
+  /**
+   * Returns the specified number of unique archive IDs that can be used by
+   * new archive files within the catalogue.
+   *
+   * The default implementation calls getNextArchiveFileId() once per
+   * identifier.  Sub-classes should override it with a single query where
+   * the database technology allows it.
+   *
+   * @param conn The database connection.
+   * @param nbIds The number of archive IDs to return.
+   * @return The unique archive IDs.
+   */
+  virtual std::list<uint64_t> getNextArchiveFileIds(rdbms::Conn& conn, const uint64_t nbIds);
+
   friend class OracleFileRecycleLogCatalogue;
   friend class PostgresFileRecycleLogCatalogue;
   friend class SqliteFileRecycleLogCatalogue;
@@ -134,12 +158,22 @@ protected:
   std::shared_ptr<rdbms::ConnPool> m_connPool;
   RdbmsCatalogue* m_rdbmsCatalogue;
 
+  /**
+   * Hands out archive file identifiers fetched by blocks, or nullptr if each
+   * identifier is fetched when needed.  Sub-classes must reset it in their
+   * destructor because its refill thread calls getNextArchiveFileIds().
+   */
+  std::unique_ptr<ArchiveFileIdBlockAllocator> m_archiveFileIdAllocator;
+
 private:
   /**
    * Cached versions of tape copy to tape tape pool mappings for specific
    * storage classes.
    */
-  mutable TimeBasedCache<catalogue::StorageClass, common::dataStructures::TapeCopyToPoolMap> m_tapeCopyToPoolCache {10};
+  mutable TimeBasedCache<catalogue::StorageClass, common::dataStructures::TapeCopyToPoolMap> m_tapeCopyToPoolCache {
+    "tape_copy_to_pool",
+    10,
+    10};
 
   /**
    * Cached versions of the expected number of archive routes for specific
@@ -147,7 +181,12 @@ private:
    * method as opposed to the actual number entered so far using the
    * createArchiveRoute() method.
    */
-  mutable TimeBasedCache<catalogue::StorageClass, uint64_t> m_expectedNbArchiveRoutesCache {10};
+  mutable TimeBasedCache<catalogue::StorageClass, uint64_t> m_expectedNbArchiveRoutesCache {
+    "expected_nb_archive_routes",
+    10,
+    10};
+
+  friend class RdbmsCatalogue;
 
   /**
    * Returns a cached version of the mapping from tape copy to tape pool for the
@@ -205,6 +244,17 @@ private:
   ValueAndTimeBasedCacheInfo<std::optional<common::dataStructures::MountPolicy>>
   getCachedRequesterGroupMountPolicy(const Group& group) const;
 
+  /**
+   * Checks that files of the specified storage class can be archived for the
+   * specified user: the storage class has the expected archive routes and a
+   * mount policy applies to the user.
+   *
+   * @throw UserError or UserErrorWithCacheInfo if the archival is not possible.
+   */
+  void checkArchivalIsPossible(const std::string& diskInstanceName,
+                               const std::string& storageClassName,
+                               const common::dataStructures::RequesterIdentity& user) const;
+
   /**
    * Throws a UserError exception if the specified searchCriteria is not valid
    * due to a user error.
@@ -227,9 +277,21 @@ private:
    * FSEQ.
    *
    * @param vid The volume identifier of the tape.
+   * @param allowReadReplica True if the files may be read from the read
+   * replica of the database.
    * @return The iterator.
    */
-  ArchiveFileItor getTapeContentsItor(const std::string& vid) const;
+  ArchiveFileItor getTapeContentsItor(const std::string& vid, const bool allowReadReplica) const;
+
+  /**
+   * Returns the specified archive files.
+   *
+   * @param searchCriteria The search criteria.
+   * @param allowReadReplica True if the files may be read from the read
+   * replica of the database.
+   * @return The archive files.
+   */
+  ArchiveFileItor getArchiveFilesItor(const TapeFileSearchCriteria& searchCriteria, const bool allowReadReplica) const;
 
   /**
    * Returns the specified archive files.  Please note that the list of files
@@ -324,6 +386,34 @@ private:
    */
   std::vector<std::pair<std::string, std::string>>
   getTapeFileStatesForArchiveFileId(rdbms::Conn& conn, const uint64_t archiveFileId) const;
+
+  /**
+   * Returns the archive files to retrieve whose identifiers are in the
+   * specified temporary table.  Like getArchiveFileToRetrieveByArchiveFileId(),
+   * only looks at the tape files on tapes in state ACTIVE or DISABLED, and
+   * leaves out the archive files without any such tape file.
+   *
+   * @param conn The database connection.
+   * @param tempArchiveFileIdsTableName The name of the temporary table of
+   * archive file identifiers returned by
+   * RdbmsCatalogue::createAndPopulateTempTableArchiveFileIds().
+   * @return The archive files by archive file identifier.
+   */
+  std::map<uint64_t, common::dataStructures::ArchiveFile>
+  getArchiveFilesToRetrieveByArchiveFileIds(rdbms::Conn& conn, const std::string& tempArchiveFileIdsTableName) const;
+
+  /**
+   * Returns the states of the tapes of the tape files of the archive files
+   * whose identifiers are in the specified temporary table.
+   *
+   * @param conn The database connection.
+   * @param tempArchiveFileIdsTableName The name of the temporary table of
+   * archive file identifiers.
+   * @return The tape file vid and corresponding tape state pairs by archive
+   * file identifier.
+   */
+  std::map<uint64_t, std::vector<std::pair<std::string, std::string>>>
+  getTapeFileStatesForArchiveFileIds(rdbms::Conn& conn, const std::string& tempArchiveFileIdsTableName) const;
 };
 
 }  // namespace catalogue
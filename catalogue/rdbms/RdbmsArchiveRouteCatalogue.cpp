@@ -8,6 +8,7 @@
 #include "catalogue/interfaces/StorageClassCatalogue.hpp"
 #include "catalogue/interfaces/TapePoolCatalogue.hpp"
 #include "catalogue/rdbms/CommonExceptions.hpp"
+#include "catalogue/rdbms/RdbmsCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsCatalogueUtils.hpp"
 #include "common/dataStructures/ArchiveRoute.hpp"
 #include "common/dataStructures/SecurityIdentity.hpp"
@@ -21,9 +22,12 @@
 
 namespace cta::catalogue {
 
-RdbmsArchiveRouteCatalogue::RdbmsArchiveRouteCatalogue(log::Logger& log, std::shared_ptr<rdbms::ConnPool> connPool)
+RdbmsArchiveRouteCatalogue::RdbmsArchiveRouteCatalogue(log::Logger& log,
+                                                       std::shared_ptr<rdbms::ConnPool> connPool,
+                                                       RdbmsCatalogue* rdbmsCatalogue)
     : m_log(log),
-      m_connPool(connPool) {}
+      m_connPool(connPool),
+      m_rdbmsCatalogue(rdbmsCatalogue) {}
 
 void RdbmsArchiveRouteCatalogue::createArchiveRoute(const common::dataStructures::SecurityIdentity& admin,
                                                     const std::string& storageClassName,
@@ -135,6 +139,8 @@ void RdbmsArchiveRouteCatalogue::createArchiveRoute(const common::dataStructures
   stmt.bindUint64(":LAST_UPDATE_TIME", now);
 
   stmt.executeNonQuery();
+
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ARCHIVE_ROUTES);
 }
 
 void RdbmsArchiveRouteCatalogue::deleteArchiveRoute(const std::string& storageClassName,
@@ -166,6 +172,8 @@ void RdbmsArchiveRouteCatalogue::deleteArchiveRoute(const std::string& storageCl
                     << " because it does not exist";
     throw ue;
   }
+
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ARCHIVE_ROUTES);
 }
 
 std::vector<common::dataStructures::ArchiveRoute> RdbmsArchiveRouteCatalogue::getArchiveRoutes() const {
@@ -330,6 +338,8 @@ void RdbmsArchiveRouteCatalogue::modifyArchiveRouteTapePoolName(
     if (0 == stmt.getNbAffectedRows()) {
       throw UserSpecifiedANonExistentArchiveRoute("Archive route does not exist");
     }
+
+    m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ARCHIVE_ROUTES);
   } catch (exception::UserError& ue) {
     std::ostringstream msg;
     msg << "Cannot modify tape pool of archive route: storageClassName=" << storageClassName << " copyNb=" << copyNb
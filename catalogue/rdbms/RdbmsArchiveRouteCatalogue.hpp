@@ -19,9 +19,13 @@ class ConnPool;
 
 namespace catalogue {
 
+class RdbmsCatalogue;
+
 class RdbmsArchiveRouteCatalogue : public ArchiveRouteCatalogue {
 public:
-  RdbmsArchiveRouteCatalogue(log::Logger& log, std::shared_ptr<rdbms::ConnPool> connPool);
+  RdbmsArchiveRouteCatalogue(log::Logger& log,
+                             std::shared_ptr<rdbms::ConnPool> connPool,
+                             RdbmsCatalogue* rdbmsCatalogue);
   ~RdbmsArchiveRouteCatalogue() override = default;
 
   void createArchiveRoute(const common::dataStructures::SecurityIdentity& admin,
@@ -60,6 +64,7 @@ private:
 
   log::Logger& m_log;
   std::shared_ptr<rdbms::ConnPool> m_connPool;
+  RdbmsCatalogue* m_rdbmsCatalogue;
 
   /**
    * @return the archive routes of the given storage class and destination tape
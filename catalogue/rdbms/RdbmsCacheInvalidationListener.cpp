@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/rdbms/RdbmsCacheInvalidationListener.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/LogContext.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace cta::catalogue {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+RdbmsCacheInvalidationListener::RdbmsCacheInvalidationListener(log::Logger& log,
+                                                               const rdbms::Login& login,
+                                                               Subscribe subscribe,
+                                                               OnInvalidation onInvalidation,
+                                                               OnListening onListening,
+                                                               const uint32_t waitTimeoutMs,
+                                                               const time_t reconnectPeriodSecs)
+    : m_log(log),
+      m_connPool(login, 1),
+      m_subscribe(std::move(subscribe)),
+      m_onInvalidation(std::move(onInvalidation)),
+      m_onListening(std::move(onListening)),
+      m_waitTimeoutMs(waitTimeoutMs),
+      m_reconnectPeriodSecs(reconnectPeriodSecs) {
+  threading::Thread::start();
+}
+
+//------------------------------------------------------------------------------
+// destructor
+//------------------------------------------------------------------------------
+RdbmsCacheInvalidationListener::~RdbmsCacheInvalidationListener() {
+  m_stopRequested = true;
+  threading::Thread::wait();
+}
+
+//------------------------------------------------------------------------------
+// run
+//------------------------------------------------------------------------------
+void RdbmsCacheInvalidationListener::run() {
+  while (!m_stopRequested) {
+    try {
+      auto conn = m_connPool.getConn();
+      m_subscribe(conn);
+      m_listening = true;
+      m_onListening(true);
+      {
+        log::LogContext lc(m_log);
+        lc.log(log::INFO, "In RdbmsCacheInvalidationListener::run(): listening to catalogue cache invalidations");
+      }
+
+      while (!m_stopRequested) {
+        // Coalesce the notifications that have already arrived with the first
+        // one so that a burst of changes is handled once
+        auto payloads = conn.waitForNotifications(m_waitTimeoutMs);
+        std::set<std::string> distinctPayloads(payloads.begin(), payloads.end());
+        while (!payloads.empty()) {
+          payloads = conn.waitForNotifications(0);
+          distinctPayloads.insert(payloads.begin(), payloads.end());
+        }
+        if (!distinctPayloads.empty()) {
+          m_onInvalidation(distinctPayloads);
+        }
+      }
+    } catch (exception::Exception& ex) {
+      log::LogContext lc(m_log);
+      log::ScopedParamContainer params(lc);
+      params.add("exceptionMessage", ex.getMessageValue());
+      lc.log(log::WARNING, "In RdbmsCacheInvalidationListener::run(): not listening to catalogue cache invalidations");
+    }
+
+    if (m_listening) {
+      m_listening = false;
+      m_onListening(false);
+    }
+    waitBeforeReconnecting();
+  }
+}
+
+//------------------------------------------------------------------------------
+// waitBeforeReconnecting
+//------------------------------------------------------------------------------
+void RdbmsCacheInvalidationListener::waitBeforeReconnecting() const {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(m_reconnectPeriodSecs);
+  while (!m_stopRequested && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+}
+
+}  // namespace cta::catalogue
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/Logger.hpp"
+#include "common/process/threading/Thread.hpp"
+#include "rdbms/ConnPool.hpp"
+
+#include <atomic>
+#include <functional>
+#include <set>
+#include <stdint.h>
+#include <string>
+#include <time.h>
+
+namespace cta::catalogue {
+
+/**
+ * Listens to the notifications sent by the catalogue processes when they
+ * modify data that other processes cache, such as mount policies.
+ *
+ * A background thread keeps a dedicated connection subscribed to the
+ * notifications.  The notifications received together are coalesced, so that
+ * a burst of admin commands invalidates each kind of cached data once.  If
+ * the connection is lost, the thread reports that it stopped listening and
+ * tries to subscribe again every reconnect period, so that the caches can
+ * fall back to expiring their values after a fixed time in the meantime.
+ */
+class RdbmsCacheInvalidationListener : private threading::Thread {
+public:
+  /**
+   * Function subscribing the specified connection to the notifications.
+   */
+  using Subscribe = std::function<void(rdbms::Conn& conn)>;
+
+  /**
+   * Function called with the distinct payloads of the notifications received.
+   */
+  using OnInvalidation = std::function<void(const std::set<std::string>& payloads)>;
+
+  /**
+   * Function called with true once the connection is subscribed to the
+   * notifications, and with false once it has been lost.
+   */
+  using OnListening = std::function<void(bool listening)>;
+
+  /**
+   * Constructor.  Starts the listening thread.
+   *
+   * @param log Object representing the API to the CTA logging system.
+   * @param login The database login details.
+   * @param subscribe Function subscribing a connection to the notifications.
+   * @param onInvalidation Function called with the payloads received.
+   * @param onListening Function called when listening starts or stops.
+   * @param waitTimeoutMs The maximum time a wait for notifications blocks,
+   * which bounds the time taken to stop the thread.
+   * @param reconnectPeriodSecs The minimum time between two subscriptions.
+   */
+  RdbmsCacheInvalidationListener(log::Logger& log,
+                                 const rdbms::Login& login,
+                                 Subscribe subscribe,
+                                 OnInvalidation onInvalidation,
+                                 OnListening onListening,
+                                 const uint32_t waitTimeoutMs = 1000,
+                                 const time_t reconnectPeriodSecs = 10);
+
+  /**
+   * Destructor.  Stops the listening thread.
+   */
+  ~RdbmsCacheInvalidationListener() override;
+
+  /**
+   * Returns true if the connection is currently subscribed to the
+   * notifications.
+   */
+  bool isListening() const { return m_listening; }
+
+private:
+  /**
+   * The listening thread.
+   */
+  void run() override;
+
+  /**
+   * Waits for the reconnect period, returning early if the thread is asked to
+   * stop.
+   */
+  void waitBeforeReconnecting() const;
+
+  log::Logger& m_log;
+
+  /**
+   * The pool of the single connection subscribed to the notifications.
+   */
+  rdbms::ConnPool m_connPool;
+
+  const Subscribe m_subscribe;
+  const OnInvalidation m_onInvalidation;
+  const OnListening m_onListening;
+  const uint32_t m_waitTimeoutMs;
+  const time_t m_reconnectPeriodSecs;
+
+  std::atomic<bool> m_listening = false;
+  std::atomic<bool> m_stopRequested = false;
+};
+
+}  // namespace cta::catalogue
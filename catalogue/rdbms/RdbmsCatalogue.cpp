@@ -30,11 +30,29 @@
 #include "catalogue/rdbms/RdbmsTapeCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsVirtualOrganizationCatalogue.hpp"
 #include "common/dataStructures/SecurityIdentity.hpp"
+#include "common/exception/NotImplementedException.hpp"
+#include "common/log/LogContext.hpp"
 
+#include <map>
 #include <memory>
 
 namespace cta::catalogue {
 
+namespace {
+/**
+ * The payloads of the cache invalidation events
+ */
+const std::map<RdbmsCatalogue::CachedData, std::string> kCachedDataPayloads {
+  {RdbmsCatalogue::CachedData::MOUNT_POLICIES,              "mount_policies"             },
+  {RdbmsCatalogue::CachedData::REQUESTER_MOUNT_RULES,       "requester_mount_rules"      },
+  {RdbmsCatalogue::CachedData::REQUESTER_GROUP_MOUNT_RULES, "requester_group_mount_rules"},
+  {RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS,       "virtual_organizations"      },
+  {RdbmsCatalogue::CachedData::ARCHIVE_ROUTES,              "archive_routes"             },
+  {RdbmsCatalogue::CachedData::STORAGE_CLASSES,             "storage_classes"            },
+  {RdbmsCatalogue::CachedData::ADMIN_USERS,                 "admin_users"                }
+};
+}  // anonymous namespace
+
 //------------------------------------------------------------------------------
 // constructor
 //------------------------------------------------------------------------------
@@ -43,14 +61,15 @@ RdbmsCatalogue::RdbmsCatalogue(log::Logger& log,
                                const uint64_t nbConns,
                                const uint64_t nbArchiveFileListingConns)
     : m_log(log),
+      m_login(login),
       m_connPool(std::make_shared<rdbms::ConnPool>(login, nbConns)),
       m_archiveFileListingConnPool(std::make_shared<rdbms::ConnPool>(login, nbArchiveFileListingConns)),
       m_schema(std::make_unique<RdbmsSchemaCatalogue>(m_log, m_connPool)),
-      m_adminUser(std::make_unique<RdbmsAdminUserCatalogue>(m_log, m_connPool)),
+      m_adminUser(std::make_unique<RdbmsAdminUserCatalogue>(m_log, m_connPool, this)),
       m_diskSystem(std::make_unique<RdbmsDiskSystemCatalogue>(m_log, m_connPool)),
       m_diskInstance(std::make_unique<RdbmsDiskInstanceCatalogue>(m_log, m_connPool)),
       m_diskInstanceSpace(std::make_unique<RdbmsDiskInstanceSpaceCatalogue>(m_log, m_connPool)),
-      m_archiveRoute(std::make_unique<RdbmsArchiveRouteCatalogue>(m_log, m_connPool)),
+      m_archiveRoute(std::make_unique<RdbmsArchiveRouteCatalogue>(m_log, m_connPool, this)),
       m_mountPolicy(std::make_unique<RdbmsMountPolicyCatalogue>(m_log, m_connPool, this)),
       m_requesterActivityMountRule(std::make_unique<RdbmsRequesterActivityMountRuleCatalogue>(m_log, m_connPool, this)),
       m_requesterMountRule(std::make_unique<RdbmsRequesterMountRuleCatalogue>(m_log, m_connPool, this)),
@@ -58,6 +77,13 @@ RdbmsCatalogue::RdbmsCatalogue(log::Logger& log,
       m_driveConfig(std::make_unique<RdbmsDriveConfigCatalogue>(m_log, m_connPool)),
       m_driveState(std::make_unique<RdbmsDriveStateCatalogue>(m_log, m_connPool)) {}
 
+//------------------------------------------------------------------------------
+// destructor
+//------------------------------------------------------------------------------
+RdbmsCatalogue::~RdbmsCatalogue() {
+  stopListeningToCacheInvalidationEvents();
+}
+
 const std::unique_ptr<SchemaCatalogue>& RdbmsCatalogue::Schema() const {
   return m_schema;
 }
@@ -146,4 +172,175 @@ const std::unique_ptr<DriveStateCatalogue>& RdbmsCatalogue::DriveState() const {
   return m_driveState;
 }
 
+//------------------------------------------------------------------------------
+// setReadReplica
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::setReadReplica(const rdbms::Login& login,
+                                    const uint64_t nbConns,
+                                    const uint64_t maxLagSecs,
+                                    const std::set<ReadReplicaQuery>& queries) {
+  m_readReplica = std::make_unique<RdbmsReadReplica>(m_log,
+                                                     login,
+                                                     nbConns,
+                                                     maxLagSecs,
+                                                     queries,
+                                                     [this](rdbms::Conn& conn) { return getReadReplicaLagSecs(conn); });
+}
+
+//------------------------------------------------------------------------------
+// getReadOnlyConnPool
+//------------------------------------------------------------------------------
+rdbms::ConnPool& RdbmsCatalogue::getReadOnlyConnPool(const ReadReplicaQuery query,
+                                                     rdbms::ConnPool& primaryConnPool) const {
+  if (m_readReplica) {
+    if (auto replicaConnPool = m_readReplica->getConnPool(query)) {
+      return *replicaConnPool;
+    }
+  }
+  return primaryConnPool;
+}
+
+//------------------------------------------------------------------------------
+// getReadReplicaLagSecs
+//------------------------------------------------------------------------------
+std::optional<uint64_t> RdbmsCatalogue::getReadReplicaLagSecs(rdbms::Conn&) const {
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// enableCacheInvalidationEvents
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::enableCacheInvalidationEvents(const time_t maxAgeSecs) {
+  if (!cacheInvalidationEventsSupported()) {
+    log::LogContext lc(m_log);
+    lc.log(log::INFO, "In RdbmsCatalogue::enableCacheInvalidationEvents(): cache invalidation events are not supported"
+                      " by the database, cached values will expire after a fixed time");
+    return;
+  }
+  m_cacheInvalidationListener = std::make_unique<RdbmsCacheInvalidationListener>(
+    m_log,
+    m_login,
+    [this](rdbms::Conn& conn) { listenToCacheInvalidationEvents(conn); },
+    [this](const std::set<std::string>& payloads) {
+      for (const auto& [data, payload] : kCachedDataPayloads) {
+        if (payloads.contains(payload)) {
+          invalidateLocalCachedData(data);
+        }
+      }
+    },
+    [this, maxAgeSecs](const bool listening) {
+      // Changes may have been missed while not listening
+      for (const auto& [data, payload] : kCachedDataPayloads) {
+        invalidateLocalCachedData(data);
+      }
+      setEventDrivenCachesMaxAgeSecs(listening ? std::optional<time_t>(maxAgeSecs) : std::nullopt);
+    });
+}
+
+//------------------------------------------------------------------------------
+// stopListeningToCacheInvalidationEvents
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::stopListeningToCacheInvalidationEvents() {
+  m_cacheInvalidationListener.reset();
+}
+
+//------------------------------------------------------------------------------
+// invalidateCachedData
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::invalidateCachedData(rdbms::Conn& conn, const CachedData data) const {
+  invalidateLocalCachedData(data);
+
+  if (!cacheInvalidationEventsSupported()) {
+    return;
+  }
+  try {
+    sendCacheInvalidationEvent(conn, kCachedDataPayloads.at(data));
+  } catch (exception::Exception& ex) {
+    // The modification itself has been committed, the other processes will
+    // see it once their cached values expire
+    log::LogContext lc(m_log);
+    log::ScopedParamContainer params(lc);
+    params.add("cachedData", kCachedDataPayloads.at(data)).add("exceptionMessage", ex.getMessageValue());
+    lc.log(log::WARNING, "In RdbmsCatalogue::invalidateCachedData(): failed to send cache invalidation event");
+  }
+}
+
+//------------------------------------------------------------------------------
+// invalidateLocalCachedData
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::invalidateLocalCachedData(const CachedData data) const {
+  switch (data) {
+    case CachedData::MOUNT_POLICIES:
+      m_groupMountPolicyCache.invalidate();
+      m_userMountPolicyCache.invalidate();
+      m_allMountPoliciesCache.invalidate();
+      break;
+    case CachedData::REQUESTER_MOUNT_RULES:
+      m_userMountPolicyCache.invalidate();
+      break;
+    case CachedData::REQUESTER_GROUP_MOUNT_RULES:
+      m_groupMountPolicyCache.invalidate();
+      break;
+    case CachedData::VIRTUAL_ORGANIZATIONS:
+      m_tapepoolVirtualOrganizationCache.invalidate();
+      break;
+    case CachedData::ARCHIVE_ROUTES:
+      static_cast<const RdbmsArchiveFileCatalogue&>(*m_archiveFile).m_tapeCopyToPoolCache.invalidate();
+      break;
+    case CachedData::STORAGE_CLASSES: {
+      const auto& archiveFileCatalogue = static_cast<const RdbmsArchiveFileCatalogue&>(*m_archiveFile);
+      archiveFileCatalogue.m_tapeCopyToPoolCache.invalidate();
+      archiveFileCatalogue.m_expectedNbArchiveRoutesCache.invalidate();
+      break;
+    }
+    case CachedData::ADMIN_USERS:
+      static_cast<const RdbmsAdminUserCatalogue&>(*m_adminUser).m_isAdminCache.invalidate();
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+// setEventDrivenCachesMaxAgeSecs
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::setEventDrivenCachesMaxAgeSecs(const std::optional<time_t>& maxAgeSecs) const {
+  const auto& archiveFileCatalogue = static_cast<const RdbmsArchiveFileCatalogue&>(*m_archiveFile);
+  const auto& adminUserCatalogue = static_cast<const RdbmsAdminUserCatalogue&>(*m_adminUser);
+  if (maxAgeSecs.has_value()) {
+    m_groupMountPolicyCache.setMaxAgeSecs(maxAgeSecs.value());
+    m_userMountPolicyCache.setMaxAgeSecs(maxAgeSecs.value());
+    m_allMountPoliciesCache.setMaxAgeSecs(maxAgeSecs.value());
+    m_tapepoolVirtualOrganizationCache.setMaxAgeSecs(maxAgeSecs.value());
+    archiveFileCatalogue.m_tapeCopyToPoolCache.setMaxAgeSecs(maxAgeSecs.value());
+    archiveFileCatalogue.m_expectedNbArchiveRoutesCache.setMaxAgeSecs(maxAgeSecs.value());
+    adminUserCatalogue.m_isAdminCache.setMaxAgeSecs(maxAgeSecs.value());
+  } else {
+    m_groupMountPolicyCache.resetMaxAgeSecs();
+    m_userMountPolicyCache.resetMaxAgeSecs();
+    m_allMountPoliciesCache.resetMaxAgeSecs();
+    m_tapepoolVirtualOrganizationCache.resetMaxAgeSecs();
+    archiveFileCatalogue.m_tapeCopyToPoolCache.resetMaxAgeSecs();
+    archiveFileCatalogue.m_expectedNbArchiveRoutesCache.resetMaxAgeSecs();
+    adminUserCatalogue.m_isAdminCache.resetMaxAgeSecs();
+  }
+}
+
+//------------------------------------------------------------------------------
+// cacheInvalidationEventsSupported
+//------------------------------------------------------------------------------
+bool RdbmsCatalogue::cacheInvalidationEventsSupported() const {
+  return false;
+}
+
+//------------------------------------------------------------------------------
+// listenToCacheInvalidationEvents
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::listenToCacheInvalidationEvents(rdbms::Conn&) const {
+  throw exception::NotImplementedException("The database does not support cache invalidation events");
+}
+
+//------------------------------------------------------------------------------
+// sendCacheInvalidationEvent
+//------------------------------------------------------------------------------
+void RdbmsCatalogue::sendCacheInvalidationEvent(rdbms::Conn&, const std::string&) const {}
+
 }  // namespace cta::catalogue
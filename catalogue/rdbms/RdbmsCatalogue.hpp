@@ -9,18 +9,22 @@
 #include "catalogue/Group.hpp"
 #include "catalogue/TimeBasedCache.hpp"
 #include "catalogue/User.hpp"
+#include "catalogue/rdbms/RdbmsCacheInvalidationListener.hpp"
+#include "catalogue/rdbms/RdbmsReadReplica.hpp"
 #include "common/dataStructures/MountPolicy.hpp"
 #include "common/dataStructures/VirtualOrganization.hpp"
 #include "common/log/Logger.hpp"
 #include "common/process/threading/Mutex.hpp"
+#include "rdbms/Login.hpp"
 
 #include <memory>
+#include <optional>
+#include <set>
 #include <string>
 
 namespace cta {
 
 namespace rdbms {
-class Login;
 class Conn;
 class ConnPool;
 }  // namespace rdbms
@@ -51,7 +55,24 @@ protected:
                  const uint64_t nbArchiveFileListingConns);
 
 public:
-  ~RdbmsCatalogue() override = default;
+  /**
+   * The kinds of cached data which are invalidated together.
+   */
+  enum class CachedData {
+    MOUNT_POLICIES,               ///< All the mount policy caches
+    REQUESTER_MOUNT_RULES,        ///< The cache of the mount policies of users
+    REQUESTER_GROUP_MOUNT_RULES,  ///< The cache of the mount policies of groups
+    VIRTUAL_ORGANIZATIONS,        ///< The cache of the virtual organizations of tape pools
+    ARCHIVE_ROUTES,               ///< The cache of the tape pools of the archive routes of storage classes
+    STORAGE_CLASSES,              ///< The caches of the archive routes and number of copies of storage classes
+    ADMIN_USERS                   ///< The cache of the administrator privileges of users
+  };
+
+  /**
+   * Destructor.  Stops listening to cache invalidation events before the
+   * catalogues the caches belong to are destroyed.
+   */
+  ~RdbmsCatalogue() override;
 
   const std::unique_ptr<SchemaCatalogue>& Schema() const override;
   const std::unique_ptr<AdminUserCatalogue>& AdminUser() const override;
@@ -76,10 +97,18 @@ public:
   const std::unique_ptr<DriveStateCatalogue>& DriveState() const override;
   const std::unique_ptr<ArchiveFileCatalogue>& ArchiveFile() const override;
 
+  void setReadReplica(const rdbms::Login& login,
+                      const uint64_t nbConns,
+                      const uint64_t maxLagSecs,
+                      const std::set<ReadReplicaQuery>& queries) override;
+
+  void enableCacheInvalidationEvents(const time_t maxAgeSecs) override;
+
 protected:
   friend class RdbmsFileRecycleLogCatalogue;
   friend class RdbmsTapeCatalogue;
   friend class RdbmsArchiveFileCatalogue;
+  friend class RdbmsTapeFileCatalogue;
   friend class OracleTapeFileCatalogue;
   friend class SqliteTapeFileCatalogue;
   /**
@@ -87,6 +116,11 @@ protected:
    */
   log::Logger& m_log;
 
+  /**
+   * The database login details.
+   */
+  const rdbms::Login m_login;
+
   /**
    * Mutex to be used to a take a global lock on the database.
    */
@@ -105,6 +139,73 @@ protected:
    */
   mutable std::shared_ptr<rdbms::ConnPool> m_archiveFileListingConnPool;
 
+  /**
+   * The read replica of the database used for some read-only queries, or
+   * nullptr if all the queries are run on the primary database.
+   */
+  std::unique_ptr<RdbmsReadReplica> m_readReplica;
+
+  /**
+   * Returns the pool of connections to be used for the specified read-only
+   * query: the pool of the read replica if the query is routed to the replica
+   * and the replica is fresh enough, else the specified pool of the primary.
+   *
+   * @param query The query.
+   * @param primaryConnPool The pool of connections to the primary database to
+   * be used if the query is not run on the replica.
+   * @return The pool of connections.
+   */
+  rdbms::ConnPool& getReadOnlyConnPool(const ReadReplicaQuery query, rdbms::ConnPool& primaryConnPool) const;
+
+  /**
+   * Returns the replication lag of a read replica of the database.
+   *
+   * The default implementation returns 0, for database technologies without
+   * replication.
+   *
+   * @param conn A connection to the replica.
+   * @return The replication lag in seconds or std::nullopt if it is unknown.
+   */
+  virtual std::optional<uint64_t> getReadReplicaLagSecs(rdbms::Conn& conn) const;
+
+  /**
+   * Invalidates the caches of the specified data in this process and notifies
+   * the other processes using the catalogue that the data has been modified.
+   *
+   * @param conn The connection used to modify the data, which sends the
+   * notification so that no other connection is taken from the pool.
+   * @param data The data which has been modified.
+   */
+  void invalidateCachedData(rdbms::Conn& conn, const CachedData data) const;
+
+  /**
+   * Returns true if the database technology can notify the other processes
+   * using the catalogue that cached data has been modified.
+   *
+   * The default implementation returns false.
+   */
+  virtual bool cacheInvalidationEventsSupported() const;
+
+  /**
+   * Subscribes the specified connection to the cache invalidation events.
+   *
+   * The default implementation throws exception::NotImplementedException.
+   *
+   * @param conn The connection.
+   */
+  virtual void listenToCacheInvalidationEvents(rdbms::Conn& conn) const;
+
+  /**
+   * Notifies the processes listening to cache invalidation events that the
+   * cached data identified by the specified payload has been modified.
+   *
+   * The default implementation does nothing.
+   *
+   * @param conn The database connection.
+   * @param payload The name of the modified cached data.
+   */
+  virtual void sendCacheInvalidationEvent(rdbms::Conn& conn, const std::string& payload) const;
+
   /**
    * Creates a temporary table from the list of disk file IDs provided in the search criteria.
    *
@@ -116,9 +217,12 @@ protected:
   createAndPopulateTempTableFxid(rdbms::Conn& conn,
                                  const std::optional<std::vector<std::string>>& diskFileIds) const = 0;
 
+  friend class RdbmsAdminUserCatalogue;
+  friend class RdbmsArchiveRouteCatalogue;
   friend class RdbmsMountPolicyCatalogue;
   friend class RdbmsRequesterActivityMountRuleCatalogue;
   friend class RdbmsRequesterMountRuleCatalogue;
+  friend class RdbmsStorageClassCatalogue;
   friend class RdbmsRequesterGroupMountRuleCatalogue;
 
   virtual std::string createAndPopulateTempTableArchiveFileIds(rdbms::Conn& conn,
@@ -126,17 +230,26 @@ protected:
   /**
    * Cached versions of mount policies for specific user groups.
    */
-  mutable TimeBasedCache<Group, std::optional<common::dataStructures::MountPolicy>> m_groupMountPolicyCache {10};
+  mutable TimeBasedCache<Group, std::optional<common::dataStructures::MountPolicy>> m_groupMountPolicyCache {
+    "group_mount_policy",
+    10,
+    10};
 
   /**
    * Cached versions of mount policies for specific users.
    */
-  mutable TimeBasedCache<User, std::optional<common::dataStructures::MountPolicy>> m_userMountPolicyCache {10};
+  mutable TimeBasedCache<User, std::optional<common::dataStructures::MountPolicy>> m_userMountPolicyCache {
+    "user_mount_policy",
+    10,
+    10};
 
   /**
    * Cached versions of all mount policies
    */
-  mutable TimeBasedCache<std::string, std::vector<common::dataStructures::MountPolicy>> m_allMountPoliciesCache {60};
+  mutable TimeBasedCache<std::string, std::vector<common::dataStructures::MountPolicy>> m_allMountPoliciesCache {
+    "all_mount_policies",
+    60,
+    60};
 
   friend class RdbmsVirtualOrganizationCatalogue;
   friend class RdbmsTapePoolCatalogue;
@@ -144,8 +257,38 @@ protected:
    * Cached versions of virtual organization for specific tapepools
    */
   mutable TimeBasedCache<std::string, common::dataStructures::VirtualOrganization> m_tapepoolVirtualOrganizationCache {
+    "tape_pool_virtual_organization",
+    60,
     60};
 
+  /**
+   * Listener of the cache invalidation events sent by the other processes, or
+   * nullptr if the caches above only expire their values after a fixed time.
+   * Declared after the caches so that it is destroyed first.
+   */
+  std::unique_ptr<RdbmsCacheInvalidationListener> m_cacheInvalidationListener;
+
+  /**
+   * Stops listening to the cache invalidation events.  Sub-classes overriding
+   * the methods used by the listener must call it in their destructor.
+   */
+  void stopListeningToCacheInvalidationEvents();
+
+  /**
+   * Invalidates the caches of the specified data in this process only.
+   *
+   * @param data The data which has been modified.
+   */
+  void invalidateLocalCachedData(const CachedData data) const;
+
+  /**
+   * Sets the maximum age of the values of the caches invalidated by events.
+   *
+   * @param maxAgeSecs The maximum age in seconds, or std::nullopt to restore
+   * the fixed maximum ages used when not listening to the events.
+   */
+  void setEventDrivenCachesMaxAgeSecs(const std::optional<time_t>& maxAgeSecs) const;
+
 protected:
   std::unique_ptr<SchemaCatalogue> m_schema;
   std::unique_ptr<AdminUserCatalogue> m_adminUser;
@@ -9,10 +9,33 @@
 #include "common/exception/Exception.hpp"
 #include "common/exception/LostDatabaseConnection.hpp"
 #include "common/exception/UserError.hpp"
+#include "rdbms/RowSchema.hpp"
 
 namespace cta::catalogue {
 
 namespace {
+/**
+ * The columns read from each row of the result set
+ */
+constexpr rdbms::RowSchema kArchiveFileColumns {
+  "ARCHIVE_FILE_ID",
+  "DISK_INSTANCE_NAME",
+  "DISK_FILE_ID",
+  "DISK_FILE_UID",
+  "DISK_FILE_GID",
+  "SIZE_IN_BYTES",
+  "CHECKSUM_BLOB",
+  "CHECKSUM_ADLER32",
+  "STORAGE_CLASS_NAME",
+  "ARCHIVE_FILE_CREATION_TIME",
+  "RECONCILIATION_TIME",
+  "VID",
+  "FSEQ",
+  "BLOCK_ID",
+  "LOGICAL_SIZE_IN_BYTES",
+  "COPY_NB",
+  "TAPE_FILE_CREATION_TIME"};
+
 /**
    * Populates an ArchiveFile object with the current column values of the
    * specified result set.
@@ -21,29 +44,30 @@ namespace {
    * @return The populated ArchiveFile object.
    */
 common::dataStructures::ArchiveFile populateArchiveFile(const rdbms::Rset& rset) {
+  const auto row = rset.columns<kArchiveFileColumns>();
   common::dataStructures::ArchiveFile archiveFile;
 
-  archiveFile.archiveFileID = rset.columnUint64("ARCHIVE_FILE_ID");
-  archiveFile.diskInstance = rset.columnString("DISK_INSTANCE_NAME");
-  archiveFile.diskFileId = rset.columnString("DISK_FILE_ID");
-  archiveFile.diskFileInfo.owner_uid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_UID"));
-  archiveFile.diskFileInfo.gid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_GID"));
-  archiveFile.fileSize = rset.columnUint64("SIZE_IN_BYTES");
-  archiveFile.checksumBlob.deserializeOrSetAdler32(rset.columnBlob("CHECKSUM_BLOB"),
-                                                   static_cast<uint32_t>(rset.columnUint64("CHECKSUM_ADLER32")));
-  archiveFile.storageClass = rset.columnString("STORAGE_CLASS_NAME");
-  archiveFile.creationTime = rset.columnUint64("ARCHIVE_FILE_CREATION_TIME");
-  archiveFile.reconciliationTime = rset.columnUint64("RECONCILIATION_TIME");
+  archiveFile.archiveFileID = row.columnUint64("ARCHIVE_FILE_ID");
+  archiveFile.diskInstance = row.columnString("DISK_INSTANCE_NAME");
+  archiveFile.diskFileId = row.columnString("DISK_FILE_ID");
+  archiveFile.diskFileInfo.owner_uid = static_cast<uint32_t>(row.columnUint64("DISK_FILE_UID"));
+  archiveFile.diskFileInfo.gid = static_cast<uint32_t>(row.columnUint64("DISK_FILE_GID"));
+  archiveFile.fileSize = row.columnUint64("SIZE_IN_BYTES");
+  archiveFile.checksumBlob.deserializeOrSetAdler32(row.columnBlob("CHECKSUM_BLOB"),
+                                                   static_cast<uint32_t>(row.columnUint64("CHECKSUM_ADLER32")));
+  archiveFile.storageClass = row.columnString("STORAGE_CLASS_NAME");
+  archiveFile.creationTime = row.columnUint64("ARCHIVE_FILE_CREATION_TIME");
+  archiveFile.reconciliationTime = row.columnUint64("RECONCILIATION_TIME");
 
   // If there is a tape file
-  if (!rset.columnIsNull("VID")) {
+  if (!row.columnIsNull("VID")) {
     common::dataStructures::TapeFile tapeFile;
-    tapeFile.vid = rset.columnString("VID");
-    tapeFile.fSeq = rset.columnUint64("FSEQ");
-    tapeFile.blockId = rset.columnUint64("BLOCK_ID");
-    tapeFile.fileSize = rset.columnUint64("LOGICAL_SIZE_IN_BYTES");
-    tapeFile.copyNb = static_cast<uint8_t>(rset.columnUint64("COPY_NB"));
-    tapeFile.creationTime = rset.columnUint64("TAPE_FILE_CREATION_TIME");
+    tapeFile.vid = row.columnString("VID");
+    tapeFile.fSeq = row.columnUint64("FSEQ");
+    tapeFile.blockId = row.columnUint64("BLOCK_ID");
+    tapeFile.fileSize = row.columnUint64("LOGICAL_SIZE_IN_BYTES");
+    tapeFile.copyNb = static_cast<uint8_t>(row.columnUint64("COPY_NB"));
+    tapeFile.creationTime = row.columnUint64("TAPE_FILE_CREATION_TIME");
     tapeFile.checksumBlob = archiveFile.checksumBlob;  // Duplicated for convenience
     archiveFile.tapeFiles.push_back(tapeFile);
   }
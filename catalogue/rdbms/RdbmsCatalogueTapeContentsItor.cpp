@@ -10,10 +10,37 @@
 #include "common/exception/LostDatabaseConnection.hpp"
 #include "common/exception/UserError.hpp"
 #include "common/log/LogContext.hpp"
+#include "rdbms/Rset.hpp"
+#include "rdbms/RowSchema.hpp"
+#include "rdbms/Stmt.hpp"
+
+#include <optional>
 
 namespace cta::catalogue {
 
 namespace {
+/**
+ * The columns read from each row of the result set
+ */
+constexpr rdbms::RowSchema kArchiveFileColumns {
+  "ARCHIVE_FILE_ID",
+  "DISK_INSTANCE_NAME",
+  "DISK_FILE_ID",
+  "DISK_FILE_UID",
+  "DISK_FILE_GID",
+  "SIZE_IN_BYTES",
+  "CHECKSUM_BLOB",
+  "CHECKSUM_ADLER32",
+  "STORAGE_CLASS_NAME",
+  "ARCHIVE_FILE_CREATION_TIME",
+  "RECONCILIATION_TIME",
+  "VID",
+  "FSEQ",
+  "BLOCK_ID",
+  "LOGICAL_SIZE_IN_BYTES",
+  "COPY_NB",
+  "TAPE_FILE_CREATION_TIME"};
+
 /**
    * Populates an ArchiveFile object with the current column values of the
    * specified result set.
@@ -22,27 +49,28 @@ namespace {
    * @return The populated ArchiveFile object.
    */
 common::dataStructures::ArchiveFile rsetToArchiveFile(const rdbms::Rset& rset) {
+  const auto row = rset.columns<kArchiveFileColumns>();
   common::dataStructures::ArchiveFile archiveFile;
 
-  archiveFile.archiveFileID = rset.columnUint64("ARCHIVE_FILE_ID");
-  archiveFile.diskInstance = rset.columnString("DISK_INSTANCE_NAME");
-  archiveFile.diskFileId = rset.columnString("DISK_FILE_ID");
-  archiveFile.diskFileInfo.owner_uid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_UID"));
-  archiveFile.diskFileInfo.gid = static_cast<uint32_t>(rset.columnUint64("DISK_FILE_GID"));
-  archiveFile.fileSize = rset.columnUint64("SIZE_IN_BYTES");
-  archiveFile.checksumBlob.deserializeOrSetAdler32(rset.columnBlob("CHECKSUM_BLOB"),
-                                                   static_cast<uint32_t>(rset.columnUint64("CHECKSUM_ADLER32")));
-  archiveFile.storageClass = rset.columnString("STORAGE_CLASS_NAME");
-  archiveFile.creationTime = rset.columnUint64("ARCHIVE_FILE_CREATION_TIME");
-  archiveFile.reconciliationTime = rset.columnUint64("RECONCILIATION_TIME");
+  archiveFile.archiveFileID = row.columnUint64("ARCHIVE_FILE_ID");
+  archiveFile.diskInstance = row.columnString("DISK_INSTANCE_NAME");
+  archiveFile.diskFileId = row.columnString("DISK_FILE_ID");
+  archiveFile.diskFileInfo.owner_uid = static_cast<uint32_t>(row.columnUint64("DISK_FILE_UID"));
+  archiveFile.diskFileInfo.gid = static_cast<uint32_t>(row.columnUint64("DISK_FILE_GID"));
+  archiveFile.fileSize = row.columnUint64("SIZE_IN_BYTES");
+  archiveFile.checksumBlob.deserializeOrSetAdler32(row.columnBlob("CHECKSUM_BLOB"),
+                                                   static_cast<uint32_t>(row.columnUint64("CHECKSUM_ADLER32")));
+  archiveFile.storageClass = row.columnString("STORAGE_CLASS_NAME");
+  archiveFile.creationTime = row.columnUint64("ARCHIVE_FILE_CREATION_TIME");
+  archiveFile.reconciliationTime = row.columnUint64("RECONCILIATION_TIME");
 
   common::dataStructures::TapeFile tapeFile;
-  tapeFile.vid = rset.columnString("VID");
-  tapeFile.fSeq = rset.columnUint64("FSEQ");
-  tapeFile.blockId = rset.columnUint64("BLOCK_ID");
-  tapeFile.fileSize = rset.columnUint64("LOGICAL_SIZE_IN_BYTES");
-  tapeFile.copyNb = static_cast<uint8_t>(rset.columnUint64("COPY_NB"));
-  tapeFile.creationTime = rset.columnUint64("TAPE_FILE_CREATION_TIME");
+  tapeFile.vid = row.columnString("VID");
+  tapeFile.fSeq = row.columnUint64("FSEQ");
+  tapeFile.blockId = row.columnUint64("BLOCK_ID");
+  tapeFile.fileSize = row.columnUint64("LOGICAL_SIZE_IN_BYTES");
+  tapeFile.copyNb = static_cast<uint8_t>(row.columnUint64("COPY_NB"));
+  tapeFile.creationTime = row.columnUint64("TAPE_FILE_CREATION_TIME");
   tapeFile.checksumBlob = archiveFile.checksumBlob;  // Duplicated for convenience
 
   archiveFile.tapeFiles.push_back(tapeFile);
@@ -56,14 +84,53 @@ common::dataStructures::ArchiveFile rsetToArchiveFile(const rdbms::Rset& rset) {
 //------------------------------------------------------------------------------
 RdbmsCatalogueTapeContentsItor::RdbmsCatalogueTapeContentsItor(log::Logger& log,
                                                                rdbms::ConnPool& connPool,
-                                                               const std::string& vid)
+                                                               const std::string& vid,
+                                                               const uint64_t pageSize)
     : m_log(log),
-      m_vid(vid) {
+      m_connPool(connPool),
+      m_vid(vid),
+      m_pageSize(pageSize) {
   if (vid.empty()) {
     throw exception::Exception("vid is an empty string");
   }
+  if (0 == pageSize) {
+    throw exception::Exception("pageSize must be greater than 0");
+  }
+
+  fetchNextPageIfNeeded();
+}
+
+//------------------------------------------------------------------------------
+// fetchNextPageIfNeeded
+//------------------------------------------------------------------------------
+void RdbmsCatalogueTapeContentsItor::fetchNextPageIfNeeded() {
+  while (m_page.empty() && !m_endOfTape) {
+    try {
+      auto conn = m_connPool.getConn();
+      fetchPage(conn);
+    } catch (exception::LostDatabaseConnection& le) {
+      // The page resumes from the last tape file read so it can be read again
+      // using a new connection
+      log::LogContext lc(m_log);
+      log::ScopedParamContainer params(lc);
+      params.add("tapeVid", m_vid).add("lastFSeq", m_lastFSeq).add("exceptionMessage", le.getMessageValue());
+      lc.log(log::WARNING, "In RdbmsCatalogueTapeContentsItor::fetchNextPageIfNeeded(): lost database connection,"
+                           " reading the page of tape files again");
+      m_page.clear();
+      auto conn = m_connPool.getConn();
+      fetchPage(conn);
+    }
+  }
+}
 
-  std::string sql = R"SQL(
+//------------------------------------------------------------------------------
+// fetchPage
+//------------------------------------------------------------------------------
+void RdbmsCatalogueTapeContentsItor::fetchPage(rdbms::Conn& conn) {
+  // Bounding the page by a window of fSeqs rather than by a number of rows
+  // keeps the query portable across database types.  A window contains at
+  // most pageSize tape files because (VID, FSEQ) is unique.
+  const char* const sql = R"SQL(
     SELECT /*+ INDEX (TAPE_FILE TAPE_FILE_VID_IDX) */
       ARCHIVE_FILE.ARCHIVE_FILE_ID AS ARCHIVE_FILE_ID,
       ARCHIVE_FILE.DISK_INSTANCE_NAME AS DISK_INSTANCE_NAME,
@@ -94,38 +161,46 @@ RdbmsCatalogueTapeContentsItor::RdbmsCatalogueTapeContentsItor(log::Logger& log,
     INNER JOIN TAPE_POOL ON
       TAPE.TAPE_POOL_ID = TAPE_POOL.TAPE_POOL_ID
     WHERE
-      TAPE_FILE.VID = :VID
-  )SQL";
-
-  sql += R"SQL(
+      TAPE_FILE.VID = :VID AND
+      TAPE_FILE.FSEQ > :AFTER_FSEQ AND
+      TAPE_FILE.FSEQ <= :LAST_FSEQ
     ORDER BY FSEQ
   )SQL";
-
-  m_conn = connPool.getConn();
-  m_stmt = m_conn.createStmt(sql);
-
-  m_stmt.bindString(":VID", vid);
-  m_rset = m_stmt.executeQuery();
-  m_rsetIsEmpty = !m_rset.next();
-  if (m_rsetIsEmpty) {
-    releaseDbResources();
+  {
+    auto stmt = conn.createStmt(sql);
+    stmt.bindString(":VID", m_vid);
+    stmt.bindUint64(":AFTER_FSEQ", m_lastFSeq);
+    stmt.bindUint64(":LAST_FSEQ", m_lastFSeq + m_pageSize);
+    auto rset = stmt.executeQuery();
+    while (rset.next()) {
+      m_page.push_back(rsetToArchiveFile(rset));
+    }
+  }
+  if (!m_page.empty()) {
+    m_lastFSeq = m_page.back().tapeFiles.front().fSeq;
+    return;
   }
-}
-
-//------------------------------------------------------------------------------
-// destructor
-//------------------------------------------------------------------------------
-RdbmsCatalogueTapeContentsItor::~RdbmsCatalogueTapeContentsItor() {
-  releaseDbResources();
-}
 
-//------------------------------------------------------------------------------
-// releaseDbResources
-//------------------------------------------------------------------------------
-void RdbmsCatalogueTapeContentsItor::releaseDbResources() noexcept {
-  m_rset.reset();
-  m_stmt.reset();
-  m_conn.reset();
+  // The window is empty, skip to the next tape file if there is one
+  const char* const nextFSeqSql = R"SQL(
+    SELECT
+      MIN(TAPE_FILE.FSEQ) AS NEXT_FSEQ
+    FROM
+      TAPE_FILE
+    WHERE
+      TAPE_FILE.VID = :VID AND
+      TAPE_FILE.FSEQ > :AFTER_FSEQ
+  )SQL";
+  auto stmt = conn.createStmt(nextFSeqSql);
+  stmt.bindString(":VID", m_vid);
+  stmt.bindUint64(":AFTER_FSEQ", m_lastFSeq);
+  auto rset = stmt.executeQuery();
+  const auto nextFSeq = rset.next() ? rset.columnOptionalUint64("NEXT_FSEQ") : std::nullopt;
+  if (nextFSeq.has_value()) {
+    m_lastFSeq = nextFSeq.value() - 1;
+  } else {
+    m_endOfTape = true;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -133,7 +208,8 @@ void RdbmsCatalogueTapeContentsItor::releaseDbResources() noexcept {
 //------------------------------------------------------------------------------
 bool RdbmsCatalogueTapeContentsItor::hasMore() {
   m_hasMoreHasBeenCalled = true;
-  return !m_rsetIsEmpty;
+  fetchNextPageIfNeeded();
+  return !m_page.empty();
 }
 
 //------------------------------------------------------------------------------
@@ -145,17 +221,13 @@ common::dataStructures::ArchiveFile RdbmsCatalogueTapeContentsItor::next() {
   }
   m_hasMoreHasBeenCalled = false;
 
-  // If there are no more rows in the result set
-  if (m_rsetIsEmpty) {
+  // If there are no more tape files
+  if (m_page.empty()) {
     throw exception::Exception("next() was called with no more rows in the result set");
   }
 
-  auto archiveFile = rsetToArchiveFile(m_rset);
-  m_rsetIsEmpty = !m_rset.next();
-  if (m_rsetIsEmpty) {
-    releaseDbResources();
-  }
-
+  auto archiveFile = std::move(m_page.front());
+  m_page.pop_front();
   return archiveFile;
 }
 
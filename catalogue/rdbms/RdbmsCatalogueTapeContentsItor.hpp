@@ -12,29 +12,44 @@
 #include "common/dataStructures/ArchiveFile.hpp"
 #include "common/log/Logger.hpp"
 #include "rdbms/ConnPool.hpp"
-#include "rdbms/Rset.hpp"
-#include "rdbms/Stmt.hpp"
+
+#include <list>
+#include <stdint.h>
 
 namespace cta::catalogue {
 
 /**
  * Iteratess across the tape files that make up the contents of a given tape.
+ *
+ * The tape files are read from the database one page at a time, each page
+ * being the tape files within the next window of pageSize fSeqs after the last
+ * tape file read.  A database connection is only borrowed from the pool for
+ * the time it takes to read a page, so a client that is slow to consume the
+ * listing of a full tape neither holds a connection nor keeps a transaction
+ * open, and at most one page of tape files is held in memory.  Because each
+ * page resumes from the (vid, fSeq) of the last tape file read, a page whose
+ * database connection is lost is simply read again.
  */
 class RdbmsCatalogueTapeContentsItor : public ArchiveFileItor::Impl {
 public:
+  /**
+   * The default maximum number of tape files read from the database at once.
+   */
+  static constexpr uint64_t DEFAULT_PAGE_SIZE = 1000;
+
   /**
    * Constructor.
    *
    * @param log Object representing the API to the CTA logging system.
    * @param connPool The database connection pool.
    * @param vid The volume identifier of the tape.
+   * @param pageSize The maximum number of tape files read from the database at
+   * once.
    */
-  RdbmsCatalogueTapeContentsItor(log::Logger& log, rdbms::ConnPool& connPool, const std::string& vid);
-
-  /**
-   * Destructor.
-   */
-  ~RdbmsCatalogueTapeContentsItor() override;
+  RdbmsCatalogueTapeContentsItor(log::Logger& log,
+                                 rdbms::ConnPool& connPool,
+                                 const std::string& vid,
+                                 const uint64_t pageSize = DEFAULT_PAGE_SIZE);
 
   /**
    * Returns true if a call to next would return another archive file.
@@ -52,15 +67,30 @@ private:
    */
   log::Logger& m_log;
 
+  /**
+   * The database connection pool.
+   */
+  rdbms::ConnPool& m_connPool;
+
   /**
    * The volume identifier of the tape.
    */
   std::string m_vid;
 
   /**
-   * True if the result set is empty.
+   * The maximum number of tape files read from the database at once.
    */
-  bool m_rsetIsEmpty = true;
+  const uint64_t m_pageSize;
+
+  /**
+   * The fSeq of the last tape file read from the database.
+   */
+  uint64_t m_lastFSeq = 0;
+
+  /**
+   * True if all the tape files of the tape have been read from the database.
+   */
+  bool m_endOfTape = false;
 
   /**
    * True if hasMore() has been called and the corresponding call to next() has
@@ -72,26 +102,26 @@ private:
   bool m_hasMoreHasBeenCalled = false;
 
   /**
-   * The database connection.
-   */
-  rdbms::Conn m_conn;
-
-  /**
-   * The database statement.
+   * The tape files read from the database and not yet returned by next().
    */
-  rdbms::Stmt m_stmt;
+  std::list<common::dataStructures::ArchiveFile> m_page;
 
   /**
-   * The result set of archive files that is to be iterated over.
+   * Reads the next non-empty page of tape files from the database, unless the
+   * current page has not been fully consumed or the end of the tape has been
+   * reached.
    */
-  rdbms::Rset m_rset;
+  void fetchNextPageIfNeeded();
 
   /**
-   * Releases the database resources.
+   * Reads into m_page the tape files within the window of fSeqs following
+   * m_lastFSeq.  If the window is empty then m_lastFSeq is moved to just
+   * before the next tape file of the tape, or m_endOfTape is set if there is
+   * none.
    *
-   * This method is idempotent.
+   * @param conn The database connection.
    */
-  void releaseDbResources() noexcept;
+  void fetchPage(rdbms::Conn& conn);
 
 };  // class RdbmsCatalogueTapeContentsItor
 
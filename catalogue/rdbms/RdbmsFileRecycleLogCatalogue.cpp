@@ -37,7 +37,18 @@ RdbmsFileRecycleLogCatalogue::RdbmsFileRecycleLogCatalogue(log::Logger& log,
 
 FileRecycleLogItor
 RdbmsFileRecycleLogCatalogue::getFileRecycleLogItor(const RecycleTapeFileSearchCriteria& searchCriteria) const {
-  auto conn = m_rdbmsCatalogue->m_archiveFileListingConnPool->getConn();
+  return getFileRecycleLogItor(searchCriteria, true);
+}
+
+FileRecycleLogItor
+RdbmsFileRecycleLogCatalogue::getFileRecycleLogItor(const RecycleTapeFileSearchCriteria& searchCriteria,
+                                                    const bool allowReadReplica) const {
+  // Populating the temporary table of disk file IDs requires a writable database
+  auto& primaryConnPool = *m_rdbmsCatalogue->m_archiveFileListingConnPool;
+  auto& connPool = allowReadReplica && !searchCriteria.diskFileIds.has_value() ?
+                     m_rdbmsCatalogue->getReadOnlyConnPool(ReadReplicaQuery::FILE_RECYCLE_LOG_LISTING, primaryConnPool) :
+                     primaryConnPool;
+  auto conn = connPool.getConn();
   checkRecycleTapeFileSearchCriteria(conn, searchCriteria);
   const auto tempDiskFxidsTableName =
     m_rdbmsCatalogue->createAndPopulateTempTableFxid(conn, searchCriteria.diskFileIds);
@@ -48,7 +59,8 @@ RdbmsFileRecycleLogCatalogue::getFileRecycleLogItor(const RecycleTapeFileSearchC
 void RdbmsFileRecycleLogCatalogue::restoreFileInRecycleLog(const RecycleTapeFileSearchCriteria& searchCriteria,
                                                            const std::string& newFid) {
   log::LogContext lc(m_log);
-  auto fileRecycleLogitor = getFileRecycleLogItor(searchCriteria);
+  // The files are about to be restored, so read them from the primary rather than from a possibly stale replica
+  auto fileRecycleLogitor = getFileRecycleLogItor(searchCriteria, false);
   auto conn = m_connPool->getConn();
   rdbms::AutoRollback autoRollback(conn);
   restoreEntryInRecycleLog(conn, fileRecycleLogitor, newFid, lc);
@@ -120,6 +120,17 @@ protected:
   RdbmsCatalogue* m_rdbmsCatalogue;
 
 private:
+  /**
+   * Returns the files in the file recycle log matching the search criteria.
+   *
+   * @param searchCriteria The search criteria.
+   * @param allowReadReplica True if the files may be read from the read
+   * replica of the database.
+   * @return The files.
+   */
+  FileRecycleLogItor getFileRecycleLogItor(const RecycleTapeFileSearchCriteria& searchCriteria,
+                                           const bool allowReadReplica) const;
+
   /**
    * Throws a UserError exception if the specified searchCriteria is not valid
    * due to a user error.
@@ -98,9 +98,7 @@ void RdbmsMountPolicyCatalogue::createMountPolicy(const common::dataStructures::
 
   stmt.executeNonQuery();
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 void RdbmsMountPolicyCatalogue::deleteMountPolicy(const std::string& name) {
@@ -116,9 +114,7 @@ void RdbmsMountPolicyCatalogue::deleteMountPolicy(const std::string& name) {
     throw exception::UserError(std::string("Cannot delete mount policy ") + name + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 std::vector<common::dataStructures::MountPolicy> RdbmsMountPolicyCatalogue::getMountPolicies() const {
@@ -275,9 +271,7 @@ void RdbmsMountPolicyCatalogue::modifyMountPolicyArchivePriority(const common::d
     throw exception::UserError(std::string("Cannot modify mount policy ") + name + " because they do not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 void RdbmsMountPolicyCatalogue::modifyMountPolicyArchiveMinRequestAge(
@@ -307,9 +301,7 @@ void RdbmsMountPolicyCatalogue::modifyMountPolicyArchiveMinRequestAge(
     throw exception::UserError(std::string("Cannot modify mount policy ") + name + " because they do not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 void RdbmsMountPolicyCatalogue::modifyMountPolicyRetrievePriority(const common::dataStructures::SecurityIdentity& admin,
@@ -338,9 +330,7 @@ void RdbmsMountPolicyCatalogue::modifyMountPolicyRetrievePriority(const common::
     throw exception::UserError(std::string("Cannot modify mount policy ") + name + " because they do not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 void RdbmsMountPolicyCatalogue::modifyMountPolicyRetrieveMinRequestAge(
@@ -370,9 +360,7 @@ void RdbmsMountPolicyCatalogue::modifyMountPolicyRetrieveMinRequestAge(
     throw exception::UserError(std::string("Cannot modify mount policy ") + name + " because they do not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 void RdbmsMountPolicyCatalogue::modifyMountPolicyComment(const common::dataStructures::SecurityIdentity& admin,
@@ -402,9 +390,7 @@ void RdbmsMountPolicyCatalogue::modifyMountPolicyComment(const common::dataStruc
     throw exception::UserError(std::string("Cannot modify mount policy ") + name + " because they do not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
-  m_rdbmsCatalogue->m_allMountPoliciesCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::MOUNT_POLICIES);
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "catalogue/rdbms/RdbmsReadReplica.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/LogContext.hpp"
+#include "common/process/threading/MutexLocker.hpp"
+
+namespace cta::catalogue {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+RdbmsReadReplica::RdbmsReadReplica(log::Logger& log,
+                                   const rdbms::Login& login,
+                                   const uint64_t nbConns,
+                                   const uint64_t maxLagSecs,
+                                   const std::set<ReadReplicaQuery>& queries,
+                                   GetLagSecs getLagSecs,
+                                   const time_t lagCheckPeriodSecs)
+    : m_log(log),
+      m_connPool(login, nbConns),
+      m_lagCheckConnPool(login, 1),
+      m_maxLagSecs(maxLagSecs),
+      m_queries(queries),
+      m_getLagSecs(std::move(getLagSecs)),
+      m_lagCheckPeriodSecs(lagCheckPeriodSecs) {}
+
+//------------------------------------------------------------------------------
+// getConnPool
+//------------------------------------------------------------------------------
+rdbms::ConnPool* RdbmsReadReplica::getConnPool(const ReadReplicaQuery query) {
+  if (!m_queries.contains(query) || !isFresh()) {
+    return nullptr;
+  }
+  return &m_connPool;
+}
+
+//------------------------------------------------------------------------------
+// isFresh
+//------------------------------------------------------------------------------
+bool RdbmsReadReplica::isFresh() {
+  const time_t now = ::time(nullptr);
+  bool firstCheck;
+  {
+    threading::MutexLocker locker(m_mutex);
+    firstCheck = 0 == m_lastLagCheckTime;
+    // While the lag is being checked, the other callers use the result of the previous check
+    if (m_lagCheckInProgress || (!firstCheck && now - m_lastLagCheckTime < m_lagCheckPeriodSecs)) {
+      return m_fresh;
+    }
+    m_lastLagCheckTime = now;
+    m_lagCheckInProgress = true;
+  }
+
+  log::LogContext lc(m_log);
+  std::optional<uint64_t> lagSecs;
+  try {
+    auto conn = m_lagCheckConnPool.getConn();
+    lagSecs = m_getLagSecs(conn);
+  } catch (exception::Exception& ex) {
+    log::ScopedParamContainer params(lc);
+    params.add("exceptionMessage", ex.getMessageValue());
+    lc.log(log::WARNING, "In RdbmsReadReplica::isFresh(): failed to get the replication lag of the read replica");
+  } catch (...) {
+    threading::MutexLocker locker(m_mutex);
+    m_lagCheckInProgress = false;
+    throw;
+  }
+
+  const bool fresh = lagSecs.has_value() && lagSecs.value() <= m_maxLagSecs;
+  bool wasFresh;
+  {
+    threading::MutexLocker locker(m_mutex);
+    wasFresh = m_fresh;
+    m_fresh = fresh;
+    m_lagCheckInProgress = false;
+  }
+  if (firstCheck || fresh != wasFresh) {
+    log::ScopedParamContainer params(lc);
+    params.add("lagSecs", lagSecs.has_value() ? std::to_string(lagSecs.value()) : "unknown")
+      .add("maxLagSecs", m_maxLagSecs);
+    if (fresh) {
+      lc.log(log::INFO, "In RdbmsReadReplica::isFresh(): routing read-only queries to the read replica");
+    } else {
+      lc.log(log::WARNING, "In RdbmsReadReplica::isFresh(): read replica is stale, routing read-only queries to the primary");
+    }
+  }
+  return fresh;
+}
+
+}  // namespace cta::catalogue
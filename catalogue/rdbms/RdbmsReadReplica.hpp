@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "catalogue/ReadReplicaQuery.hpp"
+#include "common/log/Logger.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "rdbms/ConnPool.hpp"
+
+#include <functional>
+#include <optional>
+#include <set>
+#include <stdint.h>
+#include <time.h>
+
+namespace cta::catalogue {
+
+/**
+ * A read replica of the catalogue database used for heavy read-only queries.
+ *
+ * Listings requested by operators and monitoring, such as "tape ls" or
+ * "tapefile ls", can take seconds and compete with the archive and retrieve
+ * workflows when run on the primary database.  The queries selected in the
+ * configuration are run on the replica instead, as long as the replication
+ * lag of the replica is within the configured staleness bound.  The lag is
+ * checked at most once per check period, using a dedicated connection so that
+ * the check never waits for a long listing to end.  When the lag is unknown
+ * or exceeds the bound, the queries fall back to the primary.
+ */
+class RdbmsReadReplica {
+public:
+  /**
+   * Function returning the replication lag of the replica in seconds, or
+   * std::nullopt if the lag cannot be determined.
+   */
+  using GetLagSecs = std::function<std::optional<uint64_t>(rdbms::Conn& conn)>;
+
+  /**
+   * Constructor.
+   *
+   * @param log Object representing the API to the CTA logging system.
+   * @param login The database login details of the replica.
+   * @param nbConns The maximum number of concurrent connections to the replica.
+   * @param maxLagSecs The maximum replication lag in seconds beyond which the
+   * queries are run on the primary.
+   * @param queries The queries to be run on the replica.
+   * @param getLagSecs Function returning the replication lag of the replica.
+   * @param lagCheckPeriodSecs The minimum time between two checks of the lag.
+   */
+  RdbmsReadReplica(log::Logger& log,
+                   const rdbms::Login& login,
+                   const uint64_t nbConns,
+                   const uint64_t maxLagSecs,
+                   const std::set<ReadReplicaQuery>& queries,
+                   GetLagSecs getLagSecs,
+                   const time_t lagCheckPeriodSecs = 10);
+
+  /**
+   * Returns the pool of connections to the replica if the specified query is
+   * routed to the replica and the replica is fresh enough.
+   *
+   * @param query The query.
+   * @return The pool of connections to the replica or nullptr if the query
+   * should be run on the primary.
+   */
+  rdbms::ConnPool* getConnPool(const ReadReplicaQuery query);
+
+private:
+  /**
+   * Returns true if the replication lag was within the staleness bound when
+   * last checked, checking it again if the check period has elapsed.  The
+   * lag is queried without holding m_mutex, so that the callers arriving
+   * during the query are not blocked by the database round trip.
+   */
+  bool isFresh();
+
+  log::Logger& m_log;
+
+  /**
+   * The pool of connections to the replica used by the routed queries.
+   */
+  rdbms::ConnPool m_connPool;
+
+  /**
+   * The pool of the single connection used to check the replication lag.
+   */
+  rdbms::ConnPool m_lagCheckConnPool;
+
+  const uint64_t m_maxLagSecs;
+  const std::set<ReadReplicaQuery> m_queries;
+  const GetLagSecs m_getLagSecs;
+  const time_t m_lagCheckPeriodSecs;
+
+  /** Protects the members below */
+  threading::Mutex m_mutex;
+  time_t m_lastLagCheckTime = 0;
+  bool m_lagCheckInProgress = false;
+  bool m_fresh = false;
+};
+
+}  // namespace cta::catalogue
@@ -175,7 +175,7 @@ void RdbmsRequesterActivityMountRuleCatalogue::createRequesterActivityMountRule(
 
   stmt.executeNonQuery();
 
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_MOUNT_RULES);
 }
 
 std::vector<common::dataStructures::RequesterActivityMountRule>
@@ -250,7 +250,7 @@ void RdbmsRequesterActivityMountRuleCatalogue::deleteRequesterActivityMountRule(
                                + " because the rule does not exist");
   }
 
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_MOUNT_RULES);
 }
 
 }  // namespace cta::catalogue
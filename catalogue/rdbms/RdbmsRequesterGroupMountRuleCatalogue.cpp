@@ -169,7 +169,7 @@ void RdbmsRequesterGroupMountRuleCatalogue::createRequesterGroupMountRule(
 
   stmt.executeNonQuery();
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_GROUP_MOUNT_RULES);
 }
 
 std::vector<common::dataStructures::RequesterGroupMountRule>
@@ -239,7 +239,7 @@ void RdbmsRequesterGroupMountRuleCatalogue::deleteRequesterGroupMountRule(const
                                + requesterGroupName + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_groupMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_GROUP_MOUNT_RULES);
 }
 
 }  // namespace cta::catalogue
@@ -165,7 +165,7 @@ void RdbmsRequesterMountRuleCatalogue::createRequesterMountRule(const common::da
 
   stmt.executeNonQuery();
 
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_MOUNT_RULES);
 }
 
 std::vector<common::dataStructures::RequesterMountRule>
@@ -234,7 +234,7 @@ void RdbmsRequesterMountRuleCatalogue::deleteRequesterMountRule(const std::strin
                                + requesterName + " because the rule does not exist");
   }
 
-  m_rdbmsCatalogue->m_userMountPolicyCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::REQUESTER_MOUNT_RULES);
 }
 
 }  // namespace cta::catalogue
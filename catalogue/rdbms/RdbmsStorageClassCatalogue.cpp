@@ -6,6 +6,7 @@
 #include "catalogue/rdbms/RdbmsStorageClassCatalogue.hpp"
 
 #include "catalogue/rdbms/CommonExceptions.hpp"
+#include "catalogue/rdbms/RdbmsCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsCatalogueUtils.hpp"
 #include "common/dataStructures/SecurityIdentity.hpp"
 #include "common/dataStructures/StorageClass.hpp"
@@ -141,6 +142,8 @@ void RdbmsStorageClassCatalogue::deleteStorageClass(const std::string& storageCl
     throw exception::UserError(std::string("Cannot delete storage-class : ") + storageClassName
                                + " because it does not exist");
   }
+
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::STORAGE_CLASSES);
 }
 
 std::vector<common::dataStructures::StorageClass> RdbmsStorageClassCatalogue::getStorageClasses() const {
@@ -319,6 +322,7 @@ void RdbmsStorageClassCatalogue::modifyStorageClassNbCopies(const common::dataSt
   if (0 == stmt.getNbAffectedRows()) {
     throw exception::UserError(std::string("Cannot modify storage class : ") + name + " because it does not exist");
   }
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::STORAGE_CLASSES);
 }
 
 void RdbmsStorageClassCatalogue::modifyStorageClassComment(const common::dataStructures::SecurityIdentity& admin,
@@ -415,6 +419,7 @@ void RdbmsStorageClassCatalogue::modifyStorageClassName(const common::dataStruct
     throw exception::UserError(std::string("Cannot modify storage class : ") + currentName
                                + " because it does not exist");
   }
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::STORAGE_CLASSES);
 }
 
 bool RdbmsStorageClassCatalogue::storageClassIsUsedByArchiveRoutes(rdbms::Conn& conn,
@@ -264,7 +264,12 @@ void RdbmsTapeCatalogue::deleteTape(const std::string& vid) {
 }
 
 TapeItor RdbmsTapeCatalogue::getTapesItor(const TapeSearchCriteria& searchCriteria) const {
-  auto conn = m_connPool->getConn();
+  return getTapesItor(m_rdbmsCatalogue->getReadOnlyConnPool(ReadReplicaQuery::TAPE_LISTING, *m_connPool),
+                      searchCriteria);
+}
+
+TapeItor RdbmsTapeCatalogue::getTapesItor(rdbms::ConnPool& connPool, const TapeSearchCriteria& searchCriteria) const {
+  auto conn = connPool.getConn();
   checkTapeSearchCriteria(conn, searchCriteria);
   auto impl = new RdbmsCatalogueGetTapesItor(m_log, std::move(conn), searchCriteria);
   return TapeItor(impl);
@@ -272,7 +277,8 @@ TapeItor RdbmsTapeCatalogue::getTapesItor(const TapeSearchCriteria& searchCriter
 
 std::vector<common::dataStructures::Tape> RdbmsTapeCatalogue::getTapes(const TapeSearchCriteria& searchCriteria) const {
   std::vector<common::dataStructures::Tape> tapes;
-  auto itor = getTapesItor(searchCriteria);
+  // Used by the scheduling of mounts, which must see the current state of the tapes
+  auto itor = getTapesItor(*m_connPool, searchCriteria);
   while (itor.hasMore()) {
     tapes.push_back(itor.next());
   }
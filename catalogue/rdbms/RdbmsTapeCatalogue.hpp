@@ -137,6 +137,15 @@ private:
   std::shared_ptr<rdbms::ConnPool> m_connPool;
   RdbmsCatalogue* m_rdbmsCatalogue;
 
+  /**
+   * Returns an iterator over the tapes matching the search criteria.
+   *
+   * @param connPool The pool of connections to the database to be queried.
+   * @param searchCriteria The search criteria.
+   * @return The iterator.
+   */
+  TapeItor getTapesItor(rdbms::ConnPool& connPool, const TapeSearchCriteria& searchCriteria) const;
+
   common::dataStructures::VidToTapeMap getTapesByVid(rdbms::Conn& conn, const std::string& vid) const;
 
   std::string getSelectTapesBy100VidsSql() const;
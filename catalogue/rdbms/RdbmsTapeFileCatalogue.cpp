@@ -6,6 +6,8 @@
 #include "catalogue/rdbms/RdbmsTapeFileCatalogue.hpp"
 
 #include "catalogue/InsertFileRecycleLog.hpp"
+#include "catalogue/RequesterAndGroupMountPolicies.hpp"
+#include "catalogue/RetrieveFilesQueueCriteria.hpp"
 #include "catalogue/TapeFileWritten.hpp"
 #include "catalogue/rdbms/RdbmsArchiveFileCatalogue.hpp"
 #include "catalogue/rdbms/RdbmsCatalogue.hpp"
@@ -23,8 +25,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace cta::catalogue {
 
@@ -230,32 +234,9 @@ RdbmsTapeFileCatalogue::prepareToRetrieveFile(const std::string& diskInstanceNam
     const auto getArchiveFileTime = t.secs(utils::Timer::resetCounter);
     // if the archive file was not found on tape in state ACTIVE or DISABLED, check if it is temporarily unavailable
     if (nullptr == archiveFile.get()) {
-      exception::UserError ex;
-      auto tapeFileStates = archiveFileCatalogue->getTapeFileStatesForArchiveFileId(conn, archiveFileId);
-      if (tapeFileStates.empty()) {
-        ex.getMessage() << "File with archive file ID " << archiveFileId << " does not exist in CTA namespace";
-        throw ex;
-      }
-      {
-        const auto nonBrokenState =
-          std::find_if(std::begin(tapeFileStates),
-                       std::end(tapeFileStates),
-                       [](const std::pair<std::string, std::string>& state) {
-                         return (state.second != "BROKEN") && (state.second != "BROKEN_PENDING")
-                                && (state.second != "EXPORTED") && (state.second != "EXPORTED_PENDING");
-                       });
-        if (nonBrokenState != std::end(tapeFileStates)) {
-          ex.getMessage() << "WARNING: The requested file is on tape " << nonBrokenState->first
-                          << ", which is temporarily unavailable (" << nonBrokenState->second
-                          << "). Please retry later.";
-          throw ex;
-        }
-      }
-      const auto& [brokenTape, brokenState] = tapeFileStates.front();
-      //All tape files are on broken tapes, just generate an error about the first
-      ex.getMessage() << "ERROR: The requested file is on tape " << brokenTape << ", which is permanently unavailable ("
-                      << brokenState << ").";
-      throw ex;
+      throw exception::UserError(
+        getUnavailableFileReason(archiveFileId,
+                                 archiveFileCatalogue->getTapeFileStatesForArchiveFileId(conn, archiveFileId)));
     }
     if (mountPolicyName.has_value() && !mountPolicyName.value().empty()) {
       const auto mountPolicyCatalogue = static_cast<RdbmsMountPolicyCatalogue*>(m_rdbmsCatalogue->MountPolicy().get());
@@ -275,24 +256,11 @@ RdbmsTapeFileCatalogue::prepareToRetrieveFile(const std::string& diskInstanceNam
     }
 
     if (diskInstanceName != archiveFile->diskInstance) {
-      exception::UserError ue;
-      ue.getMessage() << "Cannot retrieve file because the disk instance of the request does not match that of the"
-                         " archived file: archiveFileId="
-                      << archiveFileId << " requestDiskInstance=" << diskInstanceName
-                      << " archiveFileDiskInstance=" << archiveFile->diskInstance;
-      throw ue;
+      throw exception::UserError(getDiskInstanceMismatchReason(diskInstanceName, *archiveFile));
     }
 
     t.reset();
-    RequesterAndGroupMountPolicies mountPolicies;
-    const auto mountPolicyCatalogue = static_cast<RdbmsMountPolicyCatalogue*>(m_rdbmsCatalogue->MountPolicy().get());
-    if (activity) {
-      mountPolicies =
-        mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, user.name, user.group, activity.value());
-    } else {
-      mountPolicies = mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, user.name, user.group);
-    }
-
+    const auto mountPolicy = getRetrieveMountPolicy(conn, diskInstanceName, user, activity);
     const auto getMountPoliciesTime = t.secs(utils::Timer::resetCounter);
 
     log::ScopedParamContainer spc(lc);
@@ -301,42 +269,183 @@ RdbmsTapeFileCatalogue::prepareToRetrieveFile(const std::string& diskInstanceNam
       .add("getMountPoliciesTime", getMountPoliciesTime);
     lc.log(log::INFO, "Catalogue::prepareToRetrieve internal timings");
 
-    // Requester activity mount policies overrule requester mount policies
-    // Requester mount policies overrule requester group mount policies
-    common::dataStructures::MountPolicy mountPolicy;
-    if (!mountPolicies.requesterActivityMountPolicies.empty()) {
-      //More than one may match the activity, so choose the one with highest retrieve priority
-      mountPolicy = *std::max_element(
-        mountPolicies.requesterActivityMountPolicies.begin(),
-        mountPolicies.requesterActivityMountPolicies.end(),
-        [](const common::dataStructures::MountPolicy& p1, const common::dataStructures::MountPolicy& p2) {
-          return p1.retrievePriority < p2.retrievePriority;
-        });
-    } else if (!mountPolicies.requesterMountPolicies.empty()) {
-      mountPolicy = mountPolicies.requesterMountPolicies.front();
-    } else if (!mountPolicies.requesterGroupMountPolicies.empty()) {
-      mountPolicy = mountPolicies.requesterGroupMountPolicies.front();
-    } else {
-      mountPolicies = mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, "default", user.group);
-
-      if (!mountPolicies.requesterMountPolicies.empty()) {
-        mountPolicy = mountPolicies.requesterMountPolicies.front();
-      } else {
-        exception::UserError ue;
-        ue.getMessage()
-          << "Cannot retrieve file because there are no mount rules for the requester, activity or their group:"
-          << " archiveFileId=" << archiveFileId << " requester=" << diskInstanceName << ":" << user.name << ":"
-          << user.group;
-        if (activity) {
-          ue.getMessage() << " activity=" << activity.value();
-        }
-        throw ue;
-      }
+    if (!mountPolicy) {
+      throw exception::UserError(getNoMountRuleReason(diskInstanceName, archiveFileId, user, activity));
     }
     criteria.archiveFile = *archiveFile;
-    criteria.mountPolicy = mountPolicy;
+    criteria.mountPolicy = mountPolicy.value();
   }
   return criteria;
 }
 
+RetrieveFilesQueueCriteria
+RdbmsTapeFileCatalogue::prepareToRetrieveFiles(const std::string& diskInstanceName,
+                                               const std::set<uint64_t>& archiveFileIds,
+                                               const common::dataStructures::RequesterIdentity& user,
+                                               const std::optional<std::string>& activity,
+                                               log::LogContext& lc,
+                                               const std::optional<std::string>& mountPolicyName) {
+  RetrieveFilesQueueCriteria ret;
+  if (archiveFileIds.empty()) {
+    return ret;
+  }
+
+  cta::utils::Timer t;
+  auto conn = m_connPool->getConn();
+  const auto getConnTime = t.secs(utils::Timer::resetCounter);
+
+  // Look up all the archive files at once through a temporary table of their identifiers
+  const auto archiveFileCatalogue = static_cast<RdbmsArchiveFileCatalogue*>(m_rdbmsCatalogue->ArchiveFile().get());
+  const auto tempArchiveFileIdsTableName =
+    m_rdbmsCatalogue->createAndPopulateTempTableArchiveFileIds(conn, {archiveFileIds.begin(), archiveFileIds.end()});
+  auto archiveFiles =
+    archiveFileCatalogue->getArchiveFilesToRetrieveByArchiveFileIds(conn, tempArchiveFileIdsTableName);
+  if (archiveFiles.size() < archiveFileIds.size()) {
+    // Some of the archive files were not found on tape in state ACTIVE or DISABLED
+    auto tapeFileStates = archiveFileCatalogue->getTapeFileStatesForArchiveFileIds(conn, tempArchiveFileIdsTableName);
+    for (const auto archiveFileId : archiveFileIds) {
+      if (!archiveFiles.contains(archiveFileId)) {
+        ret.errors[archiveFileId] = getUnavailableFileReason(archiveFileId, tapeFileStates[archiveFileId]);
+      }
+    }
+  }
+  const auto getArchiveFilesTime = t.secs(utils::Timer::resetCounter);
+
+  // The mount policy is the same for all the files
+  std::optional<common::dataStructures::MountPolicy> mountPolicy;
+  if (mountPolicyName.has_value() && !mountPolicyName.value().empty()) {
+    const auto mountPolicyCatalogue = static_cast<RdbmsMountPolicyCatalogue*>(m_rdbmsCatalogue->MountPolicy().get());
+    mountPolicy = mountPolicyCatalogue->getMountPolicy(conn, mountPolicyName.value());
+    if (!mountPolicy) {
+      log::ScopedParamContainer spc(lc);
+      spc.add("mountPolicyName", mountPolicyName.value()).add("nbFiles", archiveFileIds.size());
+      lc.log(log::WARNING,
+             "Catalogue::prepareToRetrieveFiles Could not find specified mount policy, "
+             "falling back to querying mount rules");
+    }
+  }
+  if (!mountPolicy) {
+    std::erase_if(archiveFiles, [&ret, &diskInstanceName](const auto& idAndArchiveFile) {
+      const auto& [archiveFileId, archiveFile] = idAndArchiveFile;
+      if (diskInstanceName == archiveFile.diskInstance) {
+        return false;
+      }
+      ret.errors[archiveFileId] = getDiskInstanceMismatchReason(diskInstanceName, archiveFile);
+      return true;
+    });
+    if (!archiveFiles.empty()) {
+      mountPolicy = getRetrieveMountPolicy(conn, diskInstanceName, user, activity);
+    }
+  }
+  const auto getMountPoliciesTime = t.secs(utils::Timer::resetCounter);
+
+  for (auto& [archiveFileId, archiveFile] : archiveFiles) {
+    if (mountPolicy) {
+      auto& criteria = ret.criteria[archiveFileId];
+      criteria.archiveFile = std::move(archiveFile);
+      criteria.mountPolicy = mountPolicy.value();
+    } else {
+      ret.errors[archiveFileId] = getNoMountRuleReason(diskInstanceName, archiveFileId, user, activity);
+    }
+  }
+
+  log::ScopedParamContainer spc(lc);
+  spc.add("nbFiles", archiveFileIds.size())
+    .add("nbFilesToRetrieve", ret.criteria.size())
+    .add("getConnTime", getConnTime)
+    .add("getArchiveFilesTime", getArchiveFilesTime)
+    .add("getMountPoliciesTime", getMountPoliciesTime);
+  lc.log(log::INFO, "Catalogue::prepareToRetrieveFiles internal timings");
+  return ret;
+}
+
+std::optional<common::dataStructures::MountPolicy>
+RdbmsTapeFileCatalogue::getRetrieveMountPolicy(rdbms::Conn& conn,
+                                               const std::string& diskInstanceName,
+                                               const common::dataStructures::RequesterIdentity& user,
+                                               const std::optional<std::string>& activity) const {
+  RequesterAndGroupMountPolicies mountPolicies;
+  const auto mountPolicyCatalogue = static_cast<RdbmsMountPolicyCatalogue*>(m_rdbmsCatalogue->MountPolicy().get());
+  if (activity) {
+    mountPolicies =
+      mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, user.name, user.group, activity.value());
+  } else {
+    mountPolicies = mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, user.name, user.group);
+  }
+
+  // Requester activity mount policies overrule requester mount policies
+  // Requester mount policies overrule requester group mount policies
+  if (!mountPolicies.requesterActivityMountPolicies.empty()) {
+    //More than one may match the activity, so choose the one with highest retrieve priority
+    return *std::max_element(
+      mountPolicies.requesterActivityMountPolicies.begin(),
+      mountPolicies.requesterActivityMountPolicies.end(),
+      [](const common::dataStructures::MountPolicy& p1, const common::dataStructures::MountPolicy& p2) {
+        return p1.retrievePriority < p2.retrievePriority;
+      });
+  } else if (!mountPolicies.requesterMountPolicies.empty()) {
+    return mountPolicies.requesterMountPolicies.front();
+  } else if (!mountPolicies.requesterGroupMountPolicies.empty()) {
+    return mountPolicies.requesterGroupMountPolicies.front();
+  }
+
+  mountPolicies = mountPolicyCatalogue->getMountPolicies(conn, diskInstanceName, "default", user.group);
+  if (!mountPolicies.requesterMountPolicies.empty()) {
+    return mountPolicies.requesterMountPolicies.front();
+  }
+  return std::nullopt;
+}
+
+std::string RdbmsTapeFileCatalogue::getUnavailableFileReason(
+  const uint64_t archiveFileId,
+  const std::vector<std::pair<std::string, std::string>>& tapeFileStates) {
+  std::ostringstream msg;
+  if (tapeFileStates.empty()) {
+    msg << "File with archive file ID " << archiveFileId << " does not exist in CTA namespace";
+    return msg.str();
+  }
+  const auto nonBrokenState =
+    std::find_if(std::begin(tapeFileStates),
+                 std::end(tapeFileStates),
+                 [](const std::pair<std::string, std::string>& state) {
+                   return (state.second != "BROKEN") && (state.second != "BROKEN_PENDING")
+                          && (state.second != "EXPORTED") && (state.second != "EXPORTED_PENDING");
+                 });
+  if (nonBrokenState != std::end(tapeFileStates)) {
+    msg << "WARNING: The requested file is on tape " << nonBrokenState->first
+        << ", which is temporarily unavailable (" << nonBrokenState->second << "). Please retry later.";
+    return msg.str();
+  }
+  const auto& [brokenTape, brokenState] = tapeFileStates.front();
+  //All tape files are on broken tapes, just generate an error about the first
+  msg << "ERROR: The requested file is on tape " << brokenTape << ", which is permanently unavailable ("
+      << brokenState << ").";
+  return msg.str();
+}
+
+std::string RdbmsTapeFileCatalogue::getNoMountRuleReason(const std::string& diskInstanceName,
+                                                         const uint64_t archiveFileId,
+                                                         const common::dataStructures::RequesterIdentity& user,
+                                                         const std::optional<std::string>& activity) {
+  std::ostringstream msg;
+  msg << "Cannot retrieve file because there are no mount rules for the requester, activity or their group:"
+      << " archiveFileId=" << archiveFileId << " requester=" << diskInstanceName << ":" << user.name << ":"
+      << user.group;
+  if (activity) {
+    msg << " activity=" << activity.value();
+  }
+  return msg.str();
+}
+
+std::string
+RdbmsTapeFileCatalogue::getDiskInstanceMismatchReason(const std::string& diskInstanceName,
+                                                      const common::dataStructures::ArchiveFile& archiveFile) {
+  std::ostringstream msg;
+  msg << "Cannot retrieve file because the disk instance of the request does not match that of the"
+         " archived file: archiveFileId="
+      << archiveFile.archiveFileID << " requestDiskInstance=" << diskInstanceName
+      << " archiveFileDiskInstance=" << archiveFile.diskInstance;
+  return msg.str();
+}
+
 }  // namespace cta::catalogue
@@ -9,13 +9,17 @@
 #include "common/log/LogContext.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cta {
 
 namespace common::dataStructures {
 struct ArchiveFile;
 struct DeleteArchiveRequest;
+struct MountPolicy;
 struct TapeFile;
 }  // namespace common::dataStructures
 
@@ -52,9 +56,59 @@ public:
                         log::LogContext& lc,
                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
 
+  RetrieveFilesQueueCriteria
+  prepareToRetrieveFiles(const std::string& diskInstanceName,
+                         const std::set<uint64_t>& archiveFileIds,
+                         const common::dataStructures::RequesterIdentity& user,
+                         const std::optional<std::string>& activity,
+                         log::LogContext& lc,
+                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
+
 protected:
   RdbmsTapeFileCatalogue(log::Logger& log, std::shared_ptr<rdbms::ConnPool> connPool, RdbmsCatalogue* rdbmsCatalogue);
 
+private:
+  /**
+   * Returns the mount policy of the retrieve requests of the specified user
+   * under the specified activity, as given by the requester activity mount
+   * rules, then the requester mount rules, then the requester group mount
+   * rules and finally the mount rule of the "default" requester.
+   *
+   * @return The mount policy or std::nullopt if there is no matching mount rule.
+   */
+  std::optional<common::dataStructures::MountPolicy>
+  getRetrieveMountPolicy(rdbms::Conn& conn,
+                         const std::string& diskInstanceName,
+                         const common::dataStructures::RequesterIdentity& user,
+                         const std::optional<std::string>& activity) const;
+
+  /**
+   * Returns the reason why the specified archive file has no tape file on a
+   * tape in state ACTIVE or DISABLED.
+   *
+   * @param archiveFileId The identifier of the archive file.
+   * @param tapeFileStates The tape file vid and corresponding tape state pairs
+   * of the archive file.
+   */
+  static std::string getUnavailableFileReason(const uint64_t archiveFileId,
+                                              const std::vector<std::pair<std::string, std::string>>& tapeFileStates);
+
+  /**
+   * Returns the reason why the specified archive file cannot be retrieved when
+   * there is no mount rule for the requester.
+   */
+  static std::string getNoMountRuleReason(const std::string& diskInstanceName,
+                                          const uint64_t archiveFileId,
+                                          const common::dataStructures::RequesterIdentity& user,
+                                          const std::optional<std::string>& activity);
+
+  /**
+   * Returns the reason why the specified archive file cannot be retrieved by a
+   * request from another disk instance.
+   */
+  static std::string getDiskInstanceMismatchReason(const std::string& diskInstanceName,
+                                                   const common::dataStructures::ArchiveFile& archiveFile);
+
 protected:
   log::Logger& m_log;
   std::shared_ptr<rdbms::ConnPool> m_connPool;
@@ -233,7 +233,7 @@ void RdbmsTapePoolCatalogue::deleteTapePool(const std::string& name) {
       throw exception::UserError(std::string("Cannot delete tape-pool '") + name + "' because it does not exist");
     }
 
-    m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+    m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 
   } else {
     throw UserSpecifiedAnEmptyTapePool(std::string("Cannot delete tape-pool '") + name + "' because it is not empty");
@@ -576,7 +576,7 @@ void RdbmsTapePoolCatalogue::modifyTapePoolVo(const common::dataStructures::Secu
     throw exception::UserError(std::string("Cannot modify tape pool '") + name + "' because it does not exist");
   }
   //The VO of this tapepool has changed, invalidate the tapepool-VO cache
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsTapePoolCatalogue::modifyTapePoolNbPartialTapes(const common::dataStructures::SecurityIdentity& admin,
@@ -791,7 +791,9 @@ void RdbmsTapePoolCatalogue::modifyTapePoolName(const common::dataStructures::Se
     throw exception::UserError(std::string("Cannot modify tape pool '") + currentName + "' because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
+  // The archive routes now point to the new name
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::ARCHIVE_ROUTES);
 }
 
 bool RdbmsTapePoolCatalogue::tapePoolUsedInAnArchiveRoute(rdbms::Conn& conn, const std::string& tapePoolName) const {
@@ -120,7 +120,7 @@ void RdbmsVirtualOrganizationCatalogue::createVirtualOrganization(
 
   stmt.executeNonQuery();
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsVirtualOrganizationCatalogue::deleteVirtualOrganization(const std::string& voName) {
@@ -151,7 +151,7 @@ void RdbmsVirtualOrganizationCatalogue::deleteVirtualOrganization(const std::str
     throw exception::UserError(std::string("Cannot delete Virtual Organization : ") + voName
                                + " because it does not exist");
   }
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 std::vector<common::dataStructures::VirtualOrganization>
@@ -370,7 +370,7 @@ void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationName(
                                + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationReadMaxDrives(
@@ -402,7 +402,7 @@ void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationReadMaxDrives(
                                + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationWriteMaxDrives(
@@ -434,7 +434,7 @@ void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationWriteMaxDrives(
                                + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationMaxFileSize(
@@ -466,7 +466,7 @@ void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationMaxFileSize(
                                + " because it does not exist");
   }
 
-  m_rdbmsCatalogue->m_tapepoolVirtualOrganizationCache.invalidate();
+  m_rdbmsCatalogue->invalidateCachedData(conn, RdbmsCatalogue::CachedData::VIRTUAL_ORGANIZATIONS);
 }
 
 void RdbmsVirtualOrganizationCatalogue::modifyVirtualOrganizationComment(
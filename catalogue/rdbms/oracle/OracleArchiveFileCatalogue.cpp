@@ -224,6 +224,29 @@ uint64_t OracleArchiveFileCatalogue::getNextArchiveFileId(rdbms::Conn& conn) {
   return rset.columnUint64("ARCHIVE_FILE_ID");
 }
 
+std::list<uint64_t> OracleArchiveFileCatalogue::getNextArchiveFileIds(rdbms::Conn& conn, const uint64_t nbIds) {
+  const char* const sql = R"SQL(
+    SELECT
+      ARCHIVE_FILE_ID_SEQ.NEXTVAL AS ARCHIVE_FILE_ID
+    FROM
+      DUAL
+    CONNECT BY
+      LEVEL <= :NB_IDS
+  )SQL";
+  auto stmt = conn.createStmt(sql);
+  stmt.bindUint64(":NB_IDS", nbIds);
+  auto rset = stmt.executeQuery();
+  std::list<uint64_t> archiveFileIds;
+  while (rset.next()) {
+    archiveFileIds.push_back(rset.columnUint64("ARCHIVE_FILE_ID"));
+  }
+  if (archiveFileIds.size() != nbIds) {
+    throw exception::Exception("Unexpected number of archive file IDs: expected=" + std::to_string(nbIds)
+                               + " actual=" + std::to_string(archiveFileIds.size()));
+  }
+  return archiveFileIds;
+}
+
 void OracleArchiveFileCatalogue::copyArchiveFileToFileRecyleLogAndDelete(
   rdbms::Conn& conn,
   const common::dataStructures::DeleteArchiveRequest& request,
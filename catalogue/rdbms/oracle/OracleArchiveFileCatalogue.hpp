@@ -8,6 +8,7 @@
 #include "catalogue/rdbms/RdbmsArchiveFileCatalogue.hpp"
 #include "common/checksum/ChecksumBlob.hpp"
 
+#include <list>
 #include <map>
 #include <memory>
 #include <set>
@@ -23,7 +24,7 @@ public:
   OracleArchiveFileCatalogue(log::Logger& log,
                              std::shared_ptr<rdbms::ConnPool> connPool,
                              RdbmsCatalogue* rdbmsCatalogue);
-  ~OracleArchiveFileCatalogue() override = default;
+  ~OracleArchiveFileCatalogue() override { m_archiveFileIdAllocator.reset(); }
 
   void DO_NOT_USE_deleteArchiveFile_DO_NOT_USE(const std::string& diskInstanceName,
                                                const uint64_t archiveFileId,
@@ -32,6 +33,8 @@ public:
 private:
   uint64_t getNextArchiveFileId(rdbms::Conn& conn) override;
 
+  std::list<uint64_t> getNextArchiveFileIds(rdbms::Conn& conn, const uint64_t nbIds) override;
+
   void copyArchiveFileToFileRecyleLogAndDelete(rdbms::Conn& conn,
                                                const common::dataStructures::DeleteArchiveRequest& request,
                                                log::LogContext& lc) override;
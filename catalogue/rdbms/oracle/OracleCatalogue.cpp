@@ -96,4 +96,29 @@ std::string OracleCatalogue::createAndPopulateTempTableArchiveFileIds(rdbms::Con
   return tempTableName;
 }
 
+std::optional<uint64_t> OracleCatalogue::getReadReplicaLagSecs(rdbms::Conn& conn) const {
+  // Only an Active Data Guard standby reports an apply lag, the lag of any other database is unknown
+  const char* const sql = R"SQL(
+    SELECT
+      EXTRACT(DAY FROM APPLY_LAG) * 86400 +
+      EXTRACT(HOUR FROM APPLY_LAG) * 3600 +
+      EXTRACT(MINUTE FROM APPLY_LAG) * 60 +
+      FLOOR(EXTRACT(SECOND FROM APPLY_LAG)) AS LAG_SECS
+    FROM (
+      SELECT
+        TO_DSINTERVAL(VALUE) AS APPLY_LAG
+      FROM
+        V$DATAGUARD_STATS
+      WHERE
+        NAME = 'apply lag'
+    )
+  )SQL";
+  auto stmt = conn.createStmt(sql);
+  auto rset = stmt.executeQuery();
+  if (!rset.next()) {
+    return std::nullopt;
+  }
+  return rset.columnOptionalUint64("LAG_SECS");
+}
+
 }  // namespace cta::catalogue
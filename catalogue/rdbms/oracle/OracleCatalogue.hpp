@@ -51,6 +51,14 @@ public:
 
   std::string createAndPopulateTempTableArchiveFileIds(rdbms::Conn& conn,
                                                        const std::list<uint64_t>& archiveFileIds) const override;
+
+  /**
+   * Returns the replication lag of a read replica of the database.
+   *
+   * @param conn A connection to the replica.
+   * @return The replication lag in seconds or std::nullopt if it is unknown.
+   */
+  std::optional<uint64_t> getReadReplicaLagSecs(rdbms::Conn& conn) const override;
 };  // class OracleCatalogue
 
 }  // namespace cta::catalogue
@@ -109,4 +109,38 @@ PostgresCatalogue::createAndPopulateTempTableArchiveFileIds(rdbms::Conn& conn,
   return tempTableName;
 }
 
+std::optional<uint64_t> PostgresCatalogue::getReadReplicaLagSecs(rdbms::Conn& conn) const {
+  // A hot standby which has replayed all the WAL it received is up to date, however old its last replayed transaction
+  const char* const sql = R"SQL(
+    SELECT
+      CASE
+        WHEN NOT PG_IS_IN_RECOVERY() THEN 0
+        WHEN PG_LAST_WAL_RECEIVE_LSN() = PG_LAST_WAL_REPLAY_LSN() THEN 0
+        ELSE CAST(GREATEST(0, FLOOR(EXTRACT(EPOCH FROM (CURRENT_TIMESTAMP - PG_LAST_XACT_REPLAY_TIMESTAMP())))) AS BIGINT)
+      END AS LAG_SECS
+  )SQL";
+  auto stmt = conn.createStmt(sql);
+  auto rset = stmt.executeQuery();
+  if (!rset.next()) {
+    return std::nullopt;
+  }
+  return rset.columnOptionalUint64("LAG_SECS");
+}
+
+bool PostgresCatalogue::cacheInvalidationEventsSupported() const {
+  return true;
+}
+
+void PostgresCatalogue::listenToCacheInvalidationEvents(rdbms::Conn& conn) const {
+  conn.executeNonQuery("LISTEN CTA_CATALOGUE_CACHE");
+}
+
+void PostgresCatalogue::sendCacheInvalidationEvent(rdbms::Conn& conn, const std::string& payload) const {
+  // LISTEN folds the unquoted channel name to lower case
+  auto stmt = conn.createStmt("SELECT PG_NOTIFY('cta_catalogue_cache', :PAYLOAD) AS NOTIFIED");
+  stmt.bindString(":PAYLOAD", payload);
+  auto rset = stmt.executeQuery();
+  rset.next();
+}
+
 }  // namespace cta::catalogue
@@ -33,9 +33,10 @@ public:
                     const uint64_t nbArchiveFileListingConns);
 
   /**
-   * Destructor.
+   * Destructor.  Stops listening to cache invalidation events, as the
+   * listener calls the methods overridden below.
    */
-  ~PostgresCatalogue() override = default;
+  ~PostgresCatalogue() override { stopListeningToCacheInvalidationEvents(); }
 
   /**
    * Creates a temporary table from the list of disk file IDs provided in the search criteria.
@@ -49,6 +50,35 @@ public:
 
   std::string createAndPopulateTempTableArchiveFileIds(rdbms::Conn& conn,
                                                        const std::list<uint64_t>& archiveFileIds) const override;
+
+  /**
+   * Returns the replication lag of a read replica of the database.
+   *
+   * @param conn A connection to the replica.
+   * @return The replication lag in seconds or std::nullopt if it is unknown.
+   */
+  std::optional<uint64_t> getReadReplicaLagSecs(rdbms::Conn& conn) const override;
+
+  /**
+   * Returns true, cache invalidation events are sent with NOTIFY.
+   */
+  bool cacheInvalidationEventsSupported() const override;
+
+  /**
+   * Subscribes the specified connection to the cache invalidation events with
+   * LISTEN.
+   *
+   * @param conn The connection.
+   */
+  void listenToCacheInvalidationEvents(rdbms::Conn& conn) const override;
+
+  /**
+   * Sends a cache invalidation event with NOTIFY.
+   *
+   * @param conn The database connection.
+   * @param payload The name of the modified cached data.
+   */
+  void sendCacheInvalidationEvent(rdbms::Conn& conn, const std::string& payload) const override;
 };  // class PostgresCatalogue
 
 }  // namespace cta::catalogue
@@ -18,7 +18,7 @@ public:
   SqliteArchiveFileCatalogue(log::Logger& log,
                              std::shared_ptr<rdbms::ConnPool> connPool,
                              RdbmsCatalogue* rdbmsCatalogue);
-  ~SqliteArchiveFileCatalogue() override = default;
+  ~SqliteArchiveFileCatalogue() override { m_archiveFileIdAllocator.reset(); }
 
   void DO_NOT_USE_deleteArchiveFile_DO_NOT_USE(const std::string& diskInstanceName,
                                                const uint64_t archiveFileId,
@@ -37,6 +37,23 @@ ArchiveFileCatalogueRetryWrapper::checkAndGetNextArchiveFileId(const std::string
     m_maxTriesToConnect);
 }
 
+std::list<uint64_t>
+ArchiveFileCatalogueRetryWrapper::checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                                const std::string& storageClassName,
+                                                                const common::dataStructures::RequesterIdentity& user,
+                                                                const uint64_t nbIds) {
+  return retryOnLostConnection(
+    m_log,
+    [this, &diskInstanceName, &storageClassName, &user, nbIds] {
+      return m_catalogue.ArchiveFile()->checkAndGetNextArchiveFileIds(diskInstanceName, storageClassName, user, nbIds);
+    },
+    m_maxTriesToConnect);
+}
+
+void ArchiveFileCatalogueRetryWrapper::setArchiveFileIdBlockSize(const uint64_t blockSize) {
+  m_catalogue.ArchiveFile()->setArchiveFileIdBlockSize(blockSize);
+}
+
 common::dataStructures::ArchiveFileQueueCriteria
 ArchiveFileCatalogueRetryWrapper::getArchiveFileQueueCriteria(const std::string& diskInstanceName,
                                                               const std::string& storageClassName,
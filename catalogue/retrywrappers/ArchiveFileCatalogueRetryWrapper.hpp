@@ -30,6 +30,13 @@ public:
                                         const std::string& storageClassName,
                                         const common::dataStructures::RequesterIdentity& user) override;
 
+  std::list<uint64_t> checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                    const std::string& storageClassName,
+                                                    const common::dataStructures::RequesterIdentity& user,
+                                                    const uint64_t nbIds) override;
+
+  void setArchiveFileIdBlockSize(const uint64_t blockSize) override;
+
   common::dataStructures::ArchiveFileQueueCriteria
   getArchiveFileQueueCriteria(const std::string& diskInstanceName,
                               const std::string& storageClassName,
@@ -155,4 +155,15 @@ const std::unique_ptr<DriveStateCatalogue>& CatalogueRetryWrapper::DriveState()
   return m_driveState;
 }
 
+void CatalogueRetryWrapper::setReadReplica(const rdbms::Login& login,
+                                           const uint64_t nbConns,
+                                           const uint64_t maxLagSecs,
+                                           const std::set<ReadReplicaQuery>& queries) {
+  m_catalogue->setReadReplica(login, nbConns, maxLagSecs, queries);
+}
+
+void CatalogueRetryWrapper::enableCacheInvalidationEvents(const time_t maxAgeSecs) {
+  m_catalogue->enableCacheInvalidationEvents(maxAgeSecs);
+}
+
 }  // namespace cta::catalogue
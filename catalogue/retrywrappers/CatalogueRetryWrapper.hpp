@@ -58,6 +58,13 @@ public:
   const std::unique_ptr<FileRecycleLogCatalogue>& FileRecycleLog() const override;
   const std::unique_ptr<ArchiveFileCatalogue>& ArchiveFile() const override;
 
+  void setReadReplica(const rdbms::Login& login,
+                      const uint64_t nbConns,
+                      const uint64_t maxLagSecs,
+                      const std::set<ReadReplicaQuery>& queries) override;
+
+  void enableCacheInvalidationEvents(const time_t maxAgeSecs) override;
+
 protected:
   /**
    * Object representing the API to the CTA logging system.
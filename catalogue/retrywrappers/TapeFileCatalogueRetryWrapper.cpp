@@ -6,6 +6,7 @@
 #include "catalogue/retrywrappers/TapeFileCatalogueRetryWrapper.hpp"
 
 #include "catalogue/Catalogue.hpp"
+#include "catalogue/RetrieveFilesQueueCriteria.hpp"
 #include "catalogue/retrywrappers/retryOnLostConnection.hpp"
 #include "common/dataStructures/ArchiveFile.hpp"
 #include "common/dataStructures/RetrieveFileQueueCriteria.hpp"
@@ -53,4 +54,20 @@ TapeFileCatalogueRetryWrapper::prepareToRetrieveFile(const std::string& diskInst
     m_maxTriesToConnect);
 }
 
+RetrieveFilesQueueCriteria
+TapeFileCatalogueRetryWrapper::prepareToRetrieveFiles(const std::string& diskInstanceName,
+                                                      const std::set<uint64_t>& archiveFileIds,
+                                                      const common::dataStructures::RequesterIdentity& user,
+                                                      const std::optional<std::string>& activity,
+                                                      log::LogContext& lc,
+                                                      const std::optional<std::string>& mountPolicyName) {
+  return retryOnLostConnection(
+    m_log,
+    [this, &diskInstanceName, &archiveFileIds, &user, &activity, &lc, &mountPolicyName] {
+      return m_catalogue.TapeFile()
+        ->prepareToRetrieveFiles(diskInstanceName, archiveFileIds, user, activity, lc, mountPolicyName);
+    },
+    m_maxTriesToConnect);
+}
+
 }  // namespace cta::catalogue
@@ -31,6 +31,14 @@ public:
                         log::LogContext& lc,
                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
 
+  RetrieveFilesQueueCriteria
+  prepareToRetrieveFiles(const std::string& diskInstanceName,
+                         const std::set<uint64_t>& archiveFileIds,
+                         const common::dataStructures::RequesterIdentity& user,
+                         const std::optional<std::string>& activity,
+                         log::LogContext& lc,
+                         const std::optional<std::string>& mountPolicyName = std::nullopt) override;
+
 private:
   const Catalogue& m_catalogue;
   log::Logger& m_log;
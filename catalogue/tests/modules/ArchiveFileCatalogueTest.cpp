@@ -350,6 +350,168 @@ TEST_P(cta_catalogue_ArchiveFileTest, checkAndGetNextArchiveFileId_requester_mou
   }
 }
 
+TEST_P(cta_catalogue_ArchiveFileTest, checkAndGetNextArchiveFileId_block_allocation) {
+  auto mountPolicyToAdd = CatalogueTestUtils::getMountPolicy1();
+  std::string mountPolicyName = mountPolicyToAdd.name;
+  m_catalogue->MountPolicy()->createMountPolicy(m_admin, mountPolicyToAdd);
+  m_catalogue->DiskInstance()->createDiskInstance(m_admin, m_diskInstance.name, m_diskInstance.comment);
+
+  const std::string diskInstanceName = m_diskInstance.name;
+  const std::string requesterName = "requester_name";
+  m_catalogue->RequesterMountRule()->createRequesterMountRule(m_admin,
+                                                              mountPolicyName,
+                                                              diskInstanceName,
+                                                              requesterName,
+                                                              "Create mount rule for requester");
+
+  m_catalogue->VO()->createVirtualOrganization(m_admin, m_vo);
+  m_catalogue->StorageClass()->createStorageClass(m_admin, m_storageClassSingleCopy);
+
+  const std::string tapePoolName = "tape_pool";
+  const uint64_t nbPartialTapes = 2;
+  const std::string encryptionKeyName = "encryption_key_name";
+  const std::vector<std::string> supply;
+  m_catalogue->TapePool()->createTapePool(m_admin,
+                                          m_tape1.tapePoolName,
+                                          m_vo.name,
+                                          nbPartialTapes,
+                                          encryptionKeyName,
+                                          supply,
+                                          "Create tape pool");
+
+  const uint32_t copyNb = 1;
+  m_catalogue->ArchiveRoute()->createArchiveRoute(m_admin,
+                                                  m_storageClassSingleCopy.name,
+                                                  copyNb,
+                                                  cta::common::dataStructures::ArchiveRouteType::DEFAULT,
+                                                  tapePoolName,
+                                                  "Create archive route");
+
+  cta::common::dataStructures::RequesterIdentity requesterIdentity;
+  requesterIdentity.name = requesterName;
+  requesterIdentity.group = "group";
+
+  // Archive file IDs taken one at a time and by blocks must never collide
+  std::set<uint64_t> archiveFileIds;
+  for (uint64_t i = 0; i < 3; i++) {
+    const uint64_t archiveFileId =
+      m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileId(diskInstanceName,
+                                                               m_storageClassSingleCopy.name,
+                                                               requesterIdentity);
+    ASSERT_TRUE(archiveFileIds.insert(archiveFileId).second);
+  }
+  m_catalogue->ArchiveFile()->setArchiveFileIdBlockSize(4);
+  for (uint64_t i = 0; i < 10; i++) {
+    const uint64_t archiveFileId =
+      m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileId(diskInstanceName,
+                                                               m_storageClassSingleCopy.name,
+                                                               requesterIdentity);
+    ASSERT_TRUE(archiveFileIds.insert(archiveFileId).second);
+  }
+  m_catalogue->ArchiveFile()->setArchiveFileIdBlockSize(0);
+  const uint64_t archiveFileId =
+    m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileId(diskInstanceName,
+                                                             m_storageClassSingleCopy.name,
+                                                             requesterIdentity);
+  ASSERT_TRUE(archiveFileIds.insert(archiveFileId).second);
+}
+
+TEST_P(cta_catalogue_ArchiveFileTest, checkAndGetNextArchiveFileIds) {
+  auto mountPolicyToAdd = CatalogueTestUtils::getMountPolicy1();
+  std::string mountPolicyName = mountPolicyToAdd.name;
+  m_catalogue->MountPolicy()->createMountPolicy(m_admin, mountPolicyToAdd);
+  m_catalogue->DiskInstance()->createDiskInstance(m_admin, m_diskInstance.name, m_diskInstance.comment);
+
+  const std::string diskInstanceName = m_diskInstance.name;
+  const std::string requesterName = "requester_name";
+  m_catalogue->RequesterMountRule()->createRequesterMountRule(m_admin,
+                                                              mountPolicyName,
+                                                              diskInstanceName,
+                                                              requesterName,
+                                                              "Create mount rule for requester");
+
+  m_catalogue->VO()->createVirtualOrganization(m_admin, m_vo);
+  m_catalogue->StorageClass()->createStorageClass(m_admin, m_storageClassSingleCopy);
+
+  const std::string tapePoolName = "tape_pool";
+  const uint64_t nbPartialTapes = 2;
+  const std::string encryptionKeyName = "encryption_key_name";
+  const std::vector<std::string> supply;
+  m_catalogue->TapePool()->createTapePool(m_admin,
+                                          m_tape1.tapePoolName,
+                                          m_vo.name,
+                                          nbPartialTapes,
+                                          encryptionKeyName,
+                                          supply,
+                                          "Create tape pool");
+
+  const uint32_t copyNb = 1;
+  m_catalogue->ArchiveRoute()->createArchiveRoute(m_admin,
+                                                  m_storageClassSingleCopy.name,
+                                                  copyNb,
+                                                  cta::common::dataStructures::ArchiveRouteType::DEFAULT,
+                                                  tapePoolName,
+                                                  "Create archive route");
+
+  cta::common::dataStructures::RequesterIdentity requesterIdentity;
+  requesterIdentity.name = requesterName;
+  requesterIdentity.group = "group";
+
+  // Archive file IDs taken one at a time and several at once, with and without block allocation, must never collide
+  std::set<uint64_t> archiveFileIds;
+  auto ids =
+    m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileIds(diskInstanceName,
+                                                              m_storageClassSingleCopy.name,
+                                                              requesterIdentity,
+                                                              5);
+  ASSERT_EQ(5, ids.size());
+  archiveFileIds.insert(ids.begin(), ids.end());
+  const uint64_t archiveFileId =
+    m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileId(diskInstanceName,
+                                                             m_storageClassSingleCopy.name,
+                                                             requesterIdentity);
+  ASSERT_TRUE(archiveFileIds.insert(archiveFileId).second);
+  m_catalogue->ArchiveFile()->setArchiveFileIdBlockSize(4);
+  ids = m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileIds(diskInstanceName,
+                                                                  m_storageClassSingleCopy.name,
+                                                                  requesterIdentity,
+                                                                  10);
+  ASSERT_EQ(10, ids.size());
+  archiveFileIds.insert(ids.begin(), ids.end());
+  ASSERT_EQ(16, archiveFileIds.size());
+  ids = m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileIds(diskInstanceName,
+                                                                  m_storageClassSingleCopy.name,
+                                                                  requesterIdentity,
+                                                                  0);
+  ASSERT_TRUE(ids.empty());
+}
+
+TEST_P(cta_catalogue_ArchiveFileTest, checkAndGetNextArchiveFileIds_no_archive_routes) {
+  auto mountPolicyToAdd = CatalogueTestUtils::getMountPolicy1();
+  m_catalogue->MountPolicy()->createMountPolicy(m_admin, mountPolicyToAdd);
+  m_catalogue->DiskInstance()->createDiskInstance(m_admin, m_diskInstance.name, m_diskInstance.comment);
+
+  const std::string diskInstanceName = m_diskInstance.name;
+  const std::string requesterName = "requester_name";
+  m_catalogue->RequesterMountRule()->createRequesterMountRule(m_admin,
+                                                              mountPolicyToAdd.name,
+                                                              diskInstanceName,
+                                                              requesterName,
+                                                              "Create mount rule for requester");
+  m_catalogue->VO()->createVirtualOrganization(m_admin, m_vo);
+  m_catalogue->StorageClass()->createStorageClass(m_admin, m_storageClassSingleCopy);
+
+  cta::common::dataStructures::RequesterIdentity requesterIdentity;
+  requesterIdentity.name = requesterName;
+  requesterIdentity.group = "group";
+
+  ASSERT_THROW(m_catalogue->ArchiveFile()->checkAndGetNextArchiveFileIds(diskInstanceName,
+                                                                         m_storageClassSingleCopy.name,
+                                                                         requesterIdentity,
+                                                                         3),
+               cta::exception::UserError);
+}
+
 TEST_P(cta_catalogue_ArchiveFileTest, checkAndGetNextArchiveFileId_requester_group_mount_rule) {
   ASSERT_TRUE(m_catalogue->RequesterMountRule()->getRequesterMountRules().empty());
 
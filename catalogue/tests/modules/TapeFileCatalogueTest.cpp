@@ -9,6 +9,7 @@
 #include "catalogue/CatalogueItor.hpp"
 #include "catalogue/CreateMountPolicyAttributes.hpp"
 #include "catalogue/InsertFileRecycleLog.hpp"
+#include "catalogue/RetrieveFilesQueueCriteria.hpp"
 #include "catalogue/TapeFileWritten.hpp"
 #include "catalogue/TapeItemWrittenPointer.hpp"
 #include "catalogue/tests/CatalogueTestUtils.hpp"
@@ -1997,4 +1998,123 @@ TEST_P(cta_catalogue_TapeFileTest, prepareToRetrieveFileUsingArchiveFileId_Activ
                cta::exception::UserError);
 }
 
+TEST_P(cta_catalogue_TapeFileTest, prepareToRetrieveFiles) {
+  using namespace cta;
+
+  const std::string diskInstanceName1 = m_diskInstance.name;
+  const std::string diskInstanceName2 = "disk_instance_2";
+
+  const bool logicalLibraryIsDisabled = false;
+  std::optional<std::string> physicalLibraryName;
+  const uint64_t nbPartialTapes = 2;
+  const std::string encryptionKeyName = "encryption_key_name";
+  const std::vector<std::string> supply;
+  const std::string tapeDrive = "tape_drive";
+
+  m_catalogue->MediaType()->createMediaType(m_admin, m_mediaType);
+  m_catalogue->LogicalLibrary()->createLogicalLibrary(m_admin,
+                                                      m_tape1.logicalLibraryName,
+                                                      logicalLibraryIsDisabled,
+                                                      physicalLibraryName,
+                                                      "Create logical library");
+  m_catalogue->DiskInstance()->createDiskInstance(m_admin, diskInstanceName1, "comment");
+  m_catalogue->DiskInstance()->createDiskInstance(m_admin, diskInstanceName2, "comment");
+  m_catalogue->VO()->createVirtualOrganization(m_admin, m_vo);
+  m_catalogue->TapePool()->createTapePool(m_admin,
+                                          m_tape1.tapePoolName,
+                                          m_vo.name,
+                                          nbPartialTapes,
+                                          encryptionKeyName,
+                                          supply,
+                                          "Create tape pool");
+  m_catalogue->StorageClass()->createStorageClass(m_admin, m_storageClassSingleCopy);
+  m_catalogue->Tape()->createTape(m_admin, m_tape1);
+
+  const uint64_t nbArchiveFiles = 3;
+  std::set<catalogue::TapeItemWrittenPointer> tapeFilesWritten;
+  for (uint64_t i = 1; i <= nbArchiveFiles; i++) {
+    auto fileWrittenUP = std::make_unique<cta::catalogue::TapeFileWritten>();
+    auto& fileWritten = *fileWrittenUP;
+    fileWritten.archiveFileId = i;
+    fileWritten.diskInstance = diskInstanceName1;
+    fileWritten.diskFileId = std::to_string(12345677 + i);
+    fileWritten.diskFileOwnerUid = PUBLIC_DISK_USER;
+    fileWritten.diskFileGid = PUBLIC_DISK_GROUP;
+    fileWritten.size = 1;
+    fileWritten.checksumBlob.insert(checksum::ADLER32, "1357");
+    fileWritten.storageClassName = m_storageClassSingleCopy.name;
+    fileWritten.vid = m_tape1.vid;
+    fileWritten.fSeq = i;
+    fileWritten.blockId = i * 100;
+    fileWritten.copyNb = 1;
+    fileWritten.tapeDrive = tapeDrive;
+    tapeFilesWritten.emplace(fileWrittenUP.release());
+  }
+  m_catalogue->TapeFile()->filesWrittenToTape(tapeFilesWritten);
+
+  const auto mountPolicyToAdd = CatalogueTestUtils::getMountPolicy1();
+  m_catalogue->MountPolicy()->createMountPolicy(m_admin, mountPolicyToAdd);
+  const std::string requesterName = "requester_name";
+  m_catalogue->RequesterMountRule()->createRequesterMountRule(m_admin,
+                                                              mountPolicyToAdd.name,
+                                                              diskInstanceName1,
+                                                              requesterName,
+                                                              "Create mount rule for requester");
+
+  log::LogContext dummyLc(m_dummyLog);
+  common::dataStructures::RequesterIdentity requesterIdentity;
+  requesterIdentity.name = requesterName;
+  requesterIdentity.group = "group";
+
+  const uint64_t nonExistentArchiveFileId = nbArchiveFiles + 1;
+  const std::set<uint64_t> archiveFileIds = {1, 2, 3, nonExistentArchiveFileId};
+  {
+    const auto queueCriteria = m_catalogue->TapeFile()->prepareToRetrieveFiles(diskInstanceName1,
+                                                                              archiveFileIds,
+                                                                              requesterIdentity,
+                                                                              std::nullopt,
+                                                                              dummyLc);
+    ASSERT_EQ(nbArchiveFiles, queueCriteria.criteria.size());
+    for (uint64_t i = 1; i <= nbArchiveFiles; i++) {
+      const auto& criteria = queueCriteria.criteria.at(i);
+      ASSERT_EQ(i, criteria.archiveFile.archiveFileID);
+      ASSERT_EQ(1, criteria.archiveFile.tapeFiles.size());
+      ASSERT_EQ(i, criteria.archiveFile.tapeFiles.front().fSeq);
+      ASSERT_EQ(mountPolicyToAdd.name, criteria.mountPolicy.name);
+
+      // The criteria must be the same as those of the files prepared one by one
+      const auto fileQueueCriteria =
+        m_catalogue->TapeFile()->prepareToRetrieveFile(diskInstanceName1, i, requesterIdentity, std::nullopt, dummyLc);
+      ASSERT_EQ(fileQueueCriteria.archiveFile, criteria.archiveFile);
+      ASSERT_EQ(fileQueueCriteria.mountPolicy, criteria.mountPolicy);
+    }
+    ASSERT_EQ(1, queueCriteria.errors.size());
+    ASSERT_NE(std::string::npos, queueCriteria.errors.at(nonExistentArchiveFileId).find("does not exist"));
+  }
+
+  // Check that the diskInstanceName mismatch detection works
+  {
+    const auto queueCriteria = m_catalogue->TapeFile()->prepareToRetrieveFiles(diskInstanceName2,
+                                                                              archiveFileIds,
+                                                                              requesterIdentity,
+                                                                              std::nullopt,
+                                                                              dummyLc);
+    ASSERT_TRUE(queueCriteria.criteria.empty());
+    ASSERT_EQ(archiveFileIds.size(), queueCriteria.errors.size());
+  }
+
+  // Check that the missing mount rules are reported for every file
+  {
+    requesterIdentity.name = "unknown_requester";
+    const auto queueCriteria = m_catalogue->TapeFile()->prepareToRetrieveFiles(diskInstanceName1,
+                                                                              archiveFileIds,
+                                                                              requesterIdentity,
+                                                                              std::nullopt,
+                                                                              dummyLc);
+    ASSERT_TRUE(queueCriteria.criteria.empty());
+    ASSERT_EQ(archiveFileIds.size(), queueCriteria.errors.size());
+    ASSERT_NE(std::string::npos, queueCriteria.errors.at(1).find("no mount rules"));
+  }
+}
+
 }  // namespace unitTests
@@ -14,10 +14,12 @@ namespace cta::auth {
 JwkCache::JwkCache(std::unique_ptr<JwksFetcher> fetcher,
                    const std::string& jwkUri,
                    int pubkeyTimeout,
-                   const log::LogContext& lc)
+                   const log::LogContext& lc,
+                   int verifiedTokenTimeout)
     : m_jwksFetcher(std::move(fetcher)),
       m_jwksUri(jwkUri),
       m_pubkeyTimeout(pubkeyTimeout),
+      m_verifiedTokens(verifiedTokenTimeout),
       m_lc(lc) {};
 
 // Function to handle curl responses
@@ -68,14 +70,24 @@ std::optional<JwkCacheEntry> JwkCache::find(const std::string& key) {
   lc.log(log::DEBUG, "Just acquired the shared_lock in JwkCache::find");
   auto it = m_keymap.find(key);
   if (it == m_keymap.end()) {
-    lc.log(log::INFO, std::string("Entry not found for kid ") + key);
+    lc.log(log::DEBUG, std::string("Entry not found for kid ") + key);
     return std::nullopt;
   } else {
-    lc.log(log::INFO, std::string("Entry found in cache for kid ") + key);
+    lc.log(log::DEBUG, std::string("Entry found in cache for kid ") + key);
     return std::optional<JwkCacheEntry>(it->second);
   }
 }
 
+bool JwkCache::updateCacheOnMiss(time_t now) {
+  time_t lastUpdate = m_lastUpdateOnMiss.load();
+  // Only one of the concurrent requests missing a key updates the cache
+  if (now < lastUpdate + MIN_UPDATE_ON_MISS_INTERVAL || !m_lastUpdateOnMiss.compare_exchange_strong(lastUpdate, now)) {
+    return false;
+  }
+  updateCache(now);
+  return true;
+}
+
 void JwkCache::updateCache(time_t now) {
   log::LogContext lc(m_lc);
   log::ScopedParamContainer spc(lc);
@@ -91,16 +103,22 @@ void JwkCache::updateCache(time_t now) {
   lc.log(log::DEBUG, "In function updateCache, waiting to acquire unique lock");
   std::unique_lock<std::shared_mutex> lock(m_mutex);
   lc.log(log::DEBUG, "In updateCache, just acquired the unique lock");
+  bool keyRemoved = false;
   for (auto it = m_keymap.begin(); it != m_keymap.end();) {
     auto lastRefresh = it->second.last_refresh_time;
     // if pubkeyTimeout is 0, then we don't want public keys to expire
     if ((m_pubkeyTimeout != 0) && (lastRefresh + m_pubkeyTimeout <= now)) {
       lc.log(log::DEBUG, std::string("Removing entry for key with kid ") + it->first);
       it = m_keymap.erase(it);  // erase returns next valid iterator
+      keyRemoved = true;
     } else {
       ++it;
     }
   }
+  if (keyRemoved) {
+    // The tokens signed by the removed keys must not be accepted any more
+    m_verifiedTokens.clear();
+  }
   // add the new keys
   auto jwks = jwt::parse_jwks(raw_jwks);
   std::string kid;
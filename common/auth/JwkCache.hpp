@@ -5,9 +5,11 @@
 
 #pragma once
 
+#include "VerifiedJwtCache.hpp"
 #include "common/exception/Exception.hpp"
 #include "common/log/LogContext.hpp"
 
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <map>
@@ -54,13 +56,33 @@ public:
   JwkCache(std::unique_ptr<JwksFetcher> jwksFetcher,
            const std::string& jwkUri,
            int pubkeyTimeout,
-           const cta::log::LogContext& lc);
+           const cta::log::LogContext& lc,
+           int verifiedTokenTimeout = 0);
 
   void updateCache(time_t now);
+
+  /**
+   * Updates the cache when a token is signed by a key which is not cached yet
+   *
+   * The cache is meant to be updated periodically by a background thread, so it is only updated on the request path
+   * if it has not been updated that way in the last MIN_UPDATE_ON_MISS_INTERVAL seconds: tokens signed by an unknown
+   * key cannot trigger a call to the JWKS endpoint each.
+   *
+   * @return false if the cache has not been updated
+   */
+  bool updateCacheOnMiss(time_t now);
+
   std::optional<JwkCacheEntry> find(const std::string& key);
 
   JwksFetcher& getFetcher() { return *m_jwksFetcher; }
 
+  /**
+   * The tokens verified with the keys of this cache, cleared whenever a key is removed from the cache
+   */
+  VerifiedJwtCache& getVerifiedTokens() { return m_verifiedTokens; }
+
+  static constexpr time_t MIN_UPDATE_ON_MISS_INTERVAL = 10;
+
 private:
   std::unique_ptr<JwksFetcher> m_jwksFetcher;
   const std::string m_jwksUri;
@@ -68,6 +90,9 @@ private:
   std::map<std::string, JwkCacheEntry, std::less<>> m_keymap;
   //!< This gives the option to keep public keys around for longer than the refresh interval.
   const int m_pubkeyTimeout;
+  //!< The time of the last update made by updateCacheOnMiss, 0 if none
+  std::atomic<time_t> m_lastUpdateOnMiss = 0;
+  VerifiedJwtCache m_verifiedTokens;
   //!< The logging context
   cta::log::LogContext m_lc;  //!< always make a copy for thread safety
 };
@@ -19,6 +19,8 @@ private:
 public:
   void setResponse(const std::string& url, const std::string& jwks) { m_responses[url] = jwks; }
 
+  void removeResponse(const std::string& url) { m_responses.erase(url); }
+
   std::string fetchJWKS(const std::string& jwksUrl) override {
     auto it = m_responses.find(jwksUrl);
     if (it != m_responses.end()) {
@@ -126,4 +128,26 @@ TEST(JwkCacheTest, UpdateCacheRemovesExpiredKeys) {
   cache.updateCache(now);
   EXPECT_FALSE(cache.find("expired-key").has_value());
 }
+
+TEST(JwkCacheTest, UpdateCacheOnMissIsRateLimited) {
+  cta::log::StringLogger log("dummy", "JwkCacheTest_UpdateCacheOnMissIsRateLimited", cta::log::DEBUG);
+  cta::log::LogContext lc(log);
+
+  auto mockFetcher {std::make_unique<MockJwksFetcher>()};
+  mockFetcher->setResponse("http://fake-jwks-uri", R"({"keys": []})");
+  cta::auth::JwkCache cache(std::move(mockFetcher), "http://fake-jwks-uri", 1200, lc);
+
+  time_t now = 1000;
+  EXPECT_TRUE(cache.updateCacheOnMiss(now));
+  EXPECT_FALSE(cache.find("test-kid").has_value());
+
+  // The key is now published, but the cache has just been updated
+  auto& fetcher = static_cast<MockJwksFetcher&>(cache.getFetcher());
+  fetcher.removeResponse("http://fake-jwks-uri");
+  EXPECT_FALSE(cache.updateCacheOnMiss(now + cta::auth::JwkCache::MIN_UPDATE_ON_MISS_INTERVAL - 1));
+  EXPECT_FALSE(cache.find("test-kid").has_value());
+
+  EXPECT_TRUE(cache.updateCacheOnMiss(now + cta::auth::JwkCache::MIN_UPDATE_ON_MISS_INTERVAL));
+  EXPECT_TRUE(cache.find("test-kid").has_value());
+}
 }  // namespace unitTests
@@ -13,6 +13,11 @@ ValidateJwt(const std::string& encodedJwt, std::shared_ptr<JwkCache> pubkeyCache
   // this is thread-safe because it makes a copy of logContext for each thread
   cta::log::LogContext lc(logContext);
   cta::log::ScopedParamContainer sp(lc);
+  const time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  // A token which has already been verified is accepted without decoding it nor checking its signature again
+  if (auto subjectClaim = pubkeyCache->getVerifiedTokens().find(encodedJwt, now); subjectClaim.has_value()) {
+    return {true, subjectClaim};
+  }
   try {
     auto decoded = jwt::decode(encodedJwt);
     // Extract the "sub" claim
@@ -25,7 +30,8 @@ ValidateJwt(const std::string& encodedJwt, std::shared_ptr<JwkCache> pubkeyCache
       return {false, subjectClaim};
     }
     // Validation: check if the token is expired
-    if (auto exp = decoded.get_payload_claim("exp").as_date(); exp < std::chrono::system_clock::now()) {
+    auto exp = decoded.get_payload_claim("exp").as_date();
+    if (exp < std::chrono::system_clock::now()) {
       lc.log(cta::log::WARNING, "In ValidateJwt, Passed-in token has expired!");
       return {false, subjectClaim};  // Token has expired
     }
@@ -40,13 +46,12 @@ ValidateJwt(const std::string& encodedJwt, std::shared_ptr<JwkCache> pubkeyCache
     if (entry.has_value()) {
       pubkeyPem = entry.value().pubkey;
     } else {
-      lc.log(cta::log::INFO, "No cached key found, will fetch keys from endpoint");
       sp.add("kid", kid);
       // add the key to the cache, after fetching
-      const auto now = std::chrono::system_clock::now();
-      time_t nowt = std::chrono::system_clock::to_time_t(now);
-      pubkeyCache->updateCache(nowt);
-      entry = pubkeyCache->find(kid);
+      if (pubkeyCache->updateCacheOnMiss(now)) {
+        lc.log(cta::log::INFO, "No cached key found, fetched keys from endpoint");
+        entry = pubkeyCache->find(kid);
+      }
       if (!entry.has_value()) {
         // unable to fetch the public key for validation, fail the request
         lc.log(cta::log::ERR, "Unable to find the public key for the token, authentication failed");
@@ -58,6 +63,10 @@ ValidateJwt(const std::string& encodedJwt, std::shared_ptr<JwkCache> pubkeyCache
     // Validate signature
     auto verifier = jwt::verify().allow_algorithm(jwt::algorithm::rs256(pubkeyPem, "", "", ""));
     verifier.verify(decoded);
+    pubkeyCache->getVerifiedTokens().insert(encodedJwt,
+                                            subjectClaim.value(),
+                                            std::chrono::system_clock::to_time_t(exp),
+                                            now);
     return {true, subjectClaim};
   } catch (const std::exception& e) {
     sp.add(semconv::log::exceptionMessage, e.what());
@@ -127,6 +127,20 @@ protected:
     const auto cache = std::make_shared<cta::auth::JwkCache>(std::move(mockFetcher), "http://fake-jwks-uri", 1200, lc);
     return cache;
   }
+
+  // The verified tokens are kept for 60 seconds, the mock fetcher remains owned by the cache
+  std::shared_ptr<cta::auth::JwkCache>
+  createCacheWithVerifiedTokens(MockJwksFetcherValidateJwt** mockFetcherPtr = nullptr) const {
+    auto mockFetcher = std::make_unique<MockJwksFetcherValidateJwt>();
+    if (mockFetcherPtr != nullptr) {
+      *mockFetcherPtr = mockFetcher.get();
+    }
+    return std::make_shared<cta::auth::JwkCache>(std::move(mockFetcher),
+                                                 "http://fake-jwks-uri",
+                                                 1200,
+                                                 lc,
+                                                 60);
+  }
 };
 
 TEST_F(ValidateJwtTestFixture, ValidTokenWithCachedKey) {
@@ -165,6 +179,45 @@ TEST_F(ValidateJwtTestFixture, ValidTokenWithoutCachedKeyCacheFetchFails) {
   ASSERT_FALSE(entry.has_value());
 }
 
+TEST_F(ValidateJwtTestFixture, VerifiedTokenAcceptedFromCache) {
+  auto cache = createCacheWithVerifiedTokens();
+  std::string token = createTestJwt(false /*expired*/, "test-kid");
+  const time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  cache->updateCache(now);
+
+  auto result = cta::auth::ValidateJwt(token, cache, lc);
+  ASSERT_TRUE(result.isValid);
+  ASSERT_EQ("subjectClaim", result.subjectClaim.value());
+  ASSERT_EQ("subjectClaim", cache->getVerifiedTokens().find(token, now).value());
+  const auto firstValidationLog = log.getLog();
+  ASSERT_NE(std::string::npos, firstValidationLog.find("Entry found in cache for kid test-kid"));
+
+  // The second validation is a cache hit: the key of the token is not looked up to verify its signature again
+  result = cta::auth::ValidateJwt(token, cache, lc);
+  ASSERT_TRUE(result.isValid);
+  ASSERT_EQ("subjectClaim", result.subjectClaim.value());
+  ASSERT_EQ(std::string::npos, log.getLog().substr(firstValidationLog.size()).find("Entry found in cache for kid"));
+}
+
+TEST_F(ValidateJwtTestFixture, VerifiedTokenRejectedOnceItsKeyIsRemoved) {
+  MockJwksFetcherValidateJwt* mockFetcher = nullptr;
+  auto cache = createCacheWithVerifiedTokens(&mockFetcher);
+  std::string token = createTestJwt(false /*expired*/, "test-kid");
+  const time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+  cache->updateCache(now);
+  ASSERT_TRUE(cta::auth::ValidateJwt(token, cache, lc).isValid);
+  ASSERT_TRUE(cache->getVerifiedTokens().find(token, now).has_value());
+
+  // The key is no longer published: it is removed once it times out, and the verified tokens are cleared with it
+  mockFetcher->setJwks(R"({"keys": []})");
+  cache->updateCache(now + 1200);
+  ASSERT_FALSE(cache->find("test-kid").has_value());
+  ASSERT_FALSE(cache->getVerifiedTokens().find(token, now).has_value());
+
+  auto result = cta::auth::ValidateJwt(token, cache, lc);
+  ASSERT_FALSE(result.isValid);
+}
+
 TEST_F(ValidateJwtTestFixture, ExpiredToken) {
   auto cache = createCacheWithMockFetcher();
   std::string token = createTestJwt(true /*expired*/, "test-kid");
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "VerifiedJwtCache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+
+namespace cta::auth {
+
+VerifiedJwtCache::VerifiedJwtCache(int timeout, size_t maxTokensPerShard)
+    : m_timeout(timeout),
+      m_maxTokensPerShard(maxTokensPerShard) {}
+
+std::optional<std::string> VerifiedJwtCache::find(const std::string& encodedJwt, time_t now) const {
+  if (m_timeout <= 0) {
+    return std::nullopt;
+  }
+  const size_t hash = std::hash<std::string> {}(encodedJwt);
+  const auto& shard = m_shards[hash % NB_SHARDS];
+  std::shared_lock lock(shard.mutex);
+  auto it = shard.tokens.find(hash);
+  if (it == shard.tokens.end() || it->second.expiration <= now || it->second.encodedJwt != encodedJwt) {
+    return std::nullopt;
+  }
+  return it->second.subjectClaim;
+}
+
+void VerifiedJwtCache::insert(const std::string& encodedJwt,
+                              const std::string& subjectClaim,
+                              time_t expiration,
+                              time_t now) {
+  if (m_timeout <= 0 || expiration <= now) {
+    return;
+  }
+  const size_t hash = std::hash<std::string> {}(encodedJwt);
+  auto& shard = m_shards[hash % NB_SHARDS];
+  std::unique_lock lock(shard.mutex);
+  if (shard.tokens.size() >= m_maxTokensPerShard && !shard.tokens.contains(hash)) {
+    std::erase_if(shard.tokens, [now](const auto& token) { return token.second.expiration <= now; });
+    // The shard is full of valid tokens: they are dropped and verified again on their next use
+    if (shard.tokens.size() >= m_maxTokensPerShard) {
+      shard.tokens.clear();
+    }
+  }
+  shard.tokens[hash] = {encodedJwt, subjectClaim, std::min(expiration, now + m_timeout)};
+}
+
+void VerifiedJwtCache::clear() {
+  for (auto& shard : m_shards) {
+    std::unique_lock lock(shard.mutex);
+    shard.tokens.clear();
+  }
+}
+
+}  // namespace cta::auth
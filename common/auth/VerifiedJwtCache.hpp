@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <array>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <time.h>
+#include <unordered_map>
+
+namespace cta::auth {
+
+/**
+ * Cache of the JWT tokens whose signature has been verified, with the subject claim of each token
+ *
+ * A client sends the same token with each of its requests until the token expires, so the signature of a token only
+ * needs to be verified once. The tokens are kept until they expire, or for at most the configured timeout, which
+ * bounds how long a token stays accepted once the key used to sign it is no longer trusted.
+ *
+ * The tokens are looked up by their hash in shards, each with its own lock, so that concurrent requests do not wait
+ * for each other. The complete token is compared on lookup, a hash collision is a cache miss.
+ */
+class VerifiedJwtCache {
+public:
+  /**
+   * Constructor
+   *
+   * @param timeout             The maximum number of seconds a token is kept in the cache, 0 disables the cache
+   * @param maxTokensPerShard   The maximum number of tokens kept in each shard of the cache
+   */
+  explicit VerifiedJwtCache(int timeout, size_t maxTokensPerShard = 1024);
+
+  /**
+   * Returns the subject claim of a token, if the token has been verified and has not expired
+   */
+  std::optional<std::string> find(const std::string& encodedJwt, time_t now) const;
+
+  /**
+   * Adds a verified token to the cache
+   *
+   * @param encodedJwt    The token
+   * @param subjectClaim  The subject claim of the token
+   * @param expiration    The expiration time of the token
+   * @param now           The current time
+   */
+  void insert(const std::string& encodedJwt, const std::string& subjectClaim, time_t expiration, time_t now);
+
+  /**
+   * Removes all the tokens from the cache
+   */
+  void clear();
+
+private:
+  struct CachedToken {
+    std::string encodedJwt;
+    std::string subjectClaim;
+    time_t expiration;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<size_t, CachedToken> tokens;  //!< Tokens indexed by their hash
+  };
+
+  static constexpr size_t NB_SHARDS = 16;
+
+  const int m_timeout;
+  const size_t m_maxTokensPerShard;
+  std::array<Shard, NB_SHARDS> m_shards;
+};
+
+}  // namespace cta::auth
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "VerifiedJwtCache.hpp"
+
+#include <gtest/gtest.h>
+
+namespace unitTests {
+
+TEST(VerifiedJwtCacheTest, FindInsertedToken) {
+  cta::auth::VerifiedJwtCache cache(60);
+
+  time_t now = 1000;
+  EXPECT_FALSE(cache.find("token", now).has_value());
+  cache.insert("token", "subject", now + 3600, now);
+  auto subject = cache.find("token", now);
+  ASSERT_TRUE(subject.has_value());
+  EXPECT_EQ(subject.value(), "subject");
+  EXPECT_FALSE(cache.find("other-token", now).has_value());
+}
+
+TEST(VerifiedJwtCacheTest, TokenExpires) {
+  cta::auth::VerifiedJwtCache cache(60);
+
+  time_t now = 1000;
+  cache.insert("short-lived-token", "subject", now + 10, now);
+  cache.insert("long-lived-token", "subject", now + 3600, now);
+
+  // The short-lived token has expired
+  EXPECT_FALSE(cache.find("short-lived-token", now + 10).has_value());
+  EXPECT_TRUE(cache.find("long-lived-token", now + 10).has_value());
+  // The long-lived token is still valid, but it has to be verified again after the timeout of the cache
+  EXPECT_FALSE(cache.find("long-lived-token", now + 60).has_value());
+}
+
+TEST(VerifiedJwtCacheTest, ExpiredTokenNotInserted) {
+  cta::auth::VerifiedJwtCache cache(60);
+
+  time_t now = 1000;
+  cache.insert("token", "subject", now, now);
+  EXPECT_FALSE(cache.find("token", now - 1).has_value());
+}
+
+TEST(VerifiedJwtCacheTest, DisabledCache) {
+  cta::auth::VerifiedJwtCache cache(0);
+
+  time_t now = 1000;
+  cache.insert("token", "subject", now + 3600, now);
+  EXPECT_FALSE(cache.find("token", now).has_value());
+}
+
+TEST(VerifiedJwtCacheTest, Clear) {
+  cta::auth::VerifiedJwtCache cache(60);
+
+  time_t now = 1000;
+  cache.insert("token", "subject", now + 3600, now);
+  cache.clear();
+  EXPECT_FALSE(cache.find("token", now).has_value());
+}
+
+TEST(VerifiedJwtCacheTest, FullCacheKeepsLastToken) {
+  cta::auth::VerifiedJwtCache cache(60, 2);
+
+  time_t now = 1000;
+  for (int i = 0; i < 100; i++) {
+    cache.insert("token-" + std::to_string(i), "subject", now + 3600, now);
+    EXPECT_TRUE(cache.find("token-" + std::to_string(i), now).has_value());
+  }
+}
+
+}  // namespace unitTests
@@ -19,8 +19,9 @@ TapeFile::TapeFile() : fSeq(0), blockId(0), fileSize(0), copyNb(0), creationTime
 // operator==
 //------------------------------------------------------------------------------
 bool TapeFile::operator==(const TapeFile& rhs) const {
-  return vid == rhs.vid && fSeq == rhs.fSeq && blockId == rhs.blockId && fileSize == rhs.fileSize
-         && copyNb == rhs.copyNb && creationTime == rhs.creationTime;
+  return vid == rhs.vid && fSeq == rhs.fSeq && blockId == rhs.blockId
+         && aggregateBlockOffset == rhs.aggregateBlockOffset && fileSize == rhs.fileSize && copyNb == rhs.copyNb
+         && creationTime == rhs.creationTime;
 }
 
 //------------------------------------------------------------------------------
@@ -43,6 +44,9 @@ bool TapeFile::matchesCopyNb(uint8_t cnb) const {
 std::ostream& operator<<(std::ostream& os, const TapeFile& obj) {
   os << "(vid=" << obj.vid << " fSeq=" << obj.fSeq << " blockId=" << obj.blockId << " fileSize=" << obj.fileSize
      << " copyNb=" << static_cast<int>(obj.copyNb) << " creationTime=" << obj.creationTime;
+  if (obj.aggregateBlockOffset) {
+    os << " aggregateBlockOffset=" << *obj.aggregateBlockOffset;
+  }
   os << ")";
   return os;
 }
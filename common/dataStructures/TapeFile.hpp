@@ -7,6 +7,7 @@
 
 #include <common/checksum/ChecksumBlob.hpp>
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,12 @@ struct TapeFile {
    */
   // TODO: change denomination to match SCSI nomenclature (logical object identifier).
   uint64_t blockId;
+  /**
+   * Set if the file is a member of an aggregate tape file (many small files packed in one tape file).
+   * It is then the offset of the first data block of the file, in blocks, from the first data block of
+   * the aggregate, whose headers are found at fSeq and blockId.
+   */
+  std::optional<uint64_t> aggregateBlockOffset;
   /**
    * The uncompressed (logical) size of the tape file in bytes. This field is redundant as it already exists in the
    * ArchiveFile class, so it may be removed in future.
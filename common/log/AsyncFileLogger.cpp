@@ -0,0 +1,401 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "common/log/AsyncFileLogger.hpp"
+
+#include "common/exception/Errnum.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <fcntl.h>
+#include <ranges>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace cta::log {
+
+namespace {
+
+/**
+ * Used to give a unique identifier to each logger
+ */
+std::atomic<uint64_t> g_nextLoggerId = 0;
+
+/**
+ * The period after which the writer thread checks the ring buffers when it is not woken up
+ */
+constexpr auto WRITER_IDLE_PERIOD = std::chrono::milliseconds(10);
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// LineRing
+//------------------------------------------------------------------------------
+class AsyncFileLogger::LineRing {
+public:
+  explicit LineRing(size_t capacity) : m_lines(capacity) {}
+
+  /**
+   * Moves the specified line at the end of the ring buffer if it is not full, called by the logging thread
+   *
+   * @return true if the line has been queued, false if the ring buffer is full
+   */
+  bool tryPush(std::string& line) noexcept {
+    const uint64_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == m_lines.size()) {
+      return false;
+    }
+    m_lines[head % m_lines.size()] = std::move(line);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Returns the position after the last queued line
+   */
+  uint64_t head() const noexcept { return m_head.load(std::memory_order_acquire); }
+
+  /**
+   * Returns the position of the first queued line
+   */
+  uint64_t tail() const noexcept { return m_tail.load(std::memory_order_acquire); }
+
+  /**
+   * Returns the number of queued lines
+   */
+  size_t size() const noexcept { return head() - tail(); }
+
+  /**
+   * Returns the line at the specified position, called by the writer thread
+   */
+  std::string& lineAt(uint64_t position) noexcept { return m_lines[position % m_lines.size()]; }
+
+  /**
+   * Frees the specified number of lines at the beginning of the ring buffer, called by the writer thread
+   */
+  void release(uint64_t nbLines) noexcept {
+    const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    for (uint64_t position = tail; position < tail + nbLines; position++) {
+      lineAt(position) = std::string();
+    }
+    m_tail.store(tail + nbLines, std::memory_order_release);
+  }
+
+  /**
+   * Set when the logging thread has exited, no line will be queued anymore
+   */
+  std::atomic<bool> m_producerExited = false;
+
+  /**
+   * Set when the logger has been destroyed, the logging thread can forget the ring buffer
+   */
+  std::atomic<bool> m_loggerDestroyed = false;
+
+private:
+  std::vector<std::string> m_lines;
+
+  // The positions are only ever incremented, they are written by different threads and kept on different cache lines
+  alignas(64) std::atomic<uint64_t> m_head = 0;
+  alignas(64) std::atomic<uint64_t> m_tail = 0;
+};
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+AsyncFileLogger::AsyncFileLogger(std::string_view hostName,
+                                 std::string_view programName,
+                                 const std::string& filePath,
+                                 int logMask,
+                                 size_t threadBufferSize)
+    : Logger(hostName, programName, logMask),
+      m_id(g_nextLoggerId++),
+      m_threadBufferSize(threadBufferSize),
+      m_filePath(filePath) {
+  if (0 == m_threadBufferSize) {
+    throw exception::Exception("In AsyncFileLogger::AsyncFileLogger(): the thread buffer size must be greater than 0");
+  }
+  m_fd = ::open(m_filePath.data(), O_APPEND | O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+  exception::Errnum::throwOnMinusOne(m_fd,
+                                     std::string("In AsyncFileLogger::AsyncFileLogger(): failed to open log file: ")
+                                       + m_filePath);
+}
+
+//------------------------------------------------------------------------------
+// destructor
+//------------------------------------------------------------------------------
+AsyncFileLogger::~AsyncFileLogger() {
+  stopWriter();
+  {
+    std::lock_guard lock(m_ringsMutex);
+    for (const auto& ring : m_rings) {
+      ring->m_loggerDestroyed = true;
+    }
+  }
+  if (-1 != m_fd) {
+    ::close(m_fd);
+  }
+}
+
+//------------------------------------------------------------------------------
+// prepareForFork
+//------------------------------------------------------------------------------
+void AsyncFileLogger::prepareForFork() {
+  stopWriter();
+}
+
+//------------------------------------------------------------------------------
+// refresh
+//------------------------------------------------------------------------------
+void AsyncFileLogger::refresh() {
+  // In the case of AsyncFileLogger this means getting a new fd (to rotate the log file).
+  operator()(INFO, "Refreshing log file descriptor");
+  flush();
+  {
+    std::lock_guard lock(m_fdMutex);
+    if (-1 != m_fd) {
+      ::close(m_fd);
+    }
+    m_fd = ::open(m_filePath.data(), O_APPEND | O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    exception::Errnum::throwOnMinusOne(m_fd,
+                                       std::string("In AsyncFileLogger::refresh(): failed to refresh log file: ")
+                                         + m_filePath);
+  }
+  operator()(INFO, "Log file descriptor reopened");
+}
+
+//------------------------------------------------------------------------------
+// flush
+//------------------------------------------------------------------------------
+void AsyncFileLogger::flush() {
+  std::vector<std::pair<std::shared_ptr<LineRing>, uint64_t>> ringHeads;
+  {
+    std::lock_guard lock(m_ringsMutex);
+    for (const auto& ring : m_rings) {
+      ringHeads.emplace_back(ring, ring->head());
+    }
+  }
+  for (const auto& [ring, head] : ringHeads) {
+    while (ring->tail() < head) {
+      if (!m_writerRunning) {
+        startWriter();
+      }
+      wakeUpWriter();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// writeMsgToUnderlyingLoggingSystem
+//-----------------------------------------------------------------------------
+void AsyncFileLogger::writeMsgToUnderlyingLoggingSystem(std::string_view header, std::string_view body) {
+  // Prepare the string to print
+  const bool isJson = m_logFormat == LogFormat::JSON;
+  std::string line;
+  line.reserve(header.size() + body.size() + 3);
+  if (isJson) {
+    line += '{';
+  }
+  line += header;
+  line += body;
+  if (isJson) {
+    line += '}';
+  }
+  line += '\n';
+
+  if (!m_writerRunning.load(std::memory_order_acquire)) {
+    startWriter();
+  }
+
+  // Queue the line, waiting for the writer thread to make room if the ring buffer of this thread is full
+  auto& ring = getThreadRing();
+  while (!ring.tryPush(line)) {
+    wakeUpWriter();
+    std::this_thread::yield();
+  }
+  if (ring.size() >= m_threadBufferSize / 2) {
+    wakeUpWriter();
+  }
+}
+
+//------------------------------------------------------------------------------
+// getThreadRing
+//------------------------------------------------------------------------------
+AsyncFileLogger::LineRing& AsyncFileLogger::getThreadRing() {
+  // The ring buffers of the calling thread, one per logger
+  struct ThreadRings {
+    std::vector<std::pair<uint64_t, std::shared_ptr<LineRing>>> m_rings;
+
+    ~ThreadRings() {
+      for (const auto& ring : m_rings | std::views::values) {
+        ring->m_producerExited = true;
+      }
+    }
+  };
+  thread_local ThreadRings threadRings;
+
+  for (const auto& [loggerId, ring] : threadRings.m_rings) {
+    if (loggerId == m_id) {
+      return *ring;
+    }
+  }
+
+  // First message logged by this thread
+  std::erase_if(threadRings.m_rings, [](const auto& idAndRing) { return idAndRing.second->m_loggerDestroyed.load(); });
+  auto ring = std::make_shared<LineRing>(m_threadBufferSize);
+  {
+    std::lock_guard lock(m_ringsMutex);
+    m_rings.push_back(ring);
+    m_ringsVersion++;
+  }
+  threadRings.m_rings.emplace_back(m_id, ring);
+  return *ring;
+}
+
+//------------------------------------------------------------------------------
+// startWriter
+//------------------------------------------------------------------------------
+void AsyncFileLogger::startWriter() {
+  std::lock_guard lock(m_writerMutex);
+  if (m_writerRunning) {
+    return;
+  }
+  m_stopWriter = false;
+  m_writer = std::thread(&AsyncFileLogger::writerLoop, this);
+  m_writerRunning.store(true, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// stopWriter
+//------------------------------------------------------------------------------
+void AsyncFileLogger::stopWriter() {
+  std::lock_guard lock(m_writerMutex);
+  if (!m_writerRunning) {
+    return;
+  }
+  m_stopWriter = true;
+  wakeUpWriter();
+  m_writer.join();
+  m_writerRunning = false;
+}
+
+//------------------------------------------------------------------------------
+// writerLoop
+//------------------------------------------------------------------------------
+void AsyncFileLogger::writerLoop() {
+  std::vector<std::shared_ptr<LineRing>> rings;
+  uint64_t ringsVersion = 0;
+  bool ringsKnown = false;
+  while (true) {
+    if (!ringsKnown || ringsVersion != m_ringsVersion) {
+      std::lock_guard lock(m_ringsMutex);
+      rings = m_rings;
+      ringsVersion = m_ringsVersion;
+      ringsKnown = true;
+    }
+
+    const size_t nbLinesWritten = drainRings(rings);
+
+    // Forget the ring buffers of the threads which have exited once they are empty. Whether the thread has exited
+    // must be checked first, as the ring buffer is not empty anymore if the thread logged before exiting.
+    const auto isDone = [](const std::shared_ptr<LineRing>& ring) {
+      return ring->m_producerExited.load() && 0 == ring->size();
+    };
+    if (std::ranges::any_of(rings, isDone)) {
+      std::lock_guard lock(m_ringsMutex);
+      std::erase_if(m_rings, isDone);
+      m_ringsVersion++;
+    }
+
+    if (0 == nbLinesWritten) {
+      if (m_stopWriter) {
+        return;
+      }
+      std::unique_lock lock(m_writerCvMutex);
+      m_writerCv.wait_for(lock, WRITER_IDLE_PERIOD);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// drainRings
+//------------------------------------------------------------------------------
+size_t AsyncFileLogger::drainRings(const std::vector<std::shared_ptr<LineRing>>& rings) {
+  // The lines are written in batches of at most IOV_MAX lines, each ring buffer is drained once so that the new
+  // ring buffers are taken into account even if the logging threads keep the writer thread busy
+  std::vector<iovec> lines;
+  lines.reserve(IOV_MAX);
+  std::vector<std::pair<LineRing*, uint64_t>> nbLinesPerRing;
+  size_t nbLinesWritten = 0;
+  const auto writeBatch = [&]() {
+    writeLines(lines);
+    for (const auto& [ring, nbLines] : nbLinesPerRing) {
+      ring->release(nbLines);
+    }
+    nbLinesWritten += lines.size();
+    lines.clear();
+    nbLinesPerRing.clear();
+  };
+
+  for (const auto& ring : rings) {
+    const uint64_t head = ring->head();
+    uint64_t position = ring->tail();
+    while (position < head) {
+      const uint64_t nbLines = std::min<uint64_t>(head - position, IOV_MAX - lines.size());
+      for (uint64_t i = 0; i < nbLines; i++) {
+        auto& line = ring->lineAt(position + i);
+        lines.push_back({line.data(), line.size()});
+      }
+      nbLinesPerRing.emplace_back(ring.get(), nbLines);
+      position += nbLines;
+      if (IOV_MAX == lines.size()) {
+        writeBatch();
+      }
+    }
+  }
+  if (!lines.empty()) {
+    writeBatch();
+  }
+  return nbLinesWritten;
+}
+
+//------------------------------------------------------------------------------
+// writeLines
+//------------------------------------------------------------------------------
+void AsyncFileLogger::writeLines(std::vector<iovec>& lines) {
+  std::lock_guard lock(m_fdMutex);
+  iovec* iov = lines.data();
+  auto iovcnt = static_cast<int>(lines.size());
+  while (iovcnt > 0) {
+    const ssize_t nbBytesWritten = ::writev(m_fd, iov, iovcnt);
+    if (nbBytesWritten < 0) {
+      if (EINTR == errno) {
+        continue;
+      }
+      return;
+    }
+    // Skip what has been written in case of a partial write
+    auto remainingBytes = static_cast<size_t>(nbBytesWritten);
+    while (iovcnt > 0 && remainingBytes >= iov->iov_len) {
+      remainingBytes -= iov->iov_len;
+      iov++;
+      iovcnt--;
+    }
+    if (iovcnt > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + remainingBytes;
+      iov->iov_len -= remainingBytes;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// wakeUpWriter
+//------------------------------------------------------------------------------
+void AsyncFileLogger::wakeUpWriter() {
+  m_writerCv.notify_one();
+}
+
+}  // namespace cta::log
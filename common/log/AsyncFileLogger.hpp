@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/Logger.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sys/uio.h>
+#include <thread>
+#include <vector>
+
+namespace cta::log {
+
+/**
+ * Class implementing the API of the CTA logging system which writes to a file asynchronously
+ *
+ * The logging threads never write to the file nor take a lock shared with the other logging threads. Each of them
+ * formats its log lines and hands them over to the writer thread through its own lock-free single-producer
+ * single-consumer ring buffer. The writer thread drains the ring buffers of all the logging threads and writes their
+ * lines to the file in batches with writev().
+ *
+ * The lines logged by the same thread are written in order, but the lines of different threads can be written in a
+ * different order than they were logged. Their time stamps are the time they were logged.
+ *
+ * A logging thread whose ring buffer is full waits for the writer thread to make room, so no log line is lost when the
+ * file cannot keep up.
+ */
+class AsyncFileLogger : public Logger {
+public:
+  /**
+   * The default number of log lines which can be queued by each logging thread
+   */
+  static constexpr size_t DEFAULT_THREAD_BUFFER_SIZE = 1024;
+
+  /**
+   * Constructor
+   *
+   * @param hostName         The host name to be prepended to every log message.
+   * @param programName      The name of the program to be prepended to every log message.
+   * @param filePath         Path to the log file.
+   * @param logMask          The log mask.
+   * @param threadBufferSize The number of log lines which can be queued by each logging thread.
+   */
+  AsyncFileLogger(std::string_view hostName,
+                  std::string_view programName,
+                  const std::string& filePath,
+                  int logMask,
+                  size_t threadBufferSize = DEFAULT_THREAD_BUFFER_SIZE);
+
+  /**
+   * Destructor
+   *
+   * Writes the queued log lines before returning.
+   */
+  ~AsyncFileLogger() final;
+
+  /**
+   * Prepares the logger object for a call to fork().
+   *
+   * Writes the queued log lines and stops the writer thread, which is restarted by the next log message in the parent
+   * and in the child processes.
+   *
+   * No further calls to operator() should be made after calling this
+   * method until the call to fork() has completed.
+   */
+  void prepareForFork() final;
+
+  /**
+   * Refresh the underlying logger setup
+   */
+  void refresh() final;
+
+  /**
+   * Waits until the log lines queued so far have been written to the file
+   */
+  void flush();
+
+protected:
+  /**
+   * Queues the specified msg to be written to the log file by the writer thread
+   *
+   * @param header The header of the message to be logged.
+   * @param body The body of the message to be logged.
+   */
+  void writeMsgToUnderlyingLoggingSystem(std::string_view header, std::string_view body) final;
+
+private:
+  /**
+   * Lock-free ring buffer of log lines, written by one logging thread and read by the writer thread
+   */
+  class LineRing;
+
+  /**
+   * Returns the ring buffer of the calling thread, creating it on the first call
+   */
+  LineRing& getThreadRing();
+
+  /**
+   * Starts the writer thread if it is not running
+   */
+  void startWriter();
+
+  /**
+   * Stops the writer thread after it has written the queued log lines
+   */
+  void stopWriter();
+
+  /**
+   * Body of the writer thread
+   */
+  void writerLoop();
+
+  /**
+   * Writes the log lines queued in the specified ring buffers
+   *
+   * @param rings The ring buffers to drain
+   * @return      The number of log lines written
+   */
+  size_t drainRings(const std::vector<std::shared_ptr<LineRing>>& rings);
+
+  /**
+   * Writes the specified log lines to the log file
+   *
+   * The lines are dropped if they cannot be written, as there is nowhere to report the error.
+   *
+   * @param lines The log lines
+   */
+  void writeLines(std::vector<iovec>& lines);
+
+  /**
+   * Wakes up the writer thread
+   */
+  void wakeUpWriter();
+
+  /**
+   * Unique identifier of the logger, used to find the ring buffers of this logger among those of a thread
+   */
+  const uint64_t m_id;
+
+  /**
+   * The number of log lines which can be queued by each logging thread
+   */
+  const size_t m_threadBufferSize;
+
+  /**
+   * Log file path
+   */
+  const std::string m_filePath;
+
+  /**
+   * Mutex protecting the output file handle, which is only used by the writer thread and refresh()
+   */
+  std::mutex m_fdMutex;
+
+  /**
+   * The output file handle
+   */
+  int m_fd = -1;
+
+  /**
+   * Mutex protecting the list of ring buffers, only taken when a thread logs for the first time
+   */
+  std::mutex m_ringsMutex;
+
+  /**
+   * The ring buffers of the logging threads
+   */
+  std::vector<std::shared_ptr<LineRing>> m_rings;
+
+  /**
+   * Incremented each time a ring buffer is added to or removed from m_rings
+   */
+  std::atomic<uint64_t> m_ringsVersion = 0;
+
+  /**
+   * Mutex protecting the start and the stop of the writer thread
+   */
+  std::mutex m_writerMutex;
+
+  /**
+   * Mutex associated to m_writerCv
+   */
+  std::mutex m_writerCvMutex;
+
+  /**
+   * Condition variable used to wake up the writer thread
+   */
+  std::condition_variable m_writerCv;
+
+  /**
+   * The writer thread
+   */
+  std::thread m_writer;
+
+  /**
+   * True while the writer thread is running
+   */
+  std::atomic<bool> m_writerRunning = false;
+
+  /**
+   * Set to ask the writer thread to exit after writing the queued log lines
+   */
+  std::atomic<bool> m_stopWriter = false;
+};
+
+}  // namespace cta::log
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "AsyncFileLogger.hpp"
+
+#include "FileLogger.hpp"
+#include "tests/TempFile.hpp"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace cta::log;
+
+namespace unitTests {
+TEST(cta_log_AsyncFileLogger, basicTest) {
+  std::string jat = "Just a test";
+  TempFile tf;
+  AsyncFileLogger fl("dummy", "cta_log_AsyncFileLogger", tf.path(), DEBUG);
+  fl(INFO, jat);
+  fl.flush();
+  std::ifstream ifs(tf.path());
+  std::stringstream res;
+  res << ifs.rdbuf();
+  ASSERT_NE(std::string::npos, res.str().find(jat));
+}
+
+TEST(cta_log_AsyncFileLogger, allLinesWrittenInThreadOrder) {
+  const int nbThreads = 4;
+  const int nbMsgsPerThread = 1000;
+  TempFile tf;
+  {
+    // A small ring buffer makes the logging threads wait for the writer thread
+    AsyncFileLogger fl("dummy", "cta_log_AsyncFileLogger", tf.path(), DEBUG, 8);
+    fl.setLogFormat("json");
+    std::vector<std::thread> threads;
+    for (int t = 0; t < nbThreads; t++) {
+      threads.emplace_back([&fl, t]() {
+        for (int i = 0; i < nbMsgsPerThread; i++) {
+          fl(INFO, "Test message", {Param("thread", t), Param("msgNb", i)});
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::ifstream ifs(tf.path());
+  std::map<int, int> nextMsgNbPerThread;
+  int nbLines = 0;
+  for (std::string line; std::getline(ifs, line); nbLines++) {
+    ASSERT_EQ('{', line.front());
+    ASSERT_EQ('}', line.back());
+    const auto msgNbPos = line.find(R"("msgNb":)");
+    const auto threadPos = line.find(R"("thread":)");
+    ASSERT_NE(std::string::npos, msgNbPos);
+    ASSERT_NE(std::string::npos, threadPos);
+    const int msgNb = std::stoi(line.substr(msgNbPos + 8));
+    const int thread = std::stoi(line.substr(threadPos + 9));
+    ASSERT_EQ(nextMsgNbPerThread[thread]++, msgNb);
+  }
+  ASSERT_EQ(nbThreads * nbMsgsPerThread, nbLines);
+}
+
+TEST(cta_log_AsyncFileLogger, sameOutputAsFileLogger) {
+  TempFile asyncTf;
+  TempFile syncTf;
+  AsyncFileLogger afl("dummy", "cta_log_AsyncFileLogger", asyncTf.path(), DEBUG);
+  FileLogger fl("dummy", "cta_log_AsyncFileLogger", syncTf.path(), DEBUG);
+  afl.setLogFormat("json");
+  fl.setLogFormat("json");
+  const std::vector<Param> params = {Param("vid", "V00001"), Param("fileId", 1), Param("ratio", 0.5)};
+  afl(INFO, "Test message", params);
+  fl(INFO, "Test message", params);
+  afl.flush();
+
+  // The lines only differ before the message: time stamps and source location
+  const auto readFromMessage = [](const std::string& path) {
+    std::ifstream ifs(path);
+    std::stringstream res;
+    res << ifs.rdbuf();
+    return res.str().substr(res.str().find(R"("message":)"));
+  };
+  ASSERT_EQ(readFromMessage(syncTf.path()), readFromMessage(asyncTf.path()));
+}
+}  // namespace unitTests
@@ -48,13 +48,22 @@ void FileLogger::writeMsgToUnderlyingLoggingSystem(std::string_view header, std:
   }
 
   // Prepare the string to print
-  std::ostringstream logLine;
-  logLine << (m_logFormat == LogFormat::JSON ? "{" : "") << header << body
-          << (m_logFormat == LogFormat::JSON ? "}" : "") << std::endl;
+  const bool isJson = m_logFormat == LogFormat::JSON;
+  std::string logLine;
+  logLine.reserve(header.size() + body.size() + 3);
+  if (isJson) {
+    logLine += '{';
+  }
+  logLine += header;
+  logLine += body;
+  if (isJson) {
+    logLine += '}';
+  }
+  logLine += '\n';
 
   // Append the message to the file
   threading::MutexLocker lock(m_mutex);
-  exception::Errnum::throwOnMinusOne(::write(m_fd, logLine.str().c_str(), logLine.str().size()),
+  exception::Errnum::throwOnMinusOne(::write(m_fd, logLine.data(), logLine.size()),
                                      "In FileLogger::writeMsgToUnderlyingLoggingSystem(): failed to write to file");
 }
 
@@ -17,34 +17,43 @@ namespace cta::log {
 LogContext::LogContext(Logger& logger) noexcept : m_log(logger) {}
 
 void LogContext::push(const Param& param) noexcept {
-  m_paramsMap[param.getName()].push_back(param);
+  const auto it = std::ranges::upper_bound(m_params, param.getName(), {}, &Param::getName);
+  m_params.insert(it, param);
 }
 
 void LogContext::push(Param&& param) noexcept {
-  m_paramsMap[param.getName()].push_back(std::move(param));
+  const auto it = std::ranges::upper_bound(m_params, param.getName(), {}, &Param::getName);
+  m_params.insert(it, std::move(param));
 }
 
-void LogContext::pop(const std::string& paramName) noexcept {
-  if (auto it = m_paramsMap.find(paramName); it != m_paramsMap.end()) {
-    it->second.pop_back();
-    if (it->second.empty()) {
-      m_paramsMap.erase(it);
-    }
+void LogContext::pop(std::string_view paramName) noexcept {
+  // The last parameter pushed with this name is the last one of its range
+  if (auto it = std::ranges::upper_bound(m_params, paramName, {}, &Param::getName);
+      it != m_params.begin() && std::prev(it)->getName() == paramName) {
+    m_params.erase(std::prev(it));
   }
 }
 
 void LogContext::erase(const std::set<std::string>& paramNamesSet) noexcept {
-  for (const auto& paramName : paramNamesSet) {
-    m_paramsMap.erase(paramName);
-  }
+  std::erase_if(m_params, [&paramNamesSet](const Param& param) { return paramNamesSet.contains(param.getName()); });
 }
 
 void LogContext::clear() {
-  m_paramsMap.clear();
+  m_params.clear();
+}
+
+size_t LogContext::size() const {
+  size_t nbNames = 0;
+  for (auto it = m_params.begin(); it != m_params.end(); ++it) {
+    if (std::next(it) == m_params.end() || std::next(it)->getName() != it->getName()) {
+      nbNames++;
+    }
+  }
+  return nbNames;
 }
 
 void LogContext::log(int priority, std::string_view msg, const std::source_location location) noexcept {
-  m_log.logInternal(priority, msg, m_paramsMap, location);
+  m_log.logInternal(priority, msg, m_params, location);
 }
 
 void LogContext::logEvent(int priority,
@@ -53,7 +62,7 @@ void LogContext::logEvent(int priority,
                           const std::source_location location) noexcept {
   Param eventParam(semconv::log::eventName, eventName);
   push(eventParam);
-  m_log.logInternal(priority, msg, m_paramsMap, location);
+  m_log.logInternal(priority, msg, m_params, location);
   pop(eventParam.getName());
 }
 
@@ -106,13 +115,17 @@ LogContext::ScopedParam::~ScopedParam() noexcept {
 
 std::ostream& operator<<(std::ostream& os, const LogContext& lc) {
   bool first = true;
-  for (auto& p : lc.m_paramsMap | std::views::values) {
+  for (auto it = lc.m_params.begin(); it != lc.m_params.end(); ++it) {
+    // Only the last parameter pushed with a name is visible
+    if (std::next(it) != lc.m_params.end() && std::next(it)->getName() == it->getName()) {
+      continue;
+    }
     if (!first) {
       os << " ";
     } else {
       first = false;
     }
-    os << p.back().getName() << "=" << p.back().getValueStr();
+    os << it->getName() << "=" << it->getValueStr();
   }
   return os;
 }
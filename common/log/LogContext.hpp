@@ -18,6 +18,10 @@ namespace cta::log {
  * Container for a set of parameters to be used repetitively in logs. The
  * container is ordered , by order of inclusion. There can be only one
  * parameter value per parameter name.
+ *
+ * The parameters are kept in a flat vector sorted by name, so that pushing and
+ * popping the innermost parameter of a scope does not allocate a tree node and
+ * the vector can be handed to the logger as is.
  */
 class LogContext final {
   friend std::ostream& operator<<(std::ostream& os, const LogContext& lc);
@@ -55,7 +59,7 @@ public:
     * Does not throw exceptions (fails silently).
     * @param paramName
     */
-  void pop(const std::string& paramName) noexcept;
+  void pop(std::string_view paramName) noexcept;
 
   /**
    * Erases all parameters with a name from the list.
@@ -118,7 +122,7 @@ public:
    * Small introspection function to help in tests
    * @return size
    */
-  size_t size() const { return m_paramsMap.size(); }
+  size_t size() const;
 
   /**
    * Scoped parameter addition to the context. Constructor adds the parameter,
@@ -137,7 +141,11 @@ public:
 
 private:
   Logger& m_log;
-  std::map<std::string, std::vector<Param>> m_paramsMap;
+
+  /**
+   * The parameters sorted by name, the parameters with the same name are kept in the order they were pushed
+   */
+  std::vector<Param> m_params;
 };  // class LogContext
 
 class ScopedParamContainer {
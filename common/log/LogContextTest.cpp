@@ -157,6 +157,24 @@ TEST(cta_log_LogContextTest, paramsFound) {
   ASSERT_EQ(std::string::npos, third.find("fileId", offset));
 }
 
+TEST(cta_log_LogContextTest, paramsLoggedInNameOrder) {
+  StringLogger sl("dummy", "cta_log_LogContextTest", DEBUG);
+  LogContext lc(sl);
+  lc.push(Param("vid", "V00001"));
+  lc.push(Param("fileId", 1));
+  lc.push(Param("vid", "V00002"));
+  lc.push(Param("archiveFileId", 2));
+  ASSERT_EQ(3U, lc.size());
+  lc.log(INFO, "Test");
+  ASSERT_NE(std::string::npos, sl.getLog().find(R"(archiveFileId="2" fileId="1" vid="V00002" )"));
+  ASSERT_EQ(std::string::npos, sl.getLog().find("V00001"));
+  sl.clearLog();
+
+  lc.pop("vid");
+  lc.log(INFO, "Test");
+  ASSERT_NE(std::string::npos, sl.getLog().find(R"(archiveFileId="2" fileId="1" vid="V00001" )"));
+}
+
 TEST(cta_log_LogContextTest, logMessageEscaping) {
   StringLogger sl(R"(dummy")", R"(cta_log_LogContextTest_escaped")", DEBUG);
   sl.setLogFormat("json");
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/LogContext.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace cta::log {
+
+/**
+ * Name of a log message field, usable as a template parameter
+ */
+template<size_t N>
+struct FieldName {
+  consteval FieldName(const char (&name)[N]) { std::copy_n(name, N, m_name); }
+
+  constexpr std::string_view view() const { return {m_name, N - 1}; }
+
+  char m_name[N];
+};
+
+/**
+ * The types of the values of the log message fields: the values are captured as is and only converted into log
+ * parameters when the message passes the log mask
+ */
+template<typename T>
+concept LogFieldValue =
+  std::is_arithmetic_v<T> || std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+template<typename T>
+struct IsOptionalLogFieldValue : std::false_type {};
+
+template<LogFieldValue T>
+struct IsOptionalLogFieldValue<std::optional<T>> : std::true_type {};
+
+/**
+ * A field of a log message: its name and the type of its value
+ */
+template<FieldName Name, typename T>
+  requires LogFieldValue<T> || IsOptionalLogFieldValue<T>::value
+struct Field {
+  static constexpr std::string_view name = Name.view();
+  using Type = T;
+  // Scalars are passed by value, strings by reference so that they are not copied when the message is filtered out
+  using ArgType = std::conditional_t<std::is_scalar_v<T>, T, const T&>;
+};
+
+/**
+ * Returns true if the specified field names are non-empty and unique
+ */
+consteval bool areValidFieldNames(std::initializer_list<std::string_view> names) {
+  for (auto it = names.begin(); it != names.end(); ++it) {
+    if (it->empty() || std::find(std::next(it), names.end(), *it) != names.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Log message whose fields are declared at compile time
+ *
+ * The values of the fields are given in the order of the fields. They are only converted into log parameters, and
+ * the message only formatted, if the priority of the message passes the log mask of the logger. The fields take
+ * precedence over the parameters of the log context with the same name, which are restored afterwards.
+ *
+ * \code{.cpp}
+ *
+ * using FileReadLog = cta::log::LogSchema<cta::log::Field<"fileId", uint64_t>, cta::log::Field<"readTime", double>>;
+ *
+ * FileReadLog::log(lc, cta::log::DEBUG, "File read", fileId, readTime);
+ *
+ * \endcode
+ */
+template<typename... Fields>
+class LogSchema {
+public:
+  /**
+   * Writes a message with the specified field values
+   *
+   * @param lc       the log context, whose parameters are added to the message
+   * @param priority the priority of the message as defined by the syslog API
+   * @param msg      the message
+   * @param values   the values of the fields, in the order of the fields
+   * @param location source location of where the log statement was executed
+   */
+  static void log(LogContext& lc,
+                  int priority,
+                  std::string_view msg,
+                  typename Fields::ArgType... values,
+                  const std::source_location location = std::source_location::current()) noexcept {
+    if (!lc.logger().isLogged(priority)) {
+      return;
+    }
+    (lc.push(Param(Fields::name, toParamValue(values))), ...);
+    lc.log(priority, msg, location);
+    (lc.pop(Fields::name), ...);
+  }
+
+private:
+  static_assert(areValidFieldNames({Fields::name...}),
+                "The names of the fields of a log message must be non-empty and unique");
+
+  /**
+   * String views are stored as strings by the parameters, the other values as is
+   */
+  template<typename T>
+  static decltype(auto) toParamValue(const T& value) {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+      return std::string(value);
+    } else if constexpr (std::is_same_v<T, std::optional<std::string_view>>) {
+      return value.has_value() ? std::optional<std::string>(*value) : std::nullopt;
+    } else {
+      return value;
+    }
+  }
+};
+
+}  // namespace cta::log
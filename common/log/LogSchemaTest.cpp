@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "common/log/LogSchema.hpp"
+
+#include "common/log/StringLogger.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace cta::log;
+
+namespace unitTests {
+
+using TestLog = LogSchema<Field<"fileId", uint64_t>,
+                          Field<"readTime", double>,
+                          Field<"path", std::string>,
+                          Field<"type", std::string_view>,
+                          Field<"vid", std::optional<std::string>>>;
+
+TEST(cta_log_LogSchemaTest, fieldsLogged) {
+  StringLogger sl("dummy", "cta_log_LogSchemaTest", DEBUG);
+  LogContext lc(sl);
+  lc.push(Param("MigrationRequestId", 123));
+  TestLog::log(lc, INFO, "Test", 1234, 0.5, "/eos/file", "Test", std::nullopt);
+  ASSERT_NE(
+    std::string::npos,
+    sl.getLog().find(
+      R"(MigrationRequestId="123" fileId="1234" path="/eos/file" readTime="0.5" type="Test" vid="" )"));
+
+  // The fields are removed from the log context
+  ASSERT_EQ(1U, lc.size());
+}
+
+TEST(cta_log_LogSchemaTest, sameOutputAsParams) {
+  StringLogger schemaLogger("dummy", "cta_log_LogSchemaTest", DEBUG);
+  StringLogger paramsLogger("dummy", "cta_log_LogSchemaTest", DEBUG);
+  schemaLogger.setLogFormat("json");
+  paramsLogger.setLogFormat("json");
+  LogContext schemaLc(schemaLogger);
+  LogContext paramsLc(paramsLogger);
+
+  TestLog::log(schemaLc, INFO, "Test", 1234, 2.0, "/eos/file", "Test", "V00001");
+  {
+    ScopedParamContainer params(paramsLc);
+    params.add("fileId", uint64_t(1234))
+      .add("readTime", 2.0)
+      .add("path", "/eos/file")
+      .add("type", "Test")
+      .add("vid", std::optional<std::string>("V00001"));
+    paramsLc.log(INFO, "Test");
+  }
+
+  const auto fromMessage = [](const std::string& log) { return log.substr(log.find(R"("message":)")); };
+  ASSERT_EQ(fromMessage(paramsLogger.getLog()), fromMessage(schemaLogger.getLog()));
+}
+
+TEST(cta_log_LogSchemaTest, fieldsOverrideContext) {
+  StringLogger sl("dummy", "cta_log_LogSchemaTest", DEBUG);
+  LogContext lc(sl);
+  lc.push(Param("fileId", 1));
+  TestLog::log(lc, INFO, "Test", 2, 0.5, "/eos/file", "Test", "V00001");
+  ASSERT_NE(std::string::npos, sl.getLog().find(R"(fileId="2")"));
+  ASSERT_EQ(std::string::npos, sl.getLog().find(R"(fileId="1")"));
+  sl.clearLog();
+
+  // The parameter of the log context is restored
+  lc.log(INFO, "Test");
+  ASSERT_NE(std::string::npos, sl.getLog().find(R"(fileId="1")"));
+}
+
+TEST(cta_log_LogSchemaTest, filteredOut) {
+  StringLogger sl("dummy", "cta_log_LogSchemaTest", INFO);
+  LogContext lc(sl);
+  TestLog::log(lc, DEBUG, "Test", 1234, 0.5, "/eos/file", "Test", "V00001");
+  ASSERT_TRUE(sl.getLog().empty());
+  ASSERT_EQ(0U, lc.size());
+}
+
+}  // namespace unitTests
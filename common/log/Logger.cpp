@@ -11,6 +11,7 @@
 #include "common/utils/utils.hpp"
 #include "version.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <ranges>
 #include <sys/time.h>
@@ -24,7 +25,9 @@ namespace cta::log {
 Logger::Logger(std::string_view hostName, std::string_view programName, int logMask)
     : m_hostName(hostName),
       m_programName(programName),
-      m_logMask(logMask) {}
+      m_logMask(logMask) {
+  formatStaticHeader();
+}
 
 //------------------------------------------------------------------------------
 // destructor
@@ -38,22 +41,28 @@ void Logger::operator()(int priority,
                         std::string_view msg,
                         const std::vector<Param>& params,
                         const std::source_location location) noexcept {
-  std::map<std::string, std::vector<Param>> paramsMap;
-  for (auto& param : params) {
-    paramsMap[param.getName()].push_back(param);
+  if (std::ranges::is_sorted(params, {}, &Param::getName)) {
+    logInternal(priority, msg, params, location);
+    return;
   }
-  logInternal(priority, msg, paramsMap, location);
+  std::vector<Param> sortedParams(params);
+  sortParams(sortedParams);
+  logInternal(priority, msg, sortedParams, location);
 }
 
 void Logger::operator()(int priority,
                         std::string_view msg,
                         std::vector<Param>&& params,
                         const std::source_location location) noexcept {
-  std::map<std::string, std::vector<Param>> paramsMap;
-  for (auto& param : params) {
-    paramsMap[param.getName()].push_back(std::move(param));
-  }
-  logInternal(priority, msg, paramsMap, location);
+  sortParams(params);
+  logInternal(priority, msg, params, location);
+}
+
+//-----------------------------------------------------------------------------
+// sortParams
+//-----------------------------------------------------------------------------
+void Logger::sortParams(std::vector<Param>& params) {
+  std::ranges::stable_sort(params, {}, &Param::getName);
 }
 
 //-----------------------------------------------------------------------------
@@ -61,7 +70,7 @@ void Logger::operator()(int priority,
 //-----------------------------------------------------------------------------
 void Logger::logInternal(int priority,
                          std::string_view msg,
-                         const std::map<std::string, std::vector<Param>>& paramsMap,
+                         const std::vector<Param>& params,
                          const std::source_location location) noexcept {
   // Ignore messages whose priority is not of interest
   if (priority > m_logMask) {
@@ -81,7 +90,7 @@ void Logger::logInternal(int priority,
   }
 
   const std::string header = createMsgHeader(timeStamp, location);
-  const std::string body = createMsgBody(priorityTextPair->second, msg, paramsMap, pid);
+  const std::string body = createMsgBody(priorityTextPair->second, msg, params, pid);
 
   writeMsgToUnderlyingLoggingSystem(header, body);
 }
@@ -149,6 +158,25 @@ void Logger::setLogFormat(std::string_view logFormat) {
   } else {
     throw exception::Exception("Log format value \"" + std::string(logFormat) + "\" is invalid.");
   }
+  formatStaticHeader();
+}
+
+//------------------------------------------------------------------------------
+// formatStaticHeader
+//------------------------------------------------------------------------------
+void Logger::formatStaticHeader() {
+  std::ostringstream os;
+  switch (m_logFormat) {
+    case LogFormat::DEFAULT:
+      os << m_hostName << " " << m_programName << ": ";
+      break;
+    case LogFormat::JSON:
+      os << R"("cta_version":")" << stringFormattingJSON(CTA_VERSION) << R"(",)"
+         << R"("log_schema_version":")" << stringFormattingJSON(LOG_SCHEMA_VERSION) << R"(",)"
+         << R"("hostname":")" << stringFormattingJSON(m_hostName) << R"(",)"
+         << R"("program":")" << stringFormattingJSON(m_programName) << R"(",)";
+  }
+  m_staticHeaderStr = os.str();
 }
 
 //------------------------------------------------------------------------------
@@ -215,15 +243,11 @@ std::string Logger::createMsgHeader(const TimestampT& timeStamp, const std::sour
   switch (m_logFormat) {
     case LogFormat::DEFAULT:
       os << std::put_time(&localTime, "%b %e %T") << '.' << std::setfill('0') << std::setw(9) << ts_ns_fraction << ' '
-         << m_hostName << " " << m_programName << ": ";
+         << m_staticHeaderStr;
       break;
     case LogFormat::JSON:
       os << R"("epoch_time":)" << ts_s_fraction << '.' << std::setfill('0') << std::setw(9) << ts_ns_fraction << R"(,)"
-         << R"("local_time":")" << std::put_time(&localTime, "%FT%T%z") << R"(",)"
-         << R"("cta_version":")" << stringFormattingJSON(CTA_VERSION) << R"(",)"
-         << R"("log_schema_version":")" << stringFormattingJSON(LOG_SCHEMA_VERSION) << R"(",)"
-         << R"("hostname":")" << stringFormattingJSON(m_hostName) << R"(",)"
-         << R"("program":")" << stringFormattingJSON(m_programName) << R"(",)"
+         << R"("local_time":")" << std::put_time(&localTime, "%FT%T%z") << R"(",)" << m_staticHeaderStr
          << R"("source_location":")" << stringFormattingJSON(sourceLoc) << R"(",)";
   }
   return os.str();
@@ -274,7 +298,7 @@ std::ostream& operator<<(std::ostream& oss, const Logger::stringFormattingJSON&
 //-----------------------------------------------------------------------------
 std::string Logger::createMsgBody(std::string_view logLevel,
                                   std::string_view msg,
-                                  const std::map<std::string, std::vector<Param>>& paramsMap,
+                                  const std::vector<Param>& params,
                                   int pid) const {
   std::ostringstream os;
 
@@ -295,9 +319,12 @@ std::string Logger::createMsgBody(std::string_view logLevel,
   // Print static params
   os << m_staticParamsStr;
 
-  // Process parameters
-  for (const auto& paramVector : paramsMap | std::views::values) {
-    auto& param = paramVector.back();
+  // Process parameters, only the last one of the parameters with the same name is logged
+  for (auto it = params.begin(); it != params.end(); ++it) {
+    if (std::next(it) != params.end() && std::next(it)->getName() == it->getName()) {
+      continue;
+    }
+    auto& param = *it;
     // Write the name and value to the buffer
     switch (m_logFormat) {
       case LogFormat::DEFAULT: {
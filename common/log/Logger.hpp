@@ -120,6 +120,15 @@ public:
                   std::vector<Param>&& params = std::vector<Param>(),
                   const std::source_location location = std::source_location::current()) noexcept;
 
+  /**
+   * Returns true if the messages of the specified priority pass the log mask
+   *
+   * It allows skipping the preparation of the parameters of a message which would be ignored.
+   *
+   * @param priority the priority of the message as defined by the syslog API
+   */
+  bool isLogged(int priority) const noexcept { return priority <= m_logMask; }
+
   /**
    * Sets the log mask
    *
@@ -225,6 +234,12 @@ protected:
    */
   std::string m_staticParamsStr;
 
+  /**
+   * Part of the message header which does not change from one message to the next: version, host and program names.
+   * It is formatted once for the current log format by formatStaticHeader.
+   */
+  std::string m_staticHeaderStr;
+
   /**
    * Map from syslog integer priority to textual representation
    */
@@ -255,14 +270,19 @@ protected:
    *
    * @param priority the priority of the message as defined by the syslog API
    * @param msg      the message
-   * @param params   parameters of the message, will select last value for each entry
+   * @param params   parameters of the message sorted by name, will select last value for each name
    * @param location source location of where the log statement was executed
    */
   void logInternal(int priority,
                    std::string_view msg,
-                   const std::map<std::string, std::vector<Param>>& paramsMap,
+                   const std::vector<Param>& params,
                    const std::source_location location) noexcept;
 
+  /**
+   * Sorts the specified parameters by name, keeping the parameters with the same name in order
+   */
+  static void sortParams(std::vector<Param>& params);
+
   /**
    * Generates and returns the mapping between syslog priorities and their textual representations
    */
@@ -310,14 +330,19 @@ private:
    *
    * @param logLevel    Log level
    * @param msg         Message text
-   * @param params      Message parameters
+   * @param params      Message parameters sorted by name
    * @param pid         Process ID of the process logging the message
    * @return            Message body
    */
   std::string createMsgBody(std::string_view logLevel,
                             std::string_view msg,
-                            const std::map<std::string, std::vector<Param>>& params,
+                            const std::vector<Param>& params,
                             int pid) const;
+
+  /**
+   * Formats m_staticHeaderStr for the current log format
+   */
+  void formatStaticHeader();
 };
 
 }  // namespace cta::log
@@ -36,6 +36,8 @@ static constexpr const char* kSchedulerNamespace = "cta.scheduler.namespace";  /
 static constexpr const char* kSchedulerOperationName = "cta.scheduler.operation.name";
 static constexpr const char* kSchedulerOperationWorkflow = "cta.scheduler.operation.workflow";
 static constexpr const char* kFrontendRequesterName = "cta.frontend.requester.name";
+static constexpr const char* kFrontendRequestPhase = "cta.frontend.request.phase";
+static constexpr const char* kFrontendRequestQueue = "cta.frontend.request.queue";
 static constexpr const char* kCtaTransferDirection = "cta.transfer.direction";
 static constexpr const char* kCtaIoDirection = "cta.io.direction";  // similar to disk.io.direction
 static constexpr const char* kCtaIoMedium = "cta.io.medium";
@@ -46,6 +48,8 @@ static constexpr const char* kTapeDriveName = "tape.drive.name";
 static constexpr const char* kTapeLibraryLogicalName = "tape.library.logical.name";
 static constexpr const char* kCtaRoutineName = "cta.routine.name";
 static constexpr const char* kCtaRepackReportType = "cta.repack.report.type";
+static constexpr const char* kCtaCatalogueCacheName = "cta.catalogue.cache.name";
+static constexpr const char* kCtaCatalogueCacheResult = "cta.catalogue.cache.result";
 
 // -------------------- Attribute Values --------------------
 
@@ -84,6 +88,21 @@ static constexpr const char* kRetrieveSuccess = "RetrieveSuccess";
 static constexpr const char* kRetrieveFailed = "RetrieveFailed";
 }  // namespace CtaRepackReportTypeValues
 
+namespace CtaCatalogueCacheResultValues {
+static constexpr const char* kHit = "hit";
+static constexpr const char* kStaleHit = "stale_hit";
+static constexpr const char* kMiss = "miss";
+static constexpr const char* kRefresh = "refresh";
+static constexpr const char* kCoalesced = "coalesced";
+}  // namespace CtaCatalogueCacheResultValues
+
+namespace FrontendRequestPhaseValues {
+static constexpr const char* kAuth = "auth";
+static constexpr const char* kCatalogue = "catalogue";
+static constexpr const char* kScheduler = "scheduler";
+static constexpr const char* kResponse = "response";
+}  // namespace FrontendRequestPhaseValues
+
 namespace ErrorTypeValues {
 static constexpr const char* kUserError = "user_error";
 static constexpr const char* kException = "exception";
@@ -37,6 +37,20 @@ static constexpr const char* kMetricCtaFrontendActiveRequests = "cta.frontend.ac
 static constexpr const char* descrCtaFrontendActiveRequests = "Number of active CTA Frontend requests.";
 static constexpr const char* unitCtaFrontendActiveRequests = "1";
 
+static constexpr const char* kMetricCtaFrontendRequestPhaseDuration = "cta.frontend.request.phase.duration";
+static constexpr const char* descrCtaFrontendRequestPhaseDuration =
+  "Duration the frontend spends in a given phase of the processing of a request.";
+static constexpr const char* unitCtaFrontendRequestPhaseDuration = "ms";
+
+static constexpr const char* kMetricCtaFrontendRequestQueueWait = "cta.frontend.request.queue.wait";
+static constexpr const char* descrCtaFrontendRequestQueueWait =
+  "Time a request waits in the frontend before a thread starts processing it.";
+static constexpr const char* unitCtaFrontendRequestQueueWait = "ms";
+
+static constexpr const char* kMetricCtaFrontendQueuedRequests = "cta.frontend.queued_requests";
+static constexpr const char* descrCtaFrontendQueuedRequests = "Number of requests waiting for a frontend thread.";
+static constexpr const char* unitCtaFrontendQueuedRequests = "1";
+
 // -------------------- RDBMS --------------------
 
 // See https://opentelemetry.io/docs/specs/semconv/database/database-metrics/#metric-dbclientoperationduration
@@ -56,6 +70,31 @@ static constexpr const char* descrDbClientConnectionCount =
   "The number of connections that are currently in state described by the state attribute.";
 static constexpr const char* unitDbClientConnectionCount = "1";
 
+static constexpr const char* kMetricCtaCatalogueArchiveFileIdRefillCount = "cta.catalogue.archive_file_id.refill.count";
+static constexpr const char* descrCtaCatalogueArchiveFileIdRefillCount =
+  "Number of blocks of archive file IDs fetched from the catalogue";
+static constexpr const char* unitCtaCatalogueArchiveFileIdRefillCount = "1";
+
+static constexpr const char* kMetricCtaCatalogueArchiveFileIdWastedCount = "cta.catalogue.archive_file_id.wasted.count";
+static constexpr const char* descrCtaCatalogueArchiveFileIdWastedCount =
+  "Number of fetched archive file IDs never handed out before shutdown";
+static constexpr const char* unitCtaCatalogueArchiveFileIdWastedCount = "1";
+
+static constexpr const char* kMetricCtaCatalogueCacheLookupCount = "cta.catalogue.cache.lookup.count";
+static constexpr const char* descrCtaCatalogueCacheLookupCount =
+  "Number of lookups in the catalogue caches by result";
+static constexpr const char* unitCtaCatalogueCacheLookupCount = "1";
+
+static constexpr const char* kMetricCtaRdbmsFetchDuration = "cta.rdbms.fetch.duration";
+static constexpr const char* descrCtaRdbmsFetchDuration =
+  "Time spent fetching the rows of the result set of a database query.";
+static constexpr const char* unitCtaRdbmsFetchDuration = "ms";
+
+static constexpr const char* kMetricCtaRdbmsSlowStatementCount = "cta.rdbms.slow_statement.count";
+static constexpr const char* descrCtaRdbmsSlowStatementCount =
+  "Number of database statements slower than the slow statement threshold";
+static constexpr const char* unitCtaRdbmsSlowStatementCount = "1";
+
 // -------------------- SCHEDULER --------------------
 
 // Based on https://opentelemetry.io/docs/specs/semconv/messaging/messaging-metrics/#metric-messagingclientoperationduration
@@ -152,4 +191,12 @@ static constexpr const char* kMetricCtaMaintdRoutineDuration = "cta.maintd.routi
 static constexpr const char* descrCtaMaintdRoutineDuration = "Duration to execute a routine of the given type";
 static constexpr const char* unitCtaMaintdRoutineDuration = "ms";
 
+static constexpr const char* kMetricCtaMaintdRoutineQueueDepth = "cta.maintd.routine.queue.depth";
+static constexpr const char* descrCtaMaintdRoutineQueueDepth = "Number of routines due and waiting for a worker";
+static constexpr const char* unitCtaMaintdRoutineQueueDepth = "1";
+
+static constexpr const char* kMetricCtaMaintdRoutineLag = "cta.maintd.routine.lag";
+static constexpr const char* descrCtaMaintdRoutineLag = "Delay before a due routine is executed";
+static constexpr const char* unitCtaMaintdRoutineLag = "ms";
+
 }  // namespace cta::semconv::metrics
@@ -16,6 +16,9 @@ namespace cta::telemetry::metrics {
 
 std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaFrontendRequestDuration;
 std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaFrontendActiveRequests;
+std::unique_ptr<opentelemetry::metrics::Histogram<double>> ctaFrontendRequestPhaseDuration;
+std::unique_ptr<opentelemetry::metrics::Histogram<double>> ctaFrontendRequestQueueWait;
+std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaFrontendQueuedRequests;
 
 }  // namespace cta::telemetry::metrics
 
@@ -32,6 +35,21 @@ void initInstruments() {
     meter->CreateInt64UpDownCounter(cta::semconv::metrics::kMetricCtaFrontendActiveRequests,
                                     cta::semconv::metrics::descrCtaFrontendActiveRequests,
                                     cta::semconv::metrics::unitCtaFrontendActiveRequests);
+
+  cta::telemetry::metrics::ctaFrontendRequestPhaseDuration =
+    meter->CreateDoubleHistogram(cta::semconv::metrics::kMetricCtaFrontendRequestPhaseDuration,
+                                 cta::semconv::metrics::descrCtaFrontendRequestPhaseDuration,
+                                 cta::semconv::metrics::unitCtaFrontendRequestPhaseDuration);
+
+  cta::telemetry::metrics::ctaFrontendRequestQueueWait =
+    meter->CreateDoubleHistogram(cta::semconv::metrics::kMetricCtaFrontendRequestQueueWait,
+                                 cta::semconv::metrics::descrCtaFrontendRequestQueueWait,
+                                 cta::semconv::metrics::unitCtaFrontendRequestQueueWait);
+
+  cta::telemetry::metrics::ctaFrontendQueuedRequests =
+    meter->CreateInt64UpDownCounter(cta::semconv::metrics::kMetricCtaFrontendQueuedRequests,
+                                    cta::semconv::metrics::descrCtaFrontendQueuedRequests,
+                                    cta::semconv::metrics::unitCtaFrontendQueuedRequests);
 }
 
 // Register and run this init function at start time
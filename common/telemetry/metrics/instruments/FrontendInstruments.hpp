@@ -17,5 +17,17 @@ extern std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaFrontendR
  * Number of active requests in the CTA frontend.
  */
 extern std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaFrontendActiveRequests;
+/**
+ * Duration the frontend spends in each phase of the processing of a request.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Histogram<double>> ctaFrontendRequestPhaseDuration;
+/**
+ * Time a request waits in the frontend before a thread starts processing it.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Histogram<double>> ctaFrontendRequestQueueWait;
+/**
+ * Number of requests waiting for a thread in the CTA frontend.
+ */
+extern std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaFrontendQueuedRequests;
 
 }  // namespace cta::telemetry::metrics
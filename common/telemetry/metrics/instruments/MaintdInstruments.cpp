@@ -14,6 +14,8 @@
 
 namespace cta::telemetry::metrics {
 std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaMaintdRoutineDuration;
+std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaMaintdRoutineQueueDepth;
+std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaMaintdRoutineLag;
 }  // namespace cta::telemetry::metrics
 
 namespace {
@@ -24,6 +26,16 @@ void initInstruments() {
     meter->CreateUInt64Histogram(cta::semconv::metrics::kMetricCtaMaintdRoutineDuration,
                                  cta::semconv::metrics::descrCtaMaintdRoutineDuration,
                                  cta::semconv::metrics::unitCtaMaintdRoutineDuration);
+
+  cta::telemetry::metrics::ctaMaintdRoutineQueueDepth =
+    meter->CreateInt64UpDownCounter(cta::semconv::metrics::kMetricCtaMaintdRoutineQueueDepth,
+                                    cta::semconv::metrics::descrCtaMaintdRoutineQueueDepth,
+                                    cta::semconv::metrics::unitCtaMaintdRoutineQueueDepth);
+
+  cta::telemetry::metrics::ctaMaintdRoutineLag =
+    meter->CreateUInt64Histogram(cta::semconv::metrics::kMetricCtaMaintdRoutineLag,
+                                 cta::semconv::metrics::descrCtaMaintdRoutineLag,
+                                 cta::semconv::metrics::unitCtaMaintdRoutineLag);
 }
 
 // Register and run this init function at start time
@@ -14,4 +14,14 @@ namespace cta::telemetry::metrics {
  */
 extern std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaMaintdRoutineDuration;
 
+/**
+ * Number of routines due for execution and waiting for a worker.
+ */
+extern std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> ctaMaintdRoutineQueueDepth;
+
+/**
+ * Delay between the time a routine of the given type is due and the start of its execution.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaMaintdRoutineLag;
+
 }  // namespace cta::telemetry::metrics
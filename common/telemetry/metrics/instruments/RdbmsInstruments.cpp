@@ -17,6 +17,11 @@ namespace cta::telemetry::metrics {
 std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> dbClientOperationDuration;
 std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> dbClientResponseReturnedRows;
 std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> dbClientConnectionCount;
+std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueArchiveFileIdRefillCount;
+std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueArchiveFileIdWastedCount;
+std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueCacheLookupCount;
+std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaRdbmsFetchDuration;
+std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaRdbmsSlowStatementCount;
 
 }  // namespace cta::telemetry::metrics
 
@@ -38,6 +43,31 @@ void initInstruments() {
     meter->CreateInt64UpDownCounter(cta::semconv::metrics::kMetricDbClientConnectionCount,
                                     cta::semconv::metrics::descrDbClientConnectionCount,
                                     cta::semconv::metrics::unitDbClientConnectionCount);
+
+  cta::telemetry::metrics::ctaCatalogueArchiveFileIdRefillCount =
+    meter->CreateUInt64Counter(cta::semconv::metrics::kMetricCtaCatalogueArchiveFileIdRefillCount,
+                               cta::semconv::metrics::descrCtaCatalogueArchiveFileIdRefillCount,
+                               cta::semconv::metrics::unitCtaCatalogueArchiveFileIdRefillCount);
+
+  cta::telemetry::metrics::ctaCatalogueArchiveFileIdWastedCount =
+    meter->CreateUInt64Counter(cta::semconv::metrics::kMetricCtaCatalogueArchiveFileIdWastedCount,
+                               cta::semconv::metrics::descrCtaCatalogueArchiveFileIdWastedCount,
+                               cta::semconv::metrics::unitCtaCatalogueArchiveFileIdWastedCount);
+
+  cta::telemetry::metrics::ctaCatalogueCacheLookupCount =
+    meter->CreateUInt64Counter(cta::semconv::metrics::kMetricCtaCatalogueCacheLookupCount,
+                               cta::semconv::metrics::descrCtaCatalogueCacheLookupCount,
+                               cta::semconv::metrics::unitCtaCatalogueCacheLookupCount);
+
+  cta::telemetry::metrics::ctaRdbmsFetchDuration =
+    meter->CreateUInt64Histogram(cta::semconv::metrics::kMetricCtaRdbmsFetchDuration,
+                                 cta::semconv::metrics::descrCtaRdbmsFetchDuration,
+                                 cta::semconv::metrics::unitCtaRdbmsFetchDuration);
+
+  cta::telemetry::metrics::ctaRdbmsSlowStatementCount =
+    meter->CreateUInt64Counter(cta::semconv::metrics::kMetricCtaRdbmsSlowStatementCount,
+                               cta::semconv::metrics::descrCtaRdbmsSlowStatementCount,
+                               cta::semconv::metrics::unitCtaRdbmsSlowStatementCount);
 }
 
 // Register and run this init function at start time
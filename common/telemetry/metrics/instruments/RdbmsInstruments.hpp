@@ -24,4 +24,29 @@ extern std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> dbClientResp
  */
 extern std::unique_ptr<opentelemetry::metrics::UpDownCounter<int64_t>> dbClientConnectionCount;
 
+/**
+ * Number of blocks of archive file IDs fetched from the catalogue.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueArchiveFileIdRefillCount;
+
+/**
+ * Number of fetched archive file IDs never handed out before shutdown.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueArchiveFileIdWastedCount;
+
+/**
+ * Number of lookups in the catalogue caches by result.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaCatalogueCacheLookupCount;
+
+/**
+ * Time spent fetching the rows of the result set of a database query.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Histogram<uint64_t>> ctaRdbmsFetchDuration;
+
+/**
+ * Number of database statements slower than the slow statement threshold.
+ */
+extern std::unique_ptr<opentelemetry::metrics::Counter<uint64_t>> ctaRdbmsSlowStatementCount;
+
 }  // namespace cta::telemetry::metrics
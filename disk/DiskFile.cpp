@@ -8,6 +8,7 @@
 #include "disk/DiskFileImplementations.hpp"
 
 #include <algorithm>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <uuid/uuid.h>
@@ -15,7 +16,9 @@
 
 namespace cta::disk {
 
-DiskFileFactory::DiskFileFactory(uint16_t xrootTimeout) : m_xrootTimeout(xrootTimeout) {}
+DiskFileFactory::DiskFileFactory(uint16_t xrootTimeout, bool localDirectIO)
+    : m_xrootTimeout(xrootTimeout),
+      m_localDirectIO(localDirectIO) {}
 
 ReadFile* DiskFileFactory::createReadFile(const std::string& path) {
   std::vector<std::string> regexResult;
@@ -45,7 +48,7 @@ WriteFile* DiskFileFactory::createWriteFile(const std::string& path) {
   // local file URL?
   regexResult = m_URLLocalFile.exec(path);
   if (regexResult.size()) {
-    return new LocalWriteFile(regexResult[1]);
+    return new LocalWriteFile(regexResult[1], m_localDirectIO);
   }
   // Xroot URL?
   regexResult = m_URLXrootFile.exec(path);
@@ -56,7 +59,7 @@ WriteFile* DiskFileFactory::createWriteFile(const std::string& path) {
   // Do we have a local file?
   regexResult = m_NoURLLocalFile.exec(path);
   if (regexResult.size()) {
-    return new LocalWriteFile(regexResult[2]);
+    return new LocalWriteFile(regexResult[2], m_localDirectIO);
   }
   throw cta::exception::Exception(std::string("In DiskFileFactory::createWriteFile failed to parse URL: ") + path);
 }
@@ -95,9 +98,14 @@ LocalReadFile::~LocalReadFile() noexcept {
 //==============================================================================
 // LOCAL WRITE FILE
 //==============================================================================
-LocalWriteFile::LocalWriteFile(const std::string& path) {
+LocalWriteFile::LocalWriteFile(const std::string& path, bool directIO) : m_directIO(directIO) {
   // For local files, we truncate the file like for RFIO
-  m_fd = ::open64((char*) path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  m_fd = ::open64((char*) path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | (m_directIO ? O_DIRECT : 0), 0666);
+  if (m_fd == -1 && m_directIO && errno == EINVAL) {
+    // The file system does not support direct I/O
+    m_directIO = false;
+    m_fd = ::open64((char*) path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+  }
   m_URL = "file://";
   m_URL += path;
   cta::exception::Errnum::throwOnMinusOne(m_fd,
@@ -106,7 +114,25 @@ LocalWriteFile::LocalWriteFile(const std::string& path) {
 }
 
 void LocalWriteFile::write(const void* data, const size_t size) {
-  ::write(m_fd, (void*) data, size);
+  if (m_directIO && (reinterpret_cast<uintptr_t>(data) % kDirectIOAlignment || size % kDirectIOAlignment)) {
+    // Only the last block of a file is expected to be unaligned: write it through the page cache
+    const int flags = ::fcntl(m_fd, F_GETFL);
+    cta::exception::Errnum::throwOnMinusOne(flags, std::string("In LocalWriteFile::write failed fcntl() on ") + m_URL);
+    cta::exception::Errnum::throwOnMinusOne(::fcntl(m_fd, F_SETFL, flags & ~O_DIRECT),
+                                            std::string("In LocalWriteFile::write failed fcntl() on ") + m_URL);
+    m_directIO = false;
+  }
+  auto remaining = size;
+  auto position = static_cast<const char*>(data);
+  while (remaining) {
+    const ssize_t written = ::write(m_fd, position, remaining);
+    if (written == -1 && errno == EINTR) {
+      continue;
+    }
+    cta::exception::Errnum::throwOnMinusOne(written, std::string("In LocalWriteFile::write failed write() on ") + m_URL);
+    position += written;
+    remaining -= written;
+  }
 }
 
 void LocalWriteFile::close() {
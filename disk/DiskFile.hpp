@@ -31,6 +31,12 @@ class WriteFile;
 class DiskFileRemover;
 class Directory;
 
+/**
+ * Alignment of the buffer address, size and file offset required for direct I/O to local files.
+ * Buffers aligned this way can also be transferred by DMA by the SCSI tape driver.
+ */
+static constexpr size_t kDirectIOAlignment = 4096;
+
 /**
        * Factory class deciding on the type of read/write file type
        * based on the url passed
@@ -39,7 +45,11 @@ class DiskFileFactory {
   using Regex = cta::utils::Regex;
 
 public:
-  explicit DiskFileFactory(uint16_t xrootTimeout);
+  /**
+   * @param xrootTimeout Timeout for XRoot functions
+   * @param localDirectIO Whether local files are written with direct I/O (O_DIRECT), bypassing the page cache
+   */
+  explicit DiskFileFactory(uint16_t xrootTimeout, bool localDirectIO = false);
   ReadFile* createReadFile(const std::string& path);
   WriteFile* createWriteFile(const std::string& path);
 
@@ -48,6 +58,7 @@ private:
   Regex m_URLLocalFile {"^file://(.*)$"};
   Regex m_URLXrootFile {"^(root://.*)$"};
   const uint16_t m_xrootTimeout;
+  const bool m_localDirectIO;
 };
 
 class ReadFile {
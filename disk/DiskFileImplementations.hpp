@@ -37,13 +37,19 @@ private:
 
 class LocalWriteFile : public WriteFile {
 public:
-  explicit LocalWriteFile(const std::string& path);
+  /**
+   * @param path Path of the file to write
+   * @param directIO Open the file with O_DIRECT, so that aligned buffers are transferred to the disk
+   * without going through the page cache. Falls back to buffered I/O if the file system does not support it.
+   */
+  explicit LocalWriteFile(const std::string& path, bool directIO = false);
   void write(const void* data, const size_t size) final;
   void close() final;
   ~LocalWriteFile() noexcept final;
 
 private:
   int m_fd;
+  bool m_directIO;
   bool m_closeTried = false;
 };
 
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "DiskReportWindow.hpp"
+
+#include <algorithm>
+
+namespace cta::disk {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+DiskReportWindow::DiskReportWindow(size_t maxInFlightPerEndpoint)
+    : m_maxInFlightPerEndpoint(std::max(maxInFlightPerEndpoint, size_t(1))) {}
+
+//------------------------------------------------------------------------------
+// destructor
+//------------------------------------------------------------------------------
+DiskReportWindow::~DiskReportWindow() {
+  // The reporters must outlive their asynchronous reports
+  for (auto& [endpoint, inFlightReports] : m_inFlightReports) {
+    for (auto& inFlightReport : inFlightReports) {
+      try {
+        inFlightReport.reporter->waitReport();
+      } catch (...) {}
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// report
+//------------------------------------------------------------------------------
+void DiskReportWindow::report(std::unique_ptr<DiskReporter> reporter, CompletionCallback onCompletion) {
+  auto& inFlightReports = m_inFlightReports[reporter->getEndpoint()];
+  while (inFlightReports.size() >= m_maxInFlightPerEndpoint) {
+    completeOldest(inFlightReports);
+  }
+  reporter->asyncReport();
+  inFlightReports.push_back({std::move(reporter), std::move(onCompletion)});
+}
+
+//------------------------------------------------------------------------------
+// waitAll
+//------------------------------------------------------------------------------
+void DiskReportWindow::waitAll() {
+  for (auto& [endpoint, inFlightReports] : m_inFlightReports) {
+    while (!inFlightReports.empty()) {
+      completeOldest(inFlightReports);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// completeOldest
+//------------------------------------------------------------------------------
+void DiskReportWindow::completeOldest(std::deque<InFlightReport>& inFlightReports) {
+  InFlightReport oldest = std::move(inFlightReports.front());
+  inFlightReports.pop_front();
+  std::exception_ptr error;
+  try {
+    oldest.reporter->waitReport();
+  } catch (...) {
+    error = std::current_exception();
+  }
+  try {
+    oldest.onCompletion(error);
+  } catch (...) {}
+}
+
+}  // namespace cta::disk
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "DiskReporter.hpp"
+
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace cta::disk {
+
+/**
+ * Sends disk reports asynchronously while bounding the number of reports in flight to each endpoint
+ *
+ * The reports are grouped by the endpoint they are sent to. Once the maximum number of reports are in flight to an
+ * endpoint, sending a new report to this endpoint first waits for the oldest of them to complete. The reports to the
+ * other endpoints are not affected, so a slow disk instance does not hold back the reports to the others.
+ *
+ * The completion callbacks are called by the thread sending the reports, in the order the reports were sent to each
+ * endpoint. They are expected to handle their own errors: an exception thrown by a completion callback is dropped, so
+ * that it cannot be taken for a failure of the report being sent when the callback was called.
+ */
+class DiskReportWindow {
+public:
+  /**
+   * Called when a report completes, with the exception thrown by the report if it failed
+   */
+  using CompletionCallback = std::function<void(std::exception_ptr error)>;
+
+  /**
+   * The default maximum number of reports in flight to an endpoint
+   */
+  static constexpr size_t DEFAULT_MAX_IN_FLIGHT_PER_ENDPOINT = 100;
+
+  /**
+   * Constructor
+   *
+   * @param maxInFlightPerEndpoint The maximum number of reports in flight to an endpoint
+   */
+  explicit DiskReportWindow(size_t maxInFlightPerEndpoint = DEFAULT_MAX_IN_FLIGHT_PER_ENDPOINT);
+
+  /**
+   * Destructor
+   *
+   * Waits for the reports still in flight, without calling their completion callbacks.
+   */
+  ~DiskReportWindow();
+
+  /**
+   * Sends the specified report asynchronously
+   *
+   * An exception thrown when launching the report is passed on to the caller and the completion callback is not
+   * called.
+   *
+   * @param reporter     The report to send
+   * @param onCompletion Called when the report completes
+   */
+  void report(std::unique_ptr<DiskReporter> reporter, CompletionCallback onCompletion);
+
+  /**
+   * Waits for all the reports in flight to complete
+   */
+  void waitAll();
+
+private:
+  struct InFlightReport {
+    std::unique_ptr<DiskReporter> reporter;
+    CompletionCallback onCompletion;
+  };
+
+  /**
+   * Waits for the oldest of the specified reports in flight to complete, removes it and calls its completion callback
+   */
+  static void completeOldest(std::deque<InFlightReport>& inFlightReports);
+
+  const size_t m_maxInFlightPerEndpoint;
+
+  /**
+   * The reports in flight to each endpoint, oldest first
+   */
+  std::map<std::string, std::deque<InFlightReport>, std::less<>> m_inFlightReports;
+};
+
+}  // namespace cta::disk
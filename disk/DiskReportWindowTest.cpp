@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "disk/DiskReportWindow.hpp"
+
+#include "common/exception/Exception.hpp"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <vector>
+
+namespace unitTests {
+
+/**
+ * Reporter which keeps track of the number of reports in flight to each endpoint
+ */
+class FakeReporter : public cta::disk::DiskReporter {
+public:
+  FakeReporter(const std::string& endpoint, std::map<std::string, size_t>& inFlight, bool fail = false)
+      : m_endpoint(endpoint),
+        m_inFlight(inFlight),
+        m_fail(fail) {}
+
+  void asyncReport() override {
+    auto& count = m_inFlight[m_endpoint];
+    count++;
+    m_maxInFlight = std::max(m_maxInFlight, count);
+  }
+
+  void waitReport() override {
+    m_inFlight[m_endpoint]--;
+    if (m_fail) {
+      throw cta::exception::Exception("Report failed");
+    }
+  }
+
+  std::string getEndpoint() const override { return m_endpoint; }
+
+  static size_t m_maxInFlight;
+
+private:
+  std::string m_endpoint;
+  std::map<std::string, size_t>& m_inFlight;
+  bool m_fail;
+};
+
+size_t FakeReporter::m_maxInFlight = 0;
+
+TEST(DiskReportWindowTest, boundsReportsInFlightPerEndpoint) {
+  std::map<std::string, size_t> inFlight;
+  std::vector<std::string> completed;
+  FakeReporter::m_maxInFlight = 0;
+  {
+    cta::disk::DiskReportWindow window(3);
+    for (int i = 0; i < 10; i++) {
+      for (const std::string endpoint : {"eosA", "eosB"}) {
+        window.report(std::make_unique<FakeReporter>(endpoint, inFlight),
+                      [&completed, endpoint, i](std::exception_ptr error) {
+                        ASSERT_FALSE(error);
+                        completed.push_back(endpoint + std::to_string(i));
+                      });
+        ASSERT_LE(inFlight[endpoint], 3);
+      }
+    }
+    // The reports to each endpoint only wait for the reports to the same endpoint
+    ASSERT_EQ(3, inFlight["eosA"]);
+    ASSERT_EQ(3, inFlight["eosB"]);
+    window.waitAll();
+  }
+  ASSERT_EQ(3, FakeReporter::m_maxInFlight);
+  ASSERT_EQ(0, inFlight["eosA"]);
+  ASSERT_EQ(0, inFlight["eosB"]);
+  ASSERT_EQ(20, completed.size());
+  // The reports to an endpoint complete in the order they were sent
+  std::vector<std::string> completedToA;
+  std::copy_if(completed.begin(), completed.end(), std::back_inserter(completedToA), [](const std::string& c) {
+    return c.starts_with("eosA");
+  });
+  for (size_t i = 0; i < completedToA.size(); i++) {
+    ASSERT_EQ("eosA" + std::to_string(i), completedToA[i]);
+  }
+}
+
+TEST(DiskReportWindowTest, failedReportsPassedToCallback) {
+  std::map<std::string, size_t> inFlight;
+  size_t succeeded = 0;
+  size_t failed = 0;
+  cta::disk::DiskReportWindow window(2);
+  for (int i = 0; i < 6; i++) {
+    window.report(std::make_unique<FakeReporter>("eos", inFlight, i % 2), [&](std::exception_ptr error) {
+      if (error) {
+        ASSERT_THROW(std::rethrow_exception(error), cta::exception::Exception);
+        failed++;
+      } else {
+        succeeded++;
+      }
+    });
+  }
+  window.waitAll();
+  ASSERT_EQ(3, succeeded);
+  ASSERT_EQ(3, failed);
+}
+
+TEST(DiskReportWindowTest, callbackExceptionsDoNotReachReport) {
+  std::map<std::string, size_t> inFlight;
+  std::vector<int> completed;
+  cta::disk::DiskReportWindow window(1);
+  for (int i = 0; i < 4; i++) {
+    // Each report but the first completes the previous one, whose callback throws
+    ASSERT_NO_THROW(window.report(std::make_unique<FakeReporter>("eos", inFlight), [&completed, i](std::exception_ptr) {
+      completed.push_back(i);
+      throw cta::exception::Exception("Callback failed");
+    }));
+  }
+  ASSERT_NO_THROW(window.waitAll());
+  ASSERT_EQ((std::vector<int> {0, 1, 2, 3}), completed);
+}
+
+}  // namespace unitTests
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <future>
+#include <string>
 
 namespace cta::disk {
 
@@ -15,6 +16,11 @@ public:
 
   virtual void waitReport() { m_promise.get_future().get(); }
 
+  /**
+   * Returns the endpoint the report is sent to, or an empty string if the report is not sent anywhere
+   */
+  virtual std::string getEndpoint() const { return {}; }
+
   virtual ~DiskReporter() = default;
 
 protected:
@@ -16,7 +16,7 @@ DiskReporter* DiskReporterFactory::createDiskReporter(const std::string& URL) {
   threading::MutexLocker ml(m_mutex);
   auto regexResult = m_EosUrlRegex.exec(URL);
   if (regexResult.size()) {
-    return new EOSReporter(regexResult[1], regexResult[2]);
+    return new EOSReporter(regexResult[1], getEosFileSystem(regexResult[1]), regexResult[2]);
   }
   regexResult = m_NullRegex.exec(URL);
   if (regexResult.size()) {
@@ -26,4 +26,12 @@ DiskReporter* DiskReporterFactory::createDiskReporter(const std::string& URL) {
                                   + URL);
 }
 
+std::shared_ptr<XrdCl::FileSystem> DiskReporterFactory::getEosFileSystem(const std::string& hostURL) {
+  auto fs = m_eosFileSystems.find(hostURL);
+  if (fs == m_eosFileSystems.end()) {
+    fs = m_eosFileSystems.emplace(hostURL, std::make_shared<XrdCl::FileSystem>(XrdCl::URL(hostURL))).first;
+  }
+  return fs->second;
+}
+
 }  // namespace cta::disk
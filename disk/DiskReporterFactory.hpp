@@ -10,8 +10,14 @@
 #include "common/utils/Regex.hpp"
 
 #include <future>
+#include <map>
+#include <memory>
 #include <string>
 
+namespace XrdCl {
+class FileSystem;
+}
+
 namespace cta::disk {
 
 class DiskReporterFactory {
@@ -19,6 +25,14 @@ public:
   DiskReporter* createDiskReporter(const std::string& URL);
 
 private:
+  /**
+   * Returns the file system object of the specified EOS instance, creating it on the first call
+   *
+   * The file system objects are kept for the lifetime of the factory, so that all the reports to an EOS instance reuse
+   * the same connection instead of setting up a new one for each report. Must be called with m_mutex locked.
+   */
+  std::shared_ptr<XrdCl::FileSystem> getEosFileSystem(const std::string& hostURL);
+
   // The typical call to give report to EOS will be:
   // xrdfs localhost query opaquefile "/eos/wfe/passwd?mgm.pcmd=event&mgm.fid=112&mgm.logid=cta&mgm.event=migrated&mgm.workflow=default&mgm.path=/eos/wfe/passwd&mgm.ruid=0&mgm.rgid=0"
   // which will be encoded as eosQuery://eosserver.cern.ch/eos/wfe/passwd?mgm.pcmd=event&mgm.fid=112&mgm.logid=cta&mgm.event=migrated&mgm.workflow=default&mgm.path=/eos/wfe/passwd&mgm.ruid=0&mgm.rgid=0"
@@ -26,7 +40,9 @@ private:
   // XrdCl::FileSystem(XrdCl::URL("eoserver.cern.ch")).Query("/eos/wfe/passwd?mgm.pcmd=event&mgm.fid=112&mgm.logid=cta&mgm.event=migrated&mgm.workflow=default&mgm.path=/eos/wfe/passwd&mgm.ruid=0&mgm.rgid=0");
   cta::utils::Regex m_EosUrlRegex {"^eosQuery://([^/]+)(/.*)$"};
   cta::utils::Regex m_NullRegex {"^$|^null:"};
-  /// This mutex ensures we do not use the regexes in parallel.
+  /// This mutex ensures we do not use the regexes in parallel and protects m_eosFileSystems.
   cta::threading::Mutex m_mutex;
+  /// The file system objects of the EOS instances, by host URL.
+  std::map<std::string, std::shared_ptr<XrdCl::FileSystem>, std::less<>> m_eosFileSystems;
 };
 }  // namespace cta::disk
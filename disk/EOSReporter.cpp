@@ -9,15 +9,18 @@
 
 namespace cta::disk {
 
-EOSReporter::EOSReporter(const std::string& hostURL, const std::string& queryValue)
-    : m_fs(hostURL),
+EOSReporter::EOSReporter(const std::string& hostURL,
+                         std::shared_ptr<XrdCl::FileSystem> fs,
+                         const std::string& queryValue)
+    : m_hostURL(hostURL),
+      m_fs(std::move(fs)),
       m_query(queryValue) {}
 
 void EOSReporter::asyncReport() {
   auto qcOpaque = XrdCl::QueryCode::OpaqueFile;
   XrdCl::Buffer arg(m_query.size());
   arg.FromString(m_query);
-  XrdCl::XRootDStatus status = m_fs.Query(qcOpaque, arg, this, CTA_EOS_QUERY_TIMEOUT);
+  XrdCl::XRootDStatus status = m_fs->Query(qcOpaque, arg, this, CTA_EOS_QUERY_TIMEOUT);
   exception::XrdClException::throwOnError(
     status,
     "In EOSReporter::asyncReportArchiveFullyComplete(): failed to XrdCl::FileSystem::Query()");
@@ -9,6 +9,8 @@
 
 #include <XrdCl/XrdClFileSystem.hh>
 #include <future>
+#include <memory>
+#include <string>
 
 namespace cta::disk {
 
@@ -16,11 +18,22 @@ const uint16_t CTA_EOS_QUERY_TIMEOUT = 15;  // Timeout in seconds that is rounde
 
 class EOSReporter : public DiskReporter, public XrdCl::ResponseHandler {
 public:
-  EOSReporter(const std::string& hostURL, const std::string& queryValue);
+  /**
+   * Constructor
+   *
+   * @param hostURL    The URL of the EOS instance
+   * @param fs         The file system object of the EOS instance, shared by all the reports to this instance so that
+   *                   they reuse the same connection
+   * @param queryValue The query reporting the event
+   */
+  EOSReporter(const std::string& hostURL, std::shared_ptr<XrdCl::FileSystem> fs, const std::string& queryValue);
   void asyncReport() override;
 
+  std::string getEndpoint() const override { return m_hostURL; }
+
 private:
-  XrdCl::FileSystem m_fs;
+  std::string m_hostURL;
+  std::shared_ptr<XrdCl::FileSystem> m_fs;
   std::string m_query;
   void HandleResponse(XrdCl::XRootDStatus* status, XrdCl::AnyObject* response) override;
 };
@@ -21,7 +21,8 @@ namespace cta::frontend {
 
 AdminCmd::AdminCmd(const frontend::FrontendService& frontendService,
                    const common::dataStructures::SecurityIdentity& clientIdentity,
-                   const admin::AdminCmd& adminCmd)
+                   const admin::AdminCmd& adminCmd,
+                   double clientAuthMsecs)
     : AdminCmdOptions(adminCmd),
       m_adminCmd(adminCmd),
       m_catalogue(frontendService.getCatalogue()),
@@ -37,11 +38,14 @@ AdminCmd::AdminCmd(const frontend::FrontendService& frontendService,
       m_adminCommandMode(toAdminCmdMode(frontendService.getOperationMode())) {
   m_lc.push({"user", m_cliIdentity.username});
 
+  utils::Timer authTimer;
   m_scheduler.authorizeAdmin(m_cliIdentity, m_lc);
+  m_authMsecs = clientAuthMsecs + authTimer.msecs();
 }
 
 xrd::Response AdminCmd::process() {
   cta::frontend::RequestTracker requestTracker("ADMIN", "admin");
+  requestTracker.addPhaseTime(RequestTracker::Phase::Auth, m_authMsecs);
   xrd::Response response;
   utils::Timer t;
 
@@ -17,9 +17,12 @@ enum class AdminCmdStatus { SUCCESS, USER_ERROR, EXCEPTION };
 
 class AdminCmd : public AdminCmdOptions {
 public:
+  // clientAuthMsecs is the time in milliseconds spent validating the client token, it is added to the time taken by
+  // authorizeAdmin() in the Auth phase of the request
   AdminCmd(const frontend::FrontendService& frontendService,
            const common::dataStructures::SecurityIdentity& clientIdentity,
-           const admin::AdminCmd& adminCmd);
+           const admin::AdminCmd& adminCmd,
+           double clientAuthMsecs = 0);
 
   ~AdminCmd() override = default;
 
@@ -74,6 +77,7 @@ protected:
   catalogue::Catalogue& m_catalogue;  //!< Reference to CTA Catalogue
   cta::Scheduler& m_scheduler;        //!< Reference to CTA Scheduler
   log::LogContext m_lc;               //!< CTA Log Context
+  double m_authMsecs = 0;             //!< Time in milliseconds taken to authorize the client
 
 private:
   /*!
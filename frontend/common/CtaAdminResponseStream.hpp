@@ -25,6 +25,14 @@ public:
   virtual bool isDone() = 0;
   virtual cta::xrd::Data next() = 0;
 
+  /*!
+   * Fills the specified record with the next item of the stream
+   *
+   * The caller reuses the same record for all the items of the stream, so that the streams overriding this method
+   * can keep the memory already allocated for its fields instead of building a new record for each item.
+   */
+  virtual void fillNext(cta::xrd::Data& record) { record = next(); }
+
 protected:
   cta::catalogue::Catalogue& m_catalogue;
   cta::Scheduler& m_scheduler;
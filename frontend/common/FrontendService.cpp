@@ -9,7 +9,9 @@
 #include "catalogue/Catalogue.hpp"
 #include "catalogue/CatalogueFactory.hpp"
 #include "catalogue/CatalogueFactoryFactory.hpp"
+#include "catalogue/ReadReplicaQuery.hpp"
 #include "common/config/Config.hpp"
+#include "common/log/AsyncFileLogger.hpp"
 #include "common/log/FileLogger.hpp"
 #include "common/log/LogLevel.hpp"
 #include "common/log/StdoutLogger.hpp"
@@ -19,13 +21,20 @@
 #include "common/telemetry/config/TelemetryConfig.hpp"
 #include "common/utils/utils.hpp"
 #include "rdbms/Login.hpp"
+#include "rdbms/SlowStmtLog.hpp"
 #include "version.hpp"
 
 #include <fstream>
+#include <set>
 #include <opentelemetry/sdk/common/global_log_handler.h>
 
 namespace cta::frontend {
 
+namespace {
+// Maximum number of PREPARE events whose retrieve requests are queued with a single call to the scheduler
+constexpr size_t RETRIEVE_REQUEST_MAX_BATCH_SIZE = 100;
+}  // namespace
+
 std::string toString(AuthMethod method) {
   using enum AuthMethod;
   switch (method) {
@@ -136,6 +145,42 @@ void FrontendService::loadGrpcConfigParams(const std::string& configFileName,
     }
     m_threads = threads.value();
   }
+
+  // Each RPC type served with the callback API has its own threads and queue, so that slow admin commands or a storm
+  // of one workflow event cannot hold the threads serving the others
+  if (config.getOptionValueBool("grpc.callback_api.enabled").value_or(false)) {
+    const std::map<std::string, RpcQueueConfig, std::less<>> defaultRpcQueueConfigs = {
+      {"create",          {16, 2000}},
+      {"archive",         {32, 5000}},
+      {"retrieve",        {16, 5000}},
+      {"cancel_retrieve", {4, 1000} },
+      {"delete",          {8, 2000} },
+      {"admin",           {4, 100}  }
+    };
+    for (const auto& [rpcType, defaultRpcQueueConfig] : defaultRpcQueueConfigs) {
+      const std::string keyPrefix = "grpc.callback_api." + rpcType;
+      auto rpcThreads = config.getOptionValueUInt(keyPrefix + ".threads");
+      auto rpcQueueSize = config.getOptionValueUInt(keyPrefix + ".queue_size");
+      if (rpcThreads.has_value() && rpcThreads.value() < 1) {
+        throw exception::UserError("value of " + keyPrefix + ".threads must be at least 1 in configuration file "
+                                   + configFileName);
+      }
+      RpcQueueConfig rpcQueueConfig;
+      rpcQueueConfig.m_threads = rpcThreads.value_or(defaultRpcQueueConfig.m_threads);
+      rpcQueueConfig.m_queueSize = rpcQueueSize.value_or(defaultRpcQueueConfig.m_queueSize);
+      m_rpcQueueConfigs.emplace(rpcType, rpcQueueConfig);
+
+      std::vector<log::Param> params;
+      params.emplace_back("source", rpcThreads.has_value() || rpcQueueSize.has_value() ? configFileName
+                                                                                        : "Compile time default");
+      params.emplace_back("category", "grpc.callback_api");
+      params.emplace_back("key", rpcType);
+      params.emplace_back("value",
+                          std::to_string(rpcQueueConfig.m_threads) + " threads, queue of "
+                            + std::to_string(rpcQueueConfig.m_queueSize));
+      log(log::INFO, "Configuration entry", params);
+    }
+  }
 }
 
 void FrontendService::loadJWTConfigParams(const std::string& configFileName,
@@ -177,6 +222,10 @@ void FrontendService::loadJWTConfigParams(const std::string& configFileName,
   jwtConfig.m_jwksTotalTimeout = readJwtTimeout("grpc.jwks.total_timeout",
                                                 60,
                                                 "No value set for grpc.jwks.total_timeout, using default value (60s)");
+  jwtConfig.m_verifiedTokenTimeout =
+    readJwtTimeout("grpc.jwt.cache.timeout_secs",
+                   60,
+                   "No value set for grpc.jwt.cache.timeout_secs, using default value (60s)");
 
   if (jwtConfig.m_pubkeyTimeout != 0 && jwtConfig.m_pubkeyTimeout < jwtConfig.m_cacheRefreshInterval) {
     log(log::WARNING,
@@ -237,7 +286,12 @@ FrontendService::FrontendService(const std::string& configFilename,
     } else if (loggerURL.value().substr(0, 5) == "file:") {
       logtoFile = 1;
       logFilePath = loggerURL.value().substr(5);
-      m_log = std::make_unique<log::FileLogger>(shortHostname, "cta-frontend", logFilePath, loggerLevel);
+      // Write the log file from a dedicated thread, or from the logging threads
+      if (config.getOptionValueBool("cta.log.async").value_or(false)) {
+        m_log = std::make_unique<log::AsyncFileLogger>(shortHostname, "cta-frontend", logFilePath, loggerLevel);
+      } else {
+        m_log = std::make_unique<log::FileLogger>(shortHostname, "cta-frontend", logFilePath, loggerLevel);
+      }
     } else {
       throw exception::UserError(std::string("Unknown log URL: ") + loggerURL.value());
     }
@@ -349,6 +403,19 @@ FrontendService::FrontendService(const std::string& configFilename,
     log(log::INFO, "Configuration entry", params);
   }
 
+  // Database statements slower than the threshold are counted and a sample of them is logged
+  if (auto slowStmtThresholdMs = config.getOptionValueUInt("cta.rdbms.slow_statement_threshold_ms");
+      slowStmtThresholdMs.has_value()) {
+    rdbms::SlowStmtLog::enable(*m_log, slowStmtThresholdMs.value());
+
+    std::vector<log::Param> params;
+    params.emplace_back("source", configFilename);
+    params.emplace_back("category", "cta.rdbms");
+    params.emplace_back("key", "slow_statement_threshold_ms");
+    params.emplace_back("value", std::to_string(slowStmtThresholdMs.value()));
+    log(log::INFO, "Configuration entry", params);
+  }
+
   // Initialise the Catalogue
   std::string catalogueConfigFile = "/etc/cta/cta-catalogue.conf";
   const rdbms::Login catalogueLogin = rdbms::Login::parseFile(catalogueConfigFile);
@@ -392,6 +459,74 @@ FrontendService::FrontendService(const std::string& configFilename,
     }
   }
 
+  {
+    // Archive file IDs are handed out from blocks leased from the catalogue sequence
+    auto archiveFileIdBlockSize = config.getOptionValueUInt("cta.catalogue.archive_file_id_block_size");
+    // Block allocation is left disabled unless explicitly configured, as not every catalogue implements it
+    if (archiveFileIdBlockSize.value_or(0) > 1) {
+      m_catalogue->ArchiveFile()->setArchiveFileIdBlockSize(archiveFileIdBlockSize.value());
+    }
+
+    // Log cta.catalogue.archive_file_id_block_size
+    std::vector<log::Param> params;
+    params.emplace_back("source", archiveFileIdBlockSize.has_value() ? configFilename : "Compile time default");
+    params.emplace_back("category", "cta.catalogue");
+    params.emplace_back("key", "archive_file_id_block_size");
+    params.emplace_back("value", std::to_string(archiveFileIdBlockSize.value_or(0)));
+    log(log::INFO, "Configuration entry", params);
+  }
+
+  {
+    // Heavy read-only listings may be routed to a read replica of the catalogue database
+    auto replicaConfigFile = config.getOptionValueStr("cta.catalogue.replica.config_file");
+    if (replicaConfigFile.has_value()) {
+      const rdbms::Login replicaLogin = rdbms::Login::parseFile(replicaConfigFile.value());
+      const uint64_t nbReplicaConns = config.getOptionValueUInt("cta.catalogue.replica.numberofconnections").value_or(5);
+      const uint64_t maxReplicaLagSecs = config.getOptionValueUInt("cta.catalogue.replica.max_lag_secs").value_or(60);
+      std::set<catalogue::ReadReplicaQuery> replicaQueries;
+      for (const auto& queryName : config.getOptionValueStrVector("cta.catalogue.replica.queries")) {
+        replicaQueries.insert(catalogue::readReplicaQueryFromString(queryName));
+      }
+      if (replicaQueries.empty()) {
+        replicaQueries = catalogue::allReadReplicaQueries();
+      }
+      m_catalogue->setReadReplica(replicaLogin, nbReplicaConns, maxReplicaLagSecs, replicaQueries);
+
+      // Log cta.catalogue.replica.*
+      std::string replicaQueryNames;
+      for (const auto query : replicaQueries) {
+        replicaQueryNames += (replicaQueryNames.empty() ? "" : " ") + catalogue::toString(query);
+      }
+      std::vector<log::Param> params;
+      params.emplace_back("source", configFilename);
+      params.emplace_back("category", "cta.catalogue");
+      params.emplace_back("key", "replica");
+      params.emplace_back("configFile", replicaConfigFile.value());
+      params.emplace_back("numberofconnections", std::to_string(nbReplicaConns));
+      params.emplace_back("maxLagSecs", std::to_string(maxReplicaLagSecs));
+      params.emplace_back("queries", replicaQueryNames);
+      log(log::INFO, "Configuration entry", params);
+    }
+  }
+
+  {
+    // Cached mount policies and virtual organizations may be kept until another process notifies it modified them
+    auto cacheInvalidationEvents = config.getOptionValueBool("cta.catalogue.cache_invalidation_events");
+    if (cacheInvalidationEvents.value_or(false)) {
+      auto cacheMaxAgeSecs = config.getOptionValueUInt("cta.catalogue.cache_invalidation_events_max_age_secs");
+      m_catalogue->enableCacheInvalidationEvents(cacheMaxAgeSecs.value_or(600));
+
+      // Log cta.catalogue.cache_invalidation_events*
+      std::vector<log::Param> params;
+      params.emplace_back("source", configFilename);
+      params.emplace_back("category", "cta.catalogue");
+      params.emplace_back("key", "cache_invalidation_events");
+      params.emplace_back("value", "true");
+      params.emplace_back("maxAgeSecs", std::to_string(cacheMaxAgeSecs.value_or(600)));
+      log(log::INFO, "Configuration entry", params);
+    }
+  }
+
   m_catalogue_conn_string = catalogueLogin.connectionString;
 
   // Initialise the Scheduler DB
@@ -455,6 +590,11 @@ FrontendService::FrontendService(const std::string& configFilename,
   m_scheddb->initConfig(osThreadPoolSize, osThreadStackSize);
   // Initialise the Scheduler
   m_scheduler = std::make_unique<cta::Scheduler>(*m_catalogue, *m_scheddb, m_schedulerBackendName);
+  m_retrieveRequestBatcher = std::make_unique<RetrieveRequestBatcher>(
+    [this](const std::string& instanceName,
+           std::vector<common::dataStructures::RetrieveRequest>& requests,
+           log::LogContext& lc) { return m_scheduler->queueRetrieves(instanceName, requests, lc); },
+    RETRIEVE_REQUEST_MAX_BATCH_SIZE);
 
   // Initialise the Frontend
   auto archiveFileMaxSize = config.getOptionValueUInt("cta.archivefile.max_size_gb");
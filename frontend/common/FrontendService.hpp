@@ -7,9 +7,11 @@
 
 #include "AuthMethod.hpp"
 #include "OperationModes.hpp"
+#include "RetrieveRequestBatcher.hpp"
 #include "common/config/Config.hpp"
 #include "scheduler/Scheduler.hpp"
 
+#include <map>
 #include <stdexcept>
 #ifdef CTA_PGSCHED
 #include "scheduler/rdbms/RelationalDBInit.hpp"
@@ -37,6 +39,14 @@ struct JWTConfig {
   int m_cacheRefreshInterval;  //!< The number of seconds after which to update the cache of public keys used to sign JWT tokens
   int m_pubkeyTimeout;         //!< The number of seconds after which to update the cache entry for a cached key
   int m_jwksTotalTimeout;      //!< The total timeout in seconds for JWKS endpoint (default 60)
+  int m_verifiedTokenTimeout;  //!< The number of seconds a verified token is accepted without verifying it again (0 to disable)
+  // clang-format on
+};
+
+struct RpcQueueConfig {
+  // clang-format off
+  uint32_t m_threads;    //!< The maximum number of RPCs of a type served concurrently
+  uint32_t m_queueSize;  //!< The maximum number of RPCs of a type waiting to be served
   // clang-format on
 };
 
@@ -125,6 +135,11 @@ public:
    */
   cta::Scheduler& getScheduler() const { return *m_scheduler; }
 
+  /*!
+   * Get a reference to the batcher queueing the retrieve requests of PREPARE events
+   */
+  RetrieveRequestBatcher& getRetrieveRequestBatcher() const { return *m_retrieveRequestBatcher; }
+
   /**
    * Getting the configured scheduler backend name
    *
@@ -224,6 +239,12 @@ public:
    */
   std::optional<JWTConfig> getJwtConfig() const { return m_jwtConfig; }
 
+  /*
+   * Get the concurrency limits of each RPC type served with the gRPC callback API, by RPC type
+   * (empty if the RPCs are served with the synchronous API)
+   */
+  const std::map<std::string, RpcQueueConfig, std::less<>>& getRpcQueueConfigs() const { return m_rpcQueueConfigs; }
+
   /*
    * Get the instanceName from config file
    */
@@ -261,6 +282,7 @@ private:
   std::unique_ptr<SchedulerDBInit_t>            m_scheddbInit;                  //!< Persistent initialiser object for Scheduler DB
   std::unique_ptr<cta::SchedulerDB_t>           m_scheddb;                      //!< Scheduler DB for persistent objects (queues and requests)
   std::unique_ptr<cta::Scheduler>               m_scheduler;                    //!< The scheduler
+  std::unique_ptr<RetrieveRequestBatcher>       m_retrieveRequestBatcher;       //!< Queues the retrieve requests of concurrent PREPARE events together
   OperationMode                                 m_operationMode;                //!< Which operation mode (wfe / admin_*) is being used
   std::optional<uint64_t>                       m_tapeCacheMaxAgeSecs;          //!< Option to override the tape cache timeout value in the scheduler DB
   std::optional<uint64_t>                       m_retrieveQueueCacheMaxAgeSecs; //!< Option to override the retrieve queue timeout value in the scheduler DB
@@ -283,6 +305,7 @@ private:
   std::optional<std::string>                    m_tlsCert;                      //!< The TLS service certificate file
   std::optional<std::string>                    m_tlsChain;                     //!< The TLS CA chain file
   std::optional<JWTConfig>                      m_jwtConfig;                     //!< The JWT configuration parameters
+  std::map<std::string, RpcQueueConfig, std::less<>> m_rpcQueueConfigs;          //!< The concurrency limits of the RPCs served with the callback API
 
   uint64_t                                      m_missingFileCopiesMinAgeSecs;  //!< Missing tape file copies minimum age.
   uint64_t                                      m_recycleLogQuarantineSecs;     //!< Minimum quarantine period before tape reclaim
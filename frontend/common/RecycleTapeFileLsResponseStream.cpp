@@ -58,14 +58,21 @@ bool RecycleTapeFileLsResponseStream::isDone() {
 }
 
 cta::xrd::Data RecycleTapeFileLsResponseStream::next() {
+  cta::xrd::Data data;
+  fillNext(data);
+  return data;
+}
+
+void RecycleTapeFileLsResponseStream::fillNext(cta::xrd::Data& record) {
   if (isDone()) {
     throw std::runtime_error("Stream is exhausted");
   }
 
   const auto fileRecycleLog = m_fileRecycleLogItor.next();
 
-  cta::xrd::Data data;
-  auto recycleLogToReturn = data.mutable_rtfls_item();
+  // Only the item is cleared, its fields then keep their memory from one item of the stream to the next
+  auto recycleLogToReturn = record.mutable_rtfls_item();
+  recycleLogToReturn->Clear();
 
   recycleLogToReturn->set_instance_name(m_instanceName);
   recycleLogToReturn->set_vid(fileRecycleLog.vid);
@@ -101,8 +108,6 @@ cta::xrd::Data RecycleTapeFileLsResponseStream::next() {
   }
   recycleLogToReturn->set_reason_log(fileRecycleLog.reasonLog);
   recycleLogToReturn->set_recycle_log_time(fileRecycleLog.recycleLogTime);
-
-  return data;
 }
 
 }  // namespace cta::frontend
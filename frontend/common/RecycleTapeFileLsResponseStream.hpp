@@ -21,6 +21,7 @@ public:
                                   const admin::AdminCmd& adminCmd);
   bool isDone() override;
   cta::xrd::Data next() override;
+  void fillNext(cta::xrd::Data& record) override;
 
 private:
   catalogue::FileRecycleLogItor m_fileRecycleLogItor;
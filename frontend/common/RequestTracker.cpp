@@ -12,12 +12,24 @@
 
 namespace cta::frontend {
 
+namespace {
+
+// The values of the phase attribute, indexed by RequestTracker::Phase
+constexpr std::array kPhaseNames = {cta::semconv::attr::FrontendRequestPhaseValues::kAuth,
+                                    cta::semconv::attr::FrontendRequestPhaseValues::kCatalogue,
+                                    cta::semconv::attr::FrontendRequestPhaseValues::kScheduler,
+                                    cta::semconv::attr::FrontendRequestPhaseValues::kResponse};
+
+}  // namespace
+
 RequestTracker::RequestTracker(std::string_view eventName, std::string_view requesterName)
     : m_eventName(eventName),
       m_requesterName(requesterName) {
+  static_assert(kPhaseNames.size() == kNbPhases);
   cta::telemetry::metrics::ctaFrontendActiveRequests->Add(
     1,
     {
+      {cta::semconv::attr::kEventName,             m_eventName    },
       {cta::semconv::attr::kFrontendRequesterName, m_requesterName}
   });
 }
@@ -26,8 +38,10 @@ RequestTracker::~RequestTracker() {
   cta::telemetry::metrics::ctaFrontendActiveRequests->Add(
     -1,
     {
+      {cta::semconv::attr::kEventName,             m_eventName    },
       {cta::semconv::attr::kFrontendRequesterName, m_requesterName}
   });
+  const auto context = opentelemetry::context::RuntimeContext::GetCurrent();
   if (m_errorType) {
     cta::telemetry::metrics::ctaFrontendRequestDuration->Record(
       m_timer.msecs(),
@@ -36,7 +50,7 @@ RequestTracker::~RequestTracker() {
         {cta::semconv::attr::kFrontendRequesterName, m_requesterName    },
         {cta::semconv::attr::kErrorType,             m_errorType.value()}
     },
-      opentelemetry::context::RuntimeContext::GetCurrent());
+      context);
 
   } else {
     cta::telemetry::metrics::ctaFrontendRequestDuration->Record(
@@ -45,7 +59,19 @@ RequestTracker::~RequestTracker() {
         {cta::semconv::attr::kEventName,             m_eventName    },
         {cta::semconv::attr::kFrontendRequesterName, m_requesterName}
     },
-      opentelemetry::context::RuntimeContext::GetCurrent());
+      context);
+  }
+  for (size_t phase = 0; phase < kNbPhases; phase++) {
+    if (!m_phaseMsecs[phase]) {
+      continue;
+    }
+    cta::telemetry::metrics::ctaFrontendRequestPhaseDuration->Record(
+      m_phaseMsecs[phase].value(),
+      {
+        {cta::semconv::attr::kEventName,            m_eventName       },
+        {cta::semconv::attr::kFrontendRequestPhase, kPhaseNames[phase]}
+    },
+      context);
   }
 }
 
@@ -53,4 +79,13 @@ void RequestTracker::setErrorType(std::string_view errorType) {
   m_errorType = errorType;
 }
 
+void RequestTracker::addPhaseTime(Phase phase, double msecs) {
+  auto& phaseMsecs = m_phaseMsecs[static_cast<size_t>(phase)];
+  phaseMsecs = phaseMsecs.value_or(0) + msecs;
+}
+
+std::optional<double> RequestTracker::getPhaseTime(Phase phase) const {
+  return m_phaseMsecs[static_cast<size_t>(phase)];
+}
+
 }  // namespace cta::frontend
@@ -7,14 +7,41 @@
 
 #include "common/utils/Timer.hpp"
 
+#include <array>
+#include <cstdint>
 #include <optional>
 #include <string>
 
 namespace cta::frontend {
 
-// Used to track ctaFrontendActiveRequests
+// Used to track ctaFrontendActiveRequests, ctaFrontendRequestDuration and ctaFrontendRequestPhaseDuration
+//
+// The time spent in each phase of the request is accumulated while the request is processed and recorded once, with
+// the duration of the request, when the tracker is destroyed. The phases which have not been entered are not recorded.
 class RequestTracker {
 public:
+  // The phases of the processing of a request
+  enum class Phase : uint8_t {
+    Auth,       // Authorization of the client
+    Catalogue,  // Calls to the catalogue
+    Scheduler,  // Calls to the scheduler
+    Response    // Building of the response and of its log message
+  };
+
+  // Adds the time elapsed between its construction and its destruction to a phase of a request
+  class PhaseTimer {
+  public:
+    PhaseTimer(RequestTracker& requestTracker, Phase phase) : m_requestTracker(requestTracker), m_phase(phase) {}
+    ~PhaseTimer() { m_requestTracker.addPhaseTime(m_phase, m_timer.msecs()); }
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+  private:
+    RequestTracker& m_requestTracker;
+    Phase m_phase;
+    utils::Timer m_timer;
+  };
+
   RequestTracker(std::string_view eventName, std::string_view requesterName);
   ~RequestTracker();
   RequestTracker(const RequestTracker&) = delete;
@@ -22,11 +49,21 @@ public:
 
   void setErrorType(std::string_view errorType);
 
+  // Adds the specified time in milliseconds to a phase of the request
+  void addPhaseTime(Phase phase, double msecs);
+
+  // Returns the time in milliseconds spent so far in a phase of the request, if it has been entered
+  std::optional<double> getPhaseTime(Phase phase) const;
+
 private:
+  static constexpr size_t kNbPhases = static_cast<size_t>(Phase::Response) + 1;
+
   utils::Timer m_timer;
   std::string m_eventName;
   std::string m_requesterName;
   std::optional<std::string> m_errorType;
+  // Time in milliseconds spent in each phase, if it has been entered
+  std::array<std::optional<double>, kNbPhases> m_phaseMsecs;
 };
 
 }  // namespace cta::frontend
@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/common/RequestTracker.hpp"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace unitTests {
+
+using cta::frontend::RequestTracker;
+
+TEST(cta_frontend_RequestTracker, phasesNotEnteredAreNotSet) {
+  RequestTracker requestTracker("PREPARE", "eosunittest");
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Auth).has_value());
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Catalogue).has_value());
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Scheduler).has_value());
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Response).has_value());
+}
+
+TEST(cta_frontend_RequestTracker, addPhaseTimeAccumulates) {
+  RequestTracker requestTracker("CLOSEW", "eosunittest");
+  // Authentication measured by the gRPC handler, then the instance name check of the workflow event
+  requestTracker.addPhaseTime(RequestTracker::Phase::Auth, 2.5);
+  requestTracker.addPhaseTime(RequestTracker::Phase::Auth, 0.5);
+  requestTracker.addPhaseTime(RequestTracker::Phase::Catalogue, 0);
+
+  ASSERT_DOUBLE_EQ(3.0, requestTracker.getPhaseTime(RequestTracker::Phase::Auth).value());
+  // A phase entered for no measurable time is still recorded
+  ASSERT_DOUBLE_EQ(0.0, requestTracker.getPhaseTime(RequestTracker::Phase::Catalogue).value());
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Scheduler).has_value());
+}
+
+TEST(cta_frontend_RequestTracker, phaseTimerAddsElapsedTime) {
+  RequestTracker requestTracker("ADMIN", "admin");
+  requestTracker.addPhaseTime(RequestTracker::Phase::Scheduler, 1000);
+  {
+    RequestTracker::PhaseTimer timer(requestTracker, RequestTracker::Phase::Scheduler);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Nothing is added before the timer goes out of scope
+    ASSERT_DOUBLE_EQ(1000.0, requestTracker.getPhaseTime(RequestTracker::Phase::Scheduler).value());
+  }
+  ASSERT_LE(1010.0, requestTracker.getPhaseTime(RequestTracker::Phase::Scheduler).value());
+  ASSERT_FALSE(requestTracker.getPhaseTime(RequestTracker::Phase::Response).has_value());
+}
+
+}  // namespace unitTests
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/common/RetrieveRequestBatcher.hpp"
+
+#include "common/exception/Exception.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace cta::frontend {
+
+RetrieveRequestBatcher::RetrieveRequestBatcher(QueueRetrieves queueRetrieves, size_t maxBatchSize)
+    : m_queueRetrieves(std::move(queueRetrieves)),
+      m_maxBatchSize(maxBatchSize) {
+  if (m_maxBatchSize < 1) {
+    throw exception::Exception("In RetrieveRequestBatcher::RetrieveRequestBatcher(): batch size must be at least 1");
+  }
+}
+
+std::string RetrieveRequestBatcher::queueRetrieve(const std::string& instanceName,
+                                                  common::dataStructures::RetrieveRequest& request,
+                                                  log::LogContext& lc) {
+  PendingRequest pending {instanceName, request};
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_pending.push_back(&pending);
+  while (!pending.done) {
+    if (m_batchInProgress) {
+      m_batchDone.wait(lock);
+      continue;
+    }
+    // No batch in progress: queue the oldest waiting requests, which include ours unless too many came before it
+    m_batchInProgress = true;
+    const auto batchSize = std::min(m_pending.size(), m_maxBatchSize);
+    std::vector<PendingRequest*> batch(m_pending.begin(), m_pending.begin() + batchSize);
+    m_pending.erase(m_pending.begin(), m_pending.begin() + batchSize);
+    lock.unlock();
+    queueBatch(batch, lc);
+    lock.lock();
+    for (auto pendingRequest : batch) {
+      pendingRequest->done = true;
+    }
+    m_batchInProgress = false;
+    m_batchDone.notify_all();
+  }
+  lock.unlock();
+
+  if (pending.result.error) {
+    std::rethrow_exception(pending.result.error);
+  }
+  return pending.result.requestId;
+}
+
+void RetrieveRequestBatcher::queueBatch(const std::vector<PendingRequest*>& batch, log::LogContext& lc) const {
+  std::map<std::string, std::vector<PendingRequest*>> batchByInstance;
+  for (auto pendingRequest : batch) {
+    batchByInstance[pendingRequest->instanceName].push_back(pendingRequest);
+  }
+
+  for (auto& [instanceName, instanceBatch] : batchByInstance) {
+    std::vector<common::dataStructures::RetrieveRequest> requests;
+    requests.reserve(instanceBatch.size());
+    for (auto pendingRequest : instanceBatch) {
+      requests.push_back(pendingRequest->request);
+    }
+    try {
+      auto results = m_queueRetrieves(instanceName, requests, lc);
+      if (results.size() != requests.size()) {
+        throw exception::Exception("In RetrieveRequestBatcher::queueBatch(): unexpected number of results");
+      }
+      for (size_t i = 0; i < instanceBatch.size(); i++) {
+        instanceBatch[i]->request = std::move(requests[i]);
+        instanceBatch[i]->result = std::move(results[i]);
+      }
+    } catch (...) {
+      // The whole batch failed: each waiting thread gets the exception
+      for (auto pendingRequest : instanceBatch) {
+        pendingRequest->result.error = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace cta::frontend
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/dataStructures/RetrieveRequest.hpp"
+#include "common/log/LogContext.hpp"
+#include "scheduler/Scheduler.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cta::frontend {
+
+/*!
+ * Queues the retrieve requests of concurrent PREPARE events together
+ *
+ * Each PREPARE event carries a single file, so queueing it on its own costs one catalogue round trip per file. The
+ * first caller to find no batch in progress queues the requests waiting at that time, its own included, with a
+ * single call to Scheduler::queueRetrieves(), while the others wait for their outcome. Requests arriving during a
+ * batch are queued by the next one. A caller with no concurrent requests is not delayed.
+ */
+class RetrieveRequestBatcher {
+public:
+  /*!
+   * Function queueing retrieve requests, normally Scheduler::queueRetrieves()
+   */
+  using QueueRetrieves = std::function<std::vector<Scheduler::QueueRetrieveResult>(
+    const std::string& instanceName,
+    std::vector<common::dataStructures::RetrieveRequest>& requests,
+    log::LogContext& lc)>;
+
+  /*!
+   * Constructor
+   *
+   * @param queueRetrieves  Function queueing a batch of retrieve requests
+   * @param maxBatchSize    Maximum number of requests queued by one call to queueRetrieves
+   */
+  RetrieveRequestBatcher(QueueRetrieves queueRetrieves, size_t maxBatchSize);
+
+  RetrieveRequestBatcher(const RetrieveRequestBatcher&) = delete;
+  RetrieveRequestBatcher& operator=(const RetrieveRequestBatcher&) = delete;
+
+  /*!
+   * Queue a retrieve request, possibly together with the requests of other threads
+   *
+   * Throws the exception Scheduler::queueRetrieve() would have thrown for the request. The batch is queued with the
+   * log context of the thread which queues it.
+   *
+   * @param[in]     instanceName  Name of the disk instance the request comes from
+   * @param[in,out] request       The retrieve request, as updated by the scheduler
+   * @param[in]     lc            Log context of the caller
+   * @return The opaque id of the queued request
+   */
+  std::string queueRetrieve(const std::string& instanceName,
+                            common::dataStructures::RetrieveRequest& request,
+                            log::LogContext& lc);
+
+private:
+  /*!
+   * A request waiting to be queued, owned by the thread waiting for it
+   */
+  struct PendingRequest {
+    const std::string& instanceName;
+    common::dataStructures::RetrieveRequest& request;
+    Scheduler::QueueRetrieveResult result {};
+    bool done = false;
+  };
+
+  /*!
+   * Queue a batch of requests, grouped by disk instance, and store their outcome. Called without holding m_mutex.
+   */
+  void queueBatch(const std::vector<PendingRequest*>& batch, log::LogContext& lc) const;
+
+  // clang-format off
+  const QueueRetrieves         m_queueRetrieves;         //!< Function queueing a batch of retrieve requests
+  const size_t                 m_maxBatchSize;           //!< Maximum number of requests in a batch
+  std::mutex                   m_mutex;                  //!< Protects m_pending and m_batchInProgress
+  std::condition_variable      m_batchDone;              //!< Signalled when a batch has been queued
+  std::deque<PendingRequest*>  m_pending;                //!< Requests waiting to be queued, in arrival order
+  bool                         m_batchInProgress = false; //!< True while a thread is queueing a batch
+  // clang-format on
+};
+
+}  // namespace cta::frontend
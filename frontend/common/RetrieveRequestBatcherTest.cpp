@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/common/RetrieveRequestBatcher.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/exception/UserError.hpp"
+#include "common/log/DummyLogger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace unitTests {
+
+namespace {
+using cta::Scheduler;
+using cta::common::dataStructures::RetrieveRequest;
+
+/**
+ * Emulates Scheduler::queueRetrieves(): files with an ID above 1000 do not exist
+ */
+class FakeScheduler {
+public:
+  std::vector<Scheduler::QueueRetrieveResult>
+  queueRetrieves(const std::string& instanceName, std::vector<RetrieveRequest>& requests, cta::log::LogContext&) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      batchSizes.push_back(requests.size());
+    }
+    if (blockFirstBatch.exchange(false)) {
+      firstBatchStarted.set_value();
+      firstBatchReleased.get_future().wait();
+    }
+    if (failing) {
+      throw cta::exception::Exception("Catalogue unavailable");
+    }
+    std::vector<Scheduler::QueueRetrieveResult> results(requests.size());
+    for (size_t i = 0; i < requests.size(); i++) {
+      if (requests[i].archiveFileID > 1000) {
+        results[i].error = std::make_exception_ptr(cta::exception::UserError("No such file"));
+        continue;
+      }
+      requests[i].dstURL += "?queued";
+      results[i].requestId = instanceName + "/" + std::to_string(requests[i].archiveFileID);
+    }
+    return results;
+  }
+
+  std::vector<size_t> getBatchSizes() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return batchSizes;
+  }
+
+  std::atomic<bool> failing {false};
+  std::atomic<bool> blockFirstBatch {false};
+  std::promise<void> firstBatchStarted;
+  std::promise<void> firstBatchReleased;
+
+private:
+  std::mutex m_mutex;
+  std::vector<size_t> batchSizes;
+};
+
+RetrieveRequest makeRequest(uint64_t archiveFileId) {
+  RetrieveRequest request;
+  request.archiveFileID = archiveFileId;
+  request.dstURL = "root://eos//file" + std::to_string(archiveFileId);
+  return request;
+}
+
+cta::frontend::RetrieveRequestBatcher makeBatcher(FakeScheduler& scheduler, size_t maxBatchSize) {
+  return cta::frontend::RetrieveRequestBatcher(
+    [&scheduler](const std::string& instanceName, std::vector<RetrieveRequest>& requests, cta::log::LogContext& lc) {
+      return scheduler.queueRetrieves(instanceName, requests, lc);
+    },
+    maxBatchSize);
+}
+
+/**
+ * Queues one request per archive file ID, each from its own thread, while the scheduler is busy with a first request
+ */
+std::vector<std::string> queueConcurrently(cta::frontend::RetrieveRequestBatcher& batcher,
+                                           FakeScheduler& scheduler,
+                                           const std::vector<uint64_t>& archiveFileIds) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  scheduler.blockFirstBatch = true;
+  auto firstRequest = std::async(std::launch::async, [&] {
+    cta::log::LogContext lc(dl);
+    auto request = makeRequest(1);
+    return batcher.queueRetrieve("eosdev", request, lc);
+  });
+  scheduler.firstBatchStarted.get_future().wait();
+
+  std::vector<std::future<std::string>> requests;
+  for (auto archiveFileId : archiveFileIds) {
+    requests.push_back(std::async(std::launch::async, [&batcher, &dl, archiveFileId] {
+      cta::log::LogContext lc(dl);
+      auto request = makeRequest(archiveFileId);
+      return batcher.queueRetrieve("eosdev", request, lc);
+    }));
+  }
+  // Give the threads time to join the queue before the scheduler finishes the first request
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  scheduler.firstBatchReleased.set_value();
+
+  std::vector<std::string> requestIds {firstRequest.get()};
+  for (auto& request : requests) {
+    requestIds.push_back(request.get());
+  }
+  return requestIds;
+}
+}  // namespace
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, single_request) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  cta::log::LogContext lc(dl);
+  FakeScheduler scheduler;
+  auto batcher = makeBatcher(scheduler, 10);
+
+  auto request = makeRequest(1);
+  ASSERT_EQ("eosdev/1", batcher.queueRetrieve("eosdev", request, lc));
+  // The request as updated by the scheduler is given back to the caller
+  ASSERT_EQ("root://eos//file1?queued", request.dstURL);
+  ASSERT_EQ(std::vector<size_t> {1}, scheduler.getBatchSizes());
+}
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, request_error_is_rethrown) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  cta::log::LogContext lc(dl);
+  FakeScheduler scheduler;
+  auto batcher = makeBatcher(scheduler, 10);
+
+  auto request = makeRequest(1234);
+  ASSERT_THROW(batcher.queueRetrieve("eosdev", request, lc), cta::exception::UserError);
+}
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, batch_error_is_rethrown) {
+  cta::log::DummyLogger dl("dummy", "unitTest");
+  cta::log::LogContext lc(dl);
+  FakeScheduler scheduler;
+  auto batcher = makeBatcher(scheduler, 10);
+
+  scheduler.failing = true;
+  auto request = makeRequest(1);
+  ASSERT_THROW(batcher.queueRetrieve("eosdev", request, lc), cta::exception::Exception);
+
+  // The batcher is still usable afterwards
+  scheduler.failing = false;
+  ASSERT_EQ("eosdev/1", batcher.queueRetrieve("eosdev", request, lc));
+}
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, concurrent_requests_are_queued_together) {
+  FakeScheduler scheduler;
+  auto batcher = makeBatcher(scheduler, 10);
+
+  const auto requestIds = queueConcurrently(batcher, scheduler, {2, 3, 4, 5});
+
+  ASSERT_EQ((std::vector<std::string> {"eosdev/1", "eosdev/2", "eosdev/3", "eosdev/4", "eosdev/5"}), requestIds);
+  ASSERT_EQ((std::vector<size_t> {1, 4}), scheduler.getBatchSizes());
+}
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, batches_are_limited_in_size) {
+  FakeScheduler scheduler;
+  auto batcher = makeBatcher(scheduler, 2);
+
+  const auto requestIds = queueConcurrently(batcher, scheduler, {2, 3, 4, 5, 6});
+
+  ASSERT_EQ((std::vector<std::string> {"eosdev/1", "eosdev/2", "eosdev/3", "eosdev/4", "eosdev/5", "eosdev/6"}),
+            requestIds);
+  ASSERT_EQ((std::vector<size_t> {1, 2, 2, 1}), scheduler.getBatchSizes());
+}
+
+TEST(cta_frontend_RetrieveRequestBatcherTest, zero_batch_size_is_rejected) {
+  FakeScheduler scheduler;
+  ASSERT_THROW(makeBatcher(scheduler, 0), cta::exception::Exception);
+}
+
+}  // namespace unitTests
@@ -75,22 +75,27 @@ bool TapeFileLsResponseStream::isDone() {
 }
 
 cta::xrd::Data TapeFileLsResponseStream::next() {
+  cta::xrd::Data data;
+  fillNext(data);
+  return data;
+}
+
+void TapeFileLsResponseStream::fillNext(cta::xrd::Data& record) {
   if (isDone()) {
     throw std::runtime_error("Stream is exhausted");
   }
 
-  cta::xrd::Data data;
-  populateDataItem(data, *m_currentArchiveFile, *m_currentTapeFileIter);
+  populateDataItem(record, *m_currentArchiveFile, *m_currentTapeFileIter);
 
   ++m_currentTapeFileIter;
-
-  return data;
 }
 
 void TapeFileLsResponseStream::populateDataItem(cta::xrd::Data& data,
                                                 const common::dataStructures::ArchiveFile& archiveFile,
                                                 const common::dataStructures::TapeFile& tapeFile) const {
+  // Clearing the item rather than the record keeps its fields allocated when the record is reused
   cta::admin::TapeFileLsItem* tf_item = data.mutable_tfls_item();
+  tf_item->Clear();
 
   // Set the instance name
   tf_item->set_instance_name(m_instanceName);
@@ -24,6 +24,7 @@ public:
 
   bool isDone() override;
   cta::xrd::Data next() override;
+  void fillNext(cta::xrd::Data& record) override;
 
 private:
   catalogue::ArchiveFileItor m_tapeFileItor;
@@ -18,11 +18,13 @@ namespace cta::frontend {
 
 WorkflowEvent::WorkflowEvent(const frontend::FrontendService& frontendService,
                              const common::dataStructures::SecurityIdentity& clientIdentity,
-                             const eos::Notification& event)
+                             const eos::Notification& event,
+                             double clientAuthMsecs)
     : m_event(event),
       m_cliIdentity(clientIdentity),
       m_catalogue(frontendService.getCatalogue()),
       m_scheduler(frontendService.getScheduler()),
+      m_retrieveRequestBatcher(frontendService.getRetrieveRequestBatcher()),
       m_lc(frontendService.getLogContext()),
       m_verificationMountPolicy(frontendService.getVerificationMountPolicy()),
       m_zeroLengthFilesDisallowed(frontendService.getDisallowZeroLengthFiles()),
@@ -50,6 +52,7 @@ WorkflowEvent::WorkflowEvent(const frontend::FrontendService& frontendService,
   m_lc.log(log::INFO, "In WorkflowEvent::WorkflowEvent(): received event.");
 
   // Validate that instance name in key used to authenticate == instance name in protocol buffer
+  utils::Timer authTimer;
   if (m_cliIdentity.username != event.wf().instance().name()) {
     // Special case:
     // Allow KRB5 authentication for CLOSEW and PREPARE events, to allow operators to use a command line
@@ -64,6 +67,7 @@ WorkflowEvent::WorkflowEvent(const frontend::FrontendService& frontendService,
                                    + "\" does not match key identifier \"" + m_cliIdentity.username + "\"");
     }
   }
+  m_authMsecs = clientAuthMsecs + authTimer.msecs();
   // Refuse any workflow events for files in /eos/INSTANCE_NAME/proc/
   const std::string& longInstanceName = event.wf().instance().name();
   const bool longInstanceNameStartsWithEos = (0 == longInstanceName.find("eos"));
@@ -84,6 +88,7 @@ WorkflowEvent::WorkflowEvent(const frontend::FrontendService& frontendService,
 
 xrd::Response WorkflowEvent::process() {
   cta::frontend::RequestTracker requestTracker(Workflow_EventType_Name(m_event.wf().event()), m_cliIdentity.username);
+  requestTracker.addPhaseTime(RequestTracker::Phase::Auth, m_authMsecs);
   xrd::Response response;
   utils::Timer timer;
 
@@ -92,25 +97,25 @@ xrd::Response WorkflowEvent::process() {
       using namespace cta::eos;
 
       case Workflow::OPENW:
-        processOPENW(response);
+        processOPENW(response, requestTracker);
         break;
       case Workflow::CREATE:
-        processCREATE(response);
+        processCREATE(response, requestTracker);
         break;
       case Workflow::CLOSEW:
-        processCLOSEW(response);
+        processCLOSEW(response, requestTracker);
         break;
       case Workflow::PREPARE:
-        processPREPARE(response);
+        processPREPARE(response, requestTracker);
         break;
       case Workflow::ABORT_PREPARE:
-        processABORT_PREPARE(response);
+        processABORT_PREPARE(response, requestTracker);
         break;
       case Workflow::DELETE:
-        processDELETE(response);
+        processDELETE(response, requestTracker);
         break;
       case Workflow::UPDATE_FID:
-        processUPDATE_FID(response);
+        processUPDATE_FID(response, requestTracker);
         break;
       default:
         throw exception::PbException("Workflow event " + Workflow_EventType_Name(m_event.wf().event())
@@ -127,8 +132,9 @@ xrd::Response WorkflowEvent::process() {
   return response;
 }
 
-void WorkflowEvent::processOPENW(xrd::Response& response) {
+void WorkflowEvent::processOPENW(xrd::Response& response, RequestTracker& requestTracker) {
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   m_lc.log(log::INFO, "In WorkflowEvent::processOPENW(): ignoring OPENW event.");
 
@@ -136,7 +142,22 @@ void WorkflowEvent::processOPENW(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processCREATE(xrd::Response& response) {
+void WorkflowEvent::processCREATE(xrd::Response& response, RequestTracker& requestTracker) {
+  const auto requester = makeCREATERequester();
+
+  utils::Timer t;
+  uint64_t archiveFileId;
+  if (const std::string& storageClassStr = m_event.file().storage_class(); storageClassStr == "fail_on_closew_test") {
+    archiveFileId = std::numeric_limits<uint64_t>::max();
+  } else {
+    RequestTracker::PhaseTimer schedulerPhase(requestTracker, RequestTracker::Phase::Scheduler);
+    archiveFileId = m_scheduler.checkAndGetNextArchiveFileId(m_cliIdentity.username, storageClassStr, requester, m_lc);
+  }
+
+  setArchiveFileIdResponse(response, archiveFileId, t.secs(), requestTracker);
+}
+
+common::dataStructures::RequesterIdentity WorkflowEvent::makeCREATERequester() const {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.cli().user().username(), "m_event.cli.user.username");
   checkIsNotEmptyString(m_event.cli().user().groupname(), "m_event.cli.user.groupname");
@@ -149,25 +170,25 @@ void WorkflowEvent::processCREATE(xrd::Response& response) {
   requester.name = m_event.cli().user().username();
   requester.group = m_event.cli().user().groupname();
 
-  utils::Timer t;
-  uint64_t archiveFileId;
   // Check the standalone storage class attribute
-  std::string storageClassStr = m_event.file().storage_class();
-  if (storageClassStr.empty()) {
+  if (m_event.file().storage_class().empty()) {
     throw exception::PbException("CREATE: storage class is not set.");
   }
-  if (storageClassStr == "fail_on_closew_test") {
-    archiveFileId = std::numeric_limits<uint64_t>::max();
-  } else {
-    archiveFileId = m_scheduler.checkAndGetNextArchiveFileId(m_cliIdentity.username, storageClassStr, requester, m_lc);
-  }
 
+  return requester;
+}
+
+void WorkflowEvent::setArchiveFileIdResponse(xrd::Response& response,
+                                             const uint64_t archiveFileId,
+                                             const double schedulerTime,
+                                             RequestTracker& requestTracker) {
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   params.add("diskFileId", m_event.file().disk_file_id())
     .add("diskFilePath", m_event.file().lpath())
     .add("fileId", archiveFileId)
-    .add("schedulerTime", t.secs());
+    .add("schedulerTime", schedulerTime);
   m_lc.log(log::INFO, "In WorkflowEvent::processCREATE(): assigning new archive file ID.");
 
   // Set ArchiveFileId
@@ -179,7 +200,24 @@ void WorkflowEvent::processCREATE(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processCLOSEW(xrd::Response& response) {
+void WorkflowEvent::processCLOSEW(xrd::Response& response, RequestTracker& requestTracker) {
+  uint64_t archiveFileId = 0;
+  const auto request = makeArchiveRequest(archiveFileId, requestTracker);
+
+  utils::Timer t;
+
+  // Queue the request
+  std::string archiveRequestAddr;
+  if (request.fileSize > 0) {
+    RequestTracker::PhaseTimer schedulerPhase(requestTracker, RequestTracker::Phase::Scheduler);
+    archiveRequestAddr = m_scheduler.queueArchiveWithGivenId(archiveFileId, m_cliIdentity.username, request, m_lc);
+  }
+
+  setArchiveQueuedResponse(response, request, archiveFileId, archiveRequestAddr, t.secs(), requestTracker);
+}
+
+common::dataStructures::ArchiveRequest WorkflowEvent::makeArchiveRequest(uint64_t& archiveFileId,
+                                                                         RequestTracker& requestTracker) {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.cli().user().username(), "m_event.cli.user.username");
   checkIsNotEmptyString(m_event.cli().user().groupname(), "m_event.cli.user.groupname");
@@ -200,6 +238,7 @@ void WorkflowEvent::processCLOSEW(xrd::Response& response) {
   }
 
   {
+    RequestTracker::PhaseTimer cataloguePhase(requestTracker, RequestTracker::Phase::Catalogue);
     auto storageClass = m_catalogue.StorageClass()->getStorageClass(storageClassStr);
     // Disallow archival of files above the specified limit
     if (storageClass.vo.maxFileSize && m_event.file().size() > storageClass.vo.maxFileSize) {
@@ -231,15 +270,13 @@ void WorkflowEvent::processCLOSEW(xrd::Response& response) {
   request.creationLog.username = m_cliIdentity.username;
   request.creationLog.time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
 
-  log::ScopedParamContainer params(m_lc);
-  params.add("requesterInstance", m_event.wf().requester_instance());
-  std::string logMessage = "In WorkflowEvent::processCLOSEW(): ";
-
   // first check if the first-class attribute is set, if not fall back to the xattr
   // (For dCache, the first-class attribute is expected to be set)
-  uint64_t archiveFileId = 0;
   archiveFileId = m_event.file().archive_file_id();
   if (archiveFileId == 0) {
+    log::ScopedParamContainer params(m_lc);
+    params.add("requesterInstance", m_event.wf().requester_instance());
+    std::string logMessage = "In WorkflowEvent::processCLOSEW(): ";
     // CTA Archive ID is an EOS extended attribute, i.e. it is stored as a string, which
     // must be converted to a valid uint64_t
     const auto archiveFileIdItor = m_event.file().xattr().find("sys.archive.file_id");
@@ -255,17 +292,25 @@ void WorkflowEvent::processCLOSEW(xrd::Response& response) {
       m_lc.log(log::INFO, logMessage);
       throw exception::PbException("Invalid archiveFileID " + archiveFileIdStr);
     }
-    params.add("fileId", archiveFileId);
   }
 
-  utils::Timer t;
+  return request;
+}
+
+void WorkflowEvent::setArchiveQueuedResponse(xrd::Response& response,
+                                             const common::dataStructures::ArchiveRequest& request,
+                                             const uint64_t archiveFileId,
+                                             const std::string& archiveRequestAddr,
+                                             const double schedulerTime,
+                                             RequestTracker& requestTracker) {
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
+  log::ScopedParamContainer params(m_lc);
+  params.add("requesterInstance", m_event.wf().requester_instance()).add("fileId", archiveFileId);
+  std::string logMessage = "In WorkflowEvent::processCLOSEW(): ";
 
   if (request.fileSize > 0) {
-    // Queue the request
-    std::string archiveRequestAddr =
-      m_scheduler.queueArchiveWithGivenId(archiveFileId, m_cliIdentity.username, request, m_lc);
     logMessage += "queued file for archive.";
-    params.add("schedulerTime", t.secs());
+    params.add("schedulerTime", schedulerTime);
     params.add("archiveRequestId", archiveRequestAddr);
 
     // Add archive request reference to response as an extended attribute
@@ -284,7 +329,22 @@ void WorkflowEvent::processCLOSEW(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processPREPARE(xrd::Response& response) {
+void WorkflowEvent::processPREPARE(xrd::Response& response, RequestTracker& requestTracker) {
+  auto request = makeRetrieveRequest();
+
+  utils::Timer t;
+
+  // Queue the request, together with those of concurrent PREPARE events
+  std::string retrieveReqId;
+  {
+    RequestTracker::PhaseTimer schedulerPhase(requestTracker, RequestTracker::Phase::Scheduler);
+    retrieveReqId = m_retrieveRequestBatcher.queueRetrieve(m_cliIdentity.username, request, m_lc);
+  }
+
+  setRetrieveQueuedResponse(response, request, retrieveReqId, t.secs(), requestTracker);
+}
+
+common::dataStructures::RetrieveRequest WorkflowEvent::makeRetrieveRequest() const {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.cli().user().username(), "m_event.cli.user.username");
   checkIsNotEmptyString(m_event.cli().user().groupname(), "m_event.cli.user.groupname");
@@ -342,15 +402,19 @@ void WorkflowEvent::processPREPARE(xrd::Response& response) {
     request.activity = m_event.file().xattr().at("activity");
   }
 
-  utils::Timer t;
-
-  // Queue the request
-  std::string retrieveReqId = m_scheduler.queueRetrieve(m_cliIdentity.username, request, m_lc);
+  return request;
+}
 
+void WorkflowEvent::setRetrieveQueuedResponse(xrd::Response& response,
+                                              const common::dataStructures::RetrieveRequest& request,
+                                              const std::string& retrieveReqId,
+                                              const double schedulerTime,
+                                              RequestTracker& requestTracker) {
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   params.add("fileId", request.archiveFileID)
-    .add("schedulerTime", t.secs())
+    .add("schedulerTime", schedulerTime)
     .add("isVerifyOnly", request.isVerifyOnly)
     .add("retrieveReqId", retrieveReqId);
   if (static_cast<bool>(request.activity)) {
@@ -366,7 +430,7 @@ void WorkflowEvent::processPREPARE(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processABORT_PREPARE(xrd::Response& response) {
+void WorkflowEvent::processABORT_PREPARE(xrd::Response& response, RequestTracker& requestTracker) {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.cli().user().username(), "m_event.cli.user.username");
   checkIsNotEmptyString(m_event.cli().user().groupname(), "m_event.cli.user.groupname");
@@ -409,11 +473,15 @@ void WorkflowEvent::processABORT_PREPARE(xrd::Response& response) {
   }
 
   // Queue the request
-  m_scheduler.abortRetrieve(m_cliIdentity.username, request, m_lc);
+  {
+    RequestTracker::PhaseTimer schedulerPhase(requestTracker, RequestTracker::Phase::Scheduler);
+    m_scheduler.abortRetrieve(m_cliIdentity.username, request, m_lc);
+  }
 
   utils::Timer t;
 
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   params.add("fileId", request.archiveFileID)
     .add("schedulerTime", t.secs())
@@ -428,7 +496,7 @@ void WorkflowEvent::processABORT_PREPARE(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processDELETE(xrd::Response& response) {
+void WorkflowEvent::processDELETE(xrd::Response& response, RequestTracker& requestTracker) {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.cli().user().username(), "m_event.cli.user.username");
   checkIsNotEmptyString(m_event.cli().user().groupname(), "m_event.cli.user.groupname");
@@ -492,6 +560,7 @@ void WorkflowEvent::processDELETE(xrd::Response& response) {
   utils::Timer t;
   log::TimingList tl;
   try {
+    RequestTracker::PhaseTimer cataloguePhase(requestTracker, RequestTracker::Phase::Catalogue);
     request.archiveFile = m_catalogue.ArchiveFile()->getArchiveFileById(request.archiveFileID);
     tl.insertAndReset("catalogueGetArchiveFileByIdTime", t);
   } catch (exception::Exception& ex) {
@@ -502,9 +571,13 @@ void WorkflowEvent::processDELETE(xrd::Response& response) {
              "Received an exception when trying to get archive file by id. Ignoring request to delete archive file.");
   }
 
-  m_scheduler.deleteArchive(m_cliIdentity.username, request, m_lc);
+  {
+    RequestTracker::PhaseTimer schedulerPhase(requestTracker, RequestTracker::Phase::Scheduler);
+    m_scheduler.deleteArchive(m_cliIdentity.username, request, m_lc);
+  }
   tl.insertAndReset("schedulerTime", t);
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   params.add("fileId", request.archiveFileID)
     .add("address", (request.address ? request.address.value() : "null"))
@@ -516,7 +589,7 @@ void WorkflowEvent::processDELETE(xrd::Response& response) {
   response.set_type(xrd::Response::RSP_SUCCESS);
 }
 
-void WorkflowEvent::processUPDATE_FID(xrd::Response& response) {
+void WorkflowEvent::processUPDATE_FID(xrd::Response& response, RequestTracker& requestTracker) {
   // Validate received protobuf
   checkIsNotEmptyString(m_event.file().lpath(), "m_event.file.lpath");
 
@@ -543,9 +616,13 @@ void WorkflowEvent::processUPDATE_FID(xrd::Response& response) {
 
   // Update the disk file ID
   utils::Timer t;
-  m_catalogue.ArchiveFile()->updateDiskFileId(archiveFileId, diskInstance, diskFileId);
+  {
+    RequestTracker::PhaseTimer cataloguePhase(requestTracker, RequestTracker::Phase::Catalogue);
+    m_catalogue.ArchiveFile()->updateDiskFileId(archiveFileId, diskInstance, diskFileId);
+  }
 
   // Create a log entry
+  RequestTracker::PhaseTimer responsePhase(requestTracker, RequestTracker::Phase::Response);
   log::ScopedParamContainer params(m_lc);
   params.add("fileId", archiveFileId)
     .add("schedulerTime", t.secs())
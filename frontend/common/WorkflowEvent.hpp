@@ -7,16 +7,22 @@
 
 #include "frontend/common/FrontendService.hpp"
 #include "frontend/common/PbException.hpp"
+#include "frontend/common/RequestTracker.hpp"
 
 #include "cta_frontend.pb.h"
 
 namespace cta::frontend {
 
 class WorkflowEvent {
+  friend class WorkflowEventBatch;
+
 public:
+  // clientAuthMsecs is the time in milliseconds the frontend spent validating the credentials of the client before
+  // the event was built, it is reported in the Auth phase of the request
   WorkflowEvent(const frontend::FrontendService& frontendService,
                 const common::dataStructures::SecurityIdentity& clientIdentity,
-                const eos::Notification& event);
+                const eos::Notification& event,
+                double clientAuthMsecs = 0);
 
   ~WorkflowEvent() = default;
 
@@ -33,16 +39,81 @@ private:
    *
    * Note: The OPENW event is not handled by CTA, as files destined for tape are immutable.
    *
-   * @param[in]     event      Workflow event and metadata received from client
-   * @param[out]    response   Response protobuf to return to client
+   * @param[in]     event            Workflow event and metadata received from client
+   * @param[out]    response         Response protobuf to return to client
+   * @param[in,out] requestTracker   Tracker of the time spent in each phase of the event
+   */
+  void processOPENW(xrd::Response& response, RequestTracker& requestTracker);          //!< Open for write event
+  void processCREATE(xrd::Response& response, RequestTracker& requestTracker);         //!< New archive file ID event
+  void processCLOSEW(xrd::Response& response, RequestTracker& requestTracker);         //!< Archive file event
+  void processPREPARE(xrd::Response& response, RequestTracker& requestTracker);        //!< Retrieve file event
+  void processABORT_PREPARE(xrd::Response& response, RequestTracker& requestTracker);  //!< Abort retrieve file event
+  void processDELETE(xrd::Response& response, RequestTracker& requestTracker);         //!< Delete file event
+  void processUPDATE_FID(xrd::Response& response, RequestTracker& requestTracker);     //!< Update disk file ID event
+
+  /*!
+   * Validate a CREATE event and return the requester of the new archive file ID
+   */
+  common::dataStructures::RequesterIdentity makeCREATERequester() const;
+
+  /*!
+   * Log the new archive file ID of a CREATE event and fill in the response
+   *
+   * @param[out]    response       Response protobuf to return to client
+   * @param[in]     archiveFileId  The new archive file ID
+   * @param[in]     schedulerTime  The time in seconds taken to get the archive file ID
+   * @param[in,out] requestTracker Tracker of the time spent in each phase of the event
+   */
+  void setArchiveFileIdResponse(xrd::Response& response,
+                                const uint64_t archiveFileId,
+                                const double schedulerTime,
+                                RequestTracker& requestTracker);
+
+  /*!
+   * Validate a CLOSEW event and build the archive request it asks for
+   *
+   * @param[out]    archiveFileId  The archive file ID of the file
+   * @param[in,out] requestTracker Tracker of the time spent in each phase of the event
+   */
+  common::dataStructures::ArchiveRequest makeArchiveRequest(uint64_t& archiveFileId,
+                                                            RequestTracker& requestTracker);
+
+  /*!
+   * Log the queueing of the archive request of a CLOSEW event and fill in the response
+   *
+   * @param[out]    response            Response protobuf to return to client
+   * @param[in]     request             The archive request, not queued if the file is empty
+   * @param[in]     archiveFileId       The archive file ID of the file
+   * @param[in]     archiveRequestAddr  The identifier of the queued archive request
+   * @param[in]     schedulerTime       The time in seconds taken to queue the request
+   * @param[in,out] requestTracker      Tracker of the time spent in each phase of the event
+   */
+  void setArchiveQueuedResponse(xrd::Response& response,
+                                const common::dataStructures::ArchiveRequest& request,
+                                const uint64_t archiveFileId,
+                                const std::string& archiveRequestAddr,
+                                const double schedulerTime,
+                                RequestTracker& requestTracker);
+
+  /*!
+   * Validate a PREPARE event and build the retrieve request it asks for
+   */
+  common::dataStructures::RetrieveRequest makeRetrieveRequest() const;
+
+  /*!
+   * Log the queueing of the retrieve request of a PREPARE event and fill in the response
+   *
+   * @param[out]    response       Response protobuf to return to client
+   * @param[in]     request        The retrieve request
+   * @param[in]     retrieveReqId  The identifier of the queued retrieve request
+   * @param[in]     schedulerTime  The time in seconds taken to queue the request
+   * @param[in,out] requestTracker Tracker of the time spent in each phase of the event
    */
-  void processOPENW(xrd::Response& response);          //!< Open for write event
-  void processCREATE(xrd::Response& response);         //!< New archive file ID event
-  void processCLOSEW(xrd::Response& response);         //!< Archive file event
-  void processPREPARE(xrd::Response& response);        //!< Retrieve file event
-  void processABORT_PREPARE(xrd::Response& response);  //!< Abort retrieve file event
-  void processDELETE(xrd::Response& response);         //!< Delete file event
-  void processUPDATE_FID(xrd::Response& response);     //!< Update disk file ID event
+  void setRetrieveQueuedResponse(xrd::Response& response,
+                                 const common::dataStructures::RetrieveRequest& request,
+                                 const std::string& retrieveReqId,
+                                 const double schedulerTime,
+                                 RequestTracker& requestTracker);
 
   /*!
    * Throw an exception for empty protocol buffer strings
@@ -57,8 +128,10 @@ private:
   common::dataStructures::SecurityIdentity m_cliIdentity;  //!< Client identity: username, host, authentication
   catalogue::Catalogue& m_catalogue;                       //!< Reference to CTA Catalogue
   cta::Scheduler& m_scheduler;                             //!< Reference to CTA Scheduler
+  RetrieveRequestBatcher& m_retrieveRequestBatcher;        //!< Queues the retrieve requests of PREPARE events
   log::LogContext m_lc;                                    //!< CTA Log Context
   std::string m_verificationMountPolicy;                   //!< Verification mount policy
+  double m_authMsecs = 0;                                  //!< Time in milliseconds taken to authorize the client
 
   bool m_zeroLengthFilesDisallowed;  //!< Do not allow 0-length files to be archived
   std::set<std::string>
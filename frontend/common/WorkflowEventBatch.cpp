@@ -0,0 +1,295 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "WorkflowEventBatch.hpp"
+
+#include "PbException.hpp"
+#include "common/semconv/Attributes.hpp"
+
+#include <list>
+
+namespace cta::frontend {
+
+namespace {
+// Maximum number of consecutive events processed with a single call to the scheduler
+constexpr size_t WORKFLOW_EVENT_MAX_GROUP_SIZE = 100;
+}  // namespace
+
+WorkflowEventBatch::WorkflowEventBatch(const frontend::FrontendService& frontendService,
+                                       const common::dataStructures::SecurityIdentity& clientIdentity,
+                                       const std::vector<eos::Notification>& events,
+                                       double clientAuthMsecs)
+    : m_frontendService(frontendService),
+      m_cliIdentity(clientIdentity),
+      m_events(events),
+      m_clientAuthMsecs(clientAuthMsecs),
+      m_wfes(events.size()),
+      m_scheduler(frontendService.getScheduler()),
+      m_lc(frontendService.getLogContext()) {}
+
+std::vector<xrd::Response> WorkflowEventBatch::process() {
+  std::vector<xrd::Response> responses(m_events.size());
+
+  // Validate the events and find out which ones can be processed together
+  std::vector<std::optional<WorkflowEventGroupKey>> groupKeys(m_events.size());
+  for (size_t i = 0; i < m_events.size(); i++) {
+    try {
+      m_wfes[i] = std::make_unique<WorkflowEvent>(m_frontendService, m_cliIdentity, m_events[i], m_clientAuthMsecs);
+    } catch (...) {
+      setErrorResponse(responses[i], std::current_exception(), nullptr);
+      continue;
+    }
+    groupKeys[i] = getGroupKey(i);
+  }
+  const auto groups = groupWorkflowEvents(groupKeys, WORKFLOW_EVENT_MAX_GROUP_SIZE);
+
+  {
+    log::ScopedParamContainer params(m_lc);
+    params.add("nbEvents", m_events.size()).add("nbGroups", groups.size());
+    m_lc.log(log::INFO, "In WorkflowEventBatch::process(): received batch of events.");
+  }
+
+  for (const auto& group : groups) {
+    if (!group.batched) {
+      // The events which failed validation already have their response
+      if (!m_wfes[group.begin]) {
+        continue;
+      }
+      try {
+        responses[group.begin] = m_wfes[group.begin]->process();
+      } catch (...) {
+        setErrorResponse(responses[group.begin], std::current_exception(), nullptr);
+      }
+      continue;
+    }
+    switch (m_events[group.begin].wf().event()) {
+      case eos::Workflow::CREATE:
+        processCREATEs(group, responses);
+        break;
+      case eos::Workflow::CLOSEW:
+        processCLOSEWs(group, responses);
+        break;
+      case eos::Workflow::PREPARE:
+        processPREPAREs(group, responses);
+        break;
+      default:
+        // getGroupKey() only groups the event types above
+        break;
+    }
+  }
+
+  return responses;
+}
+
+std::optional<WorkflowEventGroupKey> WorkflowEventBatch::getGroupKey(size_t eventIdx) const {
+  const auto& event = m_events[eventIdx];
+  // The events are processed for the instance of the client, see WorkflowEvent::WorkflowEvent()
+  const auto& instanceName = m_wfes[eventIdx]->m_cliIdentity.username;
+  switch (event.wf().event()) {
+    case eos::Workflow::CREATE:
+      // The archive file IDs are checked against the mount rules of the requester
+      if (event.file().storage_class() == "fail_on_closew_test") {
+        return std::nullopt;
+      }
+      return WorkflowEventGroupKey {eos::Workflow::CREATE,
+                                    instanceName,
+                                    event.file().storage_class(),
+                                    event.cli().user().username(),
+                                    event.cli().user().groupname()};
+    case eos::Workflow::CLOSEW:
+      return WorkflowEventGroupKey {eos::Workflow::CLOSEW, instanceName, event.file().storage_class(), "", ""};
+    case eos::Workflow::PREPARE:
+      return WorkflowEventGroupKey {eos::Workflow::PREPARE, instanceName, "", "", ""};
+    default:
+      return std::nullopt;
+  }
+}
+
+void WorkflowEventBatch::processCREATEs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses) {
+  std::vector<std::unique_ptr<RequestTracker>> requestTrackers(group.end - group.begin);
+  std::vector<size_t> validIdxs;
+  common::dataStructures::RequesterIdentity requester;
+  for (size_t i = group.begin; i < group.end; i++) {
+    auto& requestTracker = requestTrackers[i - group.begin] = makeRequestTracker(i);
+    try {
+      requester = m_wfes[i]->makeCREATERequester();
+      validIdxs.push_back(i);
+    } catch (...) {
+      setErrorResponse(responses[i], std::current_exception(), requestTracker.get());
+    }
+  }
+  if (validIdxs.empty()) {
+    return;
+  }
+
+  utils::Timer t;
+  std::list<uint64_t> archiveFileIds;
+  try {
+    archiveFileIds = m_scheduler.checkAndGetNextArchiveFileIds(m_wfes[group.begin]->m_cliIdentity.username,
+                                                               m_events[group.begin].file().storage_class(),
+                                                               requester,
+                                                               validIdxs.size(),
+                                                               m_lc);
+  } catch (...) {
+    for (const auto i : validIdxs) {
+      setErrorResponse(responses[i], std::current_exception(), requestTrackers[i - group.begin].get());
+    }
+    return;
+  }
+  const double schedulerMsecs = t.msecs();
+
+  auto archiveFileIdItor = archiveFileIds.cbegin();
+  for (const auto i : validIdxs) {
+    auto& requestTracker = *requestTrackers[i - group.begin];
+    requestTracker.addPhaseTime(RequestTracker::Phase::Scheduler, schedulerMsecs);
+    m_wfes[i]->setArchiveFileIdResponse(responses[i], *archiveFileIdItor++, schedulerMsecs / 1000, requestTracker);
+  }
+}
+
+void WorkflowEventBatch::processCLOSEWs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses) {
+  std::vector<std::unique_ptr<RequestTracker>> requestTrackers(group.end - group.begin);
+  std::vector<uint64_t> archiveFileIds;
+  std::vector<common::dataStructures::ArchiveRequest> requests;
+  std::vector<size_t> requestIdxs;  // Index in the batch of the event of each request
+  for (size_t i = group.begin; i < group.end; i++) {
+    auto& requestTracker = requestTrackers[i - group.begin] = makeRequestTracker(i);
+    try {
+      uint64_t archiveFileId = 0;
+      auto request = m_wfes[i]->makeArchiveRequest(archiveFileId, *requestTracker);
+      if (request.fileSize == 0) {
+        // Zero-length files are not queued
+        m_wfes[i]->setArchiveQueuedResponse(responses[i], request, archiveFileId, "", 0, *requestTracker);
+        continue;
+      }
+      archiveFileIds.push_back(archiveFileId);
+      requests.push_back(std::move(request));
+      requestIdxs.push_back(i);
+    } catch (...) {
+      setErrorResponse(responses[i], std::current_exception(), requestTracker.get());
+    }
+  }
+  if (requests.empty()) {
+    return;
+  }
+
+  utils::Timer t;
+  std::vector<Scheduler::QueueArchiveResult> results;
+  try {
+    results = m_scheduler.queueArchivesWithGivenIds(archiveFileIds,
+                                                    m_wfes[group.begin]->m_cliIdentity.username,
+                                                    requests,
+                                                    m_lc);
+  } catch (...) {
+    results.resize(requests.size());
+    for (auto& result : results) {
+      result.error = std::current_exception();
+    }
+  }
+  const double schedulerMsecs = t.msecs();
+
+  for (size_t r = 0; r < requests.size(); r++) {
+    const auto i = requestIdxs[r];
+    auto& requestTracker = *requestTrackers[i - group.begin];
+    requestTracker.addPhaseTime(RequestTracker::Phase::Scheduler, schedulerMsecs);
+    if (results[r].error) {
+      setErrorResponse(responses[i], results[r].error, &requestTracker);
+      continue;
+    }
+    m_wfes[i]->setArchiveQueuedResponse(responses[i],
+                                        requests[r],
+                                        archiveFileIds[r],
+                                        results[r].requestId,
+                                        schedulerMsecs / 1000,
+                                        requestTracker);
+  }
+}
+
+void WorkflowEventBatch::processPREPAREs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses) {
+  std::vector<std::unique_ptr<RequestTracker>> requestTrackers(group.end - group.begin);
+  std::vector<common::dataStructures::RetrieveRequest> requests;
+  std::vector<size_t> requestIdxs;  // Index in the batch of the event of each request
+  for (size_t i = group.begin; i < group.end; i++) {
+    auto& requestTracker = requestTrackers[i - group.begin] = makeRequestTracker(i);
+    try {
+      requests.push_back(m_wfes[i]->makeRetrieveRequest());
+      requestIdxs.push_back(i);
+    } catch (...) {
+      setErrorResponse(responses[i], std::current_exception(), requestTracker.get());
+    }
+  }
+  if (requests.empty()) {
+    return;
+  }
+
+  utils::Timer t;
+  std::vector<Scheduler::QueueRetrieveResult> results;
+  try {
+    results = m_scheduler.queueRetrieves(m_wfes[group.begin]->m_cliIdentity.username, requests, m_lc);
+  } catch (...) {
+    results.resize(requests.size());
+    for (auto& result : results) {
+      result.error = std::current_exception();
+    }
+  }
+  const double schedulerMsecs = t.msecs();
+
+  for (size_t r = 0; r < requests.size(); r++) {
+    const auto i = requestIdxs[r];
+    auto& requestTracker = *requestTrackers[i - group.begin];
+    requestTracker.addPhaseTime(RequestTracker::Phase::Scheduler, schedulerMsecs);
+    if (results[r].error) {
+      setErrorResponse(responses[i], results[r].error, &requestTracker);
+      continue;
+    }
+    m_wfes[i]->setRetrieveQueuedResponse(responses[i],
+                                         requests[r],
+                                         results[r].requestId,
+                                         schedulerMsecs / 1000,
+                                         requestTracker);
+  }
+}
+
+std::unique_ptr<RequestTracker> WorkflowEventBatch::makeRequestTracker(size_t eventIdx) const {
+  const auto& wfe = *m_wfes[eventIdx];
+  auto requestTracker =
+    std::make_unique<RequestTracker>(Workflow_EventType_Name(m_events[eventIdx].wf().event()),
+                                     wfe.m_cliIdentity.username);
+  requestTracker->addPhaseTime(RequestTracker::Phase::Auth, wfe.m_authMsecs);
+  return requestTracker;
+}
+
+void WorkflowEventBatch::setErrorResponse(xrd::Response& response,
+                                          const std::exception_ptr& error,
+                                          RequestTracker* requestTracker) {
+  const char* errorType = cta::semconv::attr::ErrorTypeValues::kException;
+  try {
+    std::rethrow_exception(error);
+  } catch (exception::PbException& ex) {
+    m_lc.log(log::ERR, ex.getMessageValue());
+    response.set_type(xrd::Response::RSP_ERR_PROTOBUF);
+    response.set_message_txt(ex.getMessageValue());
+  } catch (exception::UserError& ex) {
+    errorType = cta::semconv::attr::ErrorTypeValues::kUserError;
+    m_lc.log(log::INFO, ex.getMessageValue());
+    response.set_type(xrd::Response::RSP_ERR_USER);
+    response.set_message_txt(ex.getMessageValue());
+  } catch (exception::Exception& ex) {
+    m_lc.log(log::ERR, ex.getMessageValue());
+    response.set_type(xrd::Response::RSP_ERR_CTA);
+    response.set_message_txt(ex.getMessageValue());
+  } catch (std::exception& ex) {
+    m_lc.log(log::ERR, ex.what());
+    response.set_type(xrd::Response::RSP_ERR_CTA);
+    response.set_message_txt(ex.what());
+  } catch (...) {
+    response.set_type(xrd::Response::RSP_ERR_CTA);
+    response.set_message_txt("Error processing workflow event");
+  }
+  if (requestTracker) {
+    requestTracker->setErrorType(errorType);
+  }
+}
+
+}  // namespace cta::frontend
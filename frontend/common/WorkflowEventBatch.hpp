@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "frontend/common/FrontendService.hpp"
+#include "frontend/common/RequestTracker.hpp"
+#include "frontend/common/WorkflowEvent.hpp"
+#include "frontend/common/WorkflowEventGroups.hpp"
+
+#include <exception>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "cta_frontend.pb.h"
+
+namespace cta::frontend {
+
+/*!
+ * A batch of Workflow events received from the same client in one request
+ *
+ * The events are processed in the order in which the client sent them. Consecutive events which can be processed
+ * together are grouped (see groupWorkflowEvents()):
+ *
+ * - the CREATE events of the same instance, storage class and requester get their archive file IDs with a single
+ *   call to Scheduler::checkAndGetNextArchiveFileIds()
+ * - the CLOSEW events of the same instance and storage class are queued with a single call to
+ *   Scheduler::queueArchivesWithGivenIds(), which uses one scheduler DB transaction per group
+ * - the PREPARE events of the same instance are queued with a single call to Scheduler::queueRetrieves()
+ *
+ * The other events are processed one by one. The failure of an event does not prevent the others from being
+ * processed, and each event gets its own response.
+ */
+class WorkflowEventBatch {
+public:
+  WorkflowEventBatch(const frontend::FrontendService& frontendService,
+                     const common::dataStructures::SecurityIdentity& clientIdentity,
+                     const std::vector<eos::Notification>& events,
+                     double clientAuthMsecs = 0);
+
+  ~WorkflowEventBatch() = default;
+
+  /*!
+   * Process the Workflow events
+   *
+   * @return Protobuf to return to the client for each event, in the order of the events
+   */
+  std::vector<xrd::Response> process();
+
+private:
+  /*!
+   * Return what the events processed together with the specified event must have in common, or std::nullopt if the
+   * event is processed on its own
+   */
+  std::optional<WorkflowEventGroupKey> getGroupKey(size_t eventIdx) const;
+
+  /*!
+   * Handlers for each group of Workflow events of the same type
+   *
+   * @param[in]     group      The events of the group
+   * @param[out]    responses  Response protobuf of each event of the batch
+   */
+  void processCREATEs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses);
+  void processCLOSEWs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses);
+  void processPREPAREs(const WorkflowEventGroup& group, std::vector<xrd::Response>& responses);
+
+  /*!
+   * Create the tracker of the processing of an event
+   */
+  std::unique_ptr<RequestTracker> makeRequestTracker(size_t eventIdx) const;
+
+  /*!
+   * Fill in the response of an event which has failed
+   *
+   * @param[out]    response        Response protobuf to return to client
+   * @param[in]     error           The exception which made the event fail
+   * @param[in,out] requestTracker  Tracker of the event, nullptr if it is not tracked
+   */
+  void setErrorResponse(xrd::Response& response, const std::exception_ptr& error, RequestTracker* requestTracker);
+
+  const frontend::FrontendService& m_frontendService;      //!< The frontend service
+  common::dataStructures::SecurityIdentity m_cliIdentity;  //!< Client identity: username, host, authentication
+  const std::vector<eos::Notification>& m_events;          //!< Workflow Event protocol buffers
+  double m_clientAuthMsecs;                                //!< Time in milliseconds taken to authorize the client
+  std::vector<std::unique_ptr<WorkflowEvent>> m_wfes;      //!< The validated events, nullptr for the invalid ones
+  cta::Scheduler& m_scheduler;                             //!< Reference to CTA Scheduler
+  log::LogContext m_lc;                                    //!< CTA Log Context
+};
+
+}  // namespace cta::frontend
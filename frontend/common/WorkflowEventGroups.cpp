@@ -0,0 +1,27 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/common/WorkflowEventGroups.hpp"
+
+namespace cta::frontend {
+
+std::vector<WorkflowEventGroup> groupWorkflowEvents(const std::vector<std::optional<WorkflowEventGroupKey>>& keys,
+                                                    size_t maxGroupSize) {
+  std::vector<WorkflowEventGroup> groups;
+  size_t i = 0;
+  while (i < keys.size()) {
+    WorkflowEventGroup group {i, i + 1, keys[i].has_value()};
+    if (group.batched) {
+      while (group.end < keys.size() && group.end - group.begin < maxGroupSize && keys[group.end] == keys[i]) {
+        group.end++;
+      }
+    }
+    groups.push_back(group);
+    i = group.end;
+  }
+  return groups;
+}
+
+}  // namespace cta::frontend
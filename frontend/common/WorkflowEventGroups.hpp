@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cta::frontend {
+
+/*!
+ * What the Workflow events processed together in a batch have in common
+ *
+ * The fields which do not matter for an event type are left empty, for example the storage class of PREPARE events.
+ */
+struct WorkflowEventGroupKey {
+  int32_t eventType = 0;       //!< Workflow event type, as in the protocol buffer
+  std::string instanceName;    //!< Disk instance of the event
+  std::string storageClass;    //!< Storage class of the file
+  std::string requesterName;   //!< Name of the user the event is processed for
+  std::string requesterGroup;  //!< Group of the user the event is processed for
+
+  auto operator<=>(const WorkflowEventGroupKey&) const = default;
+};
+
+/*!
+ * A run of consecutive events of a batch, processed together
+ */
+struct WorkflowEventGroup {
+  size_t begin = 0;      //!< Index of the first event of the group
+  size_t end = 0;        //!< Index following the last event of the group
+  bool batched = false;  //!< False for an event which is processed on its own
+
+  bool operator==(const WorkflowEventGroup&) const = default;
+};
+
+/*!
+ * Split a batch of Workflow events into groups of consecutive events with the same key
+ *
+ * Only consecutive events are grouped, so that processing the groups one after the other processes the events in the
+ * order in which the client sent them: the CLOSEW event of a file is never processed before its CREATE event. An
+ * event without a key is processed on its own.
+ *
+ * @param keys          The key of each event of the batch, std::nullopt for the events which cannot be batched
+ * @param maxGroupSize  Maximum number of events of a group
+ * @return The groups, in the order of the events
+ */
+std::vector<WorkflowEventGroup> groupWorkflowEvents(const std::vector<std::optional<WorkflowEventGroupKey>>& keys,
+                                                    size_t maxGroupSize);
+
+}  // namespace cta::frontend
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/common/WorkflowEventGroups.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace unitTests {
+
+namespace {
+using cta::frontend::groupWorkflowEvents;
+using cta::frontend::WorkflowEventGroup;
+using cta::frontend::WorkflowEventGroupKey;
+
+// Stand-ins for the values of eos::Workflow::EventType, only their being different matters
+constexpr int32_t CREATE = 1;
+constexpr int32_t CLOSEW = 2;
+constexpr int32_t PREPARE = 3;
+
+std::optional<WorkflowEventGroupKey> key(int32_t eventType, const std::string& storageClass = "") {
+  return WorkflowEventGroupKey {eventType, "eosinstance", storageClass, "user", "group"};
+}
+}  // namespace
+
+TEST(cta_frontend_WorkflowEventGroups, emptyBatch) {
+  ASSERT_TRUE(groupWorkflowEvents({}, 10).empty());
+}
+
+TEST(cta_frontend_WorkflowEventGroups, consecutiveEventsWithTheSameKeyAreGrouped) {
+  const auto groups = groupWorkflowEvents({key(CREATE, "sc1"), key(CREATE, "sc1"), key(CREATE, "sc1")}, 10);
+  ASSERT_EQ(std::vector<WorkflowEventGroup>({{0, 3, true}}), groups);
+}
+
+TEST(cta_frontend_WorkflowEventGroups, eventsAreNotReordered) {
+  // The CLOSEW events of files must not be processed before their CREATE events, nor events of the same storage
+  // class grouped across events of another one
+  const auto groups = groupWorkflowEvents({key(CREATE, "sc1"),
+                                           key(CREATE, "sc1"),
+                                           key(CLOSEW, "sc1"),
+                                           key(CREATE, "sc2"),
+                                           key(CREATE, "sc1"),
+                                           key(CLOSEW, "sc1"),
+                                           key(CLOSEW, "sc1")},
+                                          10);
+  ASSERT_EQ(std::vector<WorkflowEventGroup>({{0, 2, true}, {2, 3, true}, {3, 4, true}, {4, 5, true}, {5, 7, true}}),
+            groups);
+}
+
+TEST(cta_frontend_WorkflowEventGroups, eventsWithoutKeyAreProcessedAlone) {
+  const auto groups = groupWorkflowEvents({key(PREPARE), std::nullopt, std::nullopt, key(PREPARE), key(PREPARE)}, 10);
+  ASSERT_EQ(std::vector<WorkflowEventGroup>({{0, 1, true}, {1, 2, false}, {2, 3, false}, {3, 5, true}}), groups);
+}
+
+TEST(cta_frontend_WorkflowEventGroups, requestersAreNotMixed) {
+  auto otherRequester = key(CREATE, "sc1");
+  otherRequester->requesterName = "otheruser";
+  const auto groups = groupWorkflowEvents({key(CREATE, "sc1"), otherRequester, key(CREATE, "sc1")}, 10);
+  ASSERT_EQ(std::vector<WorkflowEventGroup>({{0, 1, true}, {1, 2, true}, {2, 3, true}}), groups);
+}
+
+TEST(cta_frontend_WorkflowEventGroups, groupsAreLimitedInSize) {
+  const std::vector<std::optional<WorkflowEventGroupKey>> keys(7, key(CLOSEW, "sc1"));
+  const auto groups = groupWorkflowEvents(keys, 3);
+  ASSERT_EQ(std::vector<WorkflowEventGroup>({{0, 3, true}, {3, 6, true}, {6, 7, true}}), groups);
+}
+
+}  // namespace unitTests
@@ -11,6 +11,7 @@
 #include "common/checksum/ChecksumBlobSerDeser.hpp"
 #include "common/dataStructures/SecurityIdentity.hpp"
 #include "common/log/LogLevel.hpp"
+#include "common/utils/Timer.hpp"
 #include "frontend/common/FrontendService.hpp"
 #include "frontend/common/WorkflowEvent.hpp"
 #include "frontend/grpc/common/GrpcAuthUtils.hpp"
@@ -28,7 +29,7 @@ using cta::common::dataStructures::SecurityIdentity;
 namespace cta::frontend::grpc {
 
 std::pair<::grpc::Status, std::optional<SecurityIdentity>>
-CtaRpcImpl::checkWFERequestAuthMetadata(::grpc::ServerContext* context,
+CtaRpcImpl::checkWFERequestAuthMetadata(::grpc::ServerContextBase* context,
                                         const cta::xrd::Request* request,
                                         cta::log::LogContext& lc) {
   std::string clientHost = request->notification().wf().instance().name();
@@ -88,9 +89,10 @@ CtaRpcImpl::checkWFERequestAuthMetadata(::grpc::ServerContext* context,
 Status CtaRpcImpl::processGrpcRequest(const cta::xrd::Request* request,
                                       cta::xrd::Response* response,
                                       cta::log::LogContext& lc,
-                                      const SecurityIdentity& clientIdentity) const {
+                                      const SecurityIdentity& clientIdentity,
+                                      double authMsecs) const {
   try {
-    cta::frontend::WorkflowEvent wfe(*m_frontendService, clientIdentity, request->notification());
+    cta::frontend::WorkflowEvent wfe(*m_frontendService, clientIdentity, request->notification(), authMsecs);
     *response = wfe.process();
   } catch (cta::exception::PbException& ex) {
     lc.log(cta::log::ERR, ex.getMessageValue());
@@ -125,10 +127,18 @@ Status CtaRpcImpl::processGrpcRequest(const cta::xrd::Request* request,
 
 Status
 CtaRpcImpl::Create(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) {
+  return processCreate(context, request, response);
+}
+
+Status CtaRpcImpl::processCreate(::grpc::ServerContextBase* context,
+                                 const cta::xrd::Request* request,
+                                 cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = checkWFERequestAuthMetadata(context, request, lc);
+  const double authMsecs = authTimer.msecs();
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
     response->set_message_txt(status.error_message());
@@ -150,15 +160,23 @@ CtaRpcImpl::Create(::grpc::ServerContext* context, const cta::xrd::Request* requ
                           "Unexpected workflow event type. Expected CREATE, found "
                             + cta::eos::Workflow_EventType_Name(event));
   }
-  return processGrpcRequest(request, response, lc, clientIdentity.value());
+  return processGrpcRequest(request, response, lc, clientIdentity.value(), authMsecs);
 }
 
 Status
 CtaRpcImpl::Archive(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) {
+  return processArchive(context, request, response);
+}
+
+Status CtaRpcImpl::processArchive(::grpc::ServerContextBase* context,
+                                  const cta::xrd::Request* request,
+                                  cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = checkWFERequestAuthMetadata(context, request, lc);
+  const double authMsecs = authTimer.msecs();
 
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
@@ -188,15 +206,23 @@ CtaRpcImpl::Archive(::grpc::ServerContext* context, const cta::xrd::Request* req
                             + cta::eos::Workflow_EventType_Name(event));
   }
 
-  return processGrpcRequest(request, response, lc, clientIdentity.value());
+  return processGrpcRequest(request, response, lc, clientIdentity.value(), authMsecs);
 }
 
 Status
 CtaRpcImpl::Delete(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) {
+  return processDelete(context, request, response);
+}
+
+Status CtaRpcImpl::processDelete(::grpc::ServerContextBase* context,
+                                 const cta::xrd::Request* request,
+                                 cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = checkWFERequestAuthMetadata(context, request, lc);
+  const double authMsecs = authTimer.msecs();
 
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
@@ -229,15 +255,23 @@ CtaRpcImpl::Delete(::grpc::ServerContext* context, const cta::xrd::Request* requ
   }
 
   // done with validation, now do the workflow processing
-  return processGrpcRequest(request, response, lc, clientIdentity.value());
+  return processGrpcRequest(request, response, lc, clientIdentity.value(), authMsecs);
 }
 
 Status
 CtaRpcImpl::Retrieve(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) {
+  return processRetrieve(context, request, response);
+}
+
+Status CtaRpcImpl::processRetrieve(::grpc::ServerContextBase* context,
+                                   const cta::xrd::Request* request,
+                                   cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = checkWFERequestAuthMetadata(context, request, lc);
+  const double authMsecs = authTimer.msecs();
 
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
@@ -277,16 +311,24 @@ CtaRpcImpl::Retrieve(::grpc::ServerContext* context, const cta::xrd::Request* re
   sp.add("archiveID", request->notification().file().archive_file_id());
   sp.add("fileID", request->notification().file().disk_file_id());
 
-  return processGrpcRequest(request, response, lc, clientIdentity.value());
+  return processGrpcRequest(request, response, lc, clientIdentity.value(), authMsecs);
 }
 
 Status CtaRpcImpl::CancelRetrieve(::grpc::ServerContext* context,
                                   const cta::xrd::Request* request,
                                   cta::xrd::Response* response) {
+  return processCancelRetrieve(context, request, response);
+}
+
+Status CtaRpcImpl::processCancelRetrieve(::grpc::ServerContextBase* context,
+                                         const cta::xrd::Request* request,
+                                         cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = checkWFERequestAuthMetadata(context, request, lc);
+  const double authMsecs = authTimer.msecs();
 
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
@@ -329,17 +371,24 @@ Status CtaRpcImpl::CancelRetrieve(::grpc::ServerContext* context,
   sp.add("schedulerJobID", request->notification().file().archive_file_id());
 
   // field verification done, now try to call the process method
-  return processGrpcRequest(request, response, lc, clientIdentity.value());
+  return processGrpcRequest(request, response, lc, clientIdentity.value(), authMsecs);
 }
 
 Status
 CtaRpcImpl::Admin(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) {
+  return processAdmin(context, request, response);
+}
+
+Status CtaRpcImpl::processAdmin(::grpc::ServerContextBase* context,
+                                const cta::xrd::Request* request,
+                                cta::xrd::Response* response) {
   cta::log::LogContext lc(m_frontendService->getLogContext());
   cta::log::ScopedParamContainer sp(lc);
 
   // Retrieve metadata from the incoming request
   const auto& metadata = context->client_metadata();
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] =
     cta::frontend::grpc::common::extractAuthHeaderAndValidate(metadata,
                                                               m_frontendService->usesAdminAuthMethod(AuthMethod::JWT),
@@ -348,6 +397,7 @@ CtaRpcImpl::Admin(::grpc::ServerContext* context, const cta::xrd::Request* reque
                                                               m_frontendService->getInstanceName(),
                                                               context->peer(),
                                                               lc);
+  const double authMsecs = authTimer.msecs();
   if (!status.ok()) {
     response->set_type(cta::xrd::Response::RSP_ERR_USER);
     response->set_message_txt(status.error_message());
@@ -364,7 +414,7 @@ CtaRpcImpl::Admin(::grpc::ServerContext* context, const cta::xrd::Request* reque
   // process the admin command
   // create a securityIdentity cli_Identity
   try {
-    cta::frontend::AdminCmd adminCmd(*m_frontendService, clientIdentity.value(), request->admincmd());
+    cta::frontend::AdminCmd adminCmd(*m_frontendService, clientIdentity.value(), request->admincmd(), authMsecs);
     *response = adminCmd.process();  // success response code will be set in here if processing goes well
   } catch (cta::exception::PbException& ex) {
     lc.log(cta::log::ERR, ex.getMessageValue());
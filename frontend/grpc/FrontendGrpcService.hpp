@@ -60,15 +60,31 @@ public:
   // Non-streaming cta-admin commands interface
   Status Admin(::grpc::ServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) final;
 
+  // Processing of the RPCs, shared with the services implemented with the gRPC callback API
+  Status
+  processCreate(::grpc::ServerContextBase* context, const cta::xrd::Request* request, cta::xrd::Response* response);
+  Status
+  processArchive(::grpc::ServerContextBase* context, const cta::xrd::Request* request, cta::xrd::Response* response);
+  Status
+  processRetrieve(::grpc::ServerContextBase* context, const cta::xrd::Request* request, cta::xrd::Response* response);
+  Status processCancelRetrieve(::grpc::ServerContextBase* context,
+                               const cta::xrd::Request* request,
+                               cta::xrd::Response* response);
+  Status
+  processDelete(::grpc::ServerContextBase* context, const cta::xrd::Request* request, cta::xrd::Response* response);
+  Status
+  processAdmin(::grpc::ServerContextBase* context, const cta::xrd::Request* request, cta::xrd::Response* response);
+
 private:
   std::pair<::grpc::Status, std::optional<cta::common::dataStructures::SecurityIdentity>>
-  checkWFERequestAuthMetadata(::grpc::ServerContext* context,
+  checkWFERequestAuthMetadata(::grpc::ServerContextBase* context,
                               const cta::xrd::Request* request,
                               cta::log::LogContext& lc);
 
   Status processGrpcRequest(const cta::xrd::Request* request,
                             cta::xrd::Response* response,
                             cta::log::LogContext& lc,
-                            const cta::common::dataStructures::SecurityIdentity& clientIdentity) const;
+                            const cta::common::dataStructures::SecurityIdentity& clientIdentity,
+                            double authMsecs) const;
 };
 }  // namespace cta::frontend::grpc
@@ -24,6 +24,7 @@
 #include "NegotiationService.hpp"
 #include "TokenStorage.hpp"
 #include "callback_api/CtaAdminServer.hpp"
+#include "callback_api/CtaRpcCallbackImpl.hpp"
 #include "common/utils/utils.hpp"
 
 #include <future>
@@ -128,14 +129,16 @@ int main(const int argc, char* const* const argv) {
     jwkCache = std::make_shared<cta::auth::JwkCache>(std::move(jwksFetcher),
                                                      jwtConfig->m_jwksUri,
                                                      jwtConfig->m_pubkeyTimeout,
-                                                     frontendService->getLogContext());
+                                                     frontendService->getLogContext(),
+                                                     jwtConfig->m_verifiedTokenTimeout);
 
     {
       log::ScopedParamContainer spc(lc);
       spc.add("jwks_uri", jwtConfig->m_jwksUri)
         .add("total_timeout", std::to_string(jwtConfig->m_jwksTotalTimeout))
         .add("key_timeout", std::to_string(jwtConfig->m_pubkeyTimeout))
-        .add("cache_refresh_interval", std::to_string(jwtConfig->m_cacheRefreshInterval));
+        .add("cache_refresh_interval", std::to_string(jwtConfig->m_cacheRefreshInterval))
+        .add("verified_token_timeout", std::to_string(jwtConfig->m_verifiedTokenTimeout));
       lc.log(log::INFO, std::string("JWT authentication enabled"));
     }
 
@@ -267,8 +270,16 @@ int main(const int argc, char* const* const argv) {
   }
 
   // Register "service" as the instance through which we'll communicate with
-  // clients. In this case it corresponds to an *synchronous* service.
-  builder.RegisterService(&svc);
+  // clients. By default it corresponds to an *synchronous* service, the
+  // callback API serves each RPC type with its own threads and queue.
+  std::unique_ptr<frontend::grpc::CtaRpcCallbackImpl> callbackSvc;
+  if (frontendService->getRpcQueueConfigs().empty()) {
+    builder.RegisterService(&svc);
+  } else {
+    lc.log(log::INFO, "Serving workflow events and admin commands with the gRPC callback API");
+    callbackSvc = std::make_unique<frontend::grpc::CtaRpcCallbackImpl>(svc, frontendService->getRpcQueueConfigs(), lc);
+    builder.RegisterService(callbackSvc.get());
+  }
 
   lc.log(log::DEBUG, "Instance name is: '" + frontendService->getInstanceName() + "'");
 
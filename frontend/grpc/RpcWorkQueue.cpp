@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "RpcWorkQueue.hpp"
+
+#include "common/exception/UserError.hpp"
+#include "common/semconv/Attributes.hpp"
+#include "common/telemetry/metrics/instruments/FrontendInstruments.hpp"
+
+#include <opentelemetry/context/runtime_context.h>
+
+namespace cta::frontend::grpc {
+
+RpcWorkQueue::RpcWorkQueue(const std::string& name, const uint32_t nbThreads, const uint32_t maxQueued)
+    : m_name(name),
+      m_maxQueued(maxQueued) {
+  if (nbThreads < 1) {
+    throw exception::UserError("The number of threads serving " + name + " RPCs must be at least 1");
+  }
+  m_threads.reserve(nbThreads);
+  for (uint32_t i = 0; i < nbThreads; i++) {
+    m_threads.emplace_back(&RpcWorkQueue::serve, this);
+  }
+}
+
+RpcWorkQueue::~RpcWorkQueue() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_workAvailable.notify_all();
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+bool RpcWorkQueue::trySubmit(std::function<void()> work) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stopping || m_queue.size() >= m_maxQueued) {
+      return false;
+    }
+    m_queue.push_back({std::move(work), std::chrono::steady_clock::now()});
+  }
+  cta::telemetry::metrics::ctaFrontendQueuedRequests->Add(
+    1,
+    {
+      {cta::semconv::attr::kFrontendRequestQueue, m_name}
+  });
+  m_workAvailable.notify_one();
+  return true;
+}
+
+::grpc::Status RpcWorkQueue::getQueueFullStatus() const {
+  return ::grpc::Status(::grpc::StatusCode::RESOURCE_EXHAUSTED,
+                        "Too many " + m_name + " requests in progress, retry later");
+}
+
+void RpcWorkQueue::serve() {
+  while (true) {
+    QueuedWork queuedWork;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_workAvailable.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+      if (m_queue.empty()) {
+        return;
+      }
+      queuedWork = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+    const std::chrono::duration<double, std::milli> queueWait = std::chrono::steady_clock::now() - queuedWork.queueTime;
+    cta::telemetry::metrics::ctaFrontendQueuedRequests->Add(
+      -1,
+      {
+        {cta::semconv::attr::kFrontendRequestQueue, m_name}
+    });
+    cta::telemetry::metrics::ctaFrontendRequestQueueWait->Record(
+      queueWait.count(),
+      {
+        {cta::semconv::attr::kFrontendRequestQueue, m_name}
+    },
+      opentelemetry::context::RuntimeContext::GetCurrent());
+    queuedWork.work();
+  }
+}
+
+}  // namespace cta::frontend::grpc
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <grpcpp/support/status.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cta::frontend::grpc {
+
+/*
+ * A queue of RPCs of the same type waiting to be served by a fixed number of
+ * threads.  The number of RPCs waiting in the queue is bounded so that a
+ * saturated RPC type is refused new work instead of delaying all the others.
+ * The number of queued RPCs and the time they wait before being served are
+ * reported as frontend metrics.
+ */
+class RpcWorkQueue {
+public:
+  /*
+   * Constructor.  Starts the threads serving the queue.
+   *
+   * @param name The name of the RPC type served by the queue
+   * @param nbThreads The maximum number of RPCs served concurrently
+   * @param maxQueued The maximum number of RPCs waiting to be served
+   */
+  RpcWorkQueue(const std::string& name, const uint32_t nbThreads, const uint32_t maxQueued);
+
+  /*
+   * Destructor.  Serves the RPCs still in the queue and then stops the threads.
+   */
+  ~RpcWorkQueue();
+
+  RpcWorkQueue(const RpcWorkQueue&) = delete;
+  RpcWorkQueue& operator=(const RpcWorkQueue&) = delete;
+
+  /*
+   * Queues the specified work if the queue is not full
+   *
+   * @param work The work serving an RPC
+   * @return false if the queue is full, in which case the work is not queued
+   */
+  bool trySubmit(std::function<void()> work);
+
+  /*
+   * Get the status refusing an RPC because the queue is full.  RESOURCE_EXHAUSTED tells the client to retry later.
+   */
+  ::grpc::Status getQueueFullStatus() const;
+
+  /*
+   * Get the name of the RPC type served by the queue
+   */
+  const std::string& getName() const { return m_name; }
+
+private:
+  /*
+   * The work serving an RPC and the time at which it was queued
+   */
+  struct QueuedWork {
+    std::function<void()> work;
+    std::chrono::steady_clock::time_point queueTime;
+  };
+
+  /*
+   * The body of the threads serving the queue
+   */
+  void serve();
+
+  // clang-format off
+  const std::string                  m_name;             //!< The name of the RPC type served by the queue
+  const uint32_t                     m_maxQueued;        //!< The maximum number of RPCs waiting to be served
+  std::mutex                         m_mutex;            //!< Protects m_queue and m_stopping
+  std::condition_variable            m_workAvailable;    //!< Signalled when work is queued or the threads should stop
+  std::deque<QueuedWork>             m_queue;            //!< The RPCs waiting to be served
+  bool                               m_stopping = false; //!< True when the threads should stop once the queue is empty
+  std::vector<std::thread>           m_threads;          //!< The threads serving the queue
+  // clang-format on
+};
+
+}  // namespace cta::frontend::grpc
@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frontend/grpc/RpcWorkQueue.hpp"
+
+#include "common/exception/UserError.hpp"
+
+#include <functional>
+#include <future>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace unitTests {
+
+namespace {
+/**
+ * Occupies the thread serving a queue until it is released
+ */
+class BlockingWork {
+public:
+  std::function<void()> work() {
+    return [this] {
+      m_started.set_value();
+      m_released.get_future().wait();
+    };
+  }
+
+  void waitStarted() { m_started.get_future().wait(); }
+
+  void release() { m_released.set_value(); }
+
+private:
+  std::promise<void> m_started;
+  std::promise<void> m_released;
+};
+}  // namespace
+
+TEST(cta_frontend_grpc_RpcWorkQueueTest, refuses_work_when_full) {
+  using cta::frontend::grpc::RpcWorkQueue;
+
+  RpcWorkQueue queue("archive", 1, 2);
+  BlockingWork blocking;
+  ASSERT_TRUE(queue.trySubmit(blocking.work()));
+  blocking.waitStarted();
+
+  // The only thread is busy: 2 RPCs can wait, the next one is refused
+  std::promise<void> queuedWorkDone;
+  ASSERT_TRUE(queue.trySubmit([] {}));
+  ASSERT_TRUE(queue.trySubmit([&queuedWorkDone] { queuedWorkDone.set_value(); }));
+  bool refusedWorkRun = false;
+  ASSERT_FALSE(queue.trySubmit([&refusedWorkRun] { refusedWorkRun = true; }));
+
+  const auto status = queue.getQueueFullStatus();
+  ASSERT_EQ(::grpc::StatusCode::RESOURCE_EXHAUSTED, status.error_code());
+  ASSERT_EQ("Too many archive requests in progress, retry later", status.error_message());
+
+  // Once the queue has drained it accepts work again
+  blocking.release();
+  queuedWorkDone.get_future().wait();
+  std::promise<void> laterWorkDone;
+  ASSERT_TRUE(queue.trySubmit([&laterWorkDone] { laterWorkDone.set_value(); }));
+  laterWorkDone.get_future().wait();
+  ASSERT_FALSE(refusedWorkRun);
+}
+
+TEST(cta_frontend_grpc_RpcWorkQueueTest, drains_in_order) {
+  using cta::frontend::grpc::RpcWorkQueue;
+
+  std::vector<int> servedWork;
+  {
+    RpcWorkQueue queue("admin", 1, 100);
+    BlockingWork blocking;
+    ASSERT_TRUE(queue.trySubmit(blocking.work()));
+    blocking.waitStarted();
+    for (int i = 0; i < 10; i++) {
+      ASSERT_TRUE(queue.trySubmit([&servedWork, i] { servedWork.push_back(i); }));
+    }
+    blocking.release();
+    // The destructor serves the RPCs still queued before stopping the threads
+  }
+  ASSERT_EQ((std::vector<int> {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), servedWork);
+}
+
+TEST(cta_frontend_grpc_RpcWorkQueueTest, needs_a_thread) {
+  using cta::frontend::grpc::RpcWorkQueue;
+
+  ASSERT_THROW(RpcWorkQueue("create", 0, 100), cta::exception::UserError);
+}
+
+}  // namespace unitTests
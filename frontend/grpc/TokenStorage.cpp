@@ -10,43 +10,37 @@
 
 void cta::frontend::grpc::server::TokenStorage::store(const std::string& strToken,
                                                       const std::string& strClientPrincipal) {
-  std::unique_lock<std::shared_mutex> lck(m_mtxLockStorage);
-  m_umapTokens[strToken] =
+  auto& shard = getShard(strToken);
+  std::unique_lock<std::mutex> lck(shard.m_mtxLockStorage);
+  shard.m_umapTokens[strToken] =
     std::pair {strClientPrincipal,
                std::chrono::system_clock::to_time_t(std::chrono::system_clock::now() + std::chrono::seconds(60))};
 }
 
-cta::frontend::grpc::server::Krb5TokenValidationResult
-cta::frontend::grpc::server::TokenStorage::validate(const std::string& strEncodedToken) const {
-  std::shared_lock<std::shared_mutex> lck(m_mtxLockStorage);
-
-  std::string strDecodedToken = cta::utils::base64decode(strEncodedToken);
-  const auto itor = m_umapTokens.find(strDecodedToken);
-  if (itor != m_umapTokens.end()) {
-    if (bool expired = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()) > itor->second.second;
-        expired) {
-      return Krb5TokenValidationResult::EXPIRED;
-    } else {
-      return Krb5TokenValidationResult::VALID;
-    }
-  }
-  return Krb5TokenValidationResult::NOT_FOUND;
-}
-
-std::string cta::frontend::grpc::server::TokenStorage::getClientPrincipal(const std::string& strEncodedToken) const {
+std::pair<cta::frontend::grpc::server::Krb5TokenValidationResult, std::string>
+cta::frontend::grpc::server::TokenStorage::take(const std::string& strEncodedToken) {
   std::string strDecodedToken = cta::utils::base64decode(strEncodedToken);
 
-  std::shared_lock<std::shared_mutex> lck(m_mtxLockStorage);
-  auto it = m_umapTokens.find(strDecodedToken);
-  if (it != m_umapTokens.end()) {
-    return it->second.first;
+  auto& shard = getShard(strDecodedToken);
+  std::unique_lock<std::mutex> lck(shard.m_mtxLockStorage);
+  auto node = shard.m_umapTokens.extract(strDecodedToken);
+  if (node.empty()) {
+    return {Krb5TokenValidationResult::NOT_FOUND, ""};
   }
-  return "";
+  // The node is destroyed once the lock is released
+  lck.unlock();
+  return {checkExpiration(node.mapped().second), std::move(node.mapped().first)};
 }
 
-void cta::frontend::grpc::server::TokenStorage::remove(const std::string& strEncodedToken) {
-  std::unique_lock<std::shared_mutex> lck(m_mtxLockStorage);
+cta::frontend::grpc::server::TokenStorage::Shard&
+cta::frontend::grpc::server::TokenStorage::getShard(const std::string& strDecodedToken) {
+  return m_shards[std::hash<std::string> {}(strDecodedToken) % NB_SHARDS];
+}
 
-  std::string strDecodedToken = cta::utils::base64decode(strEncodedToken);
-  m_umapTokens.erase(strDecodedToken);
+cta::frontend::grpc::server::Krb5TokenValidationResult
+cta::frontend::grpc::server::TokenStorage::checkExpiration(time_t expirationTime) {
+  if (std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()) > expirationTime) {
+    return Krb5TokenValidationResult::EXPIRED;
+  }
+  return Krb5TokenValidationResult::VALID;
 }
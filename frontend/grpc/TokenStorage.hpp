@@ -5,16 +5,23 @@
 
 #pragma once
 
+#include <array>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 #include <time.h>
 #include <unordered_map>
+#include <utility>
 
 namespace cta::frontend::grpc::server {
 
 enum class Krb5TokenValidationResult { EXPIRED, NOT_FOUND, VALID };
 
+/*
+ * Storage of the session tokens of the clients authenticated with Kerberos
+ *
+ * The tokens are spread over shards, each with its own lock, so that the requests of different clients do not wait
+ * for each other.
+ */
 class TokenStorage {
 public:
   TokenStorage() = default;
@@ -26,28 +33,26 @@ public:
    */
   void store(const std::string& strToken, const std::string& strClientPrincipal);
   /*
-   * Token validation
+   * Validate a token, get its client principal and remove it from storage, in a single lookup
    * @param strEncodedToken The session token encoded in base64 format
+   * @return The result of the validation and the client principal, empty if the token is not found
    */
-  Krb5TokenValidationResult validate(const std::string& strEncodedToken) const;
+  std::pair<Krb5TokenValidationResult, std::string> take(const std::string& strEncodedToken);
 
-  /*
-   * Get the client principal (username) for a validated token
-   * Needed to check if they are authorized to perform admin commands
-   * @param strEncodedToken The session token encoded in base64 format
-   */
-  std::string getClientPrincipal(const std::string& strEncodedToken) const;
+private:
+  static constexpr size_t NB_SHARDS = 16;
 
-  /*
-   * Remove a token from storage (tokens are not needed beyond the duration of a single call)
-   * @param strEncodedToken The session token encoded in base64 format
-   */
-  void remove(const std::string& strEncodedToken);
+  struct Shard {
+    // map token -> [clientPrincipal, expirationTime]
+    std::unordered_map<std::string, std::pair<std::string, time_t>> m_umapTokens;
+    std::mutex m_mtxLockStorage;
+  };
 
-private:
-  // map token -> [clientPrincipal, expirationTime]
-  std::unordered_map<std::string, std::pair<std::string, time_t>> m_umapTokens;
-  mutable std::shared_mutex m_mtxLockStorage;
+  Shard& getShard(const std::string& strDecodedToken);
+
+  static Krb5TokenValidationResult checkExpiration(time_t expirationTime);
+
+  std::array<Shard, NB_SHARDS> m_shards;
 };
 
 }  // namespace cta::frontend::grpc::server
@@ -12,6 +12,7 @@
 #include "common/log/LogContext.hpp"
 #include "common/log/Logger.hpp"
 #include "common/semconv/Attributes.hpp"
+#include "common/utils/Timer.hpp"
 #include "frontend/common/ActivityMountRuleLsResponseStream.hpp"
 #include "frontend/common/AdminLsResponseStream.hpp"
 #include "frontend/common/ArchiveRouteLsResponseStream.hpp"
@@ -113,6 +114,7 @@ CtaRpcStreamImpl::GenericAdminStream(::grpc::CallbackServerContext* context, con
   auto client_metadata = context->client_metadata();
   auto usingJWT = std::ranges::find(m_authMethods, AuthMethod::JWT) != std::end(m_authMethods);
 
+  cta::utils::Timer authTimer;
   auto [status, clientIdentity] = cta::frontend::grpc::common::extractAuthHeaderAndValidate(client_metadata,
                                                                                             usingJWT,
                                                                                             m_pubkeyCache,
@@ -120,11 +122,13 @@ CtaRpcStreamImpl::GenericAdminStream(::grpc::CallbackServerContext* context, con
                                                                                             m_instanceName,
                                                                                             context->peer(),
                                                                                             lc);
+  const double authMsecs = authTimer.msecs();
   if (!status.ok()) {
     return new DefaultWriteReactor(status.error_message(), status.error_code());
   }
 
   cta::frontend::RequestTracker requestTracker("ADMIN_STREAMING", "admin");
+  requestTracker.addPhaseTime(cta::frontend::RequestTracker::Phase::Auth, authMsecs);
   std::unique_ptr<cta::frontend::CtaAdminResponseStream> stream;
   cta::admin::HeaderType headerType;
   try {
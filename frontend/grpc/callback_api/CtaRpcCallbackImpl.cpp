@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "CtaRpcCallbackImpl.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/log/LogLevel.hpp"
+
+namespace cta::frontend::grpc {
+
+CtaRpcCallbackImpl::CtaRpcCallbackImpl(CtaRpcImpl& rpcImpl,
+                                       const std::map<std::string, RpcQueueConfig, std::less<>>& rpcQueueConfigs,
+                                       const cta::log::LogContext& lc)
+    : m_rpcImpl(rpcImpl),
+      m_lc(lc),
+      m_createQueue(makeQueue(rpcQueueConfigs, "create")),
+      m_archiveQueue(makeQueue(rpcQueueConfigs, "archive")),
+      m_retrieveQueue(makeQueue(rpcQueueConfigs, "retrieve")),
+      m_cancelRetrieveQueue(makeQueue(rpcQueueConfigs, "cancel_retrieve")),
+      m_deleteQueue(makeQueue(rpcQueueConfigs, "delete")),
+      m_adminQueue(makeQueue(rpcQueueConfigs, "admin")) {}
+
+std::unique_ptr<RpcWorkQueue>
+CtaRpcCallbackImpl::makeQueue(const std::map<std::string, RpcQueueConfig, std::less<>>& rpcQueueConfigs,
+                              const std::string& rpcType) {
+  const auto rpcQueueConfig = rpcQueueConfigs.find(rpcType);
+  if (rpcQueueConfig == rpcQueueConfigs.end()) {
+    throw cta::exception::Exception("No concurrency limits configured for " + rpcType + " RPCs");
+  }
+  return std::make_unique<RpcWorkQueue>(rpcType, rpcQueueConfig->second.m_threads, rpcQueueConfig->second.m_queueSize);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::dispatch(RpcWorkQueue& queue,
+                                                         ProcessRpc processRpc,
+                                                         ::grpc::CallbackServerContext* context,
+                                                         const cta::xrd::Request* request,
+                                                         cta::xrd::Response* response) {
+  // The request, the response and the context stay valid until Finish() is called on the reactor
+  auto* reactor = context->DefaultReactor();
+  const bool queued = queue.trySubmit([this, processRpc, reactor, context, request, response]() {
+    // Do not waste a thread on an RPC whose client has given up while it was queued
+    if (context->IsCancelled()) {
+      reactor->Finish(::grpc::Status(::grpc::StatusCode::CANCELLED, "RPC cancelled while queued"));
+      return;
+    }
+    try {
+      reactor->Finish((m_rpcImpl.*processRpc)(context, request, response));
+    } catch (cta::exception::Exception& ex) {
+      cta::log::LogContext lc(m_lc);
+      lc.log(cta::log::ERR, ex.getMessageValue());
+      response->set_type(cta::xrd::Response::RSP_ERR_CTA);
+      response->set_message_txt(ex.getMessageValue());
+      reactor->Finish(::grpc::Status(::grpc::StatusCode::FAILED_PRECONDITION, ex.getMessageValue()));
+    } catch (...) {
+      response->set_type(cta::xrd::Response::RSP_ERR_CTA);
+      reactor->Finish(::grpc::Status(::grpc::StatusCode::UNKNOWN, "Error processing gRPC request"));
+    }
+  });
+
+  if (!queued) {
+    const auto status = queue.getQueueFullStatus();
+    cta::log::LogContext lc(m_lc);
+    cta::log::ScopedParamContainer sp(lc);
+    sp.add("remoteHost", context->peer());
+    sp.add("request", queue.getName());
+    lc.log(cta::log::WARNING, "In CtaRpcCallbackImpl::dispatch(): request refused because its queue is full");
+    response->set_type(cta::xrd::Response::RSP_ERR_CTA);
+    response->set_message_txt(status.error_message());
+    reactor->Finish(status);
+  }
+  return reactor;
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::Create(::grpc::CallbackServerContext* context,
+                                                       const cta::xrd::Request* request,
+                                                       cta::xrd::Response* response) {
+  return dispatch(*m_createQueue, &CtaRpcImpl::processCreate, context, request, response);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::Archive(::grpc::CallbackServerContext* context,
+                                                        const cta::xrd::Request* request,
+                                                        cta::xrd::Response* response) {
+  return dispatch(*m_archiveQueue, &CtaRpcImpl::processArchive, context, request, response);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::Retrieve(::grpc::CallbackServerContext* context,
+                                                         const cta::xrd::Request* request,
+                                                         cta::xrd::Response* response) {
+  return dispatch(*m_retrieveQueue, &CtaRpcImpl::processRetrieve, context, request, response);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::CancelRetrieve(::grpc::CallbackServerContext* context,
+                                                               const cta::xrd::Request* request,
+                                                               cta::xrd::Response* response) {
+  return dispatch(*m_cancelRetrieveQueue, &CtaRpcImpl::processCancelRetrieve, context, request, response);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::Delete(::grpc::CallbackServerContext* context,
+                                                       const cta::xrd::Request* request,
+                                                       cta::xrd::Response* response) {
+  return dispatch(*m_deleteQueue, &CtaRpcImpl::processDelete, context, request, response);
+}
+
+::grpc::ServerUnaryReactor* CtaRpcCallbackImpl::Admin(::grpc::CallbackServerContext* context,
+                                                      const cta::xrd::Request* request,
+                                                      cta::xrd::Response* response) {
+  return dispatch(*m_adminQueue, &CtaRpcImpl::processAdmin, context, request, response);
+}
+
+}  // namespace cta::frontend::grpc
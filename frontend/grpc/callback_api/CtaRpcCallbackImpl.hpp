@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/LogContext.hpp"
+#include "frontend/grpc/FrontendGrpcService.hpp"
+#include "frontend/grpc/RpcWorkQueue.hpp"
+
+#include <grpcpp/grpcpp.h>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "cta_frontend.grpc.pb.h"
+#include "cta_frontend.pb.h"
+
+namespace cta::frontend::grpc {
+
+/* Implementation of the CtaRpc service using gRPC's callback API.
+ *
+ * The RPCs are processed by CtaRpcImpl, but instead of holding a thread of the gRPC server each RPC is queued to
+ * the RpcWorkQueue of its type, which has its own threads.  The RPCs of one type can therefore only delay the RPCs
+ * of the same type: admin commands and slow database calls cannot hold the threads queueing archive requests.
+ * When the queue of an RPC type is full the RPC is refused with the retryable status RESOURCE_EXHAUSTED.
+ */
+class CtaRpcCallbackImpl : public cta::xrd::CtaRpc::CallbackService {
+public:
+  /*
+   * Constructor
+   *
+   * @param rpcImpl The implementation processing the RPCs
+   * @param rpcQueueConfigs The concurrency limits of each RPC type
+   * @param lc The log context
+   */
+  CtaRpcCallbackImpl(CtaRpcImpl& rpcImpl,
+                     const std::map<std::string, RpcQueueConfig, std::less<>>& rpcQueueConfigs,
+                     const cta::log::LogContext& lc);
+
+  ::grpc::ServerUnaryReactor*
+  Create(::grpc::CallbackServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) final;
+  ::grpc::ServerUnaryReactor*
+  Archive(::grpc::CallbackServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) final;
+  ::grpc::ServerUnaryReactor* Retrieve(::grpc::CallbackServerContext* context,
+                                       const cta::xrd::Request* request,
+                                       cta::xrd::Response* response) final;
+  ::grpc::ServerUnaryReactor* CancelRetrieve(::grpc::CallbackServerContext* context,
+                                             const cta::xrd::Request* request,
+                                             cta::xrd::Response* response) final;
+  ::grpc::ServerUnaryReactor*
+  Delete(::grpc::CallbackServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) final;
+  ::grpc::ServerUnaryReactor*
+  Admin(::grpc::CallbackServerContext* context, const cta::xrd::Request* request, cta::xrd::Response* response) final;
+
+private:
+  using ProcessRpc = Status (CtaRpcImpl::*)(::grpc::ServerContextBase*, const cta::xrd::Request*, cta::xrd::Response*);
+
+  /*
+   * Queues the specified RPC to the queue of its type, or refuses it if the queue is full
+   *
+   * @param queue The queue of the RPC type
+   * @param processRpc The method of CtaRpcImpl processing the RPC
+   */
+  ::grpc::ServerUnaryReactor* dispatch(RpcWorkQueue& queue,
+                                       ProcessRpc processRpc,
+                                       ::grpc::CallbackServerContext* context,
+                                       const cta::xrd::Request* request,
+                                       cta::xrd::Response* response);
+
+  /*
+   * Creates the queue of the specified RPC type
+   */
+  static std::unique_ptr<RpcWorkQueue>
+  makeQueue(const std::map<std::string, RpcQueueConfig, std::less<>>& rpcQueueConfigs, const std::string& rpcType);
+
+  // clang-format off
+  CtaRpcImpl&                     m_rpcImpl;               //!< The implementation processing the RPCs
+  cta::log::LogContext            m_lc;                    //!< The log context
+  std::unique_ptr<RpcWorkQueue>   m_createQueue;           //!< The queue of the Create RPCs
+  std::unique_ptr<RpcWorkQueue>   m_archiveQueue;          //!< The queue of the Archive RPCs
+  std::unique_ptr<RpcWorkQueue>   m_retrieveQueue;         //!< The queue of the Retrieve RPCs
+  std::unique_ptr<RpcWorkQueue>   m_cancelRetrieveQueue;   //!< The queue of the CancelRetrieve RPCs
+  std::unique_ptr<RpcWorkQueue>   m_deleteQueue;           //!< The queue of the Delete RPCs
+  std::unique_ptr<RpcWorkQueue>   m_adminQueue;            //!< The queue of the Admin RPCs
+  // clang-format on
+};
+
+}  // namespace cta::frontend::grpc
@@ -17,12 +17,9 @@ namespace cta::frontend::grpc::common {
 
 std::pair<Status, std::string>
 validateKrb5Token(const std::string& token, server::TokenStorage& tokenStorage, cta::log::LogContext& lc) {
-  // Validate the Kerberos token from storage
-  if (auto validationResult = tokenStorage.validate(token);
+  // Validate the Kerberos token from storage, extracting the name and removing the token in the same lookup
+  if (auto [validationResult, username] = tokenStorage.take(token);
       validationResult != server::Krb5TokenValidationResult::NOT_FOUND) {
-    // extract the name, construct the clientIdentity and remove the token
-    std::string username = tokenStorage.getClientPrincipal(token);
-    tokenStorage.remove(token);
     if (username.empty()) {
       return {Status(StatusCode::UNAUTHENTICATED, "Failed to retrieve client principal"), ""};
     }
@@ -9,6 +9,12 @@
 
 namespace cta::maintd {
 
+/**
+ * A maintenance task executed periodically by the RoutineRunner.
+ *
+ * Different routines can be executed at the same time by different threads, so a routine should not share state
+ * which is not thread safe, such as a log context, with the other routines.
+ */
 class IRoutine {
 public:
   virtual ~IRoutine() = default;
@@ -18,22 +18,30 @@ struct DiskReportRoutineConfig final {
   bool enabled = true;
   int batch_size = 500;
   int soft_timeout_secs = 30;
+  int max_in_flight_reports = 100;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 3; }
+  static constexpr std::size_t memberCount() { return 6; }
 };
 
 struct RepackExpandRoutineConfig final {
   bool enabled = true;
   int max_to_expand = 2;
+  int max_concurrent_expansions = 1;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 2; }
+  static constexpr std::size_t memberCount() { return 5; }
 };
 
 struct RepackReportRoutineConfig final {
   bool enabled = true;
   int soft_timeout_secs = 900;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 2; }
+  static constexpr std::size_t memberCount() { return 4; }
 };
 
 #ifndef CTA_PGSCHED
@@ -41,14 +49,18 @@ struct RepackReportRoutineConfig final {
 struct QueueCleanupRoutineConfig final {
   bool enabled = true;
   int batch_size = 500;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 2; }
+  static constexpr std::size_t memberCount() { return 4; }
 };
 
 struct GarbageCollectRoutineConfig final {
   bool enabled = true;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 1; }
+  static constexpr std::size_t memberCount() { return 3; }
 };
 
 #else
@@ -57,16 +69,20 @@ struct ActivePendingQueueCleanupRoutineConfig final {
   bool enabled = true;
   int batch_size = 500;
   int age_for_collection_secs = 900;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 3; }
+  static constexpr std::size_t memberCount() { return 5; }
 };
 
 struct SchedulerMaintenanceCleanupRoutineConfig final {
   bool enabled = true;
   int batch_size = 500;
   int age_for_deletion_secs = 1209600;
+  std::optional<int> interval_secs;
+  std::optional<int> max_duration_secs;
 
-  static constexpr std::size_t memberCount() { return 3; }
+  static constexpr std::size_t memberCount() { return 5; }
 };
 
 #endif
@@ -74,6 +90,7 @@ struct SchedulerMaintenanceCleanupRoutineConfig final {
 struct RoutinesConfig final {
   int cycle_sleep_interval_secs = 10;
   int max_cycle_duration_secs = 900;
+  int max_concurrent_routines = 1;
 
   DiskReportRoutineConfig disk_report_archive;
   DiskReportRoutineConfig disk_report_retrieve;
@@ -85,7 +102,7 @@ struct RoutinesConfig final {
   GarbageCollectRoutineConfig garbage_collect;
   QueueCleanupRoutineConfig queue_cleanup;
 
-  static constexpr std::size_t memberCount() { return 8; }
+  static constexpr std::size_t memberCount() { return 9; }
 #else
   ActivePendingQueueCleanupRoutineConfig user_active_queue_cleanup;
   ActivePendingQueueCleanupRoutineConfig repack_active_queue_cleanup;
@@ -93,7 +110,7 @@ struct RoutinesConfig final {
   ActivePendingQueueCleanupRoutineConfig repack_pending_queue_cleanup;
   SchedulerMaintenanceCleanupRoutineConfig scheduler_maintenance_cleanup;
 
-  static constexpr std::size_t memberCount() { return 11; }
+  static constexpr std::size_t memberCount() { return 12; }
 #endif
 };
 
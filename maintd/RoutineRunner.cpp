@@ -12,6 +12,7 @@
 #include "common/utils/Timer.hpp"
 #include "rdbms/Login.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <opentelemetry/context/runtime_context.h>
 #include <signal.h>
@@ -20,20 +21,24 @@
 
 namespace cta::maintd {
 
-// Don't say this out loud
-int64_t nowSecs() {
-  return std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+RoutineRunner::RoutineRunner(const RoutinesConfig& routinesConfig, std::vector<ScheduledRoutine> routines)
+    : m_config(routinesConfig) {
+  m_routines.reserve(routines.size());
+  for (auto& routine : routines) {
+    m_routines.emplace_back().scheduled = std::move(routine);
+  }
 }
 
-RoutineRunner::RoutineRunner(const RoutinesConfig& routinesConfig, std::vector<std::unique_ptr<IRoutine>> routines)
-    : m_config(routinesConfig),
-      m_routines(std::move(routines)) {}
-
 //------------------------------------------------------------------------------
 // RoutineRunner::stop
 //------------------------------------------------------------------------------
 void RoutineRunner::stop() {
-  m_running = false;
+  {
+    std::lock_guard lock(m_mutex);
+    m_running = false;
+  }
+  m_queueCv.notify_all();
+  m_dispatchCv.notify_all();
 }
 
 void RoutineRunner::safeRunRoutine(IRoutine& routine, cta::log::LogContext& lc) const {
@@ -62,6 +67,77 @@ void RoutineRunner::safeRunRoutine(IRoutine& routine, cta::log::LogContext& lc)
   }
 }
 
+//------------------------------------------------------------------------------
+// RoutineRunner::workerLoop
+//------------------------------------------------------------------------------
+void RoutineRunner::workerLoop(cta::log::LogContext& lc) {
+  std::unique_lock lock(m_mutex);
+  while (true) {
+    m_queueCv.wait(lock, [this] { return !m_running || !m_queue.empty(); });
+    if (!m_running) {
+      return;
+    }
+    RoutineState& state = m_routines[m_queue.front()];
+    m_queue.pop_front();
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(startTime - state.nextRunTime);
+    state.executionStartTime = startTime;
+    state.overdueReported = false;
+    lock.unlock();
+
+    cta::telemetry::metrics::ctaMaintdRoutineQueueDepth->Add(-1);
+    cta::telemetry::metrics::ctaMaintdRoutineLag->Record(
+      lag.count(),
+      {
+        {cta::semconv::attr::kCtaRoutineName, state.scheduled.routine->getName()}
+    },
+      opentelemetry::context::RuntimeContext::GetCurrent());
+    safeRunRoutine(*state.scheduled.routine, lc);
+
+    lock.lock();
+    state.executionStartTime.reset();
+    state.nextRunTime = std::chrono::steady_clock::now() + state.scheduled.interval;
+    state.pending = false;
+    m_dispatchCv.notify_one();
+  }
+}
+
+//------------------------------------------------------------------------------
+// RoutineRunner::dispatchRoutines
+//------------------------------------------------------------------------------
+std::optional<std::chrono::steady_clock::time_point> RoutineRunner::dispatchRoutines(cta::log::LogContext& lc) {
+  const auto now = std::chrono::steady_clock::now();
+  std::optional<std::chrono::steady_clock::time_point> nextEventTime;
+  auto updateNextEventTime = [&nextEventTime](std::chrono::steady_clock::time_point t) {
+    nextEventTime = nextEventTime ? std::min(*nextEventTime, t) : t;
+  };
+  for (size_t i = 0; i < m_routines.size(); i++) {
+    RoutineState& state = m_routines[i];
+    if (!state.pending) {
+      if (state.nextRunTime <= now) {
+        state.pending = true;
+        m_queue.push_back(i);
+        cta::telemetry::metrics::ctaMaintdRoutineQueueDepth->Add(1);
+        m_queueCv.notify_one();
+      } else {
+        updateNextEventTime(state.nextRunTime);
+      }
+    } else if (state.executionStartTime && !state.overdueReported) {
+      const auto deadline = *state.executionStartTime + state.scheduled.maxDuration;
+      if (deadline <= now) {
+        state.overdueReported = true;
+        log::ScopedParamContainer params(lc);
+        params.add("routine", state.scheduled.routine->getName())
+          .add("maxDurationSecs", state.scheduled.maxDuration.count());
+        lc.log(log::WARNING, "In RoutineRunner::dispatchRoutines(): Routine exceeded its maximum duration");
+      } else {
+        updateNextEventTime(deadline);
+      }
+    }
+  }
+  return nextEventTime;
+}
+
 //------------------------------------------------------------------------------
 // RoutineRunner::run
 //------------------------------------------------------------------------------
@@ -70,23 +146,42 @@ void RoutineRunner::run(cta::log::LogContext& lc) {
   if (m_routines.empty()) {
     throw exception::UserError("No routines enabled.");
   }
+  const auto nbWorkers =
+    std::min(m_routines.size(), static_cast<size_t>(std::max(m_config.max_concurrent_routines, 1)));
+  {
+    log::ScopedParamContainer params(lc);
+    params.add("routineCount", m_routines.size()).add("workerCount", nbWorkers);
+    lc.log(log::DEBUG, "In RoutineRunner::run(): New run started.");
+  }
+
+  std::unique_lock lock(m_mutex);
   m_running = true;
-  lc.log(log::DEBUG, "In RoutineRunner::run(): New run started.");
+  const auto startTime = std::chrono::steady_clock::now();
+  for (auto& state : m_routines) {
+    state.nextRunTime = startTime;
+  }
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < nbWorkers; i++) {
+    // Each worker thread has its own log context as log contexts are not thread safe
+    workers.emplace_back([this, workerLc = lc]() mutable { workerLoop(workerLc); });
+  }
   while (m_running) {
-    m_executionStartTime = nowSecs();
-    lc.log(log::DEBUG, "In RoutineRunner::run(): Executing all routines.");
-    for (const auto& routine : m_routines) {
-      safeRunRoutine(*routine, lc);
-      if (!m_running) {
-        lc.log(log::INFO, "In RoutineRunner::run(): Stop requested.");
-        return;
-      }
+    if (const auto nextEventTime = dispatchRoutines(lc); nextEventTime) {
+      m_dispatchCv.wait_until(lock, *nextEventTime);
+    } else {
+      m_dispatchCv.wait(lock);
     }
-    m_sleepStartTime = nowSecs();
-    std::this_thread::sleep_for(std::chrono::seconds(m_config.cycle_sleep_interval_secs));
   }
-  lc.log(log::DEBUG, "In RoutineRunner::run(): Stop requested.");
-  return;
+  // The routines still queued will not be executed
+  cta::telemetry::metrics::ctaMaintdRoutineQueueDepth->Add(-static_cast<int64_t>(m_queue.size()));
+  m_queue.clear();
+  lock.unlock();
+
+  lc.log(log::INFO, "In RoutineRunner::run(): Stop requested, waiting for the routines being executed.");
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  lc.log(log::DEBUG, "In RoutineRunner::run(): All routines stopped.");
 }
 
 /**
@@ -100,24 +195,19 @@ bool RoutineRunner::isReady() const {
 }
 
 /**
- * The routine runner is considered alive when either :
- * - it is currently sleeping and it has not exceeded the sleep interval (by too much).
- * - it is currently executing a routine cycle and it has not exceeded the maximum cycle duration.
+ * The routine runner is considered alive when none of the routines being executed has exceeded its maximum
+ * duration.
  */
 bool RoutineRunner::isLive() const {
   if (!m_running) {
     // We consider ourselves alive if we haven't started yet, because a restart likely won't fix this.
     return true;
   }
-  // If the executionStartTime is the most recent, it means we are currently executing.
-  if (m_executionStartTime > m_sleepStartTime) {
-    // Check that we have not been executing for too long
-    return (nowSecs() - m_executionStartTime) < m_config.max_cycle_duration_secs;
-  }
-  // The sleepStartTime is the most recent, so we are currently sleeping.
-  // Check that we have not been sleeping for too long.
-  // We need to give it a few extra seconds as the transition from sleeping to executing is not instant
-  return (nowSecs() - m_sleepStartTime) < m_config.cycle_sleep_interval_secs + 5;
+  std::lock_guard lock(m_mutex);
+  const auto now = std::chrono::steady_clock::now();
+  return std::ranges::none_of(m_routines, [now](const RoutineState& state) {
+    return state.executionStartTime && now - *state.executionStartTime >= state.scheduled.maxDuration;
+  });
 }
 
 }  // namespace cta::maintd
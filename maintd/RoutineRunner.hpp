@@ -9,28 +9,49 @@
 #include "MaintdConfig.hpp"
 #include "common/log/LogContext.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <vector>
 
 namespace cta::maintd {
 
 /**
- * Responsible for running routines. It does so as follows:
- * 1. for all registered routines, execute the routine (synchronously)
- * 2. sleep
- * 3. Go to 1.
+ * A routine and the schedule of its executions
+ */
+struct ScheduledRoutine {
+  std::unique_ptr<IRoutine> routine;
+  // Time between the end of an execution of the routine and the start of the next one
+  std::chrono::seconds interval;
+  // Duration after which an execution of the routine is considered stuck
+  std::chrono::seconds maxDuration;
+};
+
+/**
+ * Responsible for running routines. Each routine is executed periodically on its own schedule:
+ * 1. once the interval of a routine has elapsed since the end of its previous execution, the routine is queued
+ * 2. a pool of worker threads executes the queued routines, at most max_concurrent_routines at the same time
+ * 3. a routine is not queued again until its execution has finished, so the executions of a routine never overlap
+ *
+ * A slow routine therefore only delays its own next execution, not those of the other routines.
  */
 class RoutineRunner final {
 public:
-  RoutineRunner(const RoutinesConfig& routinesConfig, std::vector<std::unique_ptr<IRoutine>> routines);
+  RoutineRunner(const RoutinesConfig& routinesConfig, std::vector<ScheduledRoutine> routines);
 
   ~RoutineRunner() = default;
 
-  void registerRoutine(std::unique_ptr<IRoutine> routine);
-
+  /**
+   * Asks the runner to stop. The routines being executed are not interrupted.
+   */
   void stop();
 
   /**
-   * Periodically executes all registered routines.
+   * Executes the routines according to their schedules until stop() is called.
    */
   void run(cta::log::LogContext& lc);
 
@@ -39,15 +60,47 @@ public:
   bool isReady() const;
 
 private:
+  /**
+   * A routine and the state of its schedule, protected by m_mutex
+   */
+  struct RoutineState {
+    ScheduledRoutine scheduled;
+    // Time at which the routine is due for its next execution
+    std::chrono::steady_clock::time_point nextRunTime;
+    // True while the routine is queued or being executed
+    bool pending = false;
+    // Start time of the current execution, if the routine is being executed
+    std::optional<std::chrono::steady_clock::time_point> executionStartTime;
+    // True once the current execution has been reported as exceeding the maximum duration
+    bool overdueReported = false;
+  };
+
   void safeRunRoutine(IRoutine& routine, cta::log::LogContext& lc) const;
 
+  /**
+   * Body of the worker threads: executes the queued routines until the runner is stopped
+   */
+  void workerLoop(cta::log::LogContext& lc);
+
+  /**
+   * Queues the routines which are due and reports the executions exceeding their maximum duration
+   *
+   * @return The time at which the next routine is due or the next execution exceeds its maximum duration, if any
+   */
+  std::optional<std::chrono::steady_clock::time_point> dispatchRoutines(cta::log::LogContext& lc);
+
   const RoutinesConfig& m_config;
-  const std::vector<std::unique_ptr<IRoutine>> m_routines;
+  std::vector<RoutineState> m_routines;
 
   std::atomic<bool> m_running = false;
 
-  std::atomic<int64_t> m_executionStartTime {0};
-  std::atomic<int64_t> m_sleepStartTime {0};
+  mutable std::mutex m_mutex;
+  // Indices in m_routines of the routines waiting for a worker thread
+  std::deque<size_t> m_queue;
+  // Signalled when a routine is queued or the runner is stopped
+  std::condition_variable m_queueCv;
+  // Signalled when the execution of a routine finishes or the runner is stopped
+  std::condition_variable m_dispatchCv;
 };
 
 }  // namespace cta::maintd
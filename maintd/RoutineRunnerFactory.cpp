@@ -25,6 +25,7 @@
 #include "routines/scheduler/rdbms/ReportingCleanupRoutines.hpp"
 #endif
 
+#include <algorithm>
 #include <chrono>
 #include <signal.h>
 #include <sys/prctl.h>
@@ -40,8 +41,10 @@ RoutineRunnerFactory::RoutineRunnerFactory(const MaintdConfig& config, cta::log:
       m_lc(lc) {
   m_lc.log(log::INFO, "In RoutineRunnerFactory::RoutineRunnerFactory(): Initialising Catalogue");
   const rdbms::Login catalogueLogin = rdbms::Login::parseFile(m_config.catalogue.config_file);
-  const uint64_t nbConns = 1;
-  const uint64_t nbArchiveFileListingConns = 1;
+  // Each of the routines executed concurrently can use its own connection
+  const uint64_t nbConns = std::max(m_config.routines.max_concurrent_routines, 1);
+  // Each of the repack requests expanded concurrently reads the files of its tape with its own connection
+  const uint64_t nbArchiveFileListingConns = std::max(m_config.routines.repack_expand.max_concurrent_expansions, 1);
   auto catalogueFactory =
     cta::catalogue::CatalogueFactoryFactory::create(m_lc.logger(), catalogueLogin, nbConns, nbArchiveFileListingConns);
 
@@ -78,140 +81,161 @@ std::unique_ptr<RoutineRunner> RoutineRunnerFactory::create() {
 
   // Create all of the different routines
 
-  std::vector<std::unique_ptr<IRoutine>> routines;
+  std::vector<ScheduledRoutine> routines;
+
+  // The routines without their own interval or maximum duration use the default ones of the routine runner
+  auto addRoutine = [this, &routines](const auto& routineConfig, std::unique_ptr<IRoutine> routine) {
+    const auto intervalSecs = routineConfig.interval_secs.value_or(m_config.routines.cycle_sleep_interval_secs);
+    const auto maxDurationSecs = routineConfig.max_duration_secs.value_or(m_config.routines.max_cycle_duration_secs);
+    routines.push_back(ScheduledRoutine {.routine = std::move(routine),
+                                         .interval = std::chrono::seconds(intervalSecs),
+                                         .maxDuration = std::chrono::seconds(maxDurationSecs)});
+  };
 
   // Add Disk Reporter for Archive
   if (m_config.routines.disk_report_archive.enabled) {
-    routines.push_back(
-      std::make_unique<DiskReportArchiveRoutine>(m_lc,
-                                                 *m_scheduler,
-                                                 m_config.routines.disk_report_archive.batch_size,
-                                                 m_config.routines.disk_report_archive.soft_timeout_secs));
+    addRoutine(m_config.routines.disk_report_archive,
+               std::make_unique<DiskReportArchiveRoutine>(
+                 m_lc,
+                 *m_scheduler,
+                 m_config.routines.disk_report_archive.batch_size,
+                 m_config.routines.disk_report_archive.soft_timeout_secs,
+                 m_config.routines.disk_report_archive.max_in_flight_reports));
   }
 
   // Add Disk Reporter for Retrieve
   if (m_config.routines.disk_report_retrieve.enabled) {
-    routines.push_back(
-      std::make_unique<DiskReportRetrieveRoutine>(m_lc,
-                                                  *m_scheduler,
-                                                  m_config.routines.disk_report_retrieve.batch_size,
-                                                  m_config.routines.disk_report_retrieve.soft_timeout_secs));
+    addRoutine(m_config.routines.disk_report_retrieve,
+               std::make_unique<DiskReportRetrieveRoutine>(
+                 m_lc,
+                 *m_scheduler,
+                 m_config.routines.disk_report_retrieve.batch_size,
+                 m_config.routines.disk_report_retrieve.soft_timeout_secs,
+                 m_config.routines.disk_report_retrieve.max_in_flight_reports));
   }
 
   // Add Repack Expansion
   if (m_config.routines.repack_expand.enabled) {
-    routines.push_back(
-      std::make_unique<RepackExpandRoutine>(m_lc, *m_scheduler, m_config.routines.repack_expand.max_to_expand));
+    addRoutine(m_config.routines.repack_expand,
+               std::make_unique<RepackExpandRoutine>(m_lc,
+                                                     *m_scheduler,
+                                                     m_config.routines.repack_expand.max_to_expand,
+                                                     m_config.routines.repack_expand.max_concurrent_expansions));
   }
 
   // Add Repack Reporting
   if (m_config.routines.repack_report.enabled) {
-    routines.push_back(
+    addRoutine(
+      m_config.routines.repack_report,
       std::make_unique<RepackReportRoutine>(m_lc, *m_scheduler, m_config.routines.repack_report.soft_timeout_secs));
   }
 
-/*
- * If we enable all routines in 1 process they will all be running sequentially
- * and with the same sleep_interval configured for the maintd process itself.
- * We can currently achieve separate sleep intervals per routine (/group of routines)
- * only if we deploy multiple processes with some routines disabled and different
- * sleep_interval in their configuration file. It might probably make sense to
- * update the internal model of maintd in the future as well
- * (or fully split it into separate services; 1 per routine).
- */
 #ifndef CTA_PGSCHED
   // Add Garbage Collector
   if (m_config.routines.garbage_collect.enabled) {
-    routines.push_back(std::make_unique<GarbageCollectRoutine>(m_lc,
-                                                               m_schedDbInit->getBackend(),
-                                                               m_schedDbInit->getAgentReference(),
-                                                               *m_catalogue));
+    addRoutine(m_config.routines.garbage_collect,
+               std::make_unique<GarbageCollectRoutine>(m_lc,
+                                                       m_schedDbInit->getBackend(),
+                                                       m_schedDbInit->getAgentReference(),
+                                                       *m_catalogue));
   }
   // Add Queue Cleanup
   if (m_config.routines.queue_cleanup.enabled) {
-    routines.push_back(std::make_unique<QueueCleanupRoutine>(m_lc,
-                                                             *m_schedDb,
-                                                             *m_catalogue,
-                                                             m_config.routines.queue_cleanup.batch_size));
+    addRoutine(m_config.routines.queue_cleanup,
+               std::make_unique<QueueCleanupRoutine>(m_lc,
+                                                     *m_schedDb,
+                                                     *m_catalogue,
+                                                     m_config.routines.queue_cleanup.batch_size));
   }
 #else
   // Add User Archive and Retrieve Active Queue Cleanup
   if (m_config.routines.user_active_queue_cleanup.enabled) {
-    routines.push_back(std::make_unique<ArchiveInactiveMountActiveQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.user_active_queue_cleanup.batch_size,
-      m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
-    routines.push_back(std::make_unique<RetrieveInactiveMountActiveQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.user_active_queue_cleanup.batch_size,
-      m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
-    routines.push_back(std::make_unique<ResubmitInactiveReportingRoutine>(
-      m_lc,
-      *m_schedDb,
-      m_config.routines.user_active_queue_cleanup.batch_size,
-      m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.user_active_queue_cleanup,
+               std::make_unique<ArchiveInactiveMountActiveQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.user_active_queue_cleanup.batch_size,
+                 m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.user_active_queue_cleanup,
+               std::make_unique<RetrieveInactiveMountActiveQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.user_active_queue_cleanup.batch_size,
+                 m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.user_active_queue_cleanup,
+               std::make_unique<ResubmitInactiveReportingRoutine>(
+                 m_lc,
+                 *m_schedDb,
+                 m_config.routines.user_active_queue_cleanup.batch_size,
+                 m_config.routines.user_active_queue_cleanup.age_for_collection_secs));
   }
   // Add Repack Archive and Repack Retrieve Active Queue Cleanup
   if (m_config.routines.repack_active_queue_cleanup.enabled) {
-    routines.push_back(std::make_unique<RepackArchiveInactiveMountActiveQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.repack_active_queue_cleanup.batch_size,
-      m_config.routines.repack_active_queue_cleanup.age_for_collection_secs));
-    routines.push_back(std::make_unique<RepackRetrieveInactiveMountActiveQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.repack_active_queue_cleanup.batch_size,
-      m_config.routines.repack_active_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.repack_active_queue_cleanup,
+               std::make_unique<RepackArchiveInactiveMountActiveQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.repack_active_queue_cleanup.batch_size,
+                 m_config.routines.repack_active_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.repack_active_queue_cleanup,
+               std::make_unique<RepackRetrieveInactiveMountActiveQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.repack_active_queue_cleanup.batch_size,
+                 m_config.routines.repack_active_queue_cleanup.age_for_collection_secs));
   }
   // Add User Archive and Repack Retrieve Pending Queue Cleanup
   if (m_config.routines.user_pending_queue_cleanup.enabled) {
-    routines.push_back(std::make_unique<ArchiveInactiveMountPendingQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.user_pending_queue_cleanup.batch_size,
-      m_config.routines.user_pending_queue_cleanup.age_for_collection_secs));
-    routines.push_back(std::make_unique<RetrieveInactiveMountPendingQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.user_pending_queue_cleanup.batch_size,
-      m_config.routines.user_pending_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.user_pending_queue_cleanup,
+               std::make_unique<ArchiveInactiveMountPendingQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.user_pending_queue_cleanup.batch_size,
+                 m_config.routines.user_pending_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.user_pending_queue_cleanup,
+               std::make_unique<RetrieveInactiveMountPendingQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.user_pending_queue_cleanup.batch_size,
+                 m_config.routines.user_pending_queue_cleanup.age_for_collection_secs));
   }
   // Add Repack Archive and Repack Retrieve Pending Queue Cleanup
   if (m_config.routines.repack_pending_queue_cleanup.enabled) {
-    routines.push_back(std::make_unique<RepackArchiveInactiveMountPendingQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.repack_pending_queue_cleanup.batch_size,
-      m_config.routines.repack_pending_queue_cleanup.age_for_collection_secs));
-    routines.push_back(std::make_unique<RepackRetrieveInactiveMountPendingQueueRoutine>(
-      m_lc,
-      *m_catalogue,
-      *m_schedDb,
-      m_config.routines.repack_pending_queue_cleanup.batch_size,
-      m_config.routines.repack_pending_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.repack_pending_queue_cleanup,
+               std::make_unique<RepackArchiveInactiveMountPendingQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.repack_pending_queue_cleanup.batch_size,
+                 m_config.routines.repack_pending_queue_cleanup.age_for_collection_secs));
+    addRoutine(m_config.routines.repack_pending_queue_cleanup,
+               std::make_unique<RepackRetrieveInactiveMountPendingQueueRoutine>(
+                 m_lc,
+                 *m_catalogue,
+                 *m_schedDb,
+                 m_config.routines.repack_pending_queue_cleanup.batch_size,
+                 m_config.routines.repack_pending_queue_cleanup.age_for_collection_secs));
   }
   // Add Scheduler Maintenance Cleanup
   if (m_config.routines.scheduler_maintenance_cleanup.enabled) {
-    routines.push_back(std::make_unique<DeleteOldFailedQueuesRoutine>(
-      m_lc,
-      *m_schedDb,
-      m_config.routines.scheduler_maintenance_cleanup.batch_size,
-      m_config.routines.scheduler_maintenance_cleanup.age_for_deletion_secs));
-    routines.push_back(std::make_unique<CleanMountLastFetchTimeRoutine>(
-      m_lc,
-      *m_schedDb,
-      m_config.routines.scheduler_maintenance_cleanup.batch_size,
-      m_config.routines.scheduler_maintenance_cleanup.age_for_deletion_secs));
+    addRoutine(m_config.routines.scheduler_maintenance_cleanup,
+               std::make_unique<DeleteOldFailedQueuesRoutine>(
+                 m_lc,
+                 *m_schedDb,
+                 m_config.routines.scheduler_maintenance_cleanup.batch_size,
+                 m_config.routines.scheduler_maintenance_cleanup.age_for_deletion_secs));
+    addRoutine(m_config.routines.scheduler_maintenance_cleanup,
+               std::make_unique<CleanMountLastFetchTimeRoutine>(
+                 m_lc,
+                 *m_schedDb,
+                 m_config.routines.scheduler_maintenance_cleanup.batch_size,
+                 m_config.routines.scheduler_maintenance_cleanup.age_for_deletion_secs));
   }
 #endif
 
@@ -15,14 +15,17 @@ namespace cta::maintd {
 DiskReportArchiveRoutine::DiskReportArchiveRoutine(cta::log::LogContext& lc,
                                                    cta::Scheduler& scheduler,
                                                    int batchSize,
-                                                   int softTimeout)
+                                                   int softTimeout,
+                                                   int maxInFlightReports)
     : m_lc(lc),
       m_scheduler(scheduler),
       m_batchSize(batchSize),
-      m_softTimeout(softTimeout) {
+      m_softTimeout(softTimeout),
+      m_maxInFlightReports(maxInFlightReports) {
   log::ScopedParamContainer params(m_lc);
   params.add("softTimeout", softTimeout);
   params.add("batchSize", batchSize);
+  params.add("maxInFlightReports", maxInFlightReports);
   m_lc.log(cta::log::INFO, "In DiskReportArchiveRoutine: Created DiskReportArchiveRoutine");
 }
 
@@ -46,7 +49,7 @@ void DiskReportArchiveRoutine::execute() {
     log::ScopedParamContainer params(m_lc);
     params.add("archiveJobsReported", archiveJobsToReport.size());
     utils::Timer t2;
-    m_scheduler.reportArchiveJobsBatch(archiveJobsToReport, m_reporterFactory, timings, t1, m_lc);
+    m_scheduler.reportArchiveJobsBatch(archiveJobsToReport, m_reporterFactory, timings, t1, m_lc, m_maxInFlightReports);
     numberOfBatchReported += archiveJobsToReport.size();
     timings.insertAndReset("reportArchiveJobsTime", t2);
     timings.addToLog(params);
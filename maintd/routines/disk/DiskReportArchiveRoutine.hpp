@@ -14,17 +14,22 @@ namespace cta::maintd {
 
 class DiskReportArchiveRoutine final : public IRoutine {
 public:
-  DiskReportArchiveRoutine(cta::log::LogContext& lc, cta::Scheduler& scheduler, int batchSize, int softTimeout);
+  DiskReportArchiveRoutine(cta::log::LogContext& lc,
+                           cta::Scheduler& scheduler,
+                           int batchSize,
+                           int softTimeout,
+                           int maxInFlightReports);
   void execute() final;
   std::string getName() const final;
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::Scheduler& m_scheduler;
   cta::disk::DiskReporterFactory m_reporterFactory;
 
   int m_batchSize = 500;
   int m_softTimeout = 30;
+  int m_maxInFlightReports = 100;
 };
 
 }  // namespace cta::maintd
@@ -15,14 +15,17 @@ namespace cta::maintd {
 DiskReportRetrieveRoutine::DiskReportRetrieveRoutine(cta::log::LogContext& lc,
                                                      cta::Scheduler& scheduler,
                                                      int batchSize,
-                                                     int softTimeout)
+                                                     int softTimeout,
+                                                     int maxInFlightReports)
     : m_lc(lc),
       m_scheduler(scheduler),
       m_batchSize(batchSize),
-      m_softTimeout(softTimeout) {
+      m_softTimeout(softTimeout),
+      m_maxInFlightReports(maxInFlightReports) {
   log::ScopedParamContainer params(m_lc);
   params.add("softTimeout", softTimeout);
   params.add("batchSize", batchSize);
+  params.add("maxInFlightReports", maxInFlightReports);
   m_lc.log(cta::log::INFO, "In DiskReportRetrieveRoutine: Created DiskReportRetrieveRoutine");
 }
 
@@ -46,7 +49,12 @@ void DiskReportRetrieveRoutine::execute() {
     log::ScopedParamContainer params(m_lc);
     params.add("retrieveJobsReported", retrieveJobsToReport.size());
     utils::Timer t2;
-    m_scheduler.reportRetrieveJobsBatch(retrieveJobsToReport, m_reporterFactory, timings, t1, m_lc);
+    m_scheduler.reportRetrieveJobsBatch(retrieveJobsToReport,
+                                        m_reporterFactory,
+                                        timings,
+                                        t1,
+                                        m_lc,
+                                        m_maxInFlightReports);
     numberOfBatchReported += retrieveJobsToReport.size();
     timings.insertAndReset("reportRetrieveJobsTime", t2);
     timings.addToLog(params);
@@ -8,53 +8,94 @@
 #include "common/exception/NoSuchObject.hpp"
 #include "scheduler/Scheduler.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
 namespace cta::maintd {
 
-RepackExpandRoutine::RepackExpandRoutine(cta::log::LogContext& lc, cta::Scheduler& scheduler, int maxRequestsToToExpand)
+RepackExpandRoutine::RepackExpandRoutine(cta::log::LogContext& lc,
+                                         cta::Scheduler& scheduler,
+                                         int maxRequestsToToExpand,
+                                         int maxConcurrentExpansions)
     : m_lc(lc),
       m_scheduler(scheduler),
-      m_repackMaxRequestsToToExpand(maxRequestsToToExpand) {
+      m_repackMaxRequestsToToExpand(maxRequestsToToExpand),
+      m_maxConcurrentExpansions(std::max(maxConcurrentExpansions, 1)) {
   log::ScopedParamContainer params(m_lc);
   params.add("maxRequestsToToExpand", maxRequestsToToExpand);
+  params.add("maxConcurrentExpansions", m_maxConcurrentExpansions);
   m_lc.log(cta::log::INFO, "In RepackExpandRoutine: Created RepackExpandRoutine");
 }
 
 void RepackExpandRoutine::execute() {
-  utils::Timer t;
-  log::TimingList timingList;
   // First expand any request to expand
   // Next promote requests to ToExpand if needed
 
   //Putting pending repack request into the RepackQueueToExpand queue
   m_scheduler.promoteRepackRequestsToToExpand(m_lc, m_repackMaxRequestsToToExpand);
 
-  //Retrieve the first repack request from the RepackQueueToExpand queue
-  const auto repackRequest = m_scheduler.getNextRepackRequestToExpand();
+  //Retrieve the first repack requests from the RepackQueueToExpand queue, one for each concurrent expansion
+  std::vector<std::unique_ptr<RepackRequest>> repackRequests;
+  while (repackRequests.size() < m_maxConcurrentExpansions) {
+    auto repackRequest = m_scheduler.getNextRepackRequestToExpand();
+    if (repackRequest == nullptr) {
+      break;
+    }
+    repackRequests.push_back(std::move(repackRequest));
+  }
 
-  if (repackRequest == nullptr) {
+  if (repackRequests.empty()) {
     // Nothing to do
     return;
   }
-  //We have a RepackRequest that has the status ToExpand, expand it
+  //We have RepackRequests that have the status ToExpand, expand them, each tape by its own thread
+  std::vector<std::future<void>> expansions;
+  for (auto& repackRequest : repackRequests) {
+    expansions.push_back(std::async(std::launch::async, [this, &repackRequest] {
+      cta::log::LogContext lc(m_lc);
+      expand(*repackRequest, lc);
+    }));
+  }
+  // The first error is rethrown once all the expansions have finished
+  std::exception_ptr expansionError;
+  for (auto& expansion : expansions) {
+    try {
+      expansion.get();
+    } catch (...) {
+      if (!expansionError) {
+        expansionError = std::current_exception();
+      }
+    }
+  }
+  if (expansionError) {
+    std::rethrow_exception(expansionError);
+  }
+}
+
+void RepackExpandRoutine::expand(cta::RepackRequest& repackRequest, cta::log::LogContext& lc) {
+  utils::Timer t;
+  log::TimingList timingList;
   try {
     try {
-      m_scheduler.expandRepackRequest(*repackRequest, timingList, t, m_lc);
-      m_lc.log(log::INFO, "In RepackExpandRoutine::execute(): finished expanding a repack request.");
+      m_scheduler.expandRepackRequest(repackRequest, timingList, t, lc);
+      lc.log(log::INFO, "In RepackExpandRoutine::execute(): finished expanding a repack request.");
     } catch (const ExpandRepackRequestException& ex) {
-      log::ScopedParamContainer spc(m_lc);
-      spc.add("vid", repackRequest->getRepackInfo().vid);
-      m_lc.log(log::ERR, ex.getMessageValue());
-      repackRequest->fail();
+      log::ScopedParamContainer spc(lc);
+      spc.add("vid", repackRequest.getRepackInfo().vid);
+      lc.log(log::ERR, ex.getMessageValue());
+      repackRequest.fail();
     } catch (const cta::exception::Exception& e) {
-      log::ScopedParamContainer spc(m_lc);
-      spc.add("vid", repackRequest->getRepackInfo().vid);
-      m_lc.log(log::ERR, e.getMessageValue());
-      repackRequest->fail();
+      log::ScopedParamContainer spc(lc);
+      spc.add("vid", repackRequest.getRepackInfo().vid);
+      lc.log(log::ERR, e.getMessageValue());
+      repackRequest.fail();
       throw;
     }
   } catch (const cta::exception::NoSuchObject&) {
     //In case the repack request is deleted during expansion, avoid a segmentation fault
-    m_lc.log(log::WARNING, "In RepackExpandRoutine::execute(), RepackRequest object does not exist in the objectstore");
+    lc.log(log::WARNING, "In RepackExpandRoutine::execute(), RepackRequest object does not exist in the objectstore");
   }
 }
 
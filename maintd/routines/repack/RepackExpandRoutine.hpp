@@ -13,16 +13,29 @@ namespace cta::maintd {
 
 class Scheduler;
 
+/**
+ * Expands the repack requests to expand, at most maxConcurrentExpansions of them at the same time, each by its own
+ * thread
+ */
 class RepackExpandRoutine final : public IRoutine {
 public:
-  RepackExpandRoutine(cta::log::LogContext& lc, cta::Scheduler& scheduler, int maxRequestsToToExpand);
+  RepackExpandRoutine(cta::log::LogContext& lc,
+                      cta::Scheduler& scheduler,
+                      int maxRequestsToToExpand,
+                      int maxConcurrentExpansions);
 
   void execute() final;
   std::string getName() const final;
 
 private:
-  cta::log::LogContext& m_lc;
+  /**
+   * Expands the specified repack request, marking it as failed if its expansion fails
+   */
+  void expand(cta::RepackRequest& repackRequest, cta::log::LogContext& lc);
+
+  cta::log::LogContext m_lc;
   cta::Scheduler& m_scheduler;
   int m_repackMaxRequestsToToExpand;
+  size_t m_maxConcurrentExpansions;
 };
 }  // namespace cta::maintd
@@ -24,7 +24,7 @@ private:
   template<typename GetBatchFunc>
   void reportBatch(const std::string& reportingType, GetBatchFunc getBatchFunc) const;
 
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::Scheduler& m_scheduler;
   int m_softTimeout;
 };
@@ -12,7 +12,7 @@ GarbageCollectRoutine::GarbageCollectRoutine(cta::log::LogContext& lc,
                                              objectstore::AgentReference& agentReference,
                                              catalogue::Catalogue& catalogue)
     : m_lc(lc),
-      m_garbageCollector(lc, os, agentReference, catalogue) {
+      m_garbageCollector(m_lc, os, agentReference, catalogue) {
   m_lc.log(cta::log::INFO, "In GarbageCollectRoutine: Created GarbageCollectRoutine");
 }
 
@@ -26,7 +26,7 @@ public:
   std::string getName() const final;
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::objectstore::GarbageCollector m_garbageCollector;
 };
 
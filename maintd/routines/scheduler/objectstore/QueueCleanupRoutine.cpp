@@ -12,7 +12,7 @@ QueueCleanupRoutine::QueueCleanupRoutine(cta::log::LogContext& lc,
                                          catalogue::Catalogue& catalogue,
                                          int batchSize)
     : m_lc(lc),
-      m_queueCleanup(lc, oStoreDb, catalogue, batchSize) {
+      m_queueCleanup(m_lc, oStoreDb, catalogue, batchSize) {
   log::ScopedParamContainer params(m_lc);
   params.add("batchSize", batchSize);
   m_lc.log(cta::log::INFO, "In QueueCleanupRoutine: Created QueueCleanupRoutine");
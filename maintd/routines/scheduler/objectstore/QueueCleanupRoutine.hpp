@@ -36,7 +36,7 @@ public:
   void execute() final;
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::objectstore::QueueCleanup m_queueCleanup;
 };
 
@@ -31,7 +31,7 @@ public:
   DeleteOldFailedQueuesRoutine(log::LogContext& lc, RelationalDB& pgs, size_t batchSize, uint64_t inactiveTimeLimit);
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::RelationalDB& m_RelationalDB;
   size_t m_batchSize;
   const std::string m_routineName = "DeleteOldFailedQueuesRoutine";
@@ -56,7 +56,7 @@ public:
   CleanMountLastFetchTimeRoutine(log::LogContext& lc, RelationalDB& pgs, size_t batchSize, uint64_t inactiveTimeLimit);
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::RelationalDB& m_RelationalDB;
   size_t m_batchSize;
   const std::string m_routineName = "CleanMountLastFetchTimeRoutine";
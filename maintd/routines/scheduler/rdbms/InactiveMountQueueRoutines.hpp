@@ -97,7 +97,7 @@ protected:
                                 const std::string& routineName,
                                 uint64_t inactiveTimeLimit);
 
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   catalogue::Catalogue& m_catalogue;
   cta::RelationalDB& m_RelationalDB;
   size_t m_batchSize;
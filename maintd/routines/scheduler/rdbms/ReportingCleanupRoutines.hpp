@@ -34,7 +34,7 @@ public:
                                    uint64_t inactiveTimeLimit);
 
 private:
-  cta::log::LogContext& m_lc;
+  cta::log::LogContext m_lc;
   cta::RelationalDB& m_RelationalDB;
   const size_t m_batchSize;
   const std::string m_routineName = "ResubmitInactiveReportingRoutine";
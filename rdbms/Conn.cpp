@@ -316,4 +316,15 @@ std::vector<std::string> Conn::getViewNames() {
   }
 }
 
+//------------------------------------------------------------------------------
+// waitForNotifications
+//------------------------------------------------------------------------------
+std::list<std::string> Conn::waitForNotifications(const uint32_t timeoutMs) {
+  if (nullptr != m_connAndStmts && nullptr != m_connAndStmts->conn) {
+    return m_connAndStmts->conn->waitForNotifications(timeoutMs);
+  } else {
+    throw exception::Exception("Conn does not contain a connection");
+  }
+}
+
 }  // namespace cta::rdbms
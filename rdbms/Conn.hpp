@@ -228,6 +228,17 @@ public:
    */
   std::vector<std::string> getViewNames();
 
+  /**
+   * Waits for asynchronous notifications to be received by this connection.
+   *
+   * @param timeoutMs The maximum time to wait in milliseconds.
+   * @return The payloads of the notifications received, which is empty if the
+   * timeout expired before any notification was received.
+   * @throw exception::NotImplementedException if the database technology does
+   * not deliver notifications to connections.
+   */
+  std::list<std::string> waitForNotifications(const uint32_t timeoutMs);
+
   /**
    * Get a pointer to the connection wrapper implementation
    *
@@ -0,0 +1,255 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/exception/Exception.hpp"
+#include "common/exception/NoSuchObject.hpp"
+#include "rdbms/NullDbValue.hpp"
+#include "rdbms/Rset.hpp"
+
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+namespace cta::rdbms {
+
+/**
+ * Compile-time list of the names of the columns read from the rows of a query.
+ *
+ * A row type declares the columns it reads once, as a constant with static
+ * storage duration:
+ *
+ * @code
+ *   static constexpr rdbms::RowSchema kColumns {"ARCHIVE_FILE_ID", "VID"};
+ * @endcode
+ *
+ * and reads each row of the result set through a RowReader:
+ *
+ * @code
+ *   const auto row = rset.columns<kColumns>();
+ *   archiveFileId = row.columnUint64("ARCHIVE_FILE_ID");
+ * @endcode
+ *
+ * The column names passed to the RowReader are checked against the schema at
+ * compile time.  The result set resolves the names of the schema into column
+ * indices once, when the first row is read, so that reading a column of a row
+ * neither builds a string nor looks up a map.
+ */
+template<std::size_t N>
+class RowSchema {
+public:
+  /**
+   * Constructor.
+   *
+   * @param names The names of the columns.
+   */
+  template<typename... Names>
+  consteval explicit RowSchema(const Names&... names) : m_names {std::string_view(names)...} {
+    for (std::size_t i = 0; i < N; i++) {
+      for (std::size_t j = i + 1; j < N; j++) {
+        if (m_names[i] == m_names[j]) {
+          throw std::invalid_argument("Duplicate column name in row schema");
+        }
+      }
+    }
+  }
+
+  /**
+   * Returns the position of the specified column in the schema.  Fails to
+   * compile if the column is not part of the schema.
+   *
+   * @param name The name of the column.
+   * @return The position of the column.
+   */
+  consteval std::size_t position(std::string_view name) const {
+    for (std::size_t i = 0; i < N; i++) {
+      if (m_names[i] == name) {
+        return i;
+      }
+    }
+    throw std::invalid_argument("Column is not part of the row schema");
+  }
+
+  /**
+   * @return The names of the columns.
+   */
+  constexpr const std::array<std::string_view, N>& names() const { return m_names; }
+
+private:
+  /**
+   * The names of the columns.
+   */
+  std::array<std::string_view, N> m_names;
+};
+
+template<typename... Names>
+RowSchema(const Names&...) -> RowSchema<sizeof...(Names)>;
+
+/**
+ * The name of a column checked at compile time against the row schema Schema.
+ *
+ * The constructor is implicit so that a string literal can be passed wherever
+ * a SchemaColumn is expected.
+ */
+template<const auto& Schema>
+class SchemaColumn {
+public:
+  /**
+   * Constructor.
+   *
+   * @param name The name of the column.
+   */
+  consteval SchemaColumn(const char* const name) : m_position(Schema.position(name)) {}
+
+  /**
+   * @return The position of the column in the schema.
+   */
+  constexpr std::size_t position() const { return m_position; }
+
+  /**
+   * @return The name of the column.
+   */
+  constexpr std::string_view name() const { return Schema.names()[m_position]; }
+
+private:
+  /**
+   * The position of the column in the schema.
+   */
+  std::size_t m_position;
+};
+
+/**
+ * Reads the columns of the current row of a result set by index.
+ *
+ * The accessors have the same names and semantics as those of Rset, but take
+ * the name of a column of the row schema Schema.  A column of the schema which
+ * is absent from the result set only raises an exception when it is read.
+ */
+template<const auto& Schema>
+class RowReader {
+public:
+  using Column = SchemaColumn<Schema>;
+
+  /**
+   * Constructor.
+   *
+   * @param rset The result set.
+   * @param colIndices The index of each column of the schema in the result set.
+   */
+  RowReader(const Rset& rset, const int* const colIndices) : m_rset(rset), m_colIndices(colIndices) {}
+
+  bool columnExists(const Column col) const { return m_colIndices[col.position()] >= 0; }
+
+  bool columnIsNull(const Column col) const { return m_rset.columnIsNullAt(getColIdx(col)); }
+
+  std::string columnBlob(const Column col) const { return m_rset.columnBlobAt(getColIdx(col)); }
+
+  std::unique_ptr<wrapper::IBlobView> columnBlobView(const Column col) const {
+    return m_rset.columnBlobViewAt(getColIdx(col));
+  }
+
+  std::optional<std::string> columnOptionalString(const Column col) const {
+    return m_rset.columnOptionalStringAt(getColIdx(col));
+  }
+
+  std::optional<uint8_t> columnOptionalUint8(const Column col) const { return columnOptionalUint<uint8_t>(col); }
+
+  std::optional<uint16_t> columnOptionalUint16(const Column col) const { return columnOptionalUint<uint16_t>(col); }
+
+  std::optional<uint32_t> columnOptionalUint32(const Column col) const { return columnOptionalUint<uint32_t>(col); }
+
+  std::optional<uint64_t> columnOptionalUint64(const Column col) const {
+    return m_rset.columnOptionalUint64At(getColIdx(col));
+  }
+
+  std::optional<bool> columnOptionalBool(const Column col) const { return m_rset.columnOptionalBoolAt(getColIdx(col)); }
+
+  std::optional<double> columnOptionalDouble(const Column col) const {
+    return m_rset.columnOptionalDoubleAt(getColIdx(col));
+  }
+
+  std::string columnString(const Column col) const { return nonNull(col, columnOptionalString(col)); }
+
+  uint8_t columnUint8(const Column col) const { return nonNull(col, columnOptionalUint8(col)); }
+
+  uint16_t columnUint16(const Column col) const { return nonNull(col, columnOptionalUint16(col)); }
+
+  uint32_t columnUint32(const Column col) const { return nonNull(col, columnOptionalUint32(col)); }
+
+  uint64_t columnUint64(const Column col) const { return nonNull(col, columnOptionalUint64(col)); }
+
+  bool columnBool(const Column col) const { return nonNull(col, columnOptionalBool(col)); }
+
+  double columnDouble(const Column col) const { return nonNull(col, columnOptionalDouble(col)); }
+
+private:
+  /**
+   * Returns the index of the specified column in the result set.
+   *
+   * @throw NoSuchObject if the column is absent from the result set.
+   */
+  int getColIdx(const Column col) const {
+    const int colIdx = m_colIndices[col.position()];
+    if (colIdx < 0) {
+      throw exception::NoSuchObject("Column does not exist: " + std::string(col.name()));
+    }
+    return colIdx;
+  }
+
+  /**
+   * Returns the value of a column which is not expected to be null.
+   *
+   * @throw NullDbValue if the value is null.
+   */
+  template<typename T>
+  static T nonNull(const Column col, std::optional<T>&& value) {
+    if (!value.has_value()) {
+      throw NullDbValue("Database column " + std::string(col.name()) + " contains a null value");
+    }
+    return std::move(*value);
+  }
+
+  /**
+   * Returns the value of a column as an unsigned integer narrower than 64 bits.
+   *
+   * @throw exception::Exception if the value does not fit in UintType.
+   */
+  template<typename UintType>
+  std::optional<UintType> columnOptionalUint(const Column col) const {
+    const std::optional<uint64_t> value = columnOptionalUint64(col);
+    if (!value.has_value()) {
+      return std::nullopt;
+    }
+    if (*value > std::numeric_limits<UintType>::max()) {
+      throw exception::Exception("Column " + std::string(col.name()) + " contains the value "
+                                 + std::to_string(*value) + " which is out of range");
+    }
+    return static_cast<UintType>(*value);
+  }
+
+  /**
+   * The result set.
+   */
+  const Rset& m_rset;
+
+  /**
+   * The index of each column of the schema in the result set, or -1 for the
+   * columns absent from the result set.
+   */
+  const int* const m_colIndices;
+};
+
+template<const auto& Schema>
+RowReader<Schema> Rset::columns() const {
+  return RowReader<Schema>(*this, bindColumns(&Schema, Schema.names().data(), Schema.names().size()));
+}
+
+}  // namespace cta::rdbms
@@ -6,9 +6,17 @@
 #include "rdbms/Rset.hpp"
 
 #include "common/exception/NullPtrException.hpp"
+#include "common/semconv/Attributes.hpp"
+#include "common/telemetry/metrics/instruments/RdbmsInstruments.hpp"
+#include "common/utils/StringConversions.hpp"
+#include "common/utils/Timer.hpp"
 #include "rdbms/NullDbValue.hpp"
+#include "rdbms/SlowStmtLog.hpp"
 #include "rdbms/wrapper/RsetWrapper.hpp"
 
+#include <opentelemetry/context/runtime_context.h>
+#include <utility>
+
 namespace cta::rdbms {
 
 //------------------------------------------------------------------------------
@@ -25,6 +33,39 @@ Rset::Rset(std::unique_ptr<wrapper::RsetWrapper> impl) : m_impl(std::move(impl))
   }
 }
 
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+Rset::Rset(std::unique_ptr<wrapper::RsetWrapper> impl, std::unique_ptr<StmtTelemetry> telemetry)
+    : Rset(std::move(impl)) {
+  m_stmtTelemetry = std::move(telemetry);
+}
+
+//------------------------------------------------------------------------------
+// move constructor
+//------------------------------------------------------------------------------
+Rset::Rset(Rset&& other) noexcept
+    : m_impl(std::move(other.m_impl)),
+      m_stmtTelemetry(std::move(other.m_stmtTelemetry)),
+      m_boundSchema(std::exchange(other.m_boundSchema, nullptr)),
+      m_boundColIndices(std::move(other.m_boundColIndices)),
+      m_nbRowsRetrieved(std::exchange(other.m_nbRowsRetrieved, 0)) {}
+
+//------------------------------------------------------------------------------
+// move assignment
+//------------------------------------------------------------------------------
+Rset& Rset::operator=(Rset&& rhs) noexcept {
+  if (this != &rhs) {
+    reset();
+    m_impl = std::move(rhs.m_impl);
+    m_stmtTelemetry = std::move(rhs.m_stmtTelemetry);
+    m_boundSchema = std::exchange(rhs.m_boundSchema, nullptr);
+    m_boundColIndices = std::move(rhs.m_boundColIndices);
+    m_nbRowsRetrieved = std::exchange(rhs.m_nbRowsRetrieved, 0);
+  }
+  return *this;
+}
+
 //------------------------------------------------------------------------------
 // destructor
 //------------------------------------------------------------------------------
@@ -36,9 +77,43 @@ Rset::~Rset() noexcept {
 // reset
 //------------------------------------------------------------------------------
 void Rset::reset() noexcept {
+  recordStmtTelemetry();
   m_impl.reset();
 }
 
+//------------------------------------------------------------------------------
+// recordStmtTelemetry
+//------------------------------------------------------------------------------
+void Rset::recordStmtTelemetry() noexcept {
+  if (nullptr == m_stmtTelemetry || nullptr == m_impl) {
+    return;
+  }
+  const auto telemetry = std::move(m_stmtTelemetry);
+
+  try {
+    const std::map<std::string, std::string> attributes = {
+      {cta::semconv::attr::kDbSystemName,    telemetry->dbSystemName                                },
+      {cta::semconv::attr::kDbNamespace,     telemetry->dbNamespace                                 },
+      {cta::semconv::attr::kDbQuerySummary,  telemetry->dbQuerySummary                              },
+      {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
+    };
+    cta::telemetry::metrics::ctaRdbmsFetchDuration->Record(telemetry->fetchMsecs,
+                                                           attributes,
+                                                           opentelemetry::context::RuntimeContext::GetCurrent());
+    cta::telemetry::metrics::dbClientResponseReturnedRows->Record(m_nbRowsRetrieved,
+                                                                  attributes,
+                                                                  opentelemetry::context::RuntimeContext::GetCurrent());
+    SlowStmtLog::stmtCompleted(telemetry->dbQuerySummary,
+                               m_impl->getSql(),
+                               telemetry->boundValues,
+                               telemetry->executeMsecs,
+                               telemetry->fetchMsecs,
+                               m_nbRowsRetrieved);
+  } catch (...) {
+    // Ignore any exceptions
+  }
+}
+
 //------------------------------------------------------------------------------
 // Implementation of methods getting column values from string memory buffer of postgres
 // without passing through optionals, then throw Null case exception within the implementation (downside)
@@ -247,12 +322,21 @@ bool Rset::next() {
     throw InvalidResultSet("This result set is invalid");
   }
 
-  const bool aRowHasBeenRetrieved = m_impl->next();
+  bool aRowHasBeenRetrieved = false;
+  if (nullptr == m_stmtTelemetry) {
+    aRowHasBeenRetrieved = m_impl->next();
+  } else {
+    utils::Timer timer;
+    aRowHasBeenRetrieved = m_impl->next();
+    m_stmtTelemetry->fetchMsecs += timer.msecs();
+  }
+
   if (aRowHasBeenRetrieved) {
     // count rows as they are consumed
     ++m_nbRowsRetrieved;
   } else {
     // Release resources of result set when its end has been reached
+    recordStmtTelemetry();
     m_impl.reset(nullptr);
   }
 
@@ -338,4 +422,84 @@ bool Rset::columnExists(const std::string& colName) const {
   return delegateToImpl<&wrapper::RsetWrapper::columnExists>(m_impl, colName);
 }
 
+//------------------------------------------------------------------------------
+// bindColumns
+//------------------------------------------------------------------------------
+const int* Rset::bindColumns(const void* schema, const std::string_view* names, std::size_t nbNames) const {
+  if (nullptr == m_impl) {
+    throw InvalidResultSet("This result set is invalid");
+  }
+  if (schema != m_boundSchema) {
+    m_boundColIndices.resize(nbNames);
+    for (std::size_t i = 0; i < nbNames; i++) {
+      m_boundColIndices[i] = m_impl->columnIndex(std::string(names[i]));
+    }
+    m_boundSchema = schema;
+  }
+  return m_boundColIndices.data();
+}
+
+//------------------------------------------------------------------------------
+// columnIsNullAt
+//------------------------------------------------------------------------------
+bool Rset::columnIsNullAt(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnIsNullAt>(m_impl, colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnBlobAt
+//------------------------------------------------------------------------------
+std::string Rset::columnBlobAt(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnBlobAt>(m_impl, colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnBlobViewAt
+//------------------------------------------------------------------------------
+std::unique_ptr<wrapper::IBlobView> Rset::columnBlobViewAt(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnBlobViewAt>(m_impl, colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalStringAt
+//------------------------------------------------------------------------------
+std::optional<std::string> Rset::columnOptionalStringAt(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnOptionalStringAt>(m_impl, colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalUint64At
+//------------------------------------------------------------------------------
+std::optional<uint64_t> Rset::columnOptionalUint64At(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnOptionalUint64At>(m_impl, colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalBoolAt
+//------------------------------------------------------------------------------
+std::optional<bool> Rset::columnOptionalBoolAt(const int colIdx) const {
+  // Booleans are stored either as numbers or as PostgreSQL booleans
+  const auto column = columnOptionalStringAt(colIdx);
+  if (!column.has_value()) {
+    return std::nullopt;
+  }
+  const std::string& strValue = column.value();
+  if (strValue == "t" || strValue == "true") {
+    return std::optional<bool>(true);
+  } else if (strValue == "f" || strValue == "false") {
+    return std::optional<bool>(false);
+  } else if (utils::isValidUInt(strValue)) {
+    return std::optional<bool>(utils::toUint64(strValue) != 0);
+  } else {
+    throw exception::Exception("Invalid boolean representation: " + strValue);
+  }
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalDoubleAt
+//------------------------------------------------------------------------------
+std::optional<double> Rset::columnOptionalDoubleAt(const int colIdx) const {
+  return delegateToImpl<&wrapper::RsetWrapper::columnOptionalDoubleAt>(m_impl, colIdx);
+}
+
 }  // namespace cta::rdbms
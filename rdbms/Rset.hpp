@@ -7,10 +7,13 @@
 
 #include "rdbms/InvalidResultSet.hpp"
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <stdint.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace cta::rdbms {
 
@@ -19,6 +22,9 @@ class RsetWrapper;
 class IBlobView;
 }  // namespace wrapper
 
+template<const auto& Schema>
+class RowReader;
+
 /**
  * A wrapper around an object that iterators over a result set from the
  * execution of a database query.
@@ -28,6 +34,33 @@ class IBlobView;
  */
 class Rset {
 public:
+  /**
+   * The telemetry of the statement that created a result set.  It is recorded
+   * once all the rows of the result set have been fetched or the result set has
+   * been released.
+   */
+  struct StmtTelemetry {
+    std::string dbSystemName;
+    std::string dbNamespace;
+    std::string dbQuerySummary;
+
+    /**
+     * The printable form of the values bound to the statement, only filled if
+     * the logging of slow statements is enabled.
+     */
+    std::map<std::string, std::string> boundValues;
+
+    /**
+     * The time taken to execute the statement.
+     */
+    double executeMsecs = 0;
+
+    /**
+     * The time spent so far fetching the rows of the result set.
+     */
+    double fetchMsecs = 0;
+  };
+
   /**
    * Constructor.
    */
@@ -40,6 +73,15 @@ public:
    */
   explicit Rset(std::unique_ptr<wrapper::RsetWrapper> impl);
 
+  /**
+   * Constructor
+   *
+   * @param impl The object actually implementing this result set
+   * @param telemetry The telemetry of the statement that created this result
+   * set
+   */
+  Rset(std::unique_ptr<wrapper::RsetWrapper> impl, std::unique_ptr<StmtTelemetry> telemetry);
+
   /**
    * Destructor.
    */
@@ -58,11 +100,11 @@ public:
   Rset(const Rset&) = delete;
 
   /**
-   * Default move constructor.
+   * Move constructor.
    *
    * @param other The other object to be moved.
    */
-  Rset(Rset&& other) = default;
+  Rset(Rset&& other) noexcept;
 
   /**
    * Deletion of copy assignment.
@@ -70,17 +112,19 @@ public:
   Rset& operator=(const Rset&) = delete;
 
   /**
-   * Default move assignment.
+   * Move assignment.  The telemetry of the result set being replaced is
+   * recorded before it is released.
    */
-  Rset& operator=(Rset&& rhs) = default;
+  Rset& operator=(Rset&& rhs) noexcept;
 
   // Generic method to handle calls to methods (MethodPtr) of m_impl (ImplPtrT)
-  template<auto MethodPtr, typename ImplPtrT>
-  decltype(auto) delegateToImpl(ImplPtrT& impl, const std::string& colName) const {
+  // The column is identified either by its name or by its index
+  template<auto MethodPtr, typename ImplPtrT, typename ColumnT>
+  decltype(auto) delegateToImpl(ImplPtrT& impl, const ColumnT& column) const {
     if (impl == nullptr) {
       throw InvalidResultSet("This result set is invalid");
     }
-    return ((*impl).*MethodPtr)(colName);
+    return ((*impl).*MethodPtr)(column);
   }
 
   /**
@@ -341,12 +385,77 @@ public:
    */
   uint64_t getNbRowsRetrieved() const { return m_nbRowsRetrieved; }
 
+  /**
+   * Returns a reader of the columns of the current row declared by the
+   * specified row schema, see RowSchema.hpp.
+   *
+   * The columns of the schema are resolved into column indices the first time
+   * this method is called for the schema, and the indices are reused for the
+   * following rows.
+   *
+   * @return The reader of the current row.
+   * @throw InvalidResultSet if the result is invalid.
+   */
+  template<const auto& Schema>
+  RowReader<Schema> columns() const;
+
 private:
+  template<const auto& Schema>
+  friend class RowReader;
+
+  /**
+   * Returns the index of each of the specified columns, resolving them only if
+   * they were not resolved yet for the same schema.
+   *
+   * @param schema Identifies the row schema.
+   * @param names The names of the columns.
+   * @param nbNames The number of columns.
+   * @return The index of each column or -1 for the columns which are absent.
+   * @throw InvalidResultSet if the result is invalid.
+   */
+  const int* bindColumns(const void* schema, const std::string_view* names, std::size_t nbNames) const;
+
+  /**
+   * Index-based accessors used by RowReader.
+   *
+   * @param colIdx The index of the column as returned by bindColumns().
+   * @throw InvalidResultSet if the result is invalid.
+   */
+  bool columnIsNullAt(const int colIdx) const;
+  std::string columnBlobAt(const int colIdx) const;
+  std::unique_ptr<wrapper::IBlobView> columnBlobViewAt(const int colIdx) const;
+  std::optional<std::string> columnOptionalStringAt(const int colIdx) const;
+  std::optional<uint64_t> columnOptionalUint64At(const int colIdx) const;
+  std::optional<bool> columnOptionalBoolAt(const int colIdx) const;
+  std::optional<double> columnOptionalDoubleAt(const int colIdx) const;
+
+  /**
+   * Records the telemetry of the statement that created this result set, if
+   * not already done.  This method must be called before m_impl is released.
+   */
+  void recordStmtTelemetry() noexcept;
+
   /**
    * The object actually implementing this result set.
    */
   std::unique_ptr<wrapper::RsetWrapper> m_impl;
 
+  /**
+   * The telemetry of the statement that created this result set, nullptr if
+   * there is none or it has already been recorded.
+   */
+  std::unique_ptr<StmtTelemetry> m_stmtTelemetry;
+
+  /**
+   * The row schema whose columns are resolved in m_boundColIndices.
+   */
+  mutable const void* m_boundSchema = nullptr;
+
+  /**
+   * The index of each column of m_boundSchema.
+   */
+  mutable std::vector<int> m_boundColIndices;
+
   // cumulative number of rows retrieved by next()
   uint64_t m_nbRowsRetrieved = 0;
 
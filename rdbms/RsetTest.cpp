@@ -6,7 +6,12 @@
 #include "rdbms/Rset.hpp"
 
 #include "common/exception/Exception.hpp"
+#include "common/exception/NoSuchObject.hpp"
+#include "common/log/StringLogger.hpp"
 #include "rdbms/ConnPool.hpp"
+#include "rdbms/NullDbValue.hpp"
+#include "rdbms/RowSchema.hpp"
+#include "rdbms/SlowStmtLog.hpp"
 #include "rdbms/wrapper/ConnFactoryFactory.hpp"
 
 #include <gtest/gtest.h>
@@ -14,6 +19,10 @@
 
 namespace unitTests {
 
+namespace {
+constexpr cta::rdbms::RowSchema kRsetTestColumns {"ID", "NAME", "IS_SET", "OPTIONAL_VALUE", "ABSENT"};
+}  // namespace
+
 class cta_rdbms_RsetTest : public ::testing::Test {
 protected:
   virtual void SetUp() {}
@@ -71,4 +80,168 @@ TEST_F(cta_rdbms_RsetTest, next) {
   }
 }
 
+TEST_F(cta_rdbms_RsetTest, columns_of_row_schema) {
+  using namespace cta::rdbms;
+
+  const Login login = Login::getInMemory();
+  auto connFactory = wrapper::ConnFactoryFactory::create(login);
+  auto conn = connFactory->create();
+  StmtPool pool;
+  {
+    const char* const sql = R"SQL(
+      CREATE TABLE RSET_TEST(ID INTEGER, NAME VARCHAR(100), IS_SET INTEGER, OPTIONAL_VALUE INTEGER)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.executeNonQuery();
+  }
+
+  {
+    const char* const sql = R"SQL(
+      INSERT INTO RSET_TEST(ID, NAME, IS_SET, OPTIONAL_VALUE) VALUES(1, 'one', 1, 300)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.executeNonQuery();
+  }
+
+  {
+    const char* const sql = R"SQL(
+      INSERT INTO RSET_TEST(ID, NAME, IS_SET, OPTIONAL_VALUE) VALUES(2, 'two', 0, NULL)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.executeNonQuery();
+  }
+
+  {
+    const char* const sql = R"SQL(
+      SELECT ID AS ID, NAME AS NAME, IS_SET AS IS_SET, OPTIONAL_VALUE AS OPTIONAL_VALUE FROM RSET_TEST ORDER BY ID
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    auto rset = stmt.executeQuery();
+
+    ASSERT_TRUE(rset.next());
+    {
+      const auto row = rset.columns<kRsetTestColumns>();
+      ASSERT_EQ(1, row.columnUint64("ID"));
+      ASSERT_EQ("one", row.columnString("NAME"));
+      ASSERT_TRUE(row.columnBool("IS_SET"));
+      ASSERT_EQ(300, row.columnOptionalUint16("OPTIONAL_VALUE"));
+      ASSERT_THROW(row.columnUint8("OPTIONAL_VALUE"), cta::exception::Exception);
+      ASSERT_FALSE(row.columnExists("ABSENT"));
+      ASSERT_THROW(row.columnUint64("ABSENT"), cta::exception::NoSuchObject);
+    }
+
+    ASSERT_TRUE(rset.next());
+    {
+      const auto row = rset.columns<kRsetTestColumns>();
+      ASSERT_EQ(2, row.columnUint64("ID"));
+      ASSERT_EQ("two", row.columnString("NAME"));
+      ASSERT_FALSE(row.columnBool("IS_SET"));
+      ASSERT_TRUE(row.columnIsNull("OPTIONAL_VALUE"));
+      ASSERT_FALSE(row.columnOptionalUint64("OPTIONAL_VALUE").has_value());
+      ASSERT_THROW(row.columnUint64("OPTIONAL_VALUE"), NullDbValue);
+    }
+
+    ASSERT_FALSE(rset.next());
+    ASSERT_THROW(rset.columns<kRsetTestColumns>(), InvalidResultSet);
+  }
+}
+
+TEST_F(cta_rdbms_RsetTest, slow_statement_logged_once_all_rows_fetched) {
+  using namespace cta::rdbms;
+
+  const Login login = Login::getInMemory();
+  auto connFactory = wrapper::ConnFactoryFactory::create(login);
+  auto conn = connFactory->create();
+  StmtPool pool;
+  {
+    const char* const sql = R"SQL(
+      CREATE TABLE RSET_TEST(ID INTEGER, NAME VARCHAR(100))
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.executeNonQuery();
+  }
+
+  cta::log::StringLogger log("dummy", "unitTest", cta::log::DEBUG);
+  SlowStmtLog::enable(log, 0);
+  {
+    const char* const sql = R"SQL(
+      INSERT INTO RSET_TEST(ID, NAME) VALUES(:ID, :NAME)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.bindUint64(":ID", 1);
+    stmt.bindString(":NAME", std::string("one"));
+    stmt.executeNonQuery();
+  }
+  ASSERT_NE(std::string::npos, log.getLog().find("boundValues=\":ID=1 :NAME='one'\""));
+
+  {
+    const char* const sql = R"SQL(
+      SELECT ID AS ID FROM RSET_TEST WHERE ID = :ID
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.bindUint64(":ID", 1);
+    auto rset = stmt.executeQuery();
+    const auto logLenBeforeFetch = log.getLog().size();
+    ASSERT_TRUE(rset.next());
+    ASSERT_EQ(logLenBeforeFetch, log.getLog().size());
+    ASSERT_FALSE(rset.next());
+    ASSERT_NE(std::string::npos, log.getLog().find("sql=\"SELECT ID AS ID FROM RSET_TEST WHERE ID = :ID\""));
+    ASSERT_NE(std::string::npos, log.getLog().find("nbRows=\"1\""));
+  }
+  SlowStmtLog::disable();
+}
+
+TEST_F(cta_rdbms_RsetTest, move_assignment_records_replaced_statement) {
+  using namespace cta::rdbms;
+
+  const Login login = Login::getInMemory();
+  auto connFactory = wrapper::ConnFactoryFactory::create(login);
+  auto conn = connFactory->create();
+  StmtPool pool;
+  {
+    const char* const sql = R"SQL(
+      CREATE TABLE RSET_TEST(ID INTEGER)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.executeNonQuery();
+  }
+  for (uint64_t id = 1; id <= 3; id++) {
+    const char* const sql = R"SQL(
+      INSERT INTO RSET_TEST(ID) VALUES(:ID)
+    )SQL";
+    Stmt stmt = pool.getStmt(*conn, sql);
+    stmt.bindUint64(":ID", id);
+    stmt.executeNonQuery();
+  }
+
+  cta::log::StringLogger log("dummy", "unitTest", cta::log::DEBUG);
+  SlowStmtLog::enable(log, 0);
+  {
+    const char* const sql1 = R"SQL(
+      SELECT ID AS ID FROM RSET_TEST ORDER BY ID
+    )SQL";
+    const char* const sql2 = R"SQL(
+      SELECT ID AS ID FROM RSET_TEST WHERE ID > 1 ORDER BY ID
+    )SQL";
+    Stmt stmt1 = pool.getStmt(*conn, sql1);
+    Stmt stmt2 = pool.getStmt(*conn, sql2);
+    auto rset = stmt1.executeQuery();
+    ASSERT_TRUE(rset.next());
+
+    // Replacing the partially fetched result set records it with the rows fetched so far
+    rset = stmt2.executeQuery();
+    ASSERT_NE(std::string::npos, log.getLog().find("sql=\"SELECT ID AS ID FROM RSET_TEST ORDER BY ID\""));
+    ASSERT_NE(std::string::npos, log.getLog().find("nbRows=\"1\""));
+
+    // The new result set carries its own statement telemetry and row count
+    ASSERT_TRUE(rset.next());
+    ASSERT_TRUE(rset.next());
+    ASSERT_FALSE(rset.next());
+    ASSERT_NE(std::string::npos,
+              log.getLog().find("sql=\"SELECT ID AS ID FROM RSET_TEST WHERE ID > 1 ORDER BY ID\""));
+    ASSERT_NE(std::string::npos, log.getLog().find("nbRows=\"2\""));
+  }
+  SlowStmtLog::disable();
+}
+
 }  // namespace unitTests
@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "rdbms/SlowStmtLog.hpp"
+
+#include "common/log/LogContext.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "common/process/threading/MutexLocker.hpp"
+#include "common/semconv/Attributes.hpp"
+#include "common/telemetry/metrics/instruments/RdbmsInstruments.hpp"
+
+#include <atomic>
+#include <cctype>
+#include <sstream>
+#include <time.h>
+
+namespace cta::rdbms {
+
+namespace {
+
+std::atomic<log::Logger*> g_log = nullptr;
+std::atomic<uint64_t> g_thresholdMsecs = 0;
+
+/** Protects the sampling state below */
+threading::Mutex g_samplingMutex;
+time_t g_samplingMinute = 0;
+uint64_t g_nbLogsInMinute = 0;
+uint64_t g_nbNotLogged = 0;
+
+/**
+ * Returns the specified SQL with each sequence of white space replaced by a
+ * single space, so that it fits on a single log line.
+ */
+std::string collapseWhiteSpace(const std::string& sql) {
+  std::string collapsed;
+  collapsed.reserve(sql.size());
+  for (const char c : sql) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      if (!collapsed.empty() && collapsed.back() != ' ') {
+        collapsed.push_back(' ');
+      }
+    } else {
+      collapsed.push_back(c);
+    }
+  }
+  if (!collapsed.empty() && collapsed.back() == ' ') {
+    collapsed.pop_back();
+  }
+  return collapsed;
+}
+
+}  // anonymous namespace
+
+//------------------------------------------------------------------------------
+// enable
+//------------------------------------------------------------------------------
+void SlowStmtLog::enable(log::Logger& log, const uint64_t thresholdMsecs) {
+  g_thresholdMsecs = thresholdMsecs;
+  g_log = &log;
+}
+
+//------------------------------------------------------------------------------
+// disable
+//------------------------------------------------------------------------------
+void SlowStmtLog::disable() {
+  g_log = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// isEnabled
+//------------------------------------------------------------------------------
+bool SlowStmtLog::isEnabled() {
+  return nullptr != g_log.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+// stmtCompleted
+//------------------------------------------------------------------------------
+void SlowStmtLog::stmtCompleted(const std::string& dbQuerySummary,
+                                const std::string& sql,
+                                const std::map<std::string, std::string>& boundValues,
+                                const double executeMsecs,
+                                const double fetchMsecs,
+                                const uint64_t nbRows) {
+  log::Logger* const logger = g_log.load();
+  const double totalMsecs = executeMsecs + fetchMsecs;
+  if (nullptr == logger || totalMsecs < static_cast<double>(g_thresholdMsecs.load())) {
+    return;
+  }
+
+  telemetry::metrics::ctaRdbmsSlowStatementCount->Add(
+    1,
+    {
+      {semconv::attr::kDbQuerySummary, dbQuerySummary}
+  });
+
+  uint64_t nbNotLogged = 0;
+  {
+    threading::MutexLocker locker(g_samplingMutex);
+    const time_t minute = ::time(nullptr) / 60;
+    if (minute != g_samplingMinute) {
+      g_samplingMinute = minute;
+      g_nbLogsInMinute = 0;
+    }
+    if (g_nbLogsInMinute >= MAX_LOGS_PER_MINUTE) {
+      g_nbNotLogged++;
+      return;
+    }
+    g_nbLogsInMinute++;
+    nbNotLogged = g_nbNotLogged;
+    g_nbNotLogged = 0;
+  }
+
+  std::ostringstream boundValuesStr;
+  for (const auto& [paramName, value] : boundValues) {
+    boundValuesStr << (boundValuesStr.tellp() > 0 ? " " : "") << paramName << "=" << value;
+  }
+
+  log::LogContext lc(*logger);
+  log::ScopedParamContainer params(lc);
+  params.add("dbQuerySummary", dbQuerySummary)
+    .add("sql", collapseWhiteSpace(sql))
+    .add("boundValues", boundValuesStr.str())
+    .add("executeTimeMs", executeMsecs)
+    .add("fetchTimeMs", fetchMsecs)
+    .add("totalTimeMs", totalMsecs)
+    .add("nbRows", nbRows)
+    .add("thresholdMs", g_thresholdMsecs.load())
+    .add("nbSlowStmtsNotLogged", nbNotLogged);
+  lc.log(log::WARNING, "Slow database statement");
+}
+
+}  // namespace cta::rdbms
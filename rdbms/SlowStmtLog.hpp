@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/Logger.hpp"
+
+#include <map>
+#include <stdint.h>
+#include <string>
+
+namespace cta::rdbms {
+
+/**
+ * Process-wide logging of the database statements slower than a threshold.
+ *
+ * Each slow statement is counted in the telemetry and logged together with
+ * its SQL and its bind values, so that a regression can be pinned to a
+ * specific catalogue or scheduler query.  The logs are sampled: at most
+ * MAX_LOGS_PER_MINUTE slow statements are logged per minute, the others are
+ * only counted.  Slow statements are neither counted nor logged until
+ * enable() has been called.
+ */
+class SlowStmtLog {
+public:
+  /**
+   * The maximum number of slow statements logged per minute.
+   */
+  static constexpr uint64_t MAX_LOGS_PER_MINUTE = 60;
+
+  /**
+   * Prevent objects of this class from being instantiated.
+   */
+  SlowStmtLog() = delete;
+
+  /**
+   * Enables the logging of slow statements.
+   *
+   * This method is meant to be called once at start up, before any database
+   * connection is created.
+   *
+   * @param log The logger to which the slow statements are logged.  It must
+   * outlive all the database connections of the process.
+   * @param thresholdMsecs The duration in milliseconds from which a statement
+   * is considered slow.
+   */
+  static void enable(log::Logger& log, const uint64_t thresholdMsecs);
+
+  /**
+   * Disables the logging of slow statements.
+   */
+  static void disable();
+
+  /**
+   * Returns true if the logging of slow statements is enabled, in which case
+   * the values bound to the statements should be recorded.
+   */
+  static bool isEnabled();
+
+  /**
+   * Counts and possibly logs the specified statement if it is slow.
+   *
+   * @param dbQuerySummary The query summary of the statement.
+   * @param sql The SQL of the statement.
+   * @param boundValues The values bound to the statement by parameter name.
+   * @param executeMsecs The time taken to execute the statement.
+   * @param fetchMsecs The time taken to fetch the rows of its result set.
+   * @param nbRows The number of rows fetched or affected.
+   */
+  static void stmtCompleted(const std::string& dbQuerySummary,
+                            const std::string& sql,
+                            const std::map<std::string, std::string>& boundValues,
+                            const double executeMsecs,
+                            const double fetchMsecs,
+                            const uint64_t nbRows);
+};
+
+}  // namespace cta::rdbms
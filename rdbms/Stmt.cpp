@@ -9,6 +9,7 @@
 #include "common/semconv/Attributes.hpp"
 #include "common/telemetry/metrics/instruments/RdbmsInstruments.hpp"
 #include "common/utils/Timer.hpp"
+#include "rdbms/SlowStmtLog.hpp"
 #include "rdbms/StmtPool.hpp"
 #include "rdbms/wrapper/StmtWrapper.hpp"
 
@@ -16,6 +17,36 @@
 
 namespace cta::rdbms {
 
+namespace {
+
+/**
+ * The maximum length of a string value logged with a slow statement.
+ */
+constexpr std::string::size_type MAX_LOGGED_STRING_VALUE_LEN = 100;
+
+/**
+ * Returns the printable form of the specified value bound to a statement.
+ */
+template<typename T>
+std::string toPrintableValue(const std::optional<T>& paramValue) {
+  return paramValue.has_value() ? std::to_string(paramValue.value()) : "NULL";
+}
+
+/**
+ * Returns the printable form of the specified string bound to a statement.
+ */
+std::string toPrintableValue(const std::optional<std::string>& paramValue) {
+  if (!paramValue.has_value()) {
+    return "NULL";
+  }
+  if (paramValue.value().size() > MAX_LOGGED_STRING_VALUE_LEN) {
+    return "'" + paramValue.value().substr(0, MAX_LOGGED_STRING_VALUE_LEN) + "...'";
+  }
+  return "'" + paramValue.value() + "'";
+}
+
+}  // anonymous namespace
+
 //-----------------------------------------------------------------------------
 // constructor
 //-----------------------------------------------------------------------------
@@ -94,6 +125,9 @@ uint32_t Stmt::getParamIdx(const std::string& paramName) const {
 //-----------------------------------------------------------------------------
 void Stmt::bindUint8(const std::string& paramName, const std::optional<uint8_t>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindUint8(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -105,6 +139,9 @@ void Stmt::bindUint8(const std::string& paramName, const std::optional<uint8_t>&
 //-----------------------------------------------------------------------------
 void Stmt::bindUint16(const std::string& paramName, const std::optional<uint16_t>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindUint16(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -116,6 +153,9 @@ void Stmt::bindUint16(const std::string& paramName, const std::optional<uint16_t
 //-----------------------------------------------------------------------------
 void Stmt::bindUint32(const std::string& paramName, const std::optional<uint32_t>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindUint32(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -127,6 +167,9 @@ void Stmt::bindUint32(const std::string& paramName, const std::optional<uint32_t
 //-----------------------------------------------------------------------------
 void Stmt::bindUint64(const std::string& paramName, const std::optional<uint64_t>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindUint64(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -138,6 +181,9 @@ void Stmt::bindUint64(const std::string& paramName, const std::optional<uint64_t
 //-----------------------------------------------------------------------------
 void Stmt::bindDouble(const std::string& paramName, const std::optional<double>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindDouble(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -149,6 +195,9 @@ void Stmt::bindDouble(const std::string& paramName, const std::optional<double>&
 //-----------------------------------------------------------------------------
 void Stmt::bindBool(const std::string& paramName, const std::optional<bool>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindBool(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -160,6 +209,9 @@ void Stmt::bindBool(const std::string& paramName, const std::optional<bool>& par
 //-----------------------------------------------------------------------------
 void Stmt::bindBlob(const std::string& paramName, const std::string& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, "<blob of " + std::to_string(paramValue.size()) + " bytes>");
+    }
     return m_stmt->bindBlob(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -171,6 +223,9 @@ void Stmt::bindBlob(const std::string& paramName, const std::string& paramValue)
 //-----------------------------------------------------------------------------
 void Stmt::bindString(const std::string& paramName, const std::optional<std::string>& paramValue) {
   if (nullptr != m_stmt) {
+    if (SlowStmtLog::isEnabled()) {
+      m_stmt->recordBoundValue(paramName, toPrintableValue(paramValue));
+    }
     return m_stmt->bindString(paramName, paramValue);
   } else {
     throw exception::Exception("Stmt does not contain a cached statement");
@@ -195,34 +250,34 @@ Rset Stmt::executeQuery() {
   utils::Timer timer;
   try {
     if (nullptr != m_stmt) {
-      auto result = Rset(m_stmt->executeQuery());
+      auto rsetImpl = m_stmt->executeQuery();
+      const double executeMsecs = timer.msecs();
       if (m_stmt->getDbQuerySummary().empty()) {
         m_stmt->setDbQuerySummary(cta::semconv::attr::DbQuerySummary::kDbTransactionStmtExecuteQuery);
       }
+      auto telemetry = std::make_unique<Rset::StmtTelemetry>();
+      telemetry->dbSystemName = m_stmt->getDbSystemName();
+      telemetry->dbNamespace = m_stmt->getDbNamespace();
+      telemetry->dbQuerySummary = m_stmt->getDbQuerySummary();
+      telemetry->executeMsecs = executeMsecs;
+      if (SlowStmtLog::isEnabled()) {
+        telemetry->boundValues = m_stmt->getBoundValues();
+      }
       cta::telemetry::metrics::dbClientOperationDuration->Record(
-        timer.msecs(),
+        executeMsecs,
         {
-          {cta::semconv::attr::kDbSystemName,    m_stmt->getDbSystemName()                              },
-          {cta::semconv::attr::kDbNamespace,     m_stmt->getDbNamespace()                               },
-          {cta::semconv::attr::kDbQuerySummary,  m_stmt->getDbQuerySummary()                            },
+          {cta::semconv::attr::kDbSystemName,    telemetry->dbSystemName                                },
+          {cta::semconv::attr::kDbNamespace,     telemetry->dbNamespace                                 },
+          {cta::semconv::attr::kDbQuerySummary,  telemetry->dbQuerySummary                              },
           {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
       },
         opentelemetry::context::RuntimeContext::GetCurrent());
-      return result;
+      return Rset(std::move(rsetImpl), std::move(telemetry));
     } else {
       throw exception::Exception("Stmt does not contain a cached statement");
     }
   } catch (std::exception&) {
-    cta::telemetry::metrics::dbClientOperationDuration->Record(
-      timer.msecs(),
-      {
-        {cta::semconv::attr::kDbSystemName,    m_stmt->getDbSystemName()                              },
-        {cta::semconv::attr::kDbNamespace,     m_stmt->getDbNamespace()                               },
-        {cta::semconv::attr::kErrorType,       cta::semconv::attr::ErrorTypeValues::kException        },
-        {cta::semconv::attr::kDbQuerySummary,  "execute query"                                        },
-        {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
-    },
-      opentelemetry::context::RuntimeContext::GetCurrent());
+    recordFailedExecution(timer.msecs(), "execute query");
     throw;
   }
 }
@@ -235,11 +290,12 @@ void Stmt::executeNonQuery() {
   try {
     if (nullptr != m_stmt) {
       m_stmt->executeNonQuery();
+      const double executeMsecs = timer.msecs();
       if (m_stmt->getDbQuerySummary().empty()) {
         m_stmt->setDbQuerySummary(cta::semconv::attr::DbQuerySummary::kDbTransactionStmtExecuteNonQuery);
       }
       cta::telemetry::metrics::dbClientOperationDuration->Record(
-        timer.msecs(),
+        executeMsecs,
         {
           {cta::semconv::attr::kDbSystemName,    m_stmt->getDbSystemName()                              },
           {cta::semconv::attr::kDbNamespace,     m_stmt->getDbNamespace()                               },
@@ -257,25 +313,42 @@ void Stmt::executeNonQuery() {
           {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
       },
         opentelemetry::context::RuntimeContext::GetCurrent());
-
+      SlowStmtLog::stmtCompleted(m_stmt->getDbQuerySummary(),
+                                 m_stmt->getSql(),
+                                 m_stmt->getBoundValues(),
+                                 executeMsecs,
+                                 0,
+                                 nrows);
     } else {
       throw exception::Exception("Stmt does not contain a cached statement");
     }
   } catch (std::exception&) {
-    cta::telemetry::metrics::dbClientOperationDuration->Record(
-      timer.msecs(),
-      {
-        {cta::semconv::attr::kDbSystemName,    m_stmt->getDbSystemName()                              },
-        {cta::semconv::attr::kDbNamespace,     m_stmt->getDbNamespace()                               },
-        {cta::semconv::attr::kErrorType,       cta::semconv::attr::ErrorTypeValues::kException        },
-        {cta::semconv::attr::kDbQuerySummary,  "execute non query"                                    },
-        {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
-    },
-      opentelemetry::context::RuntimeContext::GetCurrent());
+    recordFailedExecution(timer.msecs(), "execute non query");
     throw;
   }
 }
 
+//-----------------------------------------------------------------------------
+// recordFailedExecution
+//-----------------------------------------------------------------------------
+void Stmt::recordFailedExecution(const double executeMsecs, const std::string& defaultDbQuerySummary) const {
+  if (nullptr == m_stmt) {
+    return;
+  }
+  const std::string dbQuerySummary =
+    m_stmt->getDbQuerySummary().empty() ? defaultDbQuerySummary : m_stmt->getDbQuerySummary();
+  cta::telemetry::metrics::dbClientOperationDuration->Record(
+    executeMsecs,
+    {
+      {cta::semconv::attr::kDbSystemName,    m_stmt->getDbSystemName()                              },
+      {cta::semconv::attr::kDbNamespace,     m_stmt->getDbNamespace()                               },
+      {cta::semconv::attr::kErrorType,       cta::semconv::attr::ErrorTypeValues::kException        },
+      {cta::semconv::attr::kDbQuerySummary,  dbQuerySummary                                         },
+      {cta::semconv::attr::kDbOperationName, cta::semconv::attr::DbOperationNameValues::kTransaction}
+  },
+    opentelemetry::context::RuntimeContext::GetCurrent());
+}
+
 //-----------------------------------------------------------------------------
 // getNbAffectedRows
 //-----------------------------------------------------------------------------
@@ -215,6 +215,15 @@ public:
   void setDbQuerySummary(const std::string& optQuerySummary);
 
 private:
+  /**
+   * Records the duration of an execution of the statement that failed.
+   *
+   * @param executeMsecs The time spent executing the statement.
+   * @param defaultDbQuerySummary The query summary to be used if none has been
+   * set.
+   */
+  void recordFailedExecution(const double executeMsecs, const std::string& defaultDbQuerySummary) const;
+
   /**
    * The database statement.
    */
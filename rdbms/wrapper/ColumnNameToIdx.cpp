@@ -30,6 +30,14 @@ int ColumnNameToIdx::getIdx(const std::string& name) const {
   return it->second;
 }
 
+//------------------------------------------------------------------------------
+// findIdx
+//------------------------------------------------------------------------------
+int ColumnNameToIdx::findIdx(const std::string& name) const {
+  auto it = m_nameToIdx.find(name);
+  return m_nameToIdx.end() == it ? -1 : it->second;
+}
+
 //------------------------------------------------------------------------------
 // empty
 //------------------------------------------------------------------------------
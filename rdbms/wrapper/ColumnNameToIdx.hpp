@@ -36,6 +36,14 @@ public:
    */
   int getIdx(const std::string& name) const;
 
+  /**
+   * Returns the index of the column with the specified name or -1 if the
+   * specified column name is not in the map.
+   *
+   * @return the index of the column with the specified name or -1.
+   */
+  int findIdx(const std::string& name) const;
+
   /**
    * Returns true if this map is empty.
    *
@@ -6,6 +6,7 @@
 #include "rdbms/wrapper/ConnWrapper.hpp"
 
 #include "common/exception/Exception.hpp"
+#include "common/exception/NotImplementedException.hpp"
 #include "common/utils/utils.hpp"
 
 namespace cta::rdbms::wrapper {
@@ -15,4 +16,11 @@ namespace cta::rdbms::wrapper {
 //------------------------------------------------------------------------------
 ConnWrapper::~ConnWrapper() = default;
 
+//------------------------------------------------------------------------------
+// waitForNotifications
+//------------------------------------------------------------------------------
+std::list<std::string> ConnWrapper::waitForNotifications(const uint32_t) {
+  throw exception::NotImplementedException("The database does not deliver notifications to connections");
+}
+
 }  // namespace cta::rdbms::wrapper
@@ -9,6 +9,7 @@
 #include "rdbms/wrapper/StmtWrapper.hpp"
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <string>
 #include <vector>
@@ -202,6 +203,21 @@ public:
    */
   virtual std::string getDbNamespace() const = 0;
 
+  /**
+   * Waits for asynchronous notifications to be received by this connection,
+   * for example the ones sent by the PostgreSQL NOTIFY command on a channel
+   * the connection is listening to.
+   *
+   * The default implementation throws exception::NotImplementedException
+   * because most database technologies do not deliver notifications to
+   * connections.
+   *
+   * @param timeoutMs The maximum time to wait in milliseconds.
+   * @return The payloads of the notifications received, which is empty if the
+   * timeout expired before any notification was received.
+   */
+  virtual std::list<std::string> waitForNotifications(const uint32_t timeoutMs);
+
 };  // class ConnWrapper
 
 }  // namespace cta::rdbms::wrapper
@@ -40,6 +40,7 @@ void OcciRset::populateColNameToIdxMap() {
     const unsigned int colIdx = i + 1;
     const std::string name = columns[i].getString(occi::MetaData::ATTR_NAME);
     m_colNameToIdx.add(name, colIdx);
+    m_colNames.push_back(name);
   }
 }
 
@@ -258,4 +259,98 @@ std::optional<double> OcciRset::columnOptionalDouble(const std::string& colName)
   }
 }
 
+//------------------------------------------------------------------------------
+// columnIndex
+//------------------------------------------------------------------------------
+int OcciRset::columnIndex(const std::string& colName) const {
+  return m_colNameToIdx.findIdx(colName);
+}
+
+//------------------------------------------------------------------------------
+// columnIsNullAt
+//------------------------------------------------------------------------------
+bool OcciRset::columnIsNullAt(const int colIdx) const {
+  return m_rset->isNull(colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnBlobAt
+//------------------------------------------------------------------------------
+std::string OcciRset::columnBlobAt(const int colIdx) const {
+  try {
+    auto raw = m_rset->getBytes(colIdx);
+    auto bytearray = std::make_unique<unsigned char[]>(raw.length());
+    raw.getBytes(bytearray.get(), raw.length());
+    return std::string(reinterpret_cast<char*>(bytearray.get()), raw.length());
+  } catch (exception::Exception& ne) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + ne.getMessage().str());
+  } catch (std::exception& se) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + se.what());
+  }
+}
+
+//------------------------------------------------------------------------------
+// columnBlobViewAt
+//------------------------------------------------------------------------------
+std::unique_ptr<rdbms::wrapper::IBlobView> OcciRset::columnBlobViewAt(const int colIdx) const {
+  throw exception::NotImplementedException(
+    "This method is Not implemented for Oracle DB, since there is no way to gain access to "
+    "the raw data buffer without making a copy first.");
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalStringAt
+//------------------------------------------------------------------------------
+std::optional<std::string> OcciRset::columnOptionalStringAt(const int colIdx) const {
+  try {
+    std::string stringValue = m_rset->getString(colIdx);
+    if (stringValue.empty()) {
+      return std::nullopt;
+    }
+    return stringValue;
+  } catch (exception::Exception& ne) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + ne.getMessage().str());
+  } catch (std::exception& se) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + se.what());
+  }
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalUint64At
+//------------------------------------------------------------------------------
+std::optional<uint64_t> OcciRset::columnOptionalUint64At(const int colIdx) const {
+  try {
+    const std::string stringValue = m_rset->getString(colIdx);
+    if (stringValue.empty()) {
+      return std::nullopt;
+    }
+    if (!utils::isValidUInt(stringValue)) {
+      throw exception::Exception(std::string("Column ") + m_colNames.at(colIdx - 1) + " contains the value "
+                                 + stringValue + " which is not a valid unsigned integer");
+    }
+    return utils::toUint64(stringValue);
+  } catch (exception::Exception& ne) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + ne.getMessage().str());
+  } catch (std::exception& se) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + se.what());
+  }
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalDoubleAt
+//------------------------------------------------------------------------------
+std::optional<double> OcciRset::columnOptionalDoubleAt(const int colIdx) const {
+  try {
+    if (m_rset->isNull(colIdx)) {
+      return std::nullopt;
+    } else {
+      return m_rset->getDouble(colIdx);
+    }
+  } catch (exception::Exception& ne) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + ne.getMessage().str());
+  } catch (std::exception& se) {
+    throw exception::Exception("Failed SQL statement " + m_stmt.getSql() + ": " + se.what());
+  }
+}
+
 }  // namespace cta::rdbms::wrapper
@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <occi.h>
+#include <vector>
 
 namespace cta::rdbms::wrapper {
 
@@ -210,6 +211,17 @@ public:
    */
   std::optional<double> columnOptionalDouble(const std::string& colName) const override;
 
+  /**
+   * Index-based accessors, see RsetWrapper::columnIndex().
+   */
+  int columnIndex(const std::string& colName) const override;
+  bool columnIsNullAt(const int colIdx) const override;
+  std::string columnBlobAt(const int colIdx) const override;
+  std::unique_ptr<rdbms::wrapper::IBlobView> columnBlobViewAt(const int colIdx) const override;
+  std::optional<std::string> columnOptionalStringAt(const int colIdx) const override;
+  std::optional<uint64_t> columnOptionalUint64At(const int colIdx) const override;
+  std::optional<double> columnOptionalDoubleAt(const int colIdx) const override;
+
 private:
   /**
    * Mutex used to serialize access to this object.
@@ -231,6 +243,11 @@ private:
    */
   ColumnNameToIdx m_colNameToIdx;
 
+  /**
+   * The name of each column, indexed by column index minus one.
+   */
+  std::vector<std::string> m_colNames;
+
   /**
    * Idempotent close() method.  The destructor calls this method.
    */
@@ -0,0 +1,332 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "rdbms/wrapper/PostgresBinaryFormat.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/exception/Mismatch.hpp"
+#include "common/utils/StringConversions.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <endian.h>
+#include <vector>
+
+namespace cta::rdbms::wrapper {
+
+namespace {
+
+/**
+ * Reads a big-endian integer of type T from the start of a buffer
+ */
+template<typename T>
+T readBigEndian(const char* buf) {
+  T value;
+  std::memcpy(&value, buf, sizeof(T));
+  if constexpr (sizeof(T) == 2) {
+    return static_cast<T>(be16toh(static_cast<uint16_t>(value)));
+  } else if constexpr (sizeof(T) == 4) {
+    return static_cast<T>(be32toh(static_cast<uint32_t>(value)));
+  } else {
+    return static_cast<T>(be64toh(static_cast<uint64_t>(value)));
+  }
+}
+
+/**
+ * Reads a signed integer column of the specified width
+ */
+int64_t readInteger(Oid type, std::string_view colName, std::string_view value) {
+  size_t expectedLength = 0;
+  switch (type) {
+    case PostgresBinaryFormat::kInt2Oid:
+      expectedLength = 2;
+      break;
+    case PostgresBinaryFormat::kInt4Oid:
+      expectedLength = 4;
+      break;
+    default:
+      expectedLength = 8;
+      break;
+  }
+  if (value.size() != expectedLength) {
+    throw exception::Exception("Column " + std::string(colName) + " has an integer value of unexpected length "
+                               + std::to_string(value.size()));
+  }
+  switch (expectedLength) {
+    case 2:
+      return readBigEndian<int16_t>(value.data());
+    case 4:
+      return readBigEndian<int32_t>(value.data());
+    default:
+      return readBigEndian<int64_t>(value.data());
+  }
+}
+
+/**
+ * Reads a float4 or float8 column
+ */
+double readFloat(Oid type, std::string_view colName, std::string_view value) {
+  if (PostgresBinaryFormat::kFloat4Oid == type && value.size() == 4) {
+    const uint32_t bits = readBigEndian<uint32_t>(value.data());
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+  }
+  if (PostgresBinaryFormat::kFloat8Oid == type && value.size() == 8) {
+    const uint64_t bits = readBigEndian<uint64_t>(value.data());
+    double d;
+    std::memcpy(&d, &bits, sizeof(d));
+    return d;
+  }
+  throw exception::Exception("Column " + std::string(colName) + " has a floating point value of unexpected length "
+                             + std::to_string(value.size()));
+}
+
+/**
+ * Sign values of the NUMERIC binary format
+ */
+constexpr uint16_t kNumericPositive = 0x0000;
+constexpr uint16_t kNumericNegative = 0x4000;
+constexpr uint16_t kNumericNaN = 0xC000;
+constexpr uint16_t kNumericPInf = 0xD000;
+constexpr uint16_t kNumericNInf = 0xF000;
+
+}  // namespace
+
+struct PostgresBinaryFormat::Numeric {
+  int16_t weight = 0;
+  uint16_t sign = kNumericPositive;
+  uint16_t dscale = 0;
+  std::vector<int16_t> digits;  ///< Base 10000 digits, the first one being multiplied by 10000^weight
+};
+
+//------------------------------------------------------------------------------
+// isSupported
+//------------------------------------------------------------------------------
+bool PostgresBinaryFormat::isSupported(Oid type) {
+  switch (type) {
+    case kBoolOid:
+    case kByteaOid:
+    case kInt8Oid:
+    case kInt2Oid:
+    case kInt4Oid:
+    case kFloat4Oid:
+    case kFloat8Oid:
+    case kNumericOid:
+      return true;
+    default:
+      return isTextLike(type);
+  }
+}
+
+//------------------------------------------------------------------------------
+// isTextLike
+//------------------------------------------------------------------------------
+bool PostgresBinaryFormat::isTextLike(Oid type) {
+  switch (type) {
+    case kCharOid:
+    case kNameOid:
+    case kTextOid:
+    case kBpcharOid:
+    case kVarcharOid:
+      return true;
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+// decodeNumeric
+//------------------------------------------------------------------------------
+PostgresBinaryFormat::Numeric PostgresBinaryFormat::decodeNumeric(std::string_view colName, std::string_view value) {
+  if (value.size() < 8) {
+    throw exception::Exception("Column " + std::string(colName) + " has a truncated NUMERIC value");
+  }
+  const auto ndigits = readBigEndian<int16_t>(value.data());
+  Numeric numeric;
+  numeric.weight = readBigEndian<int16_t>(value.data() + 2);
+  numeric.sign = readBigEndian<uint16_t>(value.data() + 4);
+  numeric.dscale = readBigEndian<uint16_t>(value.data() + 6);
+  if (ndigits < 0 || value.size() != 8 + 2 * static_cast<size_t>(ndigits)) {
+    throw exception::Exception("Column " + std::string(colName) + " has a NUMERIC value of unexpected length "
+                               + std::to_string(value.size()));
+  }
+  numeric.digits.reserve(ndigits);
+  for (int16_t i = 0; i < ndigits; i++) {
+    numeric.digits.push_back(readBigEndian<int16_t>(value.data() + 8 + 2 * i));
+  }
+  return numeric;
+}
+
+//------------------------------------------------------------------------------
+// toUint64
+//------------------------------------------------------------------------------
+uint64_t PostgresBinaryFormat::toUint64(Oid type, std::string_view colName, std::string_view value) {
+  switch (type) {
+    case kInt2Oid:
+    case kInt4Oid:
+    case kInt8Oid: {
+      const int64_t integer = readInteger(type, colName, value);
+      if (integer < 0) {
+        throw exception::Mismatch("Column " + std::string(colName) + " contains the value " + std::to_string(integer)
+                                  + " which is not a valid unsigned integer");
+      }
+      return static_cast<uint64_t>(integer);
+    }
+    case kNumericOid: {
+      const Numeric numeric = decodeNumeric(colName, value);
+      const auto notAnUnsignedInteger = [&] {
+        return exception::Mismatch("Column " + std::string(colName) + " contains the value " + toString(type, colName, value)
+                                   + " which is not a valid unsigned integer");
+      };
+      if (numeric.sign != kNumericPositive && !(numeric.sign == kNumericNegative && numeric.digits.empty())) {
+        throw notAnUnsignedInteger();
+      }
+      uint64_t result = 0;
+      for (int i = 0; i <= numeric.weight; i++) {
+        const uint64_t digit = i < static_cast<int>(numeric.digits.size()) ? numeric.digits[i] : 0;
+        if (__builtin_mul_overflow(result, 10000, &result) || __builtin_add_overflow(result, digit, &result)) {
+          throw notAnUnsignedInteger();
+        }
+      }
+      // Any non-zero digit after the decimal point makes the value a non-integer
+      for (size_t i = std::max(0, numeric.weight + 1); i < numeric.digits.size(); i++) {
+        if (numeric.digits[i] != 0) {
+          throw notAnUnsignedInteger();
+        }
+      }
+      return result;
+    }
+    case kFloat4Oid:
+    case kFloat8Oid: {
+      const double d = readFloat(type, colName, value);
+      if (d < 0 || d != std::floor(d) || d >= 18446744073709551616.0) {
+        throw exception::Mismatch("Column " + std::string(colName) + " contains the value " + toString(type, colName, value)
+                                  + " which is not a valid unsigned integer");
+      }
+      return static_cast<uint64_t>(d);
+    }
+    default:
+      return utils::toUint64(toString(type, colName, value));
+  }
+}
+
+//------------------------------------------------------------------------------
+// toDouble
+//------------------------------------------------------------------------------
+double PostgresBinaryFormat::toDouble(Oid type, std::string_view colName, std::string_view value) {
+  switch (type) {
+    case kInt2Oid:
+    case kInt4Oid:
+    case kInt8Oid:
+      return static_cast<double>(readInteger(type, colName, value));
+    case kFloat4Oid:
+    case kFloat8Oid:
+      return readFloat(type, colName, value);
+    case kNumericOid: {
+      const Numeric numeric = decodeNumeric(colName, value);
+      switch (numeric.sign) {
+        case kNumericNaN:
+          return std::nan("");
+        case kNumericPInf:
+          return HUGE_VAL;
+        case kNumericNInf:
+          return -HUGE_VAL;
+        default:
+          break;
+      }
+      double result = 0;
+      for (size_t i = 0; i < numeric.digits.size(); i++) {
+        result += numeric.digits[i] * std::pow(10000.0, numeric.weight - static_cast<int>(i));
+      }
+      return numeric.sign == kNumericNegative ? -result : result;
+    }
+    default:
+      return utils::toDouble(toString(type, colName, value));
+  }
+}
+
+//------------------------------------------------------------------------------
+// toString
+//------------------------------------------------------------------------------
+std::string PostgresBinaryFormat::toString(Oid type, std::string_view colName, std::string_view value) {
+  switch (type) {
+    case kBoolOid:
+      if (value.size() != 1) {
+        throw exception::Exception("Column " + std::string(colName) + " has a boolean value of unexpected length "
+                                   + std::to_string(value.size()));
+      }
+      return value[0] ? "t" : "f";
+    case kByteaOid: {
+      // Same as the default bytea_output = 'hex' of the text format
+      static const char hexDigits[] = "0123456789abcdef";
+      std::string hex = "\\x";
+      hex.reserve(2 + 2 * value.size());
+      for (const unsigned char c : value) {
+        hex += hexDigits[c >> 4];
+        hex += hexDigits[c & 0x0f];
+      }
+      return hex;
+    }
+    case kInt2Oid:
+    case kInt4Oid:
+    case kInt8Oid:
+      return std::to_string(readInteger(type, colName, value));
+    case kFloat4Oid:
+    case kFloat8Oid: {
+      const double d = readFloat(type, colName, value);
+      if (std::isnan(d)) {
+        return "NaN";
+      }
+      if (std::isinf(d)) {
+        return d > 0 ? "Infinity" : "-Infinity";
+      }
+      char buf[32];
+      const auto result = kFloat4Oid == type ? std::to_chars(buf, buf + sizeof(buf), static_cast<float>(d)) :
+                                               std::to_chars(buf, buf + sizeof(buf), d);
+      return std::string(buf, result.ptr);
+    }
+    case kNumericOid: {
+      const Numeric numeric = decodeNumeric(colName, value);
+      switch (numeric.sign) {
+        case kNumericNaN:
+          return "NaN";
+        case kNumericPInf:
+          return "Infinity";
+        case kNumericNInf:
+          return "-Infinity";
+        default:
+          break;
+      }
+      const auto digitAt = [&numeric](int i) {
+        return i >= 0 && i < static_cast<int>(numeric.digits.size()) ? numeric.digits[i] : 0;
+      };
+      std::string str = numeric.sign == kNumericNegative ? "-" : "";
+      if (numeric.weight < 0) {
+        str += "0";
+      } else {
+        str += std::to_string(digitAt(0));
+        for (int i = 1; i <= numeric.weight; i++) {
+          const std::string group = std::to_string(digitAt(i));
+          str += std::string(4 - group.size(), '0') + group;
+        }
+      }
+      if (numeric.dscale > 0) {
+        std::string fraction;
+        for (int i = numeric.weight + 1; fraction.size() < numeric.dscale; i++) {
+          const std::string group = std::to_string(digitAt(i));
+          fraction += std::string(4 - group.size(), '0') + group;
+        }
+        str += "." + fraction.substr(0, numeric.dscale);
+      }
+      return str;
+    }
+    default:
+      return std::string(value);
+  }
+}
+
+}  // namespace cta::rdbms::wrapper
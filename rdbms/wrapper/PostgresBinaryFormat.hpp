@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <libpq-fe.h>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+namespace cta::rdbms::wrapper {
+
+/**
+ * Decoding of the values returned by the PostgreSQL server in the binary result format.
+ *
+ * A query executed in binary result format returns integers and doubles in network byte order, NUMERIC values as
+ * base 10000 digits and bytea values as raw bytes, which avoids the text parsing and bytea unescaping done in text
+ * result format. libpq only allows one format for all the columns of a result, so the binary format is only used for
+ * statements whose result columns are all of a type supported here.
+ */
+class PostgresBinaryFormat {
+public:
+  /**
+   * Type OIDs from pg_type.h, which is not part of the libpq client headers
+   */
+  static constexpr Oid kBoolOid = 16;
+  static constexpr Oid kByteaOid = 17;
+  static constexpr Oid kCharOid = 18;
+  static constexpr Oid kNameOid = 19;
+  static constexpr Oid kInt8Oid = 20;
+  static constexpr Oid kInt2Oid = 21;
+  static constexpr Oid kInt4Oid = 23;
+  static constexpr Oid kTextOid = 25;
+  static constexpr Oid kFloat4Oid = 700;
+  static constexpr Oid kFloat8Oid = 701;
+  static constexpr Oid kBpcharOid = 1042;
+  static constexpr Oid kVarcharOid = 1043;
+  static constexpr Oid kNumericOid = 1700;
+
+  /**
+   * @return true if values of the specified type can be decoded from the binary result format
+   */
+  static bool isSupported(Oid type);
+
+  /**
+   * @return true if the binary representation of the specified type is the same as its text representation
+   */
+  static bool isTextLike(Oid type);
+
+  /**
+   * Decodes an unsigned integer.
+   *
+   * @param type The type OID of the column.
+   * @param colName The name of the column, used in error messages.
+   * @param value The binary value.
+   * @return The value.
+   * @throw exception::Mismatch if the value is negative, not an integer or too big for 64 bits.
+   */
+  static uint64_t toUint64(Oid type, std::string_view colName, std::string_view value);
+
+  /**
+   * Decodes a double.
+   *
+   * @param type The type OID of the column.
+   * @param colName The name of the column, used in error messages.
+   * @param value The binary value.
+   * @return The value.
+   */
+  static double toDouble(Oid type, std::string_view colName, std::string_view value);
+
+  /**
+   * Returns the text representation of a value, as the server would have returned it in text result format.
+   *
+   * @param type The type OID of the column.
+   * @param colName The name of the column, used in error messages.
+   * @param value The binary value.
+   * @return The text representation.
+   */
+  static std::string toString(Oid type, std::string_view colName, std::string_view value);
+
+private:
+  /**
+   * The decoded header and digits of a NUMERIC value
+   */
+  struct Numeric;
+
+  /**
+   * Decodes the header and digits of a NUMERIC value
+   */
+  static Numeric decodeNumeric(std::string_view colName, std::string_view value);
+};
+
+}  // namespace cta::rdbms::wrapper
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "rdbms/wrapper/PostgresBinaryFormat.hpp"
+
+#include "common/exception/Exception.hpp"
+#include "common/exception/Mismatch.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <string>
+
+namespace unitTests {
+
+namespace {
+/**
+ * Builds a value in network byte order from a list of 16-bit words
+ */
+std::string words(std::initializer_list<uint16_t> values) {
+  std::string buf;
+  for (const uint16_t value : values) {
+    buf += static_cast<char>(value >> 8);
+    buf += static_cast<char>(value & 0xff);
+  }
+  return buf;
+}
+}  // namespace
+
+class cta_rdbms_wrapper_PostgresBinaryFormatTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {}
+
+  virtual void TearDown() {}
+};
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, integers) {
+  using namespace cta::rdbms::wrapper;
+
+  ASSERT_EQ(258, PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kInt2Oid, "COL", words({0x0102})));
+  ASSERT_EQ(0x01020304, PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kInt4Oid, "COL", words({0x0102, 0x0304})));
+  ASSERT_EQ(0x0102030405060708,
+            PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kInt8Oid, "COL", words({0x0102, 0x0304, 0x0506, 0x0708})));
+  ASSERT_EQ("-1", PostgresBinaryFormat::toString(PostgresBinaryFormat::kInt4Oid, "COL", words({0xffff, 0xffff})));
+  ASSERT_EQ(-2.0, PostgresBinaryFormat::toDouble(PostgresBinaryFormat::kInt2Oid, "COL", words({0xfffe})));
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, negative_integer_is_not_unsigned) {
+  using namespace cta::rdbms::wrapper;
+
+  ASSERT_THROW(PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kInt8Oid, "COL", words({0xffff, 0xffff, 0xffff, 0xffff})),
+               cta::exception::Mismatch);
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, integer_of_wrong_length) {
+  using namespace cta::rdbms::wrapper;
+
+  ASSERT_THROW(PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kInt8Oid, "COL", words({0x0001})),
+               cta::exception::Exception);
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, numeric) {
+  using namespace cta::rdbms::wrapper;
+
+  // 12345678 = 1234 * 10000 + 5678: ndigits=2, weight=1, sign=+, dscale=0
+  const std::string bigInteger = words({2, 1, 0x0000, 0, 1234, 5678});
+  ASSERT_EQ(12345678, PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", bigInteger));
+  ASSERT_EQ("12345678", PostgresBinaryFormat::toString(PostgresBinaryFormat::kNumericOid, "COL", bigInteger));
+
+  // 10000000000000000 = 1 * 10000^4, trailing zero digits are not sent
+  const std::string power = words({1, 4, 0x0000, 0, 1});
+  ASSERT_EQ(10000000000000000, PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", power));
+  ASSERT_EQ("10000000000000000", PostgresBinaryFormat::toString(PostgresBinaryFormat::kNumericOid, "COL", power));
+
+  // 0 has no digit
+  const std::string zero = words({0, 0, 0x0000, 0});
+  ASSERT_EQ(0, PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", zero));
+  ASSERT_EQ("0", PostgresBinaryFormat::toString(PostgresBinaryFormat::kNumericOid, "COL", zero));
+
+  // 12.5 = 12 + 5000 / 10000 with dscale=1
+  const std::string fraction = words({2, 0, 0x0000, 1, 12, 5000});
+  ASSERT_EQ("12.5", PostgresBinaryFormat::toString(PostgresBinaryFormat::kNumericOid, "COL", fraction));
+  ASSERT_EQ(12.5, PostgresBinaryFormat::toDouble(PostgresBinaryFormat::kNumericOid, "COL", fraction));
+  ASSERT_THROW(PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", fraction),
+               cta::exception::Mismatch);
+
+  // -0.0042 = -42 / 10000^1 with dscale=4
+  const std::string negativeFraction = words({1, 0xffff, 0x4000, 4, 42});
+  ASSERT_EQ("-0.0042", PostgresBinaryFormat::toString(PostgresBinaryFormat::kNumericOid, "COL", negativeFraction));
+  ASSERT_THROW(PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", negativeFraction),
+               cta::exception::Mismatch);
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, numeric_too_big_for_uint64) {
+  using namespace cta::rdbms::wrapper;
+
+  // 10000^5 = 10^20 does not fit in 64 bits
+  ASSERT_THROW(PostgresBinaryFormat::toUint64(PostgresBinaryFormat::kNumericOid, "COL", words({1, 5, 0x0000, 0, 1})),
+               cta::exception::Mismatch);
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, bool_and_bytea) {
+  using namespace cta::rdbms::wrapper;
+
+  ASSERT_EQ("t", PostgresBinaryFormat::toString(PostgresBinaryFormat::kBoolOid, "COL", std::string(1, '\1')));
+  ASSERT_EQ("f", PostgresBinaryFormat::toString(PostgresBinaryFormat::kBoolOid, "COL", std::string(1, '\0')));
+  ASSERT_EQ("\\x00ff10", PostgresBinaryFormat::toString(PostgresBinaryFormat::kByteaOid, "COL", std::string("\x00\xff\x10", 3)));
+}
+
+TEST_F(cta_rdbms_wrapper_PostgresBinaryFormatTest, supported_types) {
+  using namespace cta::rdbms::wrapper;
+
+  ASSERT_TRUE(PostgresBinaryFormat::isSupported(PostgresBinaryFormat::kNumericOid));
+  ASSERT_TRUE(PostgresBinaryFormat::isSupported(PostgresBinaryFormat::kVarcharOid));
+  ASSERT_TRUE(PostgresBinaryFormat::isTextLike(PostgresBinaryFormat::kVarcharOid));
+  ASSERT_FALSE(PostgresBinaryFormat::isTextLike(PostgresBinaryFormat::kInt8Oid));
+  // timestamp
+  ASSERT_FALSE(PostgresBinaryFormat::isSupported(1114));
+}
+
+}  // namespace unitTests
@@ -5,6 +5,7 @@
 
 #include "rdbms/wrapper/PostgresConn.hpp"
 
+#include "common/exception/Errnum.hpp"
 #include "common/exception/Exception.hpp"
 #include "common/exception/LostDatabaseConnection.hpp"
 #include "common/process/threading/RWLockRdLocker.hpp"
@@ -13,7 +14,9 @@
 #include "rdbms/Conn.hpp"
 #include "rdbms/wrapper/PostgresStmt.hpp"
 
+#include <errno.h>
 #include <exception>
+#include <poll.h>
 #include <sstream>
 #include <stdio.h>
 
@@ -533,4 +536,53 @@ std::string PostgresConn::getDbNamespace() const {
   return m_dbNamespace;
 }
 
+//------------------------------------------------------------------------------
+// waitForNotifications
+//------------------------------------------------------------------------------
+std::list<std::string> PostgresConn::waitForNotifications(const uint32_t timeoutMs) {
+  threading::RWLockWrLocker locker(m_lock);
+
+  if (!isOpenAssumeLocked()) {
+    throw exception::Exception("Connection is closed");
+  }
+
+  if (isAsyncInProgress()) {
+    throw exception::Exception("can not wait for notifications, another query is in progress");
+  }
+
+  std::list<std::string> payloads;
+  consumeNotificationsAssumeLocked(payloads);
+  if (!payloads.empty()) {
+    return payloads;
+  }
+
+  pollfd pfd {PQsocket(m_pgsqlConn), POLLIN, 0};
+  const int rc = ::poll(&pfd, 1, static_cast<int>(timeoutMs));
+  if (rc < 0 && EINTR != errno) {
+    throw exception::Errnum("In PostgresConn::waitForNotifications(): failed to poll(): ");
+  }
+  if (rc > 0) {
+    consumeNotificationsAssumeLocked(payloads);
+  }
+  return payloads;
+}
+
+//------------------------------------------------------------------------------
+// consumeNotificationsAssumeLocked
+//------------------------------------------------------------------------------
+void PostgresConn::consumeNotificationsAssumeLocked(std::list<std::string>& payloads) {
+  if (0 == PQconsumeInput(m_pgsqlConn)) {
+    std::string msg = "Failed to read notifications";
+    if (const char* const pgMsg = PQerrorMessage(m_pgsqlConn); nullptr != pgMsg) {
+      msg += std::string(": ") + pgMsg;
+    }
+    closeAssumeLocked();
+    throw exception::LostDatabaseConnection(msg);
+  }
+  while (PGnotify* const notify = PQnotifies(m_pgsqlConn)) {
+    payloads.emplace_back(nullptr != notify->extra ? notify->extra : "");
+    PQfreemem(notify);
+  }
+}
+
 }  // namespace cta::rdbms::wrapper
@@ -203,7 +203,26 @@ public:
 
   std::string getDbNamespace() const override;
 
+  /**
+   * Waits for the notifications sent by the NOTIFY command on the channels
+   * this connection is listening to.
+   *
+   * @param timeoutMs The maximum time to wait in milliseconds.
+   * @return The payloads of the notifications received, which is empty if the
+   * timeout expired before any notification was received.
+   */
+  std::list<std::string> waitForNotifications(const uint32_t timeoutMs) override;
+
 private:
+  /**
+   * Reads the data available on the socket of the connection and moves the
+   * payloads of the notifications received to the specified list.
+   * Assumes the connection is wr locked.
+   *
+   * @param payloads The list to which the payloads are appended.
+   */
+  void consumeNotificationsAssumeLocked(std::list<std::string>& payloads);
+
   /**
    * Closes the conneciton, freeing the underlying libpq conneciton.
    * Used by the public close() mehtod, without locking.
@@ -11,6 +11,7 @@
 #include "common/process/threading/RWLockWrLocker.hpp"
 #include "common/utils/utils.hpp"
 #include "rdbms/NullDbValue.hpp"
+#include "rdbms/wrapper/PostgresBinaryFormat.hpp"
 #include "rdbms/wrapper/PostgresConn.hpp"
 #include "rdbms/wrapper/PostgresStmt.hpp"
 
@@ -22,10 +23,14 @@ namespace cta::rdbms::wrapper {
 //------------------------------------------------------------------------------
 // constructor
 //------------------------------------------------------------------------------
-PostgresRset::PostgresRset(PostgresConn& conn, PostgresStmt& stmt, std::unique_ptr<Postgres::ResultItr> resItr)
+PostgresRset::PostgresRset(PostgresConn& conn,
+                           PostgresStmt& stmt,
+                           std::unique_ptr<Postgres::ResultItr> resItr,
+                           std::shared_ptr<const PostgresStmt::ResultLayout> layout)
     : m_conn(conn),
       m_stmt(stmt),
-      m_resItr(std::move(resItr)) {
+      m_resItr(std::move(resItr)),
+      m_layout(std::move(layout)) {
   // assumes statement and connection locks have already been taken
   if (!m_conn.isAsyncInProgress()) {
     throw exception::Exception("Async flag not set");
@@ -47,13 +52,19 @@ PostgresRset::~PostgresRset() {
 }
 
 //------------------------------------------------------------------------------
-// getting column index using a local cache to avoid looking up index
-// for every column for each row of the Rset whenever we loop over the result
+// getting column index using the indices computed once per statement, or else
+// a local cache to avoid looking up index for every column for each row of the
+// Rset whenever we loop over the result
 //------------------------------------------------------------------------------
 int PostgresRset::getColumnIndex(const std::string& colName) const {
   if (nullptr == m_resItr->get()) {
     throw exception::NoSuchObject("No row available");
   }
+  if (m_layout) {
+    if (auto it = m_layout->columnIndices.find(colName); it != m_layout->columnIndices.end()) {
+      return it->second;
+    }
+  }
   if (auto it = m_columnPQindexCache.find(colName); it != m_columnPQindexCache.end()) {
     return it->second;
   }
@@ -63,6 +74,64 @@ int PostgresRset::getColumnIndex(const std::string& colName) const {
   return idx;
 }
 
+//------------------------------------------------------------------------------
+// getNonNullColumnIndex
+//------------------------------------------------------------------------------
+int PostgresRset::getNonNullColumnIndex(const std::string& colName) const {
+  const int ifield = getColumnIndex(colName);
+  if (ifield < 0) {
+    throw exception::NoSuchObject("Column does not exist: " + colName);
+  }
+  if (isPGColumnNull(ifield)) {
+    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
+  }
+  return ifield;
+}
+
+//------------------------------------------------------------------------------
+// getRawValue
+//------------------------------------------------------------------------------
+std::string_view PostgresRset::getRawValue(const int ifield) const {
+  return std::string_view(PQgetvalue(m_resItr->get(), m_row, ifield), PQgetlength(m_resItr->get(), m_row, ifield));
+}
+
+//------------------------------------------------------------------------------
+// isBinaryColumn
+//------------------------------------------------------------------------------
+bool PostgresRset::isBinaryColumn(const int ifield) const {
+  return 1 == PQfformat(m_resItr->get(), ifield) && !PostgresBinaryFormat::isTextLike(PQftype(m_resItr->get(), ifield));
+}
+
+//------------------------------------------------------------------------------
+// getStringValue
+//------------------------------------------------------------------------------
+std::string PostgresRset::getStringValue(std::string_view colName, const int ifield) const {
+  if (isBinaryColumn(ifield)) {
+    return PostgresBinaryFormat::toString(PQftype(m_resItr->get(), ifield), colName, getRawValue(ifield));
+  }
+  return std::string(getRawValue(ifield));
+}
+
+//------------------------------------------------------------------------------
+// getUint64Value
+//------------------------------------------------------------------------------
+uint64_t PostgresRset::getUint64Value(std::string_view colName, const int ifield) const {
+  if (isBinaryColumn(ifield)) {
+    return PostgresBinaryFormat::toUint64(PQftype(m_resItr->get(), ifield), colName, getRawValue(ifield));
+  }
+  return utils::toUint64(getRawValue(ifield));
+}
+
+//------------------------------------------------------------------------------
+// getDoubleValue
+//------------------------------------------------------------------------------
+double PostgresRset::getDoubleValue(std::string_view colName, const int ifield) const {
+  if (isBinaryColumn(ifield)) {
+    return PostgresBinaryFormat::toDouble(PQftype(m_resItr->get(), ifield), colName, getRawValue(ifield));
+  }
+  return utils::toDouble(getRawValue(ifield));
+}
+
 //------------------------------------------------------------------------------
 // columnIsNull
 //------------------------------------------------------------------------------
@@ -78,7 +147,7 @@ bool PostgresRset::columnIsNull(const std::string& colName) const {
 // isPGColumnNull
 //------------------------------------------------------------------------------
 bool PostgresRset::isPGColumnNull(int ifield) const {
-  return PQgetisnull(m_resItr->get(), 0, ifield);
+  return PQgetisnull(m_resItr->get(), m_row, ifield);
 }
 
 std::string PostgresRset::columnBlob(const std::string& colName) const {
@@ -92,11 +161,17 @@ std::unique_ptr<rdbms::wrapper::IBlobView> PostgresRset::columnBlobView(const st
   if (ifield < 0) {
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::make_unique<BlobView>(nullptr, 0);
   }
 
-  const char* raw_blob_ptr = PQgetvalue(m_resItr->get(), 0, ifield);
+  if (isBinaryColumn(ifield)) {
+    // The bytes are not escaped in binary format: no need to decode nor to copy them
+    const std::string_view rawValue = getRawValue(ifield);
+    return BlobView::borrow(reinterpret_cast<const unsigned char*>(rawValue.data()), rawValue.size());
+  }
+
+  const char* raw_blob_ptr = PQgetvalue(m_resItr->get(), m_row, ifield);
   size_t blob_len = 0;
   unsigned char* blob_ptr = PQunescapeBytea(reinterpret_cast<const unsigned char*>(raw_blob_ptr), &blob_len);
 
@@ -119,67 +194,41 @@ bool PostgresRset::columnBoolNoOpt(const std::string& colName) const {
 }
 
 std::string PostgresRset::columnStringNoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
-  }
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
-  }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-
-  return std::string(cstrValue, PQgetlength(m_resItr->get(), 0, ifield));
+  const int ifield = getNonNullColumnIndex(colName);
+  return getStringValue(colName, ifield);
 }
 
 //------------------------------------------------------------------------------
 // Get uint8_t value from a column with error handling
 //------------------------------------------------------------------------------
 uint8_t PostgresRset::columnUint8NoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
+  const int ifield = getNonNullColumnIndex(colName);
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint8_t>(colName, ifield);
   }
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
-  }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-  return utils::toUint8(std::string_view(cstrValue, PQgetlength(m_resItr->get(), 0, ifield)));
+  return utils::toUint8(getRawValue(ifield));
 }
 
 //------------------------------------------------------------------------------
 // Get uint16_t value from a column with error handling
 //------------------------------------------------------------------------------
 uint16_t PostgresRset::columnUint16NoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
+  const int ifield = getNonNullColumnIndex(colName);
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint16_t>(colName, ifield);
   }
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
-  }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-
-  return utils::toUint16(std::string_view(cstrValue, PQgetlength(m_resItr->get(), 0, ifield)));
+  return utils::toUint16(getRawValue(ifield));
 }
 
 //------------------------------------------------------------------------------
 // Get uint32_t value from a column with error handling
 //------------------------------------------------------------------------------
 uint32_t PostgresRset::columnUint32NoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
-  }
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
+  const int ifield = getNonNullColumnIndex(colName);
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint32_t>(colName, ifield);
   }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-
-  return utils::toUint32(std::string_view(cstrValue, PQgetlength(m_resItr->get(), 0, ifield)));
+  return utils::toUint32(getRawValue(ifield));
 }
 
 //------------------------------------------------------------------------------
@@ -200,36 +249,16 @@ bool PostgresRset::columnExists(const std::string& colName) const {
 // Get uint64_t value from a column with error handling
 //------------------------------------------------------------------------------
 uint64_t PostgresRset::columnUint64NoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
-  }
-
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
-  }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-
-  return utils::toUint64(std::string_view(cstrValue, PQgetlength(m_resItr->get(), 0, ifield)));
+  const int ifield = getNonNullColumnIndex(colName);
+  return getUint64Value(colName, ifield);
 }
 
 //------------------------------------------------------------------------------
 // Get double value from a column with error handling
 //------------------------------------------------------------------------------
 double PostgresRset::columnDoubleNoOpt(const std::string& colName) const {
-  const int ifield = getColumnIndex(colName);
-  if (ifield < 0) {
-    throw exception::NoSuchObject("Column does not exist: " + colName);
-  }
-
-  if (isPGColumnNull(ifield)) {
-    throw NullDbValue(std::string("Database column ") + colName + " contains a null value");
-  }
-
-  const char* cstrValue = PQgetvalue(m_resItr->get(), 0, ifield);
-
-  return utils::toDouble(std::string_view(cstrValue, PQgetlength(m_resItr->get(), 0, ifield)));
+  const int ifield = getNonNullColumnIndex(colName);
+  return getDoubleValue(colName, ifield);
 }
 
 //------------------------------------------------------------------------------
@@ -241,14 +270,11 @@ std::optional<std::string> PostgresRset::columnOptionalString(const std::string&
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
-  const char* value = PQgetvalue(m_resItr->get(), 0, ifield);
-  int length = PQgetlength(m_resItr->get(), 0, ifield);
-
   // Construct std::string directly from PG buffer without intermediate copy
-  return std::make_optional<std::string>(value, length);
+  return getStringValue(colName, ifield);
 }
 
 //------------------------------------------------------------------------------
@@ -260,11 +286,14 @@ std::optional<uint8_t> PostgresRset::columnOptionalUint8(const std::string& colN
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint8_t>(colName, ifield);
+  }
 
-  return utils::toUint8(PQgetvalue(m_resItr->get(), 0, ifield));
+  return utils::toUint8(getRawValue(ifield));
 }
 
 //------------------------------------------------------------------------------
@@ -276,11 +305,14 @@ std::optional<uint16_t> PostgresRset::columnOptionalUint16(const std::string& co
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint16_t>(colName, ifield);
+  }
 
-  const std::string stringValue(PQgetvalue(m_resItr->get(), 0, ifield));
+  const std::string stringValue(getRawValue(ifield));
 
   if (!utils::isValidUInt(stringValue)) {
     throw exception::Mismatch(std::string("Column ") + colName + " contains the value " + stringValue
@@ -299,11 +331,14 @@ std::optional<uint32_t> PostgresRset::columnOptionalUint32(const std::string& co
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
+  if (isBinaryColumn(ifield)) {
+    return getNarrowUintValue<uint32_t>(colName, ifield);
+  }
 
-  const std::string stringValue(PQgetvalue(m_resItr->get(), 0, ifield));
+  const std::string stringValue(getRawValue(ifield));
 
   if (!utils::isValidUInt(stringValue)) {
     throw exception::Mismatch(std::string("Column ") + colName + " contains the value " + stringValue
@@ -322,11 +357,14 @@ std::optional<uint64_t> PostgresRset::columnOptionalUint64(const std::string& co
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
+  if (isBinaryColumn(ifield)) {
+    return getUint64Value(colName, ifield);
+  }
 
-  const std::string stringValue(PQgetvalue(m_resItr->get(), 0, ifield));
+  const std::string stringValue(getRawValue(ifield));
 
   if (!utils::isValidUInt(stringValue)) {
     throw exception::Mismatch(std::string("Column ") + colName + " contains the value " + stringValue
@@ -345,11 +383,14 @@ std::optional<double> PostgresRset::columnOptionalDouble(const std::string& colN
     throw exception::NoSuchObject("Column does not exist: " + colName);
   }
   // the value can be null
-  if (PQgetisnull(m_resItr->get(), 0, ifield)) {
+  if (isPGColumnNull(ifield)) {
     return std::nullopt;
   }
+  if (isBinaryColumn(ifield)) {
+    return getDoubleValue(colName, ifield);
+  }
 
-  const std::string stringValue(PQgetvalue(m_resItr->get(), 0, ifield));
+  const std::string stringValue(getRawValue(ifield));
 
   if (!utils::isValidDecimal(stringValue)) {
     throw exception::Mismatch(std::string("Column ") + colName + " contains the value " + stringValue
@@ -359,6 +400,105 @@ std::optional<double> PostgresRset::columnOptionalDouble(const std::string& colN
   return utils::toDouble(stringValue);
 }
 
+//------------------------------------------------------------------------------
+// columnIndex
+//------------------------------------------------------------------------------
+int PostgresRset::columnIndex(const std::string& colName) const {
+  return getColumnIndex(colName);
+}
+
+//------------------------------------------------------------------------------
+// getColumnName
+//------------------------------------------------------------------------------
+std::string_view PostgresRset::getColumnName(const int ifield) const {
+  const char* const colName = PQfname(m_resItr->get(), ifield);
+  if (nullptr == colName) {
+    throw exception::NoSuchObject("Column does not exist: index " + std::to_string(ifield));
+  }
+  return colName;
+}
+
+//------------------------------------------------------------------------------
+// columnIsNullAt
+//------------------------------------------------------------------------------
+bool PostgresRset::columnIsNullAt(const int colIdx) const {
+  return isPGColumnNull(colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnBlobAt
+//------------------------------------------------------------------------------
+std::string PostgresRset::columnBlobAt(const int colIdx) const {
+  auto blob_view = columnBlobViewAt(colIdx);
+  return std::string(reinterpret_cast<const char*>(blob_view->data()), blob_view->size());
+}
+
+//------------------------------------------------------------------------------
+// columnBlobViewAt
+//------------------------------------------------------------------------------
+std::unique_ptr<rdbms::wrapper::IBlobView> PostgresRset::columnBlobViewAt(const int colIdx) const {
+  if (isPGColumnNull(colIdx)) {
+    return std::make_unique<BlobView>(nullptr, 0);
+  }
+  if (isBinaryColumn(colIdx)) {
+    const std::string_view rawValue = getRawValue(colIdx);
+    return BlobView::borrow(reinterpret_cast<const unsigned char*>(rawValue.data()), rawValue.size());
+  }
+  size_t blob_len = 0;
+  unsigned char* blob_ptr =
+    PQunescapeBytea(reinterpret_cast<const unsigned char*>(PQgetvalue(m_resItr->get(), m_row, colIdx)), &blob_len);
+  if (!blob_ptr) {
+    throw NullDbValue("Failed to fetch a value for existing database column: " + std::string(getColumnName(colIdx)));
+  }
+  return std::make_unique<BlobView>(blob_ptr, blob_len);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalStringAt
+//------------------------------------------------------------------------------
+std::optional<std::string> PostgresRset::columnOptionalStringAt(const int colIdx) const {
+  if (isPGColumnNull(colIdx)) {
+    return std::nullopt;
+  }
+  return getStringValue(getColumnName(colIdx), colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalUint64At
+//------------------------------------------------------------------------------
+std::optional<uint64_t> PostgresRset::columnOptionalUint64At(const int colIdx) const {
+  if (isPGColumnNull(colIdx)) {
+    return std::nullopt;
+  }
+  if (isBinaryColumn(colIdx)) {
+    return getUint64Value(getColumnName(colIdx), colIdx);
+  }
+  const std::string_view stringValue = getRawValue(colIdx);
+  if (!utils::isValidUInt(stringValue)) {
+    throw exception::Mismatch("Column " + std::string(getColumnName(colIdx)) + " contains the value "
+                              + std::string(stringValue) + " which is not a valid unsigned integer");
+  }
+  return utils::toUint64(stringValue);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalDoubleAt
+//------------------------------------------------------------------------------
+std::optional<double> PostgresRset::columnOptionalDoubleAt(const int colIdx) const {
+  if (isPGColumnNull(colIdx)) {
+    return std::nullopt;
+  }
+  if (isBinaryColumn(colIdx)) {
+    return getDoubleValue(getColumnName(colIdx), colIdx);
+  }
+  const std::string_view stringValue = getRawValue(colIdx);
+  if (!utils::isValidDecimal(stringValue)) {
+    throw exception::Mismatch("Column " + std::string(getColumnName(colIdx)) + " contains the value "
+                              + std::string(stringValue) + " which is not a valid decimal");
+  }
+  return utils::toDouble(stringValue);
+}
+
 //------------------------------------------------------------------------------
 // getSql
 //------------------------------------------------------------------------------
@@ -374,9 +514,18 @@ bool PostgresRset::next() {
   threading::RWLockWrLocker locker2(m_stmt.m_lock);
   threading::RWLockWrLocker locker(m_conn.m_lock);
 
+  // Move to the next row of the current chunk of rows, if any
+  if (nullptr != m_resItr->get() && isRowsResult(m_resItr->rcode()) && m_row + 1 < PQntuples(m_resItr->get())) {
+    ++m_row;
+    ++m_nfetched;
+    m_stmt.setAffectedRows(m_nfetched);
+    return true;
+  }
+
   if (m_resItr->next()) {
     // For queries expect rcode PGRES_SINGLE_TUPLE with ntuples=1 for each row,
-    // followed by PGRES_TUPLES_OK and ntuples=0 at the end.
+    // or PGRES_TUPLES_CHUNK with up to PostgresStmt::kResultChunkSize rows in
+    // chunked rows mode, followed by PGRES_TUPLES_OK and ntuples=0 at the end.
     // A non query would give PGRES_COMMAND_OK but we don't accept this here
     // as a Rset is intended for an executeQuery only.
 
@@ -388,7 +537,8 @@ bool PostgresRset::next() {
       doClearAsync();
       return false;
     }
-    if (PGRES_SINGLE_TUPLE == m_resItr->rcode() && 1 == PQntuples(m_resItr->get())) {
+    if (isRowsResult(m_resItr->rcode()) && 0 < PQntuples(m_resItr->get())) {
+      m_row = 0;
       ++m_nfetched;
       m_stmt.setAffectedRows(m_nfetched);
       return true;
@@ -402,6 +552,18 @@ bool PostgresRset::next() {
   return false;
 }
 
+//------------------------------------------------------------------------------
+// isRowsResult
+//------------------------------------------------------------------------------
+bool PostgresRset::isRowsResult(const ExecStatusType rcode) {
+#ifdef LIBPQ_HAS_CHUNK_MODE
+  if (PGRES_TUPLES_CHUNK == rcode) {
+    return true;
+  }
+#endif
+  return PGRES_SINGLE_TUPLE == rcode;
+}
+
 //------------------------------------------------------------------------------
 // doClearAsync
 //------------------------------------------------------------------------------
@@ -5,17 +5,20 @@
 
 #pragma once
 
+#include "common/exception/Exception.hpp"
 #include "rdbms/wrapper/Postgres.hpp"
 #include "rdbms/wrapper/PostgresConn.hpp"
 #include "rdbms/wrapper/PostgresStmt.hpp"
 #include "rdbms/wrapper/RsetWrapper.hpp"
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace cta::rdbms::wrapper {
@@ -31,8 +34,12 @@ public:
    * @param conn The Conn
    * @param stmt The prepared statement.
    * @param res The result set.
+   * @param layout The layout of the result of the statement.
    */
-  PostgresRset(PostgresConn& conn, PostgresStmt& stmt, std::unique_ptr<Postgres::ResultItr> resitr);
+  PostgresRset(PostgresConn& conn,
+               PostgresStmt& stmt,
+               std::unique_ptr<Postgres::ResultItr> resitr,
+               std::shared_ptr<const PostgresStmt::ResultLayout> layout);
 
   /**
    * Destructor.
@@ -64,6 +71,17 @@ public:
   public:
     BlobView(unsigned char* ptr, std::size_t size) : m_data(ptr), m_size(size), m_guard(ptr, &PQfreemem) {}
 
+    /**
+     * Returns a view over a bytea value fetched in binary format. The data is owned by the libpq result and is only
+     * valid until the next call to PostgresRset::next().
+     */
+    static std::unique_ptr<BlobView> borrow(const unsigned char* ptr, std::size_t size) {
+      auto view = std::make_unique<BlobView>(nullptr, 0);
+      view->m_data = ptr;
+      view->m_size = size;
+      return view;
+    }
+
     // Explicitly delete copy constructor and copy assignment
     // (despite already implicitly done for unique pointer)
     BlobView(const BlobView&) = delete;
@@ -134,9 +152,10 @@ public:
   * The view provides access to the data via a pointer and size, and the underlying memory
   * remains valid as long as the `BlobView` instance is alive.
   *
-  * Note: This method allocates memory using `PQunescapeBytea`, which is automatically
-  * freed when the returned `BlobView` is destroyed. This is not a non-owning view;
-  * ownership of the decoded buffer is transferred to the `BlobView`.
+  * Note: In text result format, this method allocates memory using `PQunescapeBytea`, which is
+  * automatically freed when the returned `BlobView` is destroyed. In binary result format the
+  * bytes are not escaped: the `BlobView` points into the current libpq result and is only valid
+  * until the next call to next().
   *
   * @param colName The name of the column containing the BLOB data.
   * @return A `BlobView` object managing the decoded binary data and its size.
@@ -267,6 +286,17 @@ public:
    */
   std::optional<double> columnOptionalDouble(const std::string& colName) const override;
 
+  /**
+   * Index-based accessors, see RsetWrapper::columnIndex().
+   */
+  int columnIndex(const std::string& colName) const override;
+  bool columnIsNullAt(const int colIdx) const override;
+  std::string columnBlobAt(const int colIdx) const override;
+  std::unique_ptr<rdbms::wrapper::IBlobView> columnBlobViewAt(const int colIdx) const override;
+  std::optional<std::string> columnOptionalStringAt(const int colIdx) const override;
+  std::optional<uint64_t> columnOptionalUint64At(const int colIdx) const override;
+  std::optional<double> columnOptionalDoubleAt(const int colIdx) const override;
+
   /**
    * Returns the SQL statement.
    *
@@ -292,6 +322,51 @@ private:
    */
   int getColumnIndex(const std::string& colName) const;
 
+  /**
+   * Returns the index of a column which must exist and not be null in the current row
+   *
+   * @param colName
+   * @return index of the column
+   * @throw NoSuchObject if the column does not exist
+   * @throw NullDbValue if the column is null
+   */
+  int getNonNullColumnIndex(const std::string& colName) const;
+
+  /**
+   * @return the name of a column as returned by the server, for error messages
+   */
+  std::string_view getColumnName(const int ifield) const;
+
+  /**
+   * @return the raw value of a column of the current row
+   */
+  std::string_view getRawValue(const int ifield) const;
+
+  /**
+   * @return true if the value of the column needs to be decoded by PostgresBinaryFormat
+   */
+  bool isBinaryColumn(const int ifield) const;
+
+  /**
+   * Conversions of the value of a non-null column of the current row, in text or binary format
+   */
+  std::string getStringValue(std::string_view colName, const int ifield) const;
+  uint64_t getUint64Value(std::string_view colName, const int ifield) const;
+  double getDoubleValue(std::string_view colName, const int ifield) const;
+
+  /**
+   * Converts the value of a non-null column of the current row to a narrower unsigned integer type
+   */
+  template<typename UintType>
+  UintType getNarrowUintValue(std::string_view colName, const int ifield) const {
+    const uint64_t value = getUint64Value(colName, ifield);
+    if (value > std::numeric_limits<UintType>::max()) {
+      throw exception::Exception("Column " + std::string(colName) + " contains the value " + std::to_string(value)
+                                 + " which is out of range");
+    }
+    return static_cast<UintType>(value);
+  }
+
   /**
    * Template method that converts a string to a required numeric type
    * not used at the moment - might be good replacement in the future
@@ -323,6 +398,12 @@ private:
    * if we haven't done so already.
    */
   void doClearAsync();
+
+  /**
+   * @return true if the result code is the one of a result holding rows of a query
+   */
+  static bool isRowsResult(const ExecStatusType rcode);
+
   /**
    * column index cache
    */
@@ -342,6 +423,17 @@ private:
    */
   std::unique_ptr<Postgres::ResultItr> m_resItr;
 
+  /**
+   * The layout of the result, shared by all the executions of the statement
+   */
+  std::shared_ptr<const PostgresStmt::ResultLayout> m_layout;
+
+  /**
+   * The index of the current row within the current libpq result, which holds a single row in single row mode or up
+   * to PostgresStmt::kResultChunkSize rows in chunked rows mode
+   */
+  int m_row = 0;
+
   /**
    * Indicates we have cleared the async in progress flag of the conneciton.
    * This is to make sure we don't clear it more than once
@@ -10,6 +10,7 @@
 #include "common/process/threading/RWLockRdLocker.hpp"
 #include "common/semconv/Attributes.hpp"
 #include "common/utils/utils.hpp"
+#include "rdbms/wrapper/PostgresBinaryFormat.hpp"
 #include "rdbms/wrapper/PostgresColumn.hpp"
 #include "rdbms/wrapper/PostgresConn.hpp"
 #include "rdbms/wrapper/PostgresRset.hpp"
@@ -364,9 +365,17 @@ std::unique_ptr<RsetWrapper> PostgresStmt::executeQuery() {
     if (m_stmt.empty()) {
       doPrepare();
     }
+    if (!m_resultLayout) {
+      doDescribe();
+    }
 
-    doPQsendPrepared();
+    doPQsendPrepared(m_resultLayout->resultFormat);
+#ifdef LIBPQ_HAS_CHUNK_MODE
+    // Up to kResultChunkSize rows per PGresult instead of one PGresult per row
+    const int iret = PQsetChunkedRowsMode(m_conn.get(), kResultChunkSize);
+#else
     const int iret = PQsetSingleRowMode(m_conn.get());
+#endif
     auto resItr = std::make_unique<Postgres::ResultItr>(m_conn.get());
 
     if (1 != iret) {
@@ -376,7 +385,7 @@ std::unique_ptr<RsetWrapper> PostgresStmt::executeQuery() {
     m_nbAffectedRows = 0;
     m_conn.setAsyncInProgress(true);
 
-    return std::make_unique<PostgresRset>(m_conn, *this, std::move(resItr));
+    return std::make_unique<PostgresRset>(m_conn, *this, std::move(resItr), m_resultLayout);
   } catch (exception::LostDatabaseConnection& ex) {
     // reset to initial value
     m_conn.setAsyncInProgress(isasync);
@@ -444,6 +453,7 @@ void PostgresStmt::closeAssumeLocked() {
     clearAssumeLocked();
     const std::string stmt = m_stmt;
     m_stmt.clear();
+    m_resultLayout.reset();
     m_conn.deallocateStmt(stmt);
 
   } catch (exception::Exception& ex) {
@@ -501,7 +511,7 @@ void PostgresStmt::CountAndReformatSqlBinds(const std::string& common_sql, std::
 //------------------------------------------------------------------------------
 // doPQsendPrepared
 //------------------------------------------------------------------------------
-void PostgresStmt::doPQsendPrepared() {
+void PostgresStmt::doPQsendPrepared(const int resultFormat) {
   // assumes the connection and statement locks have been taken
 
   const char** params = nullptr;
@@ -509,7 +519,8 @@ void PostgresStmt::doPQsendPrepared() {
     params = &m_paramValuesPtrs[0];
   }
 
-  const int iret = PQsendQueryPrepared(m_conn.get(), m_stmt.c_str(), m_nParams, params, nullptr, nullptr, 0);
+  const int iret =
+    PQsendQueryPrepared(m_conn.get(), m_stmt.c_str(), m_nParams, params, nullptr, nullptr, resultFormat);
   if (1 != iret) {
     throwDB(nullptr, "Executing a prepared statement");
   }
@@ -571,6 +582,29 @@ void PostgresStmt::doPrepare() {
   m_stmt = stmtName;
 }
 
+//------------------------------------------------------------------------------
+// doDescribe
+//------------------------------------------------------------------------------
+void PostgresStmt::doDescribe() {
+  // assumes the connection object is aleady rw locked, and open and not in async
+
+  Postgres::Result res(PQdescribePrepared(m_conn.get(), m_stmt.c_str()));
+  throwDBIfNotStatus(res.get(), PGRES_COMMAND_OK, "Describing a statement");
+
+  auto layout = std::make_shared<ResultLayout>();
+  const int nfields = PQnfields(res.get());
+  bool allColumnsBinary = nfields > 0;
+  for (int i = 0; i < nfields; ++i) {
+    std::string colName = PQfname(res.get(), i);
+    utils::toUpper(colName);
+    // Like PQfnumber(), the first column with a given name wins
+    layout->columnIndices.try_emplace(colName, i);
+    allColumnsBinary = allColumnsBinary && PostgresBinaryFormat::isSupported(PQftype(res.get(), i));
+  }
+  layout->resultFormat = allColumnsBinary ? 1 : 0;
+  m_resultLayout = std::move(layout);
+}
+
 //------------------------------------------------------------------------------
 // replaceAll
 //------------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace cta::rdbms::wrapper {
@@ -233,8 +234,15 @@ private:
 
   /**
    * Starts async execution of prepared tatement on the postgres connection.
+   *
+   * @param resultFormat 0 to obtain the results in text format, 1 for binary format.
+   */
+  void doPQsendPrepared(const int resultFormat = 0);
+
+  /**
+   * Asks the server for the result columns of the prepared statement and sets m_resultLayout.
    */
-  void doPQsendPrepared();
+  void doDescribe();
 
   /**
    * Sends the statement's SQL to the server along with a statement name to be created.
@@ -272,6 +280,27 @@ private:
    */
   void throwDBIfNotStatus(const PGresult* res, const ExecStatusType requiredStatus, const std::string& prefix);
 
+  /**
+   * The layout of the result of a query, which is the same for every execution of the prepared statement.
+   */
+  struct ResultLayout {
+    /**
+     * 1 if all the result columns have a type decoded by PostgresBinaryFormat, in which case the results are
+     * fetched in binary format, else 0 for text format.
+     */
+    int resultFormat = 0;
+
+    /**
+     * Index of each result column, keyed by upper case column name.
+     */
+    std::unordered_map<std::string, int> columnIndices;
+  };
+
+  /**
+   * The number of rows fetched at once by a query when libpq supports the chunked rows mode.
+   */
+  static constexpr int kResultChunkSize = 1000;
+
   /**
    * Lock used to serialize access to the prepared statement and properies.
    */
@@ -297,6 +326,12 @@ private:
    */
   int m_nParams = 0;
 
+  /**
+   * The layout of the result of the prepared statement, determined the first time it is executed as a query.
+   * Shared with the result sets, which may outlive a re-preparation of the statement.
+   */
+  std::shared_ptr<const ResultLayout> m_resultLayout;
+
   /**
    * Used as an array of characeter pointers to C-string needed by libpq
    * to supply paramters on execution of a prepared statement.
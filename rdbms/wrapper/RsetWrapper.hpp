@@ -153,6 +153,31 @@ public:
    */
   virtual std::optional<double> columnOptionalDouble(const std::string& colName) const = 0;
 
+  /**
+   * Returns the index of the specified column, to be passed to the index-based
+   * accessors below.  The index is the same for all the rows of the result set
+   * and only has a meaning for this result set.
+   *
+   * This method must be called after next() has retrieved a row.
+   *
+   * @param colName The name of the column.
+   * @return The index of the column or -1 if there is no such column.
+   */
+  virtual int columnIndex(const std::string& colName) const = 0;
+
+  /**
+   * Index-based versions of the accessors above, avoiding a look up of the
+   * column name for each column of each row.
+   *
+   * @param colIdx The index of the column as returned by columnIndex().
+   */
+  virtual bool columnIsNullAt(const int colIdx) const = 0;
+  virtual std::string columnBlobAt(const int colIdx) const = 0;
+  virtual std::unique_ptr<rdbms::wrapper::IBlobView> columnBlobViewAt(const int colIdx) const = 0;
+  virtual std::optional<std::string> columnOptionalStringAt(const int colIdx) const = 0;
+  virtual std::optional<uint64_t> columnOptionalUint64At(const int colIdx) const = 0;
+  virtual std::optional<double> columnOptionalDoubleAt(const int colIdx) const = 0;
+
 };  // class RsetWrapper
 
 }  // namespace cta::rdbms::wrapper
@@ -133,18 +133,20 @@ bool SqliteRset::next() {
   }
 
   if (SQLITE_ROW == stepRc) {
-    clearAndPopulateColNameToIdxAndTypeMap();
+    // The names of the columns are the same for all the rows
+    if (m_colNameToIdx.empty()) {
+      populateColNameToIdxMap();
+    }
+    storeColTypes();
   }
 
   return SQLITE_ROW == stepRc;
 }
 
 //------------------------------------------------------------------------------
-// clearAndPopulateColNameToIdxMap
+// populateColNameToIdxMap
 //------------------------------------------------------------------------------
-void SqliteRset::clearAndPopulateColNameToIdxAndTypeMap() {
-  m_colNameToIdxAndType.clear();
-
+void SqliteRset::populateColNameToIdxMap() {
   const int nbCols = sqlite3_column_count(m_stmt.get());
   for (int i = 0; i < nbCols; i++) {
     // Get the name of the column
@@ -155,22 +157,39 @@ void SqliteRset::clearAndPopulateColNameToIdxAndTypeMap() {
       throw exception::Exception(msg.str());
     }
 
-    // Get the type of the column
-    ColumnNameToIdxAndType::IdxAndType idxAndType;
-    idxAndType.colIdx = i;
-    idxAndType.colType = sqlite3_column_type(m_stmt.get(), i);
+    // Add the mapping from column name to index
+    m_colNameToIdx.add(colName, i);
+  }
+}
 
-    // Add the mapping from column name to index and type
-    m_colNameToIdxAndType.add(colName, idxAndType);
+//------------------------------------------------------------------------------
+// storeColTypes
+//------------------------------------------------------------------------------
+void SqliteRset::storeColTypes() {
+  const int nbCols = sqlite3_column_count(m_stmt.get());
+  m_colTypes.resize(nbCols);
+  for (int i = 0; i < nbCols; i++) {
+    m_colTypes[i] = sqlite3_column_type(m_stmt.get(), i);
   }
 }
 
+//------------------------------------------------------------------------------
+// getColIdx
+//------------------------------------------------------------------------------
+int SqliteRset::getColIdx(const std::string& colName) const {
+  const int colIdx = m_colNameToIdx.findIdx(colName);
+  if (colIdx < 0) {
+    throw exception::Exception("Failed: Unknown column name " + colName);
+  }
+  return colIdx;
+}
+
 //------------------------------------------------------------------------------
 // columnIsNull
 //------------------------------------------------------------------------------
 bool SqliteRset::columnIsNull(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  return SQLITE_NULL == idxAndType.colType;
+  const int colIdx = getColIdx(colName);
+  return SQLITE_NULL == m_colTypes[colIdx];
 }
 
 //------------------------------------------------------------------------------
@@ -185,18 +204,18 @@ std::string SqliteRset::columnBlob(const std::string& colName) const {
 // columnBlobView
 //------------------------------------------------------------------------------
 std::unique_ptr<rdbms::wrapper::IBlobView> SqliteRset::columnBlobView(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
+  const int colIdx = getColIdx(colName);
 
-  if (SQLITE_NULL == idxAndType.colType) {
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::make_unique<BlobView>(nullptr, 0);
   }
 
-  const void* blobData = sqlite3_column_blob(m_stmt.get(), idxAndType.colIdx);
+  const void* blobData = sqlite3_column_blob(m_stmt.get(), colIdx);
   if (!blobData) {
     return std::make_unique<BlobView>(nullptr, 0);
   }
 
-  int blobSize = sqlite3_column_bytes(m_stmt.get(), idxAndType.colIdx);
+  int blobSize = sqlite3_column_bytes(m_stmt.get(), colIdx);
   return std::make_unique<BlobView>(static_cast<const unsigned char*>(blobData), static_cast<std::size_t>(blobSize));
 }
 
@@ -204,16 +223,16 @@ std::unique_ptr<rdbms::wrapper::IBlobView> SqliteRset::columnBlobView(const std:
 // columnOptionalString
 //------------------------------------------------------------------------------
 std::optional<std::string> SqliteRset::columnOptionalString(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    const char* const colValue = (const char*) sqlite3_column_text(m_stmt.get(), idxAndType.colIdx);
+    const char* const colValue = (const char*) sqlite3_column_text(m_stmt.get(), colIdx);
     if (nullptr == colValue) {
       exception::NullPtrException ex;
       ex.getMessage() << "Failed: sqlite3_column_text() returned NULL when"
-                         " m_colNameToIdxAndType map states otherwise: colName="
-                      << colName << ",colIdx=" << idxAndType.colIdx;
+                         " m_colTypes states otherwise: colName="
+                      << colName << ",colIdx=" << colIdx;
       throw ex;
     }
     return std::optional<std::string>(colValue);
@@ -224,11 +243,11 @@ std::optional<std::string> SqliteRset::columnOptionalString(const std::string& c
 // columnOptionalUint8
 //------------------------------------------------------------------------------
 std::optional<uint8_t> SqliteRset::columnOptionalUint8(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    return std::optional<uint8_t>(sqlite3_column_int(m_stmt.get(), idxAndType.colIdx));
+    return std::optional<uint8_t>(sqlite3_column_int(m_stmt.get(), colIdx));
   }
 }
 
@@ -236,11 +255,11 @@ std::optional<uint8_t> SqliteRset::columnOptionalUint8(const std::string& colNam
 // columnOptionalUint16
 //------------------------------------------------------------------------------
 std::optional<uint16_t> SqliteRset::columnOptionalUint16(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    return std::optional<uint16_t>(sqlite3_column_int(m_stmt.get(), idxAndType.colIdx));
+    return std::optional<uint16_t>(sqlite3_column_int(m_stmt.get(), colIdx));
   }
 }
 
@@ -248,11 +267,11 @@ std::optional<uint16_t> SqliteRset::columnOptionalUint16(const std::string& colN
 // columnOptionalUint32
 //------------------------------------------------------------------------------
 std::optional<uint32_t> SqliteRset::columnOptionalUint32(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    return std::optional<uint32_t>(sqlite3_column_int(m_stmt.get(), idxAndType.colIdx));
+    return std::optional<uint32_t>(sqlite3_column_int(m_stmt.get(), colIdx));
   }
 }
 
@@ -260,11 +279,11 @@ std::optional<uint32_t> SqliteRset::columnOptionalUint32(const std::string& colN
 // columnOptionalUint64
 //------------------------------------------------------------------------------
 std::optional<uint64_t> SqliteRset::columnOptionalUint64(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    return std::optional<uint64_t>(sqlite3_column_int64(m_stmt.get(), idxAndType.colIdx));
+    return std::optional<uint64_t>(sqlite3_column_int64(m_stmt.get(), colIdx));
   }
 }
 
@@ -272,12 +291,89 @@ std::optional<uint64_t> SqliteRset::columnOptionalUint64(const std::string& colN
 // columnOptionalDouble
 //------------------------------------------------------------------------------
 std::optional<double> SqliteRset::columnOptionalDouble(const std::string& colName) const {
-  const ColumnNameToIdxAndType::IdxAndType idxAndType = m_colNameToIdxAndType.getIdxAndType(colName);
-  if (SQLITE_NULL == idxAndType.colType) {
+  const int colIdx = getColIdx(colName);
+  if (SQLITE_NULL == m_colTypes[colIdx]) {
     return std::nullopt;
   } else {
-    return std::optional<double>(sqlite3_column_double(m_stmt.get(), idxAndType.colIdx));
+    return std::optional<double>(sqlite3_column_double(m_stmt.get(), colIdx));
+  }
+}
+
+//------------------------------------------------------------------------------
+// columnIndex
+//------------------------------------------------------------------------------
+int SqliteRset::columnIndex(const std::string& colName) const {
+  return m_colNameToIdx.findIdx(colName);
+}
+
+//------------------------------------------------------------------------------
+// columnIsNullAt
+//------------------------------------------------------------------------------
+bool SqliteRset::columnIsNullAt(const int colIdx) const {
+  return SQLITE_NULL == m_colTypes.at(colIdx);
+}
+
+//------------------------------------------------------------------------------
+// columnBlobAt
+//------------------------------------------------------------------------------
+std::string SqliteRset::columnBlobAt(const int colIdx) const {
+  auto blob_view = columnBlobViewAt(colIdx);
+  return std::string(reinterpret_cast<const char*>(blob_view->data()), blob_view->size());
+}
+
+//------------------------------------------------------------------------------
+// columnBlobViewAt
+//------------------------------------------------------------------------------
+std::unique_ptr<rdbms::wrapper::IBlobView> SqliteRset::columnBlobViewAt(const int colIdx) const {
+  if (columnIsNullAt(colIdx)) {
+    return std::make_unique<BlobView>(nullptr, 0);
+  }
+
+  const void* blobData = sqlite3_column_blob(m_stmt.get(), colIdx);
+  if (!blobData) {
+    return std::make_unique<BlobView>(nullptr, 0);
+  }
+
+  int blobSize = sqlite3_column_bytes(m_stmt.get(), colIdx);
+  return std::make_unique<BlobView>(static_cast<const unsigned char*>(blobData), static_cast<std::size_t>(blobSize));
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalStringAt
+//------------------------------------------------------------------------------
+std::optional<std::string> SqliteRset::columnOptionalStringAt(const int colIdx) const {
+  if (columnIsNullAt(colIdx)) {
+    return std::nullopt;
+  }
+  const char* const colValue = (const char*) sqlite3_column_text(m_stmt.get(), colIdx);
+  if (nullptr == colValue) {
+    exception::NullPtrException ex;
+    ex.getMessage() << "Failed: sqlite3_column_text() returned NULL when"
+                       " m_colTypes states otherwise: colName="
+                    << sqlite3_column_name(m_stmt.get(), colIdx) << ",colIdx=" << colIdx;
+    throw ex;
+  }
+  return std::optional<std::string>(colValue);
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalUint64At
+//------------------------------------------------------------------------------
+std::optional<uint64_t> SqliteRset::columnOptionalUint64At(const int colIdx) const {
+  if (columnIsNullAt(colIdx)) {
+    return std::nullopt;
+  }
+  return std::optional<uint64_t>(sqlite3_column_int64(m_stmt.get(), colIdx));
+}
+
+//------------------------------------------------------------------------------
+// columnOptionalDoubleAt
+//------------------------------------------------------------------------------
+std::optional<double> SqliteRset::columnOptionalDoubleAt(const int colIdx) const {
+  if (columnIsNullAt(colIdx)) {
+    return std::nullopt;
   }
+  return std::optional<double>(sqlite3_column_double(m_stmt.get(), colIdx));
 }
 
 }  // namespace cta::rdbms::wrapper
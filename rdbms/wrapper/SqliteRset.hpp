@@ -7,12 +7,13 @@
 
 #include "common/exception/Exception.hpp"
 #include "common/exception/NotImplementedException.hpp"
-#include "rdbms/wrapper/ColumnNameToIdxAndType.hpp"
+#include "rdbms/wrapper/ColumnNameToIdx.hpp"
 #include "rdbms/wrapper/RsetWrapper.hpp"
 
 #include <memory>
 #include <sqlite3.h>
 #include <stdint.h>
+#include <vector>
 
 namespace cta::rdbms::wrapper {
 
@@ -211,6 +212,17 @@ public:
    */
   std::optional<double> columnOptionalDouble(const std::string& colName) const override;
 
+  /**
+   * Index-based accessors, see RsetWrapper::columnIndex().
+   */
+  int columnIndex(const std::string& colName) const override;
+  bool columnIsNullAt(const int colIdx) const override;
+  std::string columnBlobAt(const int colIdx) const override;
+  std::unique_ptr<rdbms::wrapper::IBlobView> columnBlobViewAt(const int colIdx) const override;
+  std::optional<std::string> columnOptionalStringAt(const int colIdx) const override;
+  std::optional<uint64_t> columnOptionalUint64At(const int colIdx) const override;
+  std::optional<double> columnOptionalDoubleAt(const int colIdx) const override;
+
 private:
   /**
    * The prepared statement.
@@ -218,14 +230,38 @@ private:
   SqliteStmt& m_stmt;
 
   /**
-   * Map from column name to column index and type.
+   * Map from column name to column index, populated when the first row is
+   * retrieved.
+   */
+  ColumnNameToIdx m_colNameToIdx;
+
+  /**
+   * The type of each column of the current row as returned by the
+   * sqlite3_column_type() function.  With SQLite 3 the type of a column needs
+   * to be stored before any type conversion has taken place, because the
+   * result of calling sqlite3_column_type() is no longer meaningful after such
+   * a conversion.
+   */
+  std::vector<int> m_colTypes;
+
+  /**
+   * Populates the map from column name to column index.
    */
-  ColumnNameToIdxAndType m_colNameToIdxAndType;
+  void populateColNameToIdxMap();
 
   /**
-   * Clears and populates the map from column name to column index and type.
+   * Stores the type of each column of the current row.
+   */
+  void storeColTypes();
+
+  /**
+   * Returns the index of the specified column.
+   *
+   * @param colName The name of the column.
+   * @return The index of the column.
+   * @throw exception::Exception if there is no such column.
    */
-  void clearAndPopulateColNameToIdxAndTypeMap();
+  int getColIdx(const std::string& colName) const;
 
 };  // class SqlLiteRset
 
@@ -40,6 +40,13 @@ const std::string StmtWrapper::getDbQuerySummary() const {
   return m_queryType;
 }
 
+//------------------------------------------------------------------------------
+// recordBoundValue
+//------------------------------------------------------------------------------
+void StmtWrapper::recordBoundValue(const std::string& paramName, std::string printableValue) {
+  m_boundValues[paramName] = std::move(printableValue);
+}
+
 //------------------------------------------------------------------------------
 // getParamIdx
 //------------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #include "rdbms/wrapper/ParamNameToIdx.hpp"
 #include "rdbms/wrapper/RsetWrapper.hpp"
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <stdint.h>
@@ -246,6 +247,22 @@ public:
    */
   void setDbQuerySummary(const std::string& optQuerySummary);
 
+  /**
+   * Records the printable form of the value bound to the specified SQL
+   * parameter so that it can be logged if the statement turns out to be slow.
+   *
+   * @param paramName The name of the parameter.
+   * @param printableValue The printable form of the value.
+   */
+  void recordBoundValue(const std::string& paramName, std::string printableValue);
+
+  /**
+   * Returns the printable form of the values recorded by recordBoundValue().
+   *
+   * @return The printable form of the values by parameter name.
+   */
+  const std::map<std::string, std::string>& getBoundValues() const { return m_boundValues; }
+
 private:
   /**
    * The SQL statement.
@@ -262,6 +279,11 @@ private:
    */
   ParamNameToIdx m_paramNameToIdx;
 
+  /**
+   * The printable form of the values bound to the statement by parameter name.
+   */
+  std::map<std::string, std::string> m_boundValues;
+
 };  // class StmtWrapper
 
 }  // namespace cta::rdbms::wrapper
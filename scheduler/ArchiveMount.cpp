@@ -204,7 +204,8 @@ void cta::ArchiveMount::reportJobsBatchTransferred(
   std::queue<std::unique_ptr<cta::ArchiveJob>>& successfulArchiveJobs,
   std::queue<cta::catalogue::TapeItemWritten>& skippedFiles,
   std::queue<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>>& failedToReportArchiveJobs,
-  cta::log::LogContext& logContext) {
+  cta::log::LogContext& logContext,
+  CatalogueUpdateTurn* catalogueUpdateTurn) {
   std::set<cta::catalogue::TapeItemWrittenPointer> tapeItemsWritten;
   std::list<std::unique_ptr<cta::ArchiveJob>> validatedSuccessfulArchiveJobs;
   std::list<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>> validatedSuccessfulDBArchiveJobs;
@@ -265,7 +266,22 @@ void cta::ArchiveMount::reportJobsBatchTransferred(
     }
     validatedSuccessfulArchiveJobs.clear();
 
-    updateCatalogueWithTapeFilesWritten(tapeItemsWritten);
+    if (catalogueUpdateTurn) {
+      catalogueUpdateTurn->wait();
+      // The time spent waiting for the preceding batches is not catalogue time
+      t.reset();
+    }
+    try {
+      updateCatalogueWithTapeFilesWritten(tapeItemsWritten);
+    } catch (...) {
+      if (catalogueUpdateTurn) {
+        catalogueUpdateTurn->release();
+      }
+      throw;
+    }
+    if (catalogueUpdateTurn) {
+      catalogueUpdateTurn->release();
+    }
     catalogue_updated = true;
     catalogueTimeMSecs += t.msecs();
     catalogueTime = t.secs(utils::Timer::resetCounter) + catalogueTimeMSecs / 1000.;
@@ -56,6 +56,26 @@ public:
   CTA_GENERATE_EXCEPTION_CLASS(FailedReportCatalogueUpdate);
   CTA_GENERATE_EXCEPTION_CLASS(FailedReportMoveToQueue);
 
+  /**
+   * Turn-taking interface allowing a caller reporting several batches concurrently to serialise
+   * the catalogue updates done by reportJobsBatchTransferred(). The catalogue requires the files of
+   * a tape to be recorded in fSeq order, while the rest of the reporting may overlap.
+   */
+  class CatalogueUpdateTurn {
+  public:
+    virtual ~CatalogueUpdateTurn() = default;
+
+    /**
+     * Blocks until all the batches preceding this one have updated the catalogue.
+     */
+    virtual void wait() = 0;
+
+    /**
+     * Hands the catalogue over to the next batch. Only called after a successful wait().
+     */
+    virtual void release() = 0;
+  };
+
   /**
    * Returns The type of this tape mount.
    *
@@ -138,12 +158,15 @@ public:
    *
    * @param successfulArchiveJobs the jobs to report
    * @param logContext
+   * @param catalogueUpdateTurn optional turn to take before updating the catalogue, when several
+   * batches of the same tape are reported concurrently
    */
   virtual void
   reportJobsBatchTransferred(std::queue<std::unique_ptr<cta::ArchiveJob>>& successfulArchiveJobs,
                              std::queue<cta::catalogue::TapeItemWritten>& skippedFiles,
                              std::queue<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>>& failedToReportArchiveJobs,
-                             cta::log::LogContext& logContext);
+                             cta::log::LogContext& logContext,
+                             CatalogueUpdateTurn* catalogueUpdateTurn = nullptr);
   /**
   * Re-queues batch of jobs
   * Serves PGSCHED purpose only
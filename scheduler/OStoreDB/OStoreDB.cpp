@@ -3205,7 +3205,7 @@ nextSubrequest:
         is.request->fetch();
         sorter.insertRetrieveRequest(is.request, *m_oStoreDB.m_agentReference, is.activeCopyNb, lc);
       }
-      nbRetrieveSubrequestsCreated = sorter.getAllRetrieve().size();
+      nbRetrieveSubrequestsCreated += sorter.getAllRetrieve().size();
       locks.clear();
       sorter.flushAll(lc);
     }
@@ -410,6 +410,72 @@ TEST_P(SchedulerTest, archive_to_new_file) {
   }
 }
 
+TEST_P(SchedulerTest, archive_batch_of_new_files) {
+  using namespace cta;
+
+  setupDefaultCatalogue();
+  Scheduler& scheduler = getScheduler();
+
+  cta::common::dataStructures::EntryLog creationLog;
+  creationLog.host = "host2";
+  creationLog.time = 0;
+  creationLog.username = "admin1";
+  cta::common::dataStructures::RequesterIdentity requester;
+  requester.name = s_userName;
+  requester.group = "userGroup";
+
+  log::DummyLogger dl("", "");
+  log::LogContext lc(dl);
+  const uint64_t nbFiles = 3;
+  const auto archiveFileIdList =
+    scheduler.checkAndGetNextArchiveFileIds(s_diskInstance, s_storageClassName, requester, nbFiles, lc);
+  ASSERT_EQ(nbFiles, archiveFileIdList.size());
+  const std::vector<uint64_t> archiveFileIds(archiveFileIdList.begin(), archiveFileIdList.end());
+  ASSERT_EQ(nbFiles, std::set<uint64_t>(archiveFileIds.begin(), archiveFileIds.end()).size());
+
+  std::vector<cta::common::dataStructures::ArchiveRequest> requests;
+  for (uint64_t i = 0; i < nbFiles; i++) {
+    cta::common::dataStructures::ArchiveRequest request;
+    request.checksumBlob.insert(cta::checksum::ADLER32, "1111");
+    request.creationLog = creationLog;
+    request.diskFileInfo.gid = GROUP_2;
+    request.diskFileInfo.owner_uid = CMS_USER;
+    request.diskFileInfo.path = "path/to/file" + std::to_string(i);
+    request.diskFileID = "diskFileID" + std::to_string(i);
+    // The second file is empty and cannot be queued
+    request.fileSize = i == 1 ? 0 : 100 * 1000 * 1000;
+    request.requester = requester;
+    request.srcURL = "srcURL" + std::to_string(i);
+    request.storageClass = s_storageClassName;
+    // archive report url should have a value otherwise exception
+    request.archiveReportURL = "test://archive-report-url";
+    request.archiveErrorReportURL = "test://error-report-url";
+    requests.push_back(request);
+  }
+
+  const auto results = scheduler.queueArchivesWithGivenIds(archiveFileIds, s_diskInstance, requests, lc);
+  scheduler.waitSchedulerDbSubthreadsComplete();
+
+  // The results are in the order of the requests
+  ASSERT_EQ(nbFiles, results.size());
+  ASSERT_FALSE(results[0].error);
+  ASSERT_THROW(std::rethrow_exception(results[1].error), cta::exception::UserError);
+  ASSERT_TRUE(results[1].requestId.empty());
+  ASSERT_FALSE(results[2].error);
+
+  {
+    auto rqsts = scheduler.getPendingArchiveJobs(lc);
+    ASSERT_EQ(1, rqsts.size());
+    auto poolItor = rqsts.cbegin();
+    ASSERT_TRUE(s_tapePoolName == poolItor->first);
+    std::set<std::string> remoteFiles;
+    for (const auto& rqst : poolItor->second) {
+      remoteFiles.insert(rqst.request.diskFileInfo.path);
+    }
+    ASSERT_EQ(std::set<std::string>({requests[0].diskFileInfo.path, requests[2].diskFileInfo.path}), remoteFiles);
+  }
+}
+
 TEST_P(SchedulerTest, archive_report_and_retrieve_new_file) {
   using namespace cta;
 
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "scheduler/RepackExpansionReader.hpp"
+
+#include "catalogue/Catalogue.hpp"
+#include "catalogue/CatalogueItor.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace cta {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+RepackExpansionReader::RepackExpansionReader(catalogue::Catalogue& catalogue,
+                                             const common::dataStructures::RepackInfo& repackInfo,
+                                             uint64_t lastExpandedFSeq,
+                                             bool countFilesOnTape,
+                                             uint64_t pageSize)
+    : m_catalogue(catalogue),
+      m_vid(repackInfo.vid),
+      m_storageClass(repackInfo.storageClass),
+      m_maxFilesToSelect(repackInfo.maxFilesToSelect),
+      m_lastExpandedFSeq(lastExpandedFSeq),
+      m_countFilesOnTape(countFilesOnTape),
+      m_pageSize(std::max<uint64_t>(pageSize, 1)),
+      m_nextFSeq(countFilesOnTape ? 0 : lastExpandedFSeq) {}
+
+//------------------------------------------------------------------------------
+// readPage
+//------------------------------------------------------------------------------
+RepackExpansionPage RepackExpansionReader::readPage() {
+  RepackExpansionPage page;
+  // The iterator is released at the end of the page, the next page is read by a new query
+  auto archiveFileItor = m_catalogue.ArchiveFile()->getArchiveFilesForRepackItor(m_vid, m_nextFSeq);
+  while (!m_done && page.nbFilesRead < m_pageSize && archiveFileItor.hasMore()) {
+    auto archiveFile = archiveFileItor.next();
+    page.nbFilesRead++;
+    const uint64_t fSeq = getFSeqOnTape(archiveFile);
+    m_nextFSeq = fSeq + 1;
+
+    const bool storageClassCheck = m_storageClass.empty() || archiveFile.storageClass == m_storageClass;
+    const bool maxFilesToSelectCheck = m_maxFilesToSelect == 0 || m_nbSelectedFiles < m_maxFilesToSelect;
+
+    if (storageClassCheck && maxFilesToSelectCheck) {
+      m_nbSelectedFiles++;
+      page.lastConsideredFSeq = fSeq;
+    } else if (!m_countFilesOnTape) {
+      // Stop if the total number of files/bytes on tape has already been counted before
+      m_allFilesSelected = false;
+      m_done = true;
+      break;
+    } else {
+      m_allFilesSelected = false;
+      if (maxFilesToSelectCheck) {
+        page.lastConsideredFSeq = fSeq;
+      }
+    }
+
+    if (m_countFilesOnTape) {
+      m_nbFilesOnTape += 1;
+      m_nbBytesOnTape += archiveFile.fileSize;
+    }
+
+    // The files below the last expanded fSeq have already been expanded by a previous attempt
+    if (storageClassCheck && maxFilesToSelectCheck && fSeq >= m_lastExpandedFSeq) {
+      page.archiveFiles.push_back(std::move(archiveFile));
+    }
+  }
+  if (page.nbFilesRead < m_pageSize) {
+    m_done = true;
+  }
+  page.isLast = m_done;
+  return page;
+}
+
+//------------------------------------------------------------------------------
+// getFSeqOnTape
+//------------------------------------------------------------------------------
+uint64_t RepackExpansionReader::getFSeqOnTape(const common::dataStructures::ArchiveFile& archiveFile) const {
+  // The files are listed in the order of their lowest fSeq on the tape, should they have several copies on it
+  uint64_t fSeq = std::numeric_limits<uint64_t>::max();
+  for (const auto& tapeFile : archiveFile.tapeFiles) {
+    if (tapeFile.vid == m_vid) {
+      fSeq = std::min(fSeq, tapeFile.fSeq);
+    }
+  }
+  return fSeq == std::numeric_limits<uint64_t>::max() ? m_nextFSeq : fSeq;
+}
+
+}  // namespace cta
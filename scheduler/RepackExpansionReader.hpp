@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/dataStructures/ArchiveFile.hpp"
+#include "common/dataStructures/RepackInfo.hpp"
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+
+namespace cta {
+
+namespace catalogue {
+class Catalogue;
+}
+
+/**
+ * A page of the files of a tape to repack, read from the catalogue by a RepackExpansionReader
+ */
+struct RepackExpansionPage {
+  // The archive files selected for expansion, in fSeq order
+  std::list<common::dataStructures::ArchiveFile> archiveFiles;
+  // The highest fSeq of the files of the page which have been selected or filtered out by their storage class
+  std::optional<uint64_t> lastConsideredFSeq;
+  // The number of files read from the catalogue for this page
+  uint64_t nbFilesRead = 0;
+  // True if no page follows this one
+  bool isLast = false;
+};
+
+/**
+ * Reads the files of a tape to repack from the catalogue, page by page in fSeq order
+ *
+ * Each page is read with its own catalogue query starting after the last fSeq of the previous page, so that no
+ * catalogue iterator is held open for the whole expansion of the tape. The reader applies the storage class and the
+ * maximum number of files selection criteria of the repack request, and counts the files on the tape when the
+ * request has not counted them yet. Counting requires to read the whole tape, so the reader then keeps reading pages
+ * once the maximum number of files has been selected.
+ *
+ * The files whose fSeq is below the last expanded fSeq of the request are not selected again, but they are counted
+ * towards the maximum number of files to select. When the files on the tape still have to be counted, the reader
+ * therefore starts from the beginning of the tape.
+ */
+class RepackExpansionReader {
+public:
+  /**
+   * Constructor
+   *
+   * @param catalogue        The catalogue
+   * @param repackInfo       The repack request
+   * @param lastExpandedFSeq The fSeq from which the files of the tape have not been expanded yet
+   * @param countFilesOnTape True if the files on the tape have to be counted
+   * @param pageSize         The maximum number of files read from the catalogue for each page
+   */
+  RepackExpansionReader(catalogue::Catalogue& catalogue,
+                        const common::dataStructures::RepackInfo& repackInfo,
+                        uint64_t lastExpandedFSeq,
+                        bool countFilesOnTape,
+                        uint64_t pageSize);
+
+  /**
+   * Reads the next page of files. Must not be called once a page flagged as the last one has been returned.
+   */
+  RepackExpansionPage readPage();
+
+  /**
+   * The number of files on the tape, once the last page has been read and if they have been counted
+   */
+  uint64_t getNbFilesOnTape() const { return m_nbFilesOnTape; }
+
+  /**
+   * The number of bytes on the tape, once the last page has been read and if they have been counted
+   */
+  uint64_t getNbBytesOnTape() const { return m_nbBytesOnTape; }
+
+  /**
+   * True if all the files read from the tape have been selected
+   */
+  bool allFilesSelected() const { return m_allFilesSelected; }
+
+private:
+  /**
+   * Returns the fSeq of the specified file on the tape to repack
+   */
+  uint64_t getFSeqOnTape(const common::dataStructures::ArchiveFile& archiveFile) const;
+
+  catalogue::Catalogue& m_catalogue;
+  const std::string m_vid;
+  const std::string m_storageClass;
+  const uint64_t m_maxFilesToSelect;
+  const uint64_t m_lastExpandedFSeq;
+  const bool m_countFilesOnTape;
+  const uint64_t m_pageSize;
+
+  // The fSeq from which the next page is read
+  uint64_t m_nextFSeq;
+  uint64_t m_nbSelectedFiles = 0;
+  uint64_t m_nbFilesOnTape = 0;
+  uint64_t m_nbBytesOnTape = 0;
+  bool m_allFilesSelected = true;
+  bool m_done = false;
+};
+
+}  // namespace cta
@@ -8,6 +8,7 @@
 #include "catalogue/Catalogue.hpp"
 #include "catalogue/CatalogueItor.hpp"
 #include "catalogue/DriveConfig.hpp"
+#include "catalogue/RetrieveFilesQueueCriteria.hpp"
 #include "catalogue/TapeDrivesCatalogueState.hpp"
 #include "catalogue/TapePool.hpp"
 #include "common/Constants.hpp"
@@ -22,13 +23,16 @@
 #include "common/utils/Timer.hpp"
 #include "common/utils/utils.hpp"
 #include "disk/DiskFileImplementations.hpp"
+#include "disk/DiskReportWindow.hpp"
 #include "scheduler/ArchiveMount.hpp"
+#include "scheduler/RepackExpansionReader.hpp"
 #include "scheduler/RetrieveMount.hpp"
 #include "scheduler/RetrieveRequestDump.hpp"
 
 #include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <opentelemetry/context/runtime_context.h>
@@ -38,6 +42,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <time.h>
+#include <tuple>
 #include <unistd.h>
 
 namespace cta {
@@ -126,6 +131,34 @@ uint64_t Scheduler::checkAndGetNextArchiveFileId(const std::string& instanceName
   return archiveFileId;
 }
 
+//------------------------------------------------------------------------------
+// checkAndGetNextArchiveFileIds
+//------------------------------------------------------------------------------
+std::list<uint64_t> Scheduler::checkAndGetNextArchiveFileIds(const std::string& instanceName,
+                                                             const std::string& storageClassName,
+                                                             const common::dataStructures::RequesterIdentity& user,
+                                                             const uint64_t nbIds,
+                                                             log::LogContext& lc) const {
+  cta::utils::Timer t;
+  auto archiveFileIds =
+    m_catalogue.ArchiveFile()->checkAndGetNextArchiveFileIds(instanceName, storageClassName, user, nbIds);
+  const auto catalogueTime = t.secs();
+
+  log::ScopedParamContainer spc(lc);
+  spc.add("instanceName", instanceName)
+    .add("username", user.name)
+    .add("usergroup", user.group)
+    .add("storageClass", storageClassName)
+    .add("fileIdCount", archiveFileIds.size())
+    .add("catalogueTime", catalogueTime);
+  if (!archiveFileIds.empty()) {
+    spc.add("firstFileId", archiveFileIds.front()).add("lastFileId", archiveFileIds.back());
+  }
+  lc.log(log::INFO, "In Scheduler::checkAndGetNextArchiveFileIds(): Checked requests and got next archive file IDs");
+
+  return archiveFileIds;
+}
+
 //------------------------------------------------------------------------------
 // queueArchiveWithGivenId
 //------------------------------------------------------------------------------
@@ -134,8 +167,6 @@ std::string Scheduler::queueArchiveWithGivenId(const uint64_t archiveFileId,
                                                const cta::common::dataStructures::ArchiveRequest& request,
                                                log::LogContext& lc) {
   cta::utils::Timer t;
-  using utils::midEllipsis;
-  using utils::postEllipsis;
 
   if (!request.fileSize) {
     throw cta::exception::UserError(
@@ -154,6 +185,127 @@ std::string Scheduler::queueArchiveWithGivenId(const uint64_t archiveFileId,
   std::string archiveReqAddr = m_db.queueArchive(instanceName, request, catalogueInfo, lc);
   auto schedulerDbTime = t.secs();
   auto schedulerDbTimeMSecs = t.msecs();
+  logQueuedArchive(instanceName,
+                   request,
+                   catalogueInfo,
+                   catalogueTime,
+                   schedulerDbTime,
+                   "In Scheduler::queueArchiveWithGivenId(): Queued archive request",
+                   lc);
+
+  cta::telemetry::metrics::ctaSchedulerOperationDuration->Record(
+    schedulerDbTimeMSecs,
+    {
+      {cta::semconv::attr::kSchedulerOperationName,     cta::semconv::attr::SchedulerOperationNameValues::kEnqueue},
+      {cta::semconv::attr::kSchedulerOperationWorkflow,
+       cta::semconv::attr::SchedulerOperationWorkflowValues::kArchive                                             }
+  },
+    opentelemetry::context::RuntimeContext::GetCurrent());
+  return archiveReqAddr;
+}
+
+//------------------------------------------------------------------------------
+// queueArchivesWithGivenIds
+//------------------------------------------------------------------------------
+std::vector<Scheduler::QueueArchiveResult>
+Scheduler::queueArchivesWithGivenIds(const std::vector<uint64_t>& archiveFileIds,
+                                     const std::string& instanceName,
+                                     const std::vector<common::dataStructures::ArchiveRequest>& requests,
+                                     log::LogContext& lc) {
+  if (archiveFileIds.size() != requests.size()) {
+    throw exception::Exception("In Scheduler::queueArchivesWithGivenIds(): got " + std::to_string(requests.size())
+                               + " requests but " + std::to_string(archiveFileIds.size()) + " archive file IDs");
+  }
+  std::vector<QueueArchiveResult> results(requests.size());
+  cta::utils::Timer t;
+
+  // Get the queue criteria once per storage class and requester
+  using StorageClassAndRequester = std::tuple<std::string, std::string, std::string>;
+  std::map<StorageClassAndRequester, common::dataStructures::ArchiveFileQueueCriteria> queueCriteriaCache;
+  std::vector<SchedulerDatabase::ArchiveToQueue> archives;
+  std::vector<size_t> archiveRequestIdxs;  // Index in requests of the request of each archive to queue
+  for (size_t i = 0; i < requests.size(); i++) {
+    const auto& request = requests[i];
+    try {
+      if (!request.fileSize) {
+        throw cta::exception::UserError(
+          std::string("In Scheduler::queueArchivesWithGivenIds(): Rejecting archive request for zero-length file: ")
+          + request.diskFileInfo.path);
+      }
+      const StorageClassAndRequester storageClassAndRequester {request.storageClass,
+                                                               request.requester.name,
+                                                               request.requester.group};
+      auto queueCriteriaItor = queueCriteriaCache.find(storageClassAndRequester);
+      if (queueCriteriaCache.end() == queueCriteriaItor) {
+        queueCriteriaItor =
+          queueCriteriaCache
+            .emplace(storageClassAndRequester,
+                     m_catalogue.ArchiveFile()->getArchiveFileQueueCriteria(instanceName,
+                                                                            request.storageClass,
+                                                                            request.requester))
+            .first;
+      }
+      archives.push_back({request,
+                          common::dataStructures::ArchiveFileQueueCriteriaAndFileId(
+                            archiveFileIds[i],
+                            queueCriteriaItor->second.copyToPoolMap,
+                            queueCriteriaItor->second.mountPolicy)});
+      archiveRequestIdxs.push_back(i);
+    } catch (...) {
+      results[i].error = std::current_exception();
+    }
+  }
+  auto catalogueTime = t.secs(cta::utils::Timer::resetCounter);
+  if (archives.empty()) {
+    return results;
+  }
+
+  auto dbResults = m_db.queueArchives(instanceName, archives, lc);
+  auto schedulerDbTime = t.secs();
+  auto schedulerDbTimeMSecs = t.msecs();
+  for (size_t a = 0; a < archives.size(); a++) {
+    const auto i = archiveRequestIdxs[a];
+    results[i] = std::move(dbResults[a]);
+    if (!results[i].error) {
+      logQueuedArchive(instanceName,
+                       archives[a].request,
+                       archives[a].criteria,
+                       catalogueTime,
+                       schedulerDbTime,
+                       "In Scheduler::queueArchivesWithGivenIds(): Queued archive request",
+                       lc);
+    }
+  }
+  log::ScopedParamContainer spc(lc);
+  spc.add("instanceName", instanceName)
+    .add("requestCount", requests.size())
+    .add("queuedRequestCount", archives.size())
+    .add("catalogueTime", catalogueTime)
+    .add("schedulerDbTime", schedulerDbTime);
+  lc.log(log::INFO, "In Scheduler::queueArchivesWithGivenIds(): Queued batch of archive requests");
+
+  cta::telemetry::metrics::ctaSchedulerOperationDuration->Record(
+    schedulerDbTimeMSecs,
+    {
+      {cta::semconv::attr::kSchedulerOperationName,     cta::semconv::attr::SchedulerOperationNameValues::kEnqueue},
+      {cta::semconv::attr::kSchedulerOperationWorkflow,
+       cta::semconv::attr::SchedulerOperationWorkflowValues::kArchive                                             }
+  },
+    opentelemetry::context::RuntimeContext::GetCurrent());
+  return results;
+}
+
+//------------------------------------------------------------------------------
+// logQueuedArchive
+//------------------------------------------------------------------------------
+void Scheduler::logQueuedArchive(const std::string& instanceName,
+                                 const common::dataStructures::ArchiveRequest& request,
+                                 const common::dataStructures::ArchiveFileQueueCriteriaAndFileId& catalogueInfo,
+                                 const double catalogueTime,
+                                 const double schedulerDbTime,
+                                 const std::string& message,
+                                 log::LogContext& lc) {
+  using utils::midEllipsis;
   log::ScopedParamContainer spc(lc);
   spc.add("instanceName", instanceName)
     .add("storageClass", request.storageClass)
@@ -182,17 +334,7 @@ std::string Scheduler::queueArchiveWithGivenId(const uint64_t archiveFileId,
     .add("catalogueTime", catalogueTime)
     .add("schedulerDbTime", schedulerDbTime);
   request.checksumBlob.addFirstChecksumToLog(spc);
-  lc.log(log::INFO, "In Scheduler::queueArchiveWithGivenId(): Queued archive request");
-
-  cta::telemetry::metrics::ctaSchedulerOperationDuration->Record(
-    schedulerDbTimeMSecs,
-    {
-      {cta::semconv::attr::kSchedulerOperationName,     cta::semconv::attr::SchedulerOperationNameValues::kEnqueue},
-      {cta::semconv::attr::kSchedulerOperationWorkflow,
-       cta::semconv::attr::SchedulerOperationWorkflowValues::kArchive                                             }
-  },
-    opentelemetry::context::RuntimeContext::GetCurrent());
-  return archiveReqAddr;
+  lc.log(log::INFO, message);
 }
 
 //------------------------------------------------------------------------------
@@ -201,8 +343,6 @@ std::string Scheduler::queueArchiveWithGivenId(const uint64_t archiveFileId,
 std::string Scheduler::queueRetrieve(const std::string& instanceName,
                                      common::dataStructures::RetrieveRequest& request,
                                      log::LogContext& lc) {
-  using utils::midEllipsis;
-  using utils::postEllipsis;
   utils::Timer t;
   // Get the queue criteria
   common::dataStructures::RetrieveFileQueueCriteria queueCriteria;
@@ -214,11 +354,10 @@ std::string Scheduler::queueRetrieve(const std::string& instanceName,
                                                                 lc,
                                                                 request.mountPolicy);
   lc.log(log::DEBUG, "Got retrieve queue criteria");
-  queueCriteria.archiveFile.diskFileInfo = request.diskFileInfo;
 
   auto diskSystemList = m_catalogue.DiskSystem()->getAllDiskSystems();
   auto catalogueTimeMSecs = t.msecs();
-  auto catalogueTime = t.secs(cta::utils::Timer::resetCounter);
+  auto catalogueTime = t.secs();
   cta::telemetry::metrics::ctaSchedulerOperationDuration->Record(
     catalogueTimeMSecs,
     {
@@ -228,6 +367,100 @@ std::string Scheduler::queueRetrieve(const std::string& instanceName,
        cta::semconv::attr::SchedulerOperationWorkflowValues::kRetrieve     }
   },
     opentelemetry::context::RuntimeContext::GetCurrent());
+  return queueRetrieveWithCriteria(instanceName, request, queueCriteria, diskSystemList, catalogueTime, lc);
+}
+
+//------------------------------------------------------------------------------
+// queueRetrieves
+//------------------------------------------------------------------------------
+std::vector<Scheduler::QueueRetrieveResult>
+Scheduler::queueRetrieves(const std::string& instanceName,
+                          std::vector<common::dataStructures::RetrieveRequest>& requests,
+                          log::LogContext& lc) {
+  std::vector<QueueRetrieveResult> results(requests.size());
+
+  // Group the requests whose queue criteria can be got from the catalogue in one pass
+  using RequesterActivityAndMountPolicy =
+    std::tuple<std::string, std::string, std::optional<std::string>, std::optional<std::string>>;
+  std::map<RequesterActivityAndMountPolicy, std::list<size_t>> requestGroups;
+  for (size_t i = 0; i < requests.size(); i++) {
+    const auto& request = requests[i];
+    const RequesterActivityAndMountPolicy requesterActivityAndMountPolicy {request.requester.name,
+                                                                           request.requester.group,
+                                                                           request.activity,
+                                                                           request.mountPolicy};
+    requestGroups[requesterActivityAndMountPolicy].push_back(i);
+  }
+
+  const auto diskSystemList = m_catalogue.DiskSystem()->getAllDiskSystems();
+  for (const auto& [requesterActivityAndMountPolicy, requestIndexes] : requestGroups) {
+    utils::Timer t;
+    const auto& firstRequest = requests[requestIndexes.front()];
+    std::set<uint64_t> archiveFileIds;
+    for (const auto i : requestIndexes) {
+      archiveFileIds.insert(requests[i].archiveFileID);
+    }
+    catalogue::RetrieveFilesQueueCriteria queueCriteria;
+    try {
+      queueCriteria = m_catalogue.TapeFile()->prepareToRetrieveFiles(instanceName,
+                                                                     archiveFileIds,
+                                                                     firstRequest.requester,
+                                                                     firstRequest.activity,
+                                                                     lc,
+                                                                     firstRequest.mountPolicy);
+    } catch (...) {
+      for (const auto i : requestIndexes) {
+        results[i].error = std::current_exception();
+      }
+      continue;
+    }
+    auto catalogueTimeMSecs = t.msecs();
+    auto catalogueTime = t.secs();
+    cta::telemetry::metrics::ctaSchedulerOperationDuration->Record(
+      catalogueTimeMSecs,
+      {
+        {cta::semconv::attr::kSchedulerOperationName,
+         cta::semconv::attr::SchedulerOperationNameValues::kSelectCatalogueDB},
+        {cta::semconv::attr::kSchedulerOperationWorkflow,
+         cta::semconv::attr::SchedulerOperationWorkflowValues::kRetrieve     }
+    },
+      opentelemetry::context::RuntimeContext::GetCurrent());
+
+    for (const auto i : requestIndexes) {
+      auto& request = requests[i];
+      try {
+        if (const auto errorItor = queueCriteria.errors.find(request.archiveFileID);
+            queueCriteria.errors.end() != errorItor) {
+          throw exception::UserError(errorItor->second);
+        }
+        results[i].requestId = queueRetrieveWithCriteria(instanceName,
+                                                         request,
+                                                         queueCriteria.criteria.at(request.archiveFileID),
+                                                         diskSystemList,
+                                                         catalogueTime,
+                                                         lc);
+      } catch (...) {
+        results[i].error = std::current_exception();
+      }
+    }
+  }
+  return results;
+}
+
+//------------------------------------------------------------------------------
+// queueRetrieveWithCriteria
+//------------------------------------------------------------------------------
+std::string Scheduler::queueRetrieveWithCriteria(const std::string& instanceName,
+                                                 common::dataStructures::RetrieveRequest& request,
+                                                 common::dataStructures::RetrieveFileQueueCriteria queueCriteria,
+                                                 const disk::DiskSystemList& diskSystemList,
+                                                 const double catalogueTime,
+                                                 log::LogContext& lc) {
+  using utils::midEllipsis;
+  using utils::postEllipsis;
+  utils::Timer t;
+  queueCriteria.archiveFile.diskFileInfo = request.diskFileInfo;
+
   // By default, the scheduler makes its decision based on all available vids. But if a vid is specified in the protobuf,
   // ignore all the others.
   if (request.vid) {
@@ -581,7 +814,8 @@ std::unique_ptr<RepackRequest> Scheduler::getNextRepackRequestToExpand() {
 void Scheduler::expandRepackRequest(const RepackRequest& repackRequest,
                                     log::TimingList& timingList,
                                     utils::Timer& t,
-                                    log::LogContext& lc) const {
+                                    log::LogContext& lc,
+                                    uint64_t pageSize) const {
   auto repackInfo = repackRequest.getRepackInfo();
 
   using RepackType = cta::common::dataStructures::RepackInfo::Type;
@@ -609,15 +843,18 @@ void Scheduler::expandRepackRequest(const RepackRequest& repackRequest,
   repackRequest.m_dbReq->fillLastExpandedFSeqAndTotalStatsFile(fSeq, totalStatsFile);
   lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): after  fillLastExpandedFSeqAndTotalStatsFile.");
   timingList.insertAndReset("fillTotalStatsFileBeforeExpandTime", t);
-  cta::catalogue::ArchiveFileItor archiveFilesForCatalogue =
-    m_catalogue.ArchiveFile()->getArchiveFilesForRepackItor(repackInfo.vid, fSeq);
+
+  // The files on the tape are only counted once, the total is reused if the expansion is restarted
+  const bool totalFilesOnTapeAlreadyChecked = (totalStatsFile.totalFilesOnTapeAtStart != 0);
+  RepackExpansionReader reader(m_catalogue, repackInfo, fSeq, !totalFilesOnTapeAlreadyChecked, pageSize);
+  auto page = reader.readPage();
   timingList.insertAndReset("catalogueGetArchiveFilesForRepackItorTime", t);
 
   std::stringstream dirBufferURL;
   dirBufferURL << repackInfo.repackBufferBaseURL << "/" << repackInfo.vid << "/";
   std::set<std::string> filesInDirectory;
   std::unique_ptr<cta::disk::Directory> dir;
-  if (archiveFilesForCatalogue.hasMore()) {
+  if (page.nbFilesRead > 0) {
     //We only create the folder if there are some files to Repack
     cta::disk::DirectoryFactory dirFactory;
     dir.reset(dirFactory.createDirectory(dirBufferURL.str()));
@@ -655,251 +892,245 @@ void Scheduler::expandRepackRequest(const RepackRequest& repackRequest,
   }
   lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): after  setExpandStartedAndChangeStatus().");
 
-  uint64_t nbRetrieveSubrequestsQueued = 0;
-
-  std::list<cta::common::dataStructures::ArchiveFile> archiveFilesFromCatalogue;
+  auto diskSystemList = m_catalogue.DiskSystem()->getAllDiskSystems();
+  timingList.insertAndReset("getDisksystemsListTime", t);
 
-  // If requested, limit the number of files to be selected for repack
-  {
-    bool totalFilesOnTapeAlreadyChecked = (totalStatsFile.totalFilesOnTapeAtStart != 0);
-    uint64_t numberOfFilesCount = 0;
-    uint64_t numberOfBytesCount = 0;
-    bool allFilesSelected = true;
-    while (archiveFilesForCatalogue.hasMore()) {
-      auto archiveFile = archiveFilesForCatalogue.next();
-
-      const bool storageClassCheck =
-        repackInfo.storageClass.empty() || archiveFile.storageClass == repackInfo.storageClass;
-
-      const bool maxFilesToSelectCheck =
-        repackInfo.maxFilesToSelect == 0 || archiveFilesFromCatalogue.size() < repackInfo.maxFilesToSelect;
-
-      if (storageClassCheck && maxFilesToSelectCheck) {
-        archiveFilesFromCatalogue.push_back(archiveFile);
-      } else if (totalFilesOnTapeAlreadyChecked) {
-        // Break if the total number of files/bytes on tape has already been counted before
-        allFilesSelected = false;
-        break;
-      } else {
-        allFilesSelected = false;
+  uint64_t nbRetrieveSubrequestsQueued = 0;
+  // The highest fSeq of the tape up to which all the files have been expanded
+  uint64_t expandedFSeq = fSeq > 0 ? fSeq - 1 : 0;
+  // The next page is read from the catalogue while the subrequests of the current one are created and queued
+  std::future<RepackExpansionPage> nextPage;
+  while (true) {
+    if (!page.isLast) {
+      nextPage = std::async(std::launch::async, [&reader] { return reader.readPage(); });
+    }
+    auto& archiveFilesFromCatalogue = page.archiveFiles;
+
+    if (repackInfo.noRecall) {
+      // Here if we find the file in filesInDirectory also in the archiveFilesFromCatalogue we keep it,
+      // we remove all other files. By doing this we make sure, only the archive files we injected to disk are
+      // in the archiveFilesFromCatalogue. The code assumes the operator will use and filenames for the injected files
+      // the fseq of the tape file he wants to replace.
+      archiveFilesFromCatalogue.remove_if(
+        [&repackInfo, &filesInDirectory](const common::dataStructures::ArchiveFile& archiveFile) {
+          //We remove all the elements that are not in the repack buffer so that we don't recall them
+          return std::find_if(filesInDirectory.begin(),
+                              filesInDirectory.end(),
+                              [&archiveFile, &repackInfo](const std::string& fseq) {
+                                //If we find a tape file that has the current fseq and belongs to the VID to repack, then we DON'T remove it from
+                                //the archiveFilesFromCatalogue list
+                                return std::find_if(
+                                         archiveFile.tapeFiles.begin(),
+                                         archiveFile.tapeFiles.end(),
+                                         [&repackInfo, &fseq](const common::dataStructures::TapeFile& tapeFile) {
+                                           //Can we find, in the archiveFilesFromCatalogue list an archiveFile that contains a tapefile that belongs to the VID to repack and that has the
+                                           //fseq of the current file read from the filesInDirectory list ?
+                                           return tapeFile.vid == repackInfo.vid
+                                                  && tapeFile.fSeq
+                                                       == cta::utils::toUint64(cta::utils::removePrefix(fseq, '0'));
+                                         })
+                                       != archiveFile.tapeFiles.end();
+                              })
+                 == filesInDirectory.end();
+        });
+    }
+
+    std::list<SchedulerDatabase::RepackRequest::Subrequest> retrieveSubrequests;
+    uint64_t maxAddedFSeq = 0;
+    while (!archiveFilesFromCatalogue.empty()) {
+      retrieveSubrequests.emplace_back();
+      auto archiveFile = archiveFilesFromCatalogue.front();
+      archiveFilesFromCatalogue.pop_front();
+      auto& retrieveSubRequest = retrieveSubrequests.back();
+
+      retrieveSubRequest.archiveFile = archiveFile;
+      log::ScopedParamContainer params(lc);
+      params.add("archiveFile.diskFileInfo.path", retrieveSubRequest.archiveFile.diskFileInfo.path)
+        .log(log::DEBUG, "In Scheduler::expandRepackRequest(): checking archiveFile to have diskFineInfo path.");
+      retrieveSubRequest.fSeq = std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max();
+
+      //Check that all the archive routes have been configured, if one archive route is missing, we fail the repack
+      //request.
+      auto archiveFileRoutes = archiveRoutesMap[archiveFile.storageClass];
+      auto storageClassOfArchiveFile = std::find_if(
+        storageClasses.begin(),
+        storageClasses.end(),
+        [&archiveFile](const common::dataStructures::StorageClass& sc) { return sc.name == archiveFile.storageClass; });
+
+      if (storageClassOfArchiveFile == storageClasses.end()) {
+        //No storage class have been found for the current tapefile throw an exception
+        deleteRepackBuffer(std::move(dir), lc);
+        std::ostringstream oss;
+        oss << "In Scheduler::expandRepackRequest(): No storage class have been found for the file to repack. "
+               "ArchiveFileID="
+            << archiveFile.archiveFileID << " StorageClass of the file=" << archiveFile.storageClass;
+        throw ExpandRepackRequestException(oss.str());
       }
 
-      if (!totalFilesOnTapeAlreadyChecked) {
-        numberOfFilesCount += 1;
-        numberOfBytesCount += archiveFile.fileSize;
-      }
-    }
+      common::dataStructures::StorageClass sc = *storageClassOfArchiveFile;
 
-    // Only update the total number of files if the value hasn't been already set. Otherwise, reuse old value.
-    if (!totalFilesOnTapeAlreadyChecked) {
-      totalStatsFile.totalFilesOnTapeAtStart = numberOfFilesCount;
-      totalStatsFile.totalBytesOnTapeAtStart = numberOfBytesCount;
-    }
-    totalStatsFile.allFilesSelectedAtStart = allFilesSelected;
-  }
-
-  if (repackInfo.noRecall) {
-    // Here if we find the file in filesInDirectory also in the archiveFilesFromCatalogue we keep it,
-    // we remove all other files. By doing this we make sure, only the archive files we injected to disk are
-    // in the archiveFilesFromCatalogue. The code assumes the operator will use and filenames for the injected files
-    // the fseq of the tape file he wants to replace.
-    archiveFilesFromCatalogue.remove_if(
-      [&repackInfo, &filesInDirectory](const common::dataStructures::ArchiveFile& archiveFile) {
-        //We remove all the elements that are not in the repack buffer so that we don't recall them
-        return std::find_if(filesInDirectory.begin(),
-                            filesInDirectory.end(),
-                            [&archiveFile, &repackInfo](const std::string& fseq) {
-                              //If we find a tape file that has the current fseq and belongs to the VID to repack, then we DON'T remove it from
-                              //the archiveFilesFromCatalogue list
-                              return std::find_if(
-                                       archiveFile.tapeFiles.begin(),
-                                       archiveFile.tapeFiles.end(),
-                                       [&repackInfo, &fseq](const common::dataStructures::TapeFile& tapeFile) {
-                                         //Can we find, in the archiveFilesFromCatalogue list an archiveFile that contains a tapefile that belongs to the VID to repack and that has the
-                                         //fseq of the current file read from the filesInDirectory list ?
-                                         return tapeFile.vid == repackInfo.vid
-                                                && tapeFile.fSeq
-                                                     == cta::utils::toUint64(cta::utils::removePrefix(fseq, '0'));
-                                       })
-                                     != archiveFile.tapeFiles.end();
-                            })
-               == filesInDirectory.end();
-      });
-  }
-
-  std::list<SchedulerDatabase::RepackRequest::Subrequest> retrieveSubrequests;
-  uint64_t maxAddedFSeq = 0;
-  while (!archiveFilesFromCatalogue.empty()) {
-    fSeq++;
-    retrieveSubrequests.emplace_back();
-    auto archiveFile = archiveFilesFromCatalogue.front();
-    archiveFilesFromCatalogue.pop_front();
-    auto& retrieveSubRequest = retrieveSubrequests.back();
-
-    retrieveSubRequest.archiveFile = archiveFile;
-    log::ScopedParamContainer params(lc);
-    params.add("archiveFile.diskFileInfo.path", retrieveSubRequest.archiveFile.diskFileInfo.path)
-      .log(log::DEBUG, "In Scheduler::expandRepackRequest(): checking archiveFile to have diskFineInfo path.");
-    retrieveSubRequest.fSeq = std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max();
-
-    //Check that all the archive routes have been configured, if one archive route is missing, we fail the repack request.
-    auto archiveFileRoutes = archiveRoutesMap[archiveFile.storageClass];
-    auto storageClassOfArchiveFile = std::find_if(
-      storageClasses.begin(),
-      storageClasses.end(),
-      [&archiveFile](const common::dataStructures::StorageClass& sc) { return sc.name == archiveFile.storageClass; });
-
-    if (storageClassOfArchiveFile == storageClasses.end()) {
-      //No storage class have been found for the current tapefile throw an exception
-      deleteRepackBuffer(std::move(dir), lc);
-      std::ostringstream oss;
-      oss << "In Scheduler::expandRepackRequest(): No storage class have been found for the file to repack. "
-             "ArchiveFileID="
-          << archiveFile.archiveFileID << " StorageClass of the file=" << archiveFile.storageClass;
-      throw ExpandRepackRequestException(oss.str());
-    }
-
-    common::dataStructures::StorageClass sc = *storageClassOfArchiveFile;
-
-    // We have to determine which copynbs we want to rearchive, and under which fSeq we record this file.
-    if (repackInfo.type == RepackType::MoveAndAddCopies || repackInfo.type == RepackType::MoveOnly) {
-      // determine which fSeq(s) (normally only one) lives on this tape.
-      for (auto& tc : archiveFile.tapeFiles) {
-        if (tc.vid == repackInfo.vid) {
-          // We make the (reasonable) assumption that the archive file only has one copy on this tape.
-          // If not, we will ensure the subrequest is filed under the lowest fSeq existing on this tape.
-          // This will prevent double subrequest creation (we already have such a mechanism in case of crash and
-          // restart of expansion.
-
-          //Here, test that the archive route of the copyNb of the tape file is configured
-          try {
-            archiveFileRoutes.at(tc.copyNb);
-          } catch (const std::out_of_range&) {
-            deleteRepackBuffer(std::move(dir), lc);
-            std::ostringstream oss;
-            oss << "In Scheduler::expandRepackRequest(): the file archiveFileID=" << archiveFile.archiveFileID
-                << ", copyNb=" << std::to_string(tc.copyNb) << ", storageClass=" << archiveFile.storageClass
-                << " does not have any archive route for archival.";
-            throw ExpandRepackRequestException(oss.str());
-          }
-
-          totalStatsFile.totalFilesToArchive += 1;
-          totalStatsFile.totalBytesToArchive += retrieveSubRequest.archiveFile.fileSize;
-          retrieveSubRequest.copyNbsToRearchive.insert(tc.copyNb);
-          retrieveSubRequest.fSeq = tc.fSeq;
-        }
-      }
-    }
-
-    if (repackInfo.type == RepackType::AddCopiesOnly || repackInfo.type == RepackType::MoveAndAddCopies) {
-      // If the number of copies specified in the storage class of the current ArchiveFile is greater than the number of
-      // tape files we currently have, create an extra copy in addition to the repacked copy.
-      uint64_t numberOfAdditionalCopies =
-        sc.nbCopies > archiveFile.tapeFiles.size() ? sc.nbCopies - archiveFile.tapeFiles.size() : 0;
-      if (numberOfAdditionalCopies > 0) {
-        totalStatsFile.totalFilesToArchive += numberOfAdditionalCopies;
-        totalStatsFile.totalBytesToArchive += (numberOfAdditionalCopies * archiveFile.fileSize);
-        std::set<uint64_t> copyNbsAlreadyInCTA;
+      // We have to determine which copynbs we want to rearchive, and under which fSeq we record this file.
+      if (repackInfo.type == RepackType::MoveAndAddCopies || repackInfo.type == RepackType::MoveOnly) {
+        // determine which fSeq(s) (normally only one) lives on this tape.
         for (auto& tc : archiveFile.tapeFiles) {
-          copyNbsAlreadyInCTA.insert(tc.copyNb);
-          if (tc.vid == repackInfo.vid && repackInfo.type == RepackType::AddCopiesOnly) {
+          if (tc.vid == repackInfo.vid) {
             // We make the (reasonable) assumption that the archive file only has one copy on this tape.
             // If not, we will ensure the subrequest is filed under the lowest fSeq existing on this tape.
             // This will prevent double subrequest creation (we already have such a mechanism in case of crash and
             // restart of expansion.
-            //We found the copy of the file we want to retrieve and archive
-            //retrieveSubRequest.fSeq = tc.fSeq;
-            retrieveSubRequest.fSeq =
-              (retrieveSubRequest.fSeq == std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max()) ?
-                tc.fSeq :
-                std::max(tc.fSeq, retrieveSubRequest.fSeq);
+
+            //Here, test that the archive route of the copyNb of the tape file is configured
+            try {
+              archiveFileRoutes.at(tc.copyNb);
+            } catch (const std::out_of_range&) {
+              deleteRepackBuffer(std::move(dir), lc);
+              std::ostringstream oss;
+              oss << "In Scheduler::expandRepackRequest(): the file archiveFileID=" << archiveFile.archiveFileID
+                  << ", copyNb=" << std::to_string(tc.copyNb) << ", storageClass=" << archiveFile.storageClass
+                  << " does not have any archive route for archival.";
+              throw ExpandRepackRequestException(oss.str());
+            }
+
+            totalStatsFile.totalFilesToArchive += 1;
+            totalStatsFile.totalBytesToArchive += retrieveSubRequest.archiveFile.fileSize;
+            retrieveSubRequest.copyNbsToRearchive.insert(tc.copyNb);
+            retrieveSubRequest.fSeq = tc.fSeq;
           }
         }
-        for (auto archiveFileRoutesItor = archiveFileRoutes.begin(); archiveFileRoutesItor != archiveFileRoutes.end();
-             ++archiveFileRoutesItor) {
-          if (!copyNbsAlreadyInCTA.contains(archiveFileRoutesItor->first)) {
-            //We need to archive the missing copy
-            retrieveSubRequest.copyNbsToRearchive.insert(archiveFileRoutesItor->first);
+      }
+
+      if (repackInfo.type == RepackType::AddCopiesOnly || repackInfo.type == RepackType::MoveAndAddCopies) {
+        // If the number of copies specified in the storage class of the current ArchiveFile is greater than the number
+        // of tape files we currently have, create an extra copy in addition to the repacked copy.
+        uint64_t numberOfAdditionalCopies =
+          sc.nbCopies > archiveFile.tapeFiles.size() ? sc.nbCopies - archiveFile.tapeFiles.size() : 0;
+        if (numberOfAdditionalCopies > 0) {
+          totalStatsFile.totalFilesToArchive += numberOfAdditionalCopies;
+          totalStatsFile.totalBytesToArchive += (numberOfAdditionalCopies * archiveFile.fileSize);
+          std::set<uint64_t> copyNbsAlreadyInCTA;
+          for (auto& tc : archiveFile.tapeFiles) {
+            copyNbsAlreadyInCTA.insert(tc.copyNb);
+            if (tc.vid == repackInfo.vid && repackInfo.type == RepackType::AddCopiesOnly) {
+              // We make the (reasonable) assumption that the archive file only has one copy on this tape.
+              // If not, we will ensure the subrequest is filed under the lowest fSeq existing on this tape.
+              // This will prevent double subrequest creation (we already have such a mechanism in case of crash and
+              // restart of expansion.
+              //We found the copy of the file we want to retrieve and archive
+              //retrieveSubRequest.fSeq = tc.fSeq;
+              retrieveSubRequest.fSeq =
+                (retrieveSubRequest.fSeq == std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max()) ?
+                  tc.fSeq :
+                  std::max(tc.fSeq, retrieveSubRequest.fSeq);
+            }
+          }
+          for (auto archiveFileRoutesItor = archiveFileRoutes.begin(); archiveFileRoutesItor != archiveFileRoutes.end();
+               ++archiveFileRoutesItor) {
+            if (!copyNbsAlreadyInCTA.contains(archiveFileRoutesItor->first)) {
+              //We need to archive the missing copy
+              retrieveSubRequest.copyNbsToRearchive.insert(archiveFileRoutesItor->first);
+            }
+          }
+          if (retrieveSubRequest.copyNbsToRearchive.size() < numberOfAdditionalCopies) {
+            deleteRepackBuffer(std::move(dir), lc);
+            throw ExpandRepackRequestException("In Scheduler::expandRepackRequest(): Missing archive routes for the "
+                                               "creation of the new copies of the files");
+          }
+        } else {
+          if (repackInfo.type == RepackType::AddCopiesOnly) {
+            //Nothing to Archive so nothing to Retrieve as well
+            retrieveSubrequests.pop_back();
+            continue;
           }
         }
-        if (retrieveSubRequest.copyNbsToRearchive.size() < numberOfAdditionalCopies) {
-          deleteRepackBuffer(std::move(dir), lc);
-          throw ExpandRepackRequestException("In Scheduler::expandRepackRequest(): Missing archive routes for the "
-                                             "creation of the new copies of the files");
+      }
+
+      std::stringstream fileName;
+      fileName << std::setw(9) << std::setfill('0') << retrieveSubRequest.fSeq;
+      bool createArchiveSubrequest = false;
+      if (filesInDirectory.count(fileName.str())) {
+        cta::disk::DiskFileFactory fileFactory(0);
+        cta::disk::ReadFile* fileReader = fileFactory.createReadFile(dirBufferURL.str() + fileName.str());
+        if (fileReader->size() == archiveFile.fileSize) {
+          createArchiveSubrequest = true;
         }
-      } else {
-        if (repackInfo.type == RepackType::AddCopiesOnly) {
-          //Nothing to Archive so nothing to Retrieve as well
+      }
+      if (!createArchiveSubrequest
+          && retrieveSubRequest.fSeq == std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max()) {
+        if (!createArchiveSubrequest) {
+          log::ScopedParamContainer params(lc);
+          params.add("fileId", retrieveSubRequest.archiveFile.archiveFileID).add("repackVid", repackInfo.vid);
+          lc.log(log::ERR, "In Scheduler::expandRepackRequest(): no fSeq found for this file on this tape.");
+          totalStatsFile.totalBytesToRetrieve -= retrieveSubRequest.archiveFile.fileSize;
+          totalStatsFile.totalFilesToRetrieve -= 1;
           retrieveSubrequests.pop_back();
-          continue;
         }
+      } else {
+        if (!createArchiveSubrequest) {
+          totalStatsFile.totalBytesToRetrieve += retrieveSubRequest.archiveFile.fileSize;
+          totalStatsFile.totalFilesToRetrieve += 1;
+        } else {
+          totalStatsFile.userProvidedFiles += 1;
+          retrieveSubRequest.hasUserProvidedFile = true;
+        }
+        // We found some copies to rearchive. We still have to decide which file path we are going to use.
+        // File path will be base URL + /<VID>/<fSeq>
+        maxAddedFSeq = std::max(maxAddedFSeq, retrieveSubRequest.fSeq);
+        retrieveSubRequest.fileBufferURL = dirBufferURL.str() + fileName.str();
       }
     }
+    timingList.insOrIncAndReset("buildRetrieveSubrequestsTime", t);
 
-    std::stringstream fileName;
-    fileName << std::setw(9) << std::setfill('0') << retrieveSubRequest.fSeq;
-    bool createArchiveSubrequest = false;
-    if (filesInDirectory.count(fileName.str())) {
-      cta::disk::DiskFileFactory fileFactory(0);
-      cta::disk::ReadFile* fileReader = fileFactory.createReadFile(dirBufferURL.str() + fileName.str());
-      if (fileReader->size() == archiveFile.fileSize) {
-        createArchiveSubrequest = true;
-      }
+    if (page.lastConsideredFSeq.has_value()) {
+      expandedFSeq = std::max(expandedFSeq, page.lastConsideredFSeq.value());
     }
-    if (!createArchiveSubrequest
-        && retrieveSubRequest.fSeq == std::numeric_limits<decltype(retrieveSubRequest.fSeq)>::max()) {
-      if (!createArchiveSubrequest) {
-        log::ScopedParamContainer params(lc);
-        params.add("fileId", retrieveSubRequest.archiveFile.archiveFileID).add("repackVid", repackInfo.vid);
-        lc.log(log::ERR, "In Scheduler::expandRepackRequest(): no fSeq found for this file on this tape.");
-        totalStatsFile.totalBytesToRetrieve -= retrieveSubRequest.archiveFile.fileSize;
-        totalStatsFile.totalFilesToRetrieve -= 1;
-        retrieveSubrequests.pop_back();
+    if (page.isLast) {
+      // Only update the total number of files if the value hasn't been already set. Otherwise, reuse old value.
+      if (!totalFilesOnTapeAlreadyChecked) {
+        totalStatsFile.totalFilesOnTapeAtStart = reader.getNbFilesOnTape();
+        totalStatsFile.totalBytesOnTapeAtStart = reader.getNbBytesOnTape();
       }
-    } else {
-      if (!createArchiveSubrequest) {
-        totalStatsFile.totalBytesToRetrieve += retrieveSubRequest.archiveFile.fileSize;
-        totalStatsFile.totalFilesToRetrieve += 1;
-      } else {
-        totalStatsFile.userProvidedFiles += 1;
-        retrieveSubRequest.hasUserProvidedFile = true;
+      totalStatsFile.allFilesSelectedAtStart = reader.allFilesSelected();
+    }
+
+    // The pages without any subrequest are only recorded with the last one: the request would be considered complete
+    // by the Postgres scheduler if no subrequest had been queued yet.
+    if (!retrieveSubrequests.empty() || page.isLast) {
+      try {
+        // Note: the highest fSeq will be recorded internally in the following call.
+        // We pass the highest fSeq of the tape up to which all the files have been expanded to the db for recording in
+        // the repack request. This will allow restarting from the right value in case of crash.
+        lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): before addSubrequestsAndUpdateStats().");
+
+        const auto nbPageSubrequestsQueued = repackRequest.m_dbReq->addSubrequestsAndUpdateStats(retrieveSubrequests,
+                                                                                                 archiveRoutesMap,
+                                                                                                 expandedFSeq,
+                                                                                                 maxAddedFSeq,
+                                                                                                 totalStatsFile,
+                                                                                                 diskSystemList,
+                                                                                                 lc);
+        lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): after addSubrequestsAndUpdateStats().");
+        nbRetrieveSubrequestsQueued += nbPageSubrequestsQueued;
+        cta::telemetry::metrics::ctaSchedulerRepackExpandCount->Add(nbPageSubrequestsQueued);
+      } catch (const cta::ExpandRepackRequestException&) {
+        deleteRepackBuffer(std::move(dir), lc);
+        throw;
       }
-      // We found some copies to rearchive. We still have to decide which file path we are going to use.
-      // File path will be base URL + /<VID>/<fSeq>
-      maxAddedFSeq = std::max(maxAddedFSeq, retrieveSubRequest.fSeq);
-      retrieveSubRequest.fileBufferURL = dirBufferURL.str() + fileName.str();
+      timingList.insOrIncAndReset("addSubrequestsAndUpdateStatsTime", t);
     }
+
+    if (page.isLast) {
+      break;
+    }
+    page = nextPage.get();
+    timingList.insOrIncAndReset("catalogueGetArchiveFilesForRepackItorTime", t);
   }
-  auto diskSystemList = m_catalogue.DiskSystem()->getAllDiskSystems();
-  timingList.insertAndReset("getDisksystemsListTime", t);
-  try {
-    // Note: the highest fSeq will be recorded internally in the following call.
-    // We know that the fSeq processed on the tape are >= initial fSeq + filesCount - 1 (or fSeq - 1 as we counted).
-    // We pass this information to the db for recording in the repack request. This will allow restarting from the right
-    // value in case of crash.
-    lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): before addSubrequestsAndUpdateStats().");
-
-    nbRetrieveSubrequestsQueued = repackRequest.m_dbReq->addSubrequestsAndUpdateStats(retrieveSubrequests,
-                                                                                      archiveRoutesMap,
-                                                                                      fSeq,
-                                                                                      maxAddedFSeq,
-                                                                                      totalStatsFile,
-                                                                                      diskSystemList,
-                                                                                      lc);
-    lc.log(log::DEBUG, "In Scheduler::expandRepackRequest(): after addSubrequestsAndUpdateStats().");
-    cta::telemetry::metrics::ctaSchedulerRepackExpandCount->Add(nbRetrieveSubrequestsQueued);
-  } catch (const cta::ExpandRepackRequestException&) {
-    deleteRepackBuffer(std::move(dir), lc);
-    throw;
-  }
-  timingList.insertAndReset("addSubrequestsAndUpdateStatsTime", t);
 
   log::ScopedParamContainer params(lc);
   params.add("tapeVid", repackInfo.vid);
   params.add("nbRetrieveSubrequestsQueued", nbRetrieveSubrequestsQueued);
   timingList.addToLog(params);
 
-  if (archiveFilesFromCatalogue.empty() && totalStatsFile.totalFilesToArchive == 0
+  if (totalStatsFile.totalFilesToArchive == 0
       && (totalStatsFile.totalFilesToRetrieve == 0 || nbRetrieveSubrequestsQueued == 0)) {
     //If no files have been retrieved, the repack buffer will have to be deleted
     //TODO : in case of Repack tape repair, we should not try to delete the buffer
@@ -3070,29 +3301,63 @@ void Scheduler::reportArchiveJobsBatch(std::list<std::unique_ptr<ArchiveJob>>& a
                                        disk::DiskReporterFactory& reporterFactory,
                                        log::TimingList& timingList,
                                        utils::Timer& t,
-                                       log::LogContext& lc) {
+                                       log::LogContext& lc,
+                                       size_t maxReportsInFlightPerEndpoint) {
   utils::Timer ttel;
 
-  // Create the reporters
-  struct JobAndReporter {
-    std::unique_ptr<disk::DiskReporter> reporter;
-    ArchiveJob* archiveJob;
-  };
-
-  std::list<JobAndReporter> pendingReports;
+  // Launch the reports, with a bounded number of reports in flight to each disk instance
   std::list<ArchiveJob*> reportedJobs;
+  disk::DiskReportWindow reportWindow(maxReportsInFlightPerEndpoint);
+  // The window calls this while launching the report of another job: the errors of this job must not escape from here
+  auto onReportCompletion = [&reportedJobs, &lc](ArchiveJob* archiveJob, std::exception_ptr error) {
+    if (!error) {
+      reportedJobs.push_back(archiveJob);
+      return;
+    }
+    try {
+      std::string errorMessage;
+      try {
+        std::rethrow_exception(error);
+      } catch (cta::exception::Exception& ex) {
+        errorMessage = ex.getMessageValue();
+      } catch (std::exception& ex) {
+        errorMessage = ex.what();
+      }
+      // Log the error, update the request.
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", archiveJob->archiveFile.archiveFileID)
+        .add("reportType", archiveJob->reportType())
+        .add(semconv::log::exceptionMessage, errorMessage);
+      lc.log(log::ERR, "In Scheduler::reportArchiveJobsBatch(): failed to report.");
+      try {
+        archiveJob->reportFailed(errorMessage, lc);
+      } catch (const cta::exception::NoSuchObject& ex) {
+        params.add(semconv::log::exceptionMessage, ex.getMessageValue());
+        lc.log(log::WARNING,
+               "In Scheduler::reportArchiveJobsBatch(): failed to reportFailed the current job because it does not "
+               "exist in the objectstore.");
+      }
+    } catch (std::exception& ex) {
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", archiveJob->archiveFile.archiveFileID).add(semconv::log::exceptionMessage, ex.what());
+      lc.log(log::ERR, "In Scheduler::reportArchiveJobsBatch(): failed to record the failure of a report.");
+    } catch (...) {
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", archiveJob->archiveFile.archiveFileID);
+      lc.log(log::ERR,
+             "In Scheduler::reportArchiveJobsBatch(): failed to record the failure of a report: unknown exception.");
+    }
+  };
   for (auto& j : archiveJobsBatch) {
-    pendingReports.push_back(JobAndReporter());
-    auto& current = pendingReports.back();
     // We could fail to create the disk reporter or to get the report URL. This should not impact the other jobs.
     try {
-      current.reporter.reset(reporterFactory.createDiskReporter(j->exceptionThrowingReportURL()));
-      current.reporter->asyncReport();
-      current.archiveJob = j.get();
+      std::unique_ptr<disk::DiskReporter> reporter(reporterFactory.createDiskReporter(j->exceptionThrowingReportURL()));
+      reportWindow.report(std::move(reporter),
+                          [&onReportCompletion, archiveJob = j.get()](std::exception_ptr error) {
+                            onReportCompletion(archiveJob, error);
+                          });
     } catch (cta::exception::Exception& ex) {
       // Whether creation or launching of reporter failed, the promise will not receive result, so we can safely delete it.
-      // we will first determine if we need to clean up the reporter as well or not.
-      pendingReports.pop_back();
       // We are ready to carry on for other files without interactions.
       // Log the error, update the request.
       log::ScopedParamContainer params(lc);
@@ -3113,29 +3378,7 @@ void Scheduler::reportArchiveJobsBatch(std::list<std::unique_ptr<ArchiveJob>>& a
     }
   }
   timingList.insertAndReset("asyncReportLaunchTime", t);
-  for (auto& current : pendingReports) {
-    try {
-      current.reporter->waitReport();
-      reportedJobs.push_back(current.archiveJob);
-    } catch (cta::exception::Exception& ex) {
-      // Log the error, update the request.
-      log::ScopedParamContainer params(lc);
-      params.add("fileId", current.archiveJob->archiveFile.archiveFileID)
-        .add("reportType", current.archiveJob->reportType())
-        .add(semconv::log::exceptionMessage, ex.getMessageValue());
-      lc.log(log::ERR, "In Scheduler::reportArchiveJobsBatch(): failed to report.");
-      try {
-        current.archiveJob->reportFailed(ex.getMessageValue(), lc);
-      } catch (const cta::exception::NoSuchObject& ex) {
-        params.add("fileId", current.archiveJob->archiveFile.archiveFileID)
-          .add("reportType", current.archiveJob->reportType())
-          .add(semconv::log::exceptionMessage, ex.getMessageValue());
-        lc.log(log::WARNING,
-               "In Scheduler::reportArchiveJobsBatch(): failed to reportFailed the current job because it does not "
-               "exist in the objectstore.");
-      }
-    }
-  }
+  reportWindow.waitAll();
   std::list<SchedulerDatabase::ArchiveJob*> reportedDbJobs;
   for (auto& j : reportedJobs) {
     reportedDbJobs.push_back(j->m_dbJob.get());
@@ -3222,29 +3465,56 @@ void Scheduler::reportRetrieveJobsBatch(std::list<std::unique_ptr<RetrieveJob>>&
                                         disk::DiskReporterFactory& reporterFactory,
                                         log::TimingList& timingList,
                                         utils::Timer& t,
-                                        log::LogContext& lc) {
+                                        log::LogContext& lc,
+                                        size_t maxReportsInFlightPerEndpoint) {
   utils::Timer ttel;
 
-  // Create the reporters
-  struct JobAndReporter {
-    std::unique_ptr<disk::DiskReporter> reporter;
-    RetrieveJob* retrieveJob;
-  };
-
-  std::list<JobAndReporter> pendingReports;
+  // Launch the reports, with a bounded number of reports in flight to each disk instance
   std::list<RetrieveJob*> reportedJobs;
+  disk::DiskReportWindow reportWindow(maxReportsInFlightPerEndpoint);
+  // As for archive reports, the errors of a completed report must be handled here and not reach the launch loop
+  auto onReportCompletion = [&reportedJobs, &lc](RetrieveJob* retrieveJob, std::exception_ptr error) {
+    if (!error) {
+      reportedJobs.push_back(retrieveJob);
+      return;
+    }
+    try {
+      std::string errorMessage;
+      try {
+        std::rethrow_exception(error);
+      } catch (cta::exception::Exception& ex) {
+        errorMessage = ex.getMessageValue();
+      } catch (std::exception& ex) {
+        errorMessage = ex.what();
+      }
+      // Log the error, update the request.
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", retrieveJob->archiveFile.archiveFileID)
+        .add("reportType", retrieveJob->reportType())
+        .add(semconv::log::exceptionMessage, errorMessage);
+      lc.log(log::ERR, "In Scheduler::reportRetrieveJobsBatch(): failed to report.");
+      retrieveJob->reportFailed(errorMessage, lc);
+    } catch (std::exception& ex) {
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", retrieveJob->archiveFile.archiveFileID).add(semconv::log::exceptionMessage, ex.what());
+      lc.log(log::ERR, "In Scheduler::reportRetrieveJobsBatch(): failed to record the failure of a report.");
+    } catch (...) {
+      log::ScopedParamContainer params(lc);
+      params.add("fileId", retrieveJob->archiveFile.archiveFileID);
+      lc.log(log::ERR,
+             "In Scheduler::reportRetrieveJobsBatch(): failed to record the failure of a report: unknown exception.");
+    }
+  };
   for (auto& j : retrieveJobsBatch) {
-    pendingReports.push_back(JobAndReporter());
-    auto& current = pendingReports.back();
     // We could fail to create the disk reporter or to get the report URL. This should not impact the other jobs.
     try {
-      current.reporter.reset(reporterFactory.createDiskReporter(j->exceptionThrowingReportURL()));
-      current.reporter->asyncReport();
-      current.retrieveJob = j.get();
+      std::unique_ptr<disk::DiskReporter> reporter(reporterFactory.createDiskReporter(j->exceptionThrowingReportURL()));
+      reportWindow.report(std::move(reporter),
+                          [&onReportCompletion, retrieveJob = j.get()](std::exception_ptr error) {
+                            onReportCompletion(retrieveJob, error);
+                          });
     } catch (cta::exception::Exception& ex) {
       // Whether creation or launching of reporter failed, the promise will not receive result, so we can safely delete it.
-      // we will first determine if we need to clean up the reporter as well or not.
-      pendingReports.pop_back();
       // We are ready to carry on for other files without interactions.
       // Log the error, update the request.
       log::ScopedParamContainer params(lc);
@@ -3256,20 +3526,7 @@ void Scheduler::reportRetrieveJobsBatch(std::list<std::unique_ptr<RetrieveJob>>&
     }
   }
   timingList.insertAndReset("asyncReportLaunchTime", t);
-  for (auto& current : pendingReports) {
-    try {
-      current.reporter->waitReport();
-      reportedJobs.push_back(current.retrieveJob);
-    } catch (cta::exception::Exception& ex) {
-      // Log the error, update the request.
-      log::ScopedParamContainer params(lc);
-      params.add("fileId", current.retrieveJob->archiveFile.archiveFileID)
-        .add("reportType", current.retrieveJob->reportType())
-        .add(semconv::log::exceptionMessage, ex.getMessageValue());
-      lc.log(log::ERR, "In Scheduler::reportRetrieveJobsBatch(): failed to report.");
-      current.retrieveJob->reportFailed(ex.getMessageValue(), lc);
-    }
-  }
+  reportWindow.waitAll();
   timingList.insertAndReset("reportCompletionTime", t);
   std::list<SchedulerDatabase::RetrieveJob*> reportedDbJobs;
   for (auto& j : reportedJobs) {
@@ -29,20 +29,24 @@
 #include "common/log/TimingList.hpp"
 #include "common/utils/Timer.hpp"
 #include "disk/DiskFile.hpp"
+#include "disk/DiskReportWindow.hpp"
 #include "disk/DiskReporter.hpp"
 #include "disk/DiskReporterFactory.hpp"
+#include "disk/DiskSystem.hpp"
 #include "scheduler/IScheduler.hpp"
 #include "scheduler/RepackRequest.hpp"
 #include "scheduler/SchedulerDatabase.hpp"
 #include "scheduler/TapeMount.hpp"
 #include "taped/daemon/common/TapedConfiguration.hpp"
 
+#include <exception>
 #include <list>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace cta {
 
@@ -128,6 +132,25 @@ public:
                                         const common::dataStructures::RequesterIdentity& user,
                                         log::LogContext& lc) const;
 
+  /**
+   * Checks the specified archivals could take place and returns the specified
+   * number of new and unique archive file identifiers, for example for a batch
+   * of files of the same storage class and requester.
+   *
+   * @param diskInstanceName The name of the disk instance to which the
+   * storage class belongs.
+   * @param storageClassName The name of the storage class of the files to be
+   * archived.
+   * @param user The user for whom the files are to be archived.
+   * @param nbIds The number of archive file identifiers to return.
+   * @return The new archive file identifiers.
+   */
+  std::list<uint64_t> checkAndGetNextArchiveFileIds(const std::string& diskInstanceName,
+                                                    const std::string& storageClassName,
+                                                    const common::dataStructures::RequesterIdentity& user,
+                                                    const uint64_t nbIds,
+                                                    log::LogContext& lc) const;
+
   /**
    * Queue the specified archive request.
    * Throws a UserError exception in case of wrong request parameters (ex. no route to tape)
@@ -143,6 +166,32 @@ public:
                                       const cta::common::dataStructures::ArchiveRequest& request,
                                       log::LogContext& lc);
 
+  /**
+   * The outcome of queueing one of the requests given to queueArchivesWithGivenIds().
+   */
+  using QueueArchiveResult = SchedulerDatabase::QueueArchiveResult;
+
+  /**
+   * Queue several archive requests, for example the files closed by a batch
+   * of workflow events.  The queue criteria of the requests with the same
+   * storage class and requester are got from the catalogue once, and the
+   * requests are queued with a single call to SchedulerDatabase::queueArchives().
+   * A request which cannot be queued, for example because it is for a
+   * zero-length file, does not prevent the others from being queued: the
+   * exception which queueArchiveWithGivenId() would have thrown for it is
+   * returned in its result.
+   * @param archiveFileIds The archive file identifier of each request.
+   * @param instanceName name of the EOS instance
+   * @param requests the archive requests
+   * @param lc a log context allowing logging from within the scheduler routine.
+   * @return The outcome of queueing each request, in the order of the requests.
+   */
+  std::vector<QueueArchiveResult>
+  queueArchivesWithGivenIds(const std::vector<uint64_t>& archiveFileIds,
+                            const std::string& instanceName,
+                            const std::vector<cta::common::dataStructures::ArchiveRequest>& requests,
+                            log::LogContext& lc);
+
   /**
    * Queue a retrieve request.
    * Throws a UserError exception in case of wrong request parameters (ex. unknown file id)
@@ -153,6 +202,27 @@ public:
                             cta::common::dataStructures::RetrieveRequest& request,
                             log::LogContext& lc);
 
+  /**
+   * The outcome of queueing one of the requests given to queueRetrieves().
+   */
+  struct QueueRetrieveResult {
+    std::string requestId;     //!< Opaque id of the queued request, empty if the request was not queued
+    std::exception_ptr error;  //!< Exception which prevented the request from being queued, nullptr if it was queued
+  };
+
+  /**
+   * Queue several retrieve requests, for example the files of a multi-file
+   * prepare.  The queue criteria of the requests with the same requester,
+   * activity and mount policy are got from the catalogue in one pass.
+   * A request which cannot be queued, for example because its file does not
+   * exist, does not prevent the others from being queued: the exception which
+   * queueRetrieve() would have thrown for it is returned in its result.
+   * @return The outcome of queueing each request, in the order of the requests.
+   */
+  std::vector<QueueRetrieveResult> queueRetrieves(const std::string& instanceName,
+                                                  std::vector<cta::common::dataStructures::RetrieveRequest>& requests,
+                                                  log::LogContext& lc);
+
   /**
    * Delete an archived file or a file which is in the process of being archived.
    * Throws a UserError exception in case of wrong request parameters (ex. unknown file id)
@@ -497,18 +567,44 @@ public:
   std::list<std::unique_ptr<ArchiveJob>> getNextArchiveJobsToReportBatch(uint64_t filesRequested,
                                                                          log::LogContext& logContext);
 
-  void reportArchiveJobsBatch(std::list<std::unique_ptr<ArchiveJob>>& archiveJobsBatch,
-                              cta::disk::DiskReporterFactory& reporterFactory,
-                              log::TimingList&,
-                              utils::Timer&,
-                              log::LogContext&);
+  /**
+   * Reports the specified archive jobs to their disk instances and records the successful reports in the scheduler
+   * database in one batch
+   *
+   * @param maxReportsInFlightPerEndpoint the maximum number of reports in flight to each disk instance
+   */
+  void reportArchiveJobsBatch(
+    std::list<std::unique_ptr<ArchiveJob>>& archiveJobsBatch,
+    cta::disk::DiskReporterFactory& reporterFactory,
+    log::TimingList&,
+    utils::Timer&,
+    log::LogContext&,
+    size_t maxReportsInFlightPerEndpoint = disk::DiskReportWindow::DEFAULT_MAX_IN_FLIGHT_PER_ENDPOINT);
 
   /*============== Repack support ===========================================*/
   // Promotion of requests
   void promoteRepackRequestsToToExpand(log::LogContext& lc, size_t repackMaxRequestsToExpand);
   // Expansion support
   std::unique_ptr<RepackRequest> getNextRepackRequestToExpand();
-  void expandRepackRequest(const RepackRequest& repackRequest, log::TimingList&, utils::Timer&, log::LogContext&) const;
+  /**
+   * The default number of files of the tape to repack read from the catalogue at once during an expansion
+   */
+  static constexpr uint64_t DEFAULT_REPACK_EXPANSION_PAGE_SIZE = 10000;
+
+  /**
+   * Expands a repack request into retrieve subrequests for the files of its tape
+   *
+   * The files are read from the catalogue page by page. The next page is read while the subrequests of the current
+   * one are created and queued, and the last expanded fSeq is recorded after each page so that an interrupted
+   * expansion does not queue again the subrequests already queued.
+   *
+   * @param pageSize The maximum number of files read from the catalogue at once
+   */
+  void expandRepackRequest(const RepackRequest& repackRequest,
+                           log::TimingList&,
+                           utils::Timer&,
+                           log::LogContext&,
+                           uint64_t pageSize = DEFAULT_REPACK_EXPANSION_PAGE_SIZE) const;
 
   // Scheduler level will not distinguish between report types. It will just do a getnext-report cycle.
   class RepackReportBatch {
@@ -546,11 +642,19 @@ public:
   std::list<std::unique_ptr<RetrieveJob>> getNextRetrieveJobsToReportBatch(uint64_t filesRequested,
                                                                            log::LogContext& logContext);
 
-  void reportRetrieveJobsBatch(std::list<std::unique_ptr<RetrieveJob>>& retrieveJobsBatch,
-                               disk::DiskReporterFactory& reporterFactory,
-                               log::TimingList&,
-                               utils::Timer&,
-                               log::LogContext&);
+  /**
+   * Reports the specified retrieve jobs to their disk instances and records the successful reports in the scheduler
+   * database in one batch
+   *
+   * @param maxReportsInFlightPerEndpoint the maximum number of reports in flight to each disk instance
+   */
+  void reportRetrieveJobsBatch(
+    std::list<std::unique_ptr<RetrieveJob>>& retrieveJobsBatch,
+    disk::DiskReporterFactory& reporterFactory,
+    log::TimingList&,
+    utils::Timer&,
+    log::LogContext&,
+    size_t maxReportsInFlightPerEndpoint = disk::DiskReportWindow::DEFAULT_MAX_IN_FLIGHT_PER_ENDPOINT);
 
   /*!
    * Batch job factory
@@ -578,6 +682,32 @@ public:
   cta::catalogue::Catalogue& getCatalogue();
 
 private:
+  /**
+   * Common part to queueRetrieve() and queueRetrieves() queueing a retrieve
+   * request once its queue criteria have been got from the catalogue.
+   *
+   * @param catalogueTime The time spent getting the queue criteria, for logging.
+   */
+  std::string queueRetrieveWithCriteria(const std::string& instanceName,
+                                        cta::common::dataStructures::RetrieveRequest& request,
+                                        common::dataStructures::RetrieveFileQueueCriteria queueCriteria,
+                                        const disk::DiskSystemList& diskSystemList,
+                                        const double catalogueTime,
+                                        log::LogContext& lc);
+
+  /**
+   * Log the queueing of an archive request
+   *
+   * @param message The message to log.
+   */
+  static void logQueuedArchive(const std::string& instanceName,
+                               const cta::common::dataStructures::ArchiveRequest& request,
+                               const common::dataStructures::ArchiveFileQueueCriteriaAndFileId& catalogueInfo,
+                               const double catalogueTime,
+                               const double schedulerDbTime,
+                               const std::string& message,
+                               log::LogContext& lc);
+
   /**
    * The catalogue.
    */
@@ -12,6 +12,24 @@ namespace cta {
 //------------------------------------------------------------------------------
 cta::SchedulerDatabase::~SchedulerDatabase() = default;
 
+//------------------------------------------------------------------------------
+// queueArchives
+//------------------------------------------------------------------------------
+std::vector<SchedulerDatabase::QueueArchiveResult>
+SchedulerDatabase::queueArchives(const std::string& instanceName,
+                                 const std::vector<ArchiveToQueue>& archives,
+                                 log::LogContext& logContext) {
+  std::vector<QueueArchiveResult> results(archives.size());
+  for (size_t i = 0; i < archives.size(); i++) {
+    try {
+      results[i].requestId = queueArchive(instanceName, archives[i].request, archives[i].criteria, logContext);
+    } catch (...) {
+      results[i].error = std::current_exception();
+    }
+  }
+  return results;
+}
+
 SchedulerDatabase::RepackRequestStatistics::RepackRequestStatistics() {
   using Status = common::dataStructures::RepackInfo::Status;
   for (auto& s :
@@ -35,6 +35,7 @@
 #include "scheduler/TapeMount.hpp"
 #include "taped/daemon/common/TapedConfiguration.hpp"
 
+#include <exception>
 #include <limits>
 #include <list>
 #include <map>
@@ -126,6 +127,38 @@ public:
                                    const cta::common::dataStructures::ArchiveFileQueueCriteriaAndFileId& criteria,
                                    log::LogContext& logContext) = 0;
 
+  /**
+   * An archive request given to queueArchives(), with the criteria to be used
+   * to queue it.
+   */
+  struct ArchiveToQueue {
+    cta::common::dataStructures::ArchiveRequest request;
+    cta::common::dataStructures::ArchiveFileQueueCriteriaAndFileId criteria;
+  };
+
+  /**
+   * The outcome of queueing one of the requests given to queueArchives().
+   */
+  struct QueueArchiveResult {
+    std::string requestId;     //!< Address of the queued request, empty if the request was not queued
+    std::exception_ptr error;  //!< Exception which prevented the request from being queued, nullptr if it was queued
+  };
+
+  /**
+   * Queues several archive requests of the same disk instance.  The default
+   * implementation queues them one by one with queueArchive(); a database
+   * able to do so queues them in a single transaction, in which case they
+   * are either all queued or all fail with the same error.
+   *
+   * @param instanceName The disk instance of the requests.
+   * @param archives The requests and their queue criteria.
+   * @param logContext context allowing logging db operation
+   * @return The outcome of queueing each request, in the order of the requests.
+   */
+  virtual std::vector<QueueArchiveResult> queueArchives(const std::string& instanceName,
+                                                        const std::vector<ArchiveToQueue>& archives,
+                                                        log::LogContext& logContext);
+
   /**
    * Returns all of the queued archive jobs.  The returned jobs are
    * grouped by tape pool and then sorted by creation time, oldest first.
@@ -632,6 +665,7 @@ public:
   class RepackRequest {
   public:
     cta::common::dataStructures::RepackInfo repackInfo;
+    // The last expanded fSeq is stored as an exclusive bound: the first fSeq of the tape not expanded yet
     virtual uint64_t getLastExpandedFSeq() = 0;
     virtual void setLastExpandedFSeq(uint64_t fseq) = 0;
 
@@ -657,7 +691,8 @@ public:
 
     /**
      * Add Retrieve subrequests to the repack request and update its statistics
-     * @return the number of retrieve subrequests queued
+     * Called once for each page of files expanded, the statistics are the totals of the pages expanded so far
+     * @return the number of retrieve subrequests queued by this call
      */
     virtual uint64_t
     addSubrequestsAndUpdateStats(const std::list<Subrequest>& repackSubrequests,
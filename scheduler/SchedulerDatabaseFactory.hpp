@@ -60,6 +60,12 @@ public:
     return m_SchedDB->queueArchive(instanceName, request, criteria, logContext);
   }
 
+  std::vector<QueueArchiveResult> queueArchives(const std::string& instanceName,
+                                                const std::vector<ArchiveToQueue>& archives,
+                                                log::LogContext& logContext) override {
+    return m_SchedDB->queueArchives(instanceName, archives, logContext);
+  }
+
   void deleteRetrieveRequest(const common::dataStructures::SecurityIdentity& cliIdentity,
                              const std::string& remoteFile) override {
     m_SchedDB->deleteRetrieveRequest(cliIdentity, remoteFile);
@@ -485,6 +485,69 @@ TEST_P(SchedulerTest, archive_to_new_file) {
   }
 }
 
+TEST_P(SchedulerTest, archive_batch_of_new_files) {
+  using namespace cta;
+
+  setupDefaultCatalogue();
+  Scheduler& scheduler = getScheduler();
+
+  cta::common::dataStructures::EntryLog creationLog;
+  creationLog.host = "host2";
+  creationLog.time = 0;
+  creationLog.username = "admin1";
+  cta::common::dataStructures::RequesterIdentity requester;
+  requester.name = s_userName;
+  requester.group = "userGroup";
+
+  log::DummyLogger dl("", "");
+  log::LogContext lc(dl);
+  const uint64_t nbFiles = 3;
+  const auto archiveFileIdList =
+    scheduler.checkAndGetNextArchiveFileIds(s_diskInstance, s_storageClassName, requester, nbFiles, lc);
+  ASSERT_EQ(nbFiles, archiveFileIdList.size());
+  const std::vector<uint64_t> archiveFileIds(archiveFileIdList.begin(), archiveFileIdList.end());
+  ASSERT_EQ(nbFiles, std::set<uint64_t>(archiveFileIds.begin(), archiveFileIds.end()).size());
+
+  std::vector<cta::common::dataStructures::ArchiveRequest> requests;
+  for (uint64_t i = 0; i < nbFiles; i++) {
+    cta::common::dataStructures::ArchiveRequest request;
+    request.checksumBlob.insert(cta::checksum::ADLER32, "1111");
+    request.creationLog = creationLog;
+    request.diskFileInfo.gid = GROUP_2;
+    request.diskFileInfo.owner_uid = CMS_USER;
+    request.diskFileInfo.path = "path/to/file" + std::to_string(i);
+    request.diskFileID = "diskFileID" + std::to_string(i);
+    // The second file is empty and cannot be queued
+    request.fileSize = i == 1 ? 0 : 100 * 1000 * 1000;
+    request.requester = requester;
+    request.srcURL = "srcURL" + std::to_string(i);
+    request.storageClass = s_storageClassName;
+    requests.push_back(request);
+  }
+
+  const auto results = scheduler.queueArchivesWithGivenIds(archiveFileIds, s_diskInstance, requests, lc);
+  scheduler.waitSchedulerDbSubthreadsComplete();
+
+  // The results are in the order of the requests
+  ASSERT_EQ(nbFiles, results.size());
+  ASSERT_FALSE(results[0].error);
+  ASSERT_THROW(std::rethrow_exception(results[1].error), cta::exception::UserError);
+  ASSERT_TRUE(results[1].requestId.empty());
+  ASSERT_FALSE(results[2].error);
+
+  {
+    auto rqsts = scheduler.getPendingArchiveJobs(lc);
+    ASSERT_EQ(1, rqsts.size());
+    auto poolItor = rqsts.cbegin();
+    ASSERT_TRUE(s_tapePoolName_default == poolItor->first);
+    std::set<std::string> remoteFiles;
+    for (const auto& rqst : poolItor->second) {
+      remoteFiles.insert(rqst.request.diskFileInfo.path);
+    }
+    ASSERT_EQ(std::set<std::string>({requests[0].diskFileInfo.path, requests[2].diskFileInfo.path}), remoteFiles);
+  }
+}
+
 // smurray commented this test out on Mon 17 Jul 2017.  The test assumes that
 // Scheduler::deleteArchive() calls SchedulerDatabase::deleteArchiveRequest().
 // This fact is currently not true as Scheduler::deleteArchive() has been
@@ -2434,6 +2497,106 @@ TEST_P(SchedulerTest, retrieve_non_existing_file) {
   }
 }
 
+TEST_P(SchedulerTest, queueRetrieves) {
+  using namespace cta;
+
+  auto& catalogue = getCatalogue();
+  auto& scheduler = getScheduler();
+
+  setupDefaultCatalogue();
+
+  log::DummyLogger dl("", "");
+  log::LogContext lc(dl);
+
+  const bool libraryIsDisabled = false;
+  std::optional<std::string> physicalLibraryName;
+  catalogue.LogicalLibrary()->createLogicalLibrary(s_adminOnAdminHost,
+                                                   s_libraryName,
+                                                   libraryIsDisabled,
+                                                   physicalLibraryName,
+                                                   "Create logical library");
+  auto tape = getDefaultTape();
+  catalogue.Tape()->createTape(s_adminOnAdminHost, tape);
+
+  //Simulate the writing of 3 files on the tape in the catalogue
+  const uint64_t nbArchiveFiles = 3;
+  {
+    std::set<catalogue::TapeItemWrittenPointer> tapeFilesWritten;
+    checksum::ChecksumBlob checksumBlob;
+    checksumBlob.insert(cta::checksum::ADLER32, "1234");
+    for (uint64_t archiveFileId = 1; archiveFileId <= nbArchiveFiles; ++archiveFileId) {
+      auto fileWrittenUP = std::make_unique<cta::catalogue::TapeFileWritten>();
+      auto& fileWritten = *fileWrittenUP;
+      fileWritten.archiveFileId = archiveFileId;
+      fileWritten.diskInstance = s_diskInstance;
+      fileWritten.diskFileId = std::to_string(12345677 + archiveFileId);
+      fileWritten.diskFileOwnerUid = PUBLIC_OWNER_UID;
+      fileWritten.diskFileGid = PUBLIC_GID;
+      fileWritten.size = 1000;
+      fileWritten.checksumBlob = checksumBlob;
+      fileWritten.storageClassName = s_storageClassName;
+      fileWritten.vid = tape.vid;
+      fileWritten.fSeq = archiveFileId;
+      fileWritten.blockId = archiveFileId * 100;
+      fileWritten.copyNb = 1;
+      fileWritten.tapeDrive = "tape_drive";
+      tapeFilesWritten.emplace(fileWrittenUP.release());
+    }
+    catalogue.TapeFile()->filesWrittenToTape(tapeFilesWritten);
+  }
+
+  //Queue the 3 files and a non-existing one in a single call
+  std::vector<Scheduler::QueueRetrieveResult> results;
+  {
+    cta::common::dataStructures::EntryLog creationLog;
+    creationLog.host = "host2";
+    creationLog.time = 0;
+    creationLog.username = "admin1";
+    cta::common::dataStructures::DiskFileInfo diskFileInfo;
+    diskFileInfo.gid = GROUP_2;
+    diskFileInfo.owner_uid = CMS_USER;
+    diskFileInfo.path = "path/to/file";
+    std::vector<cta::common::dataStructures::RetrieveRequest> requests;
+    for (uint64_t archiveFileId : {1, 2, 12345, 3}) {
+      cta::common::dataStructures::RetrieveRequest request;
+      request.archiveFileID = archiveFileId;
+      request.creationLog = creationLog;
+      request.diskFileInfo = diskFileInfo;
+      request.dstURL = "dstURL" + std::to_string(archiveFileId);
+      request.requester.name = s_userName;
+      request.requester.group = "userGroup";
+      requests.push_back(request);
+    }
+    results = scheduler.queueRetrieves(s_diskInstance, requests, lc);
+    scheduler.waitSchedulerDbSubthreadsComplete();
+  }
+
+  //Only the non-existing file should have failed to be queued
+  ASSERT_EQ(4, results.size());
+  for (size_t i : {0, 1, 3}) {
+    ASSERT_FALSE(results.at(i).requestId.empty());
+    ASSERT_EQ(nullptr, results.at(i).error);
+  }
+  ASSERT_TRUE(results.at(2).requestId.empty());
+  ASSERT_NE(nullptr, results.at(2).error);
+  ASSERT_THROW(std::rethrow_exception(results.at(2).error), cta::exception::UserError);
+
+  //The 3 existing files should be queued on the tape
+  {
+    auto rqsts = scheduler.getPendingRetrieveJobs(lc);
+    ASSERT_EQ(1, rqsts.size());
+    auto& jobs = rqsts.at(tape.vid);
+    ASSERT_EQ(nbArchiveFiles, jobs.size());
+    std::set<uint64_t> queuedArchiveFileIds;
+    for (auto& job : jobs) {
+      ASSERT_EQ(1, job.tapeCopies.size());
+      ASSERT_EQ("dstURL" + std::to_string(job.request.archiveFileID), job.request.dstURL);
+      queuedArchiveFileIds.insert(job.request.archiveFileID);
+    }
+    ASSERT_EQ((std::set<uint64_t> {1, 2, 3}), queuedArchiveFileIds);
+  }
+}
+
 TEST_P(SchedulerTest, showqueues) {
   using namespace cta;
 
@@ -3230,6 +3393,224 @@ TEST_P(SchedulerTest, expandRepackRequestWithMaxFiles) {
   }
 }
 
+TEST_P(SchedulerTest, expandRepackRequestByPages) {
+  using namespace cta;
+  using cta::common::dataStructures::JobQueueType;
+  unitTests::TempDirectory tempDirectory;
+
+  auto& catalogue = getCatalogue();
+  auto& scheduler = getScheduler();
+  auto& schedulerDB = getSchedulerDB();
+
+  setupDefaultCatalogue();
+  catalogue.DiskInstance()->createDiskInstance({"user", "host"}, "diskInstance", "no comment");
+  catalogue.DiskInstanceSpace()->createDiskInstanceSpace({"user", "host"},
+                                                         "diskInstanceSpace",
+                                                         "diskInstance",
+                                                         "constantFreeSpace:10",
+                                                         10,
+                                                         "no comment");
+  catalogue.DiskSystem()->createDiskSystem({"user", "host"},
+                                           "diskSystem",
+                                           "diskInstance",
+                                           "diskInstanceSpace",
+                                           "/public_dir/public_file",
+                                           10L * 1000 * 1000 * 1000,
+                                           15 * 60,
+                                           "no comment");
+
+#ifdef STDOUT_LOGGING
+  log::StdoutLogger dl("dummy", "unitTest");
+#else
+  log::DummyLogger dl("", "");
+#endif
+  log::LogContext lc(dl);
+
+  //Create an agent to represent this test process
+  std::string agentReferenceName = "expandRepackRequestTest";
+  std::unique_ptr<objectstore::AgentReference> agentReference(new objectstore::AgentReference(agentReferenceName, dl));
+
+  cta::common::dataStructures::SecurityIdentity admin;
+  admin.username = "admin_user_name";
+  admin.host = "admin_host";
+
+  //Create a logical library in the catalogue
+  const bool libraryIsDisabled = false;
+  std::optional<std::string> physicalLibraryName;
+  catalogue.LogicalLibrary()->createLogicalLibrary(admin,
+                                                   s_libraryName,
+                                                   libraryIsDisabled,
+                                                   physicalLibraryName,
+                                                   "Create logical library");
+
+  uint64_t nbTapesToRepack = 2;
+
+  std::vector<std::string> allVid;
+  std::map<std::string, std::set<uint64_t>> allVidFSeq;
+
+  //Create the tapes from which we will retrieve
+  for (uint64_t i = 1; i <= nbTapesToRepack; ++i) {
+    std::ostringstream ossVid;
+    ossVid << s_vid << "_" << i;
+    std::string vid = ossVid.str();
+    allVid.push_back(vid);
+    allVidFSeq[vid] = std::set<uint64_t>();
+    auto tape = getDefaultTape();
+    tape.vid = vid;
+    tape.full = true;
+    tape.state = common::dataStructures::Tape::REPACKING;
+    tape.stateReason = "Test";
+    catalogue.Tape()->createTape(s_adminOnAdminHost, tape);
+  }
+
+  //Create a storage class in the catalogue
+  common::dataStructures::StorageClass storageClass;
+  storageClass.name = s_storageClassName;
+  storageClass.nbCopies = 2;
+  storageClass.comment = "Create storage class";
+  const std::string tapeDrive = "tape_drive";
+  const uint64_t nbArchiveFilesPerTape = 10;
+  const uint64_t maxFilesToSelect = 5;
+  // The files of the tapes are read from the catalogue and queued 3 by 3
+  const uint64_t expansionPageSize = 3;
+  const uint64_t archiveFileSize = 2 * 1000 * 1000 * 1000;
+
+  //Simulate the writing of 10 files per tape in the catalogue
+  std::set<catalogue::TapeItemWrittenPointer> tapeFilesWrittenCopy1;
+  checksum::ChecksumBlob checksumBlob;
+  checksumBlob.insert(cta::checksum::ADLER32, "1234");
+  {
+    uint64_t archiveFileId = 1;
+    for (uint64_t i = 1; i <= nbTapesToRepack; ++i) {
+      std::string currentVid = allVid.at(i - 1);
+      for (uint64_t j = 1; j <= nbArchiveFilesPerTape; ++j) {
+        std::ostringstream diskFileId;
+        diskFileId << (12345677 + archiveFileId);
+        std::ostringstream diskFilePath;
+        diskFilePath << "/public_dir/public_file_" << i << "_" << j;
+        auto fileWrittenUP = std::make_unique<cta::catalogue::TapeFileWritten>();
+        auto& fileWritten = *fileWrittenUP;
+        fileWritten.archiveFileId = archiveFileId++;
+        fileWritten.diskInstance = s_diskInstance;
+        fileWritten.diskFileId = diskFileId.str();
+
+        fileWritten.diskFileOwnerUid = PUBLIC_OWNER_UID;
+        fileWritten.diskFileGid = PUBLIC_GID;
+        fileWritten.size = archiveFileSize;
+        fileWritten.checksumBlob = checksumBlob;
+        fileWritten.storageClassName = s_storageClassName;
+        fileWritten.vid = currentVid;
+        fileWritten.fSeq = j;
+        fileWritten.blockId = j * 100;
+        fileWritten.copyNb = 1;
+        fileWritten.tapeDrive = tapeDrive;
+        tapeFilesWrittenCopy1.emplace(fileWrittenUP.release());
+        allVidFSeq[currentVid].insert(j);
+      }
+      //update the DB tape
+      catalogue.TapeFile()->filesWrittenToTape(tapeFilesWrittenCopy1);
+      tapeFilesWrittenCopy1.clear();
+    }
+  }
+  //Test the expandRepackRequest method
+  scheduler.waitSchedulerDbSubthreadsComplete();
+  {
+    ASSERT_EQ(nbTapesToRepack, 2);
+    // Tape1: Select all files
+    {
+      cta::SchedulerDatabase::QueueRepackRequest qrr(allVid.at(0),
+                                                     "file://" + tempDirectory.path(),
+                                                     common::dataStructures::RepackInfo::Type::MoveOnly,
+                                                     common::dataStructures::MountPolicy::s_defaultMountPolicyForRepack,
+                                                     s_defaultRepackNoRecall,
+                                                     0);
+      scheduler.queueRepack(admin, qrr, lc);
+    }
+
+    // Tape2: Select 'maxFilesToSelect' files
+    {
+      cta::SchedulerDatabase::QueueRepackRequest qrr(allVid.at(1),
+                                                     "file://" + tempDirectory.path(),
+                                                     common::dataStructures::RepackInfo::Type::MoveOnly,
+                                                     common::dataStructures::MountPolicy::s_defaultMountPolicyForRepack,
+                                                     s_defaultRepackNoRecall,
+                                                     maxFilesToSelect);
+      scheduler.queueRepack(admin, qrr, lc);
+    }
+
+    scheduler.waitSchedulerDbSubthreadsComplete();
+
+    scheduler.promoteRepackRequestsToToExpand(lc, 2);
+    scheduler.waitSchedulerDbSubthreadsComplete();
+
+    for (uint64_t i = 0; i < nbTapesToRepack; ++i) {
+      log::TimingList tl;
+      utils::Timer t;
+      auto repackRequestToExpand = scheduler.getNextRepackRequestToExpand();
+      scheduler.expandRepackRequest(*repackRequestToExpand, tl, t, lc, expansionPageSize);
+    }
+    scheduler.waitSchedulerDbSubthreadsComplete();
+  }
+  //Here, we will only test that the two repack requests have been expanded page by page
+  {
+    //The expandRepackRequest method should have queued nbArchiveFiles retrieve request corresponding to the previous files inserted in the catalogue
+    // Or the maximum in case 'maxFilesToSelect' was used
+
+    // Tape1: Selected all files
+    {
+      std::string vid = allVid.at(0);
+      std::list<common::dataStructures::RetrieveJob> retrieveJobs = scheduler.getPendingRetrieveJobs(vid, lc);
+      ASSERT_EQ(retrieveJobs.size(), nbArchiveFilesPerTape);
+    }
+    {
+      // Tape2: Selected 'maxFilesToSelect' files
+      std::string vid = allVid.at(1);
+      std::list<common::dataStructures::RetrieveJob> retrieveJobs = scheduler.getPendingRetrieveJobs(vid, lc);
+      ASSERT_EQ(retrieveJobs.size(), maxFilesToSelect);
+    }
+  }
+
+  scheduler.waitSchedulerDbSubthreadsComplete();
+  {
+    cta::objectstore::RootEntry re(schedulerDB.getBackend());
+    re.fetchNoLock();
+    objectstore::RepackIndex ri(re.getRepackIndexAddress(), schedulerDB.getBackend());
+    ri.fetchNoLock();
+
+    {
+      // Tape1: Selected all files
+      std::string vid = allVid.at(0);
+      cta::objectstore::RepackRequest rr(ri.getRepackRequestAddress(vid), schedulerDB.getBackend());
+      rr.fetchNoLock();
+      auto repackInfo = rr.getInfo();
+      ASSERT_EQ(repackInfo.allFilesSelectedAtStart, true);
+      ASSERT_EQ(rr.getLastExpandedFSeq(), nbArchiveFilesPerTape + 1);
+      ASSERT_EQ(repackInfo.totalFilesOnTapeAtStart, nbArchiveFilesPerTape);
+      ASSERT_EQ(repackInfo.totalBytesOnTapeAtStart, nbArchiveFilesPerTape * archiveFileSize);
+      ASSERT_EQ(repackInfo.totalFilesToRetrieve, nbArchiveFilesPerTape);
+      ASSERT_EQ(repackInfo.totalBytesToRetrieve, nbArchiveFilesPerTape * archiveFileSize);
+      ASSERT_EQ(repackInfo.totalFilesToArchive, nbArchiveFilesPerTape);
+      ASSERT_EQ(repackInfo.totalBytesToArchive, nbArchiveFilesPerTape * archiveFileSize);
+    }
+    {
+      // Tape2: Selected 'maxFilesToSelect' files
+      std::string vid = allVid.at(1);
+      cta::objectstore::RepackRequest rr(ri.getRepackRequestAddress(vid), schedulerDB.getBackend());
+      rr.fetchNoLock();
+      auto repackInfo = rr.getInfo();
+      ASSERT_EQ(repackInfo.allFilesSelectedAtStart, false);
+      // The files after the last selected one are only counted, they will be expanded by the next repack request
+      ASSERT_EQ(rr.getLastExpandedFSeq(), maxFilesToSelect + 1);
+      ASSERT_EQ(repackInfo.totalFilesOnTapeAtStart, nbArchiveFilesPerTape);
+      ASSERT_EQ(repackInfo.totalBytesOnTapeAtStart, nbArchiveFilesPerTape * archiveFileSize);
+      ASSERT_EQ(repackInfo.totalFilesToRetrieve, maxFilesToSelect);
+      ASSERT_EQ(repackInfo.totalBytesToRetrieve, maxFilesToSelect * archiveFileSize);
+      ASSERT_EQ(repackInfo.totalFilesToArchive, maxFilesToSelect);
+      ASSERT_EQ(repackInfo.totalBytesToArchive, maxFilesToSelect * archiveFileSize);
+    }
+  }
+}
+
 TEST_P(SchedulerTest, expandRepackRequestWithStorageClass) {
   using namespace cta;
   unitTests::TempDirectory tempDirectory;
@@ -67,33 +67,11 @@ ArchiveRequest::makeJobRow(const postgres::ArchiveQueueJob& archiveJob) const {
   return ajr;
 }
 
-// Inserts one row into DB
+// Inserts the rows of the jobs into DB and commits them
 void ArchiveRequest::insert() {
   try {
-    log::ScopedParamContainer params(m_lc);
-    if (m_jobs.size() == 1) {
-      const auto& aj = m_jobs.front();
-      std::unique_ptr<postgres::ArchiveJobQueueRow> row = makeJobRow(aj);
-      row->addParamsToLogContext(params);
-      row->insert(m_conn);
-      m_conn.setRowCountForTelemetry(1);
-      m_conn.commit();
-      m_lc.log(log::INFO, "In ArchiveRequest::insert(): added job to queue.");
-    } else {
-      std::vector<std::unique_ptr<postgres::ArchiveJobQueueRow>> rows;
-      rows.reserve(m_jobs.size());
-      for (const auto& aj : m_jobs) {
-        rows.emplace_back(makeJobRow(aj));
-      }
-      m_conn.setRowCountForTelemetry(rows.size());
-      postgres::ArchiveJobQueueRow::insertBatch(m_conn, rows, false);
-      m_conn.setRowCountForTelemetry(rows.size());
-      rows.back()->addParamsToLogContext(params);
-      m_lc.log(log::INFO,
-               "In ArchiveRequest::insert(): added jobs to queue. Parameters logged only for last job of the bunch "
-               "inserted !");
-      m_conn.commit();
-    }
+    insertUncommitted();
+    m_conn.commit();
   } catch (exception::Exception& ex) {
     log::ScopedParamContainer params(m_lc);
     params.add(semconv::log::exceptionMessage, ex.getMessageValue());
@@ -103,6 +81,32 @@ void ArchiveRequest::insert() {
   }
 }
 
+// Inserts the rows of the jobs into DB, leaving the commit to the caller
+void ArchiveRequest::insertUncommitted() {
+  log::ScopedParamContainer params(m_lc);
+  if (m_jobs.size() == 1) {
+    const auto& aj = m_jobs.front();
+    std::unique_ptr<postgres::ArchiveJobQueueRow> row = makeJobRow(aj);
+    row->addParamsToLogContext(params);
+    row->insert(m_conn);
+    m_conn.setRowCountForTelemetry(1);
+    m_lc.log(log::INFO, "In ArchiveRequest::insert(): added job to queue.");
+  } else {
+    std::vector<std::unique_ptr<postgres::ArchiveJobQueueRow>> rows;
+    rows.reserve(m_jobs.size());
+    for (const auto& aj : m_jobs) {
+      rows.emplace_back(makeJobRow(aj));
+    }
+    m_conn.setRowCountForTelemetry(rows.size());
+    postgres::ArchiveJobQueueRow::insertBatch(m_conn, rows, false);
+    m_conn.setRowCountForTelemetry(rows.size());
+    rows.back()->addParamsToLogContext(params);
+    m_lc.log(log::INFO,
+             "In ArchiveRequest::insert(): added jobs to queue. Parameters logged only for last job of the bunch "
+             "inserted !");
+  }
+}
+
 void ArchiveRequest::addJob(uint8_t copyNumber,
                             std::string_view tapepool,
                             uint16_t maxRetriesWithinMount,
@@ -24,6 +24,12 @@ public:
 
   std::unique_ptr<postgres::ArchiveJobQueueRow> makeJobRow(const postgres::ArchiveQueueJob& archiveJob) const;
   void insert();
+
+  /*
+   * Insert the jobs of the request without committing them, so that the
+   * caller can queue several requests in the same transaction
+   */
+  void insertUncommitted();
   [[noreturn]] void update() const;
 
   // ============================== Job management =============================
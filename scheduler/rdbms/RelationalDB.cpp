@@ -90,6 +90,67 @@ std::string RelationalDB::queueArchive(const std::string& instanceName,
   params.add("getConnTime", timeGetConn.secs());
   schedulerdb::ArchiveRequest aReq(sqlconn, lc);
 
+  utils::Timer timeSetters;
+  fillArchiveRequest(aReq, instanceName, request, criteria);
+  params.add("timeSetters", timeSetters.secs());
+
+  utils::Timer timeInsert;
+
+  aReq.insert();
+
+  params.add("fileId", criteria.fileId)
+    .add("diskInstance", instanceName)
+    .add("diskFilePath", request.diskFileInfo.path)
+    .add("diskFileId", request.diskFileID)
+    .add("insertTime", timeInsert.secs())
+    .add("totalTime", timeTotal.secs());
+  lc.log(log::INFO, "In RelationalDB::queueArchive(): Finished enqueueing request.");
+  return aReq.getIdStr();
+}
+
+std::vector<SchedulerDatabase::QueueArchiveResult>
+RelationalDB::queueArchives(const std::string& instanceName,
+                            const std::vector<ArchiveToQueue>& archives,
+                            log::LogContext& lc) {
+  std::vector<QueueArchiveResult> results(archives.size());
+  if (archives.empty()) {
+    return results;
+  }
+  utils::Timer timeTotal;
+  log::ScopedParamContainer params(lc);
+  params.add("diskInstance", instanceName).add("requestCount", archives.size());
+  // All the requests are inserted in the same transaction: they are either all queued or none of them is
+  try {
+    schedulerdb::Transaction txn(m_connPool, lc);
+    std::vector<std::string> requestIds;
+    requestIds.reserve(archives.size());
+    for (const auto& [request, criteria] : archives) {
+      schedulerdb::ArchiveRequest aReq(txn.getConn(), lc);
+      fillArchiveRequest(aReq, instanceName, request, criteria);
+      aReq.insertUncommitted();
+      requestIds.push_back(aReq.getIdStr());
+    }
+    txn.commit();
+    for (size_t i = 0; i < archives.size(); i++) {
+      results[i].requestId = std::move(requestIds[i]);
+    }
+  } catch (exception::Exception& ex) {
+    params.add(semconv::log::exceptionMessage, ex.getMessageValue());
+    lc.log(log::ERR, "In RelationalDB::queueArchives(): failed to enqueue requests, none of them was queued.");
+    for (auto& result : results) {
+      result.error = std::current_exception();
+    }
+    return results;
+  }
+  params.add("totalTime", timeTotal.secs());
+  lc.log(log::INFO, "In RelationalDB::queueArchives(): Finished enqueueing requests.");
+  return results;
+}
+
+void RelationalDB::fillArchiveRequest(schedulerdb::ArchiveRequest& aReq,
+                                      const std::string& instanceName,
+                                      const cta::common::dataStructures::ArchiveRequest& request,
+                                      const cta::common::dataStructures::ArchiveFileQueueCriteriaAndFileId& criteria) {
   // Summarize all as an archiveFile
   common::dataStructures::ArchiveFile aFile;
   aFile.archiveFileID = criteria.fileId;
@@ -103,14 +164,12 @@ std::string RelationalDB::queueArchive(const std::string& instanceName,
   aFile.storageClass = request.storageClass;
   aReq.setArchiveFile(aFile);
 
-  utils::Timer timeSetters;
   aReq.setMountPolicy(criteria.mountPolicy);
   aReq.setArchiveReportURL(request.archiveReportURL);
   aReq.setArchiveErrorReportURL(request.archiveErrorReportURL);
   aReq.setRequester(request.requester);
   aReq.setSrcURL(request.srcURL);
   aReq.setEntryLog(request.creationLog);
-  params.add("timeSetters", timeSetters.secs());
   auto archiveRequestId = 0;  //bogus, will be assigned by DB insert itself
                               // cta::schedulerdb::postgres::ArchiveJobQueueRow::getNextArchiveRequestID(sqlconn);
   int count_jobs = 0;
@@ -127,19 +186,6 @@ std::string RelationalDB::queueArchive(const std::string& instanceName,
   if (count_jobs == 0) {
     throw schedulerdb::ArchiveRequestHasNoCopies("In RelationalDB::queueArchive: the archive request has no copies");
   }
-
-  utils::Timer timeInsert;
-
-  aReq.insert();
-
-  params.add("fileId", aFile.archiveFileID)
-    .add("diskInstance", aFile.diskInstance)
-    .add("diskFilePath", aFile.diskFileInfo.path)
-    .add("diskFileId", aFile.diskFileId)
-    .add("insertTime", timeInsert.secs())
-    .add("totalTime", timeTotal.secs());
-  lc.log(log::INFO, "In RelationalDB::queueArchive(): Finished enqueueing request.");
-  return aReq.getIdStr();
 }
 
 std::map<std::string, std::list<common::dataStructures::ArchiveJob>, std::less<>> RelationalDB::getArchiveJobs() const {
@@ -48,6 +48,7 @@ class Catalogue;
 namespace schedulerdb {
 class ArchiveMount;
 class ArchiveRdbJob;
+class ArchiveRequest;
 class RetrieveMount;
 class RetrieveRdbJob;
 class TapeMountDecisionInfo;
@@ -88,6 +89,20 @@ public:
                            const cta::common::dataStructures::ArchiveFileQueueCriteriaAndFileId& criteria,
                            log::LogContext& logContext) override;
 
+  /*
+   * Queue several archive requests in a single DB transaction
+   *
+   * @param instanceName            Name of the disk instance of the requests
+   * @param archives                The archive requests and their queue criteria
+   * @param logContext              The logging context
+   *
+   * @return The outcome of queueing each request, in the order of the requests. If the transaction
+   *         fails, none of the requests is queued and they all get the same error
+   */
+  std::vector<QueueArchiveResult> queueArchives(const std::string& instanceName,
+                                                const std::vector<ArchiveToQueue>& archives,
+                                                log::LogContext& logContext) override;
+
   /*
    * Unless otherwise specified, all of the methods that follow are currently just throwing an exception
    * as they are not required for the basic PGSCHED DB Archival functionality
@@ -453,6 +468,16 @@ private:
   void fetchMountInfo(SchedulerDatabase::TapeMountDecisionInfo& tmdi,
                       [[maybe_unused]] SchedulerDatabase::PurposeGetMountInfo purpose,
                       log::LogContext& lc);
+
+  /*
+   * Set the archive file, the metadata and the jobs of a scheduler DB archive request
+   *
+   * @throw ArchiveRequestHasNoCopies if the queue criteria have no tape copy
+   */
+  static void fillArchiveRequest(schedulerdb::ArchiveRequest& aReq,
+                                 const std::string& instanceName,
+                                 const cta::common::dataStructures::ArchiveRequest& request,
+                                 const cta::common::dataStructures::ArchiveFileQueueCriteriaAndFileId& criteria);
   bool deleteDiskFiles(const std::unordered_set<std::string>& jobSrcUrls, log::LogContext& lc);
   std::list<common::dataStructures::RepackInfo> fetchRepackInfo(const std::string& vid);
   std::string m_ownerId;
@@ -104,7 +104,8 @@ RepackRequest::addSubrequestsAndUpdateStats(const std::list<Subrequest>& repackS
     .log(log::INFO, "In RepackRequest::addSubrequestsAndUpdateStats(): printing out stats.");
 
   // "repackInfo.allFilesSelectedAtStart ":true,"repackInfo.totalFilesOnTapeAtStart":2153,"repackInfo.totalFilesToRetrieve ":2143,"repackInfo.userProvidedFiles":10,"routine":"RepackExpandRoutine"}
-  uint64_t fSeq = std::max(maxFSeqLowBound + 1, maxAddedFSeq + 1);
+  // Like the object store, record the exclusive bound: the first fSeq which has not been expanded yet
+  uint64_t nextFSeqToExpand = std::max(maxFSeqLowBound + 1, maxAddedFSeq + 1);
   bool noRecall = repackInfo.noRecall;
 
   StatsValues failedCreationStats;
@@ -351,7 +352,9 @@ RepackRequest::addSubrequestsAndUpdateStats(const std::list<Subrequest>& repackS
       failedCreationStats = StatsValues {};
     }
   }
-  setLastExpandedFSeq(fSeq);
+  setLastExpandedFSeq(nextFSeqToExpand);
+  // The subrequests of a repack request can be added by several calls, the tracking row counts all of them
+  m_nbRetrieveSubrequestsExpanded += nbRetrieveSubrequestsCreated;
   cta::schedulerdb::Transaction txn(m_connPool, lc);
   try {
     // The repack request status here could be either Starting or Running.
@@ -359,8 +362,8 @@ RepackRequest::addSubrequestsAndUpdateStats(const std::list<Subrequest>& repackS
       txn,
       repackInfo.repackReqId,
       totalStatsFiles,
-      nbRetrieveSubrequestsCreated,
-      fSeq,
+      m_nbRetrieveSubrequestsExpanded,
+      nextFSeqToExpand,
       mapRepackInfoStatusToJobStatus(repackInfo.status));
     log::ScopedParamContainer(lc)
       .add("nrows", nrows)
@@ -101,6 +101,8 @@ public:
   };
 
   std::list<SubrequestPointer> m_subreqp;
+  // The number of retrieve subrequests created by all the calls to addSubrequestsAndUpdateStats()
+  uint64_t m_nbRetrieveSubrequestsExpanded = 0;
   // References to external objects
   //rdbms::ConnPool      &m_connPool;
   rdbms::ConnPool& m_connPool;
@@ -10,6 +10,7 @@
 #include "common/log/LogContext.hpp"
 #include "rdbms/Conn.hpp"
 #include "rdbms/NullDbValue.hpp"
+#include "rdbms/RowSchema.hpp"
 #include "scheduler/SchedulerDatabase.hpp"
 #include "scheduler/rdbms/postgres/Enums.hpp"
 #include "scheduler/rdbms/postgres/Transaction.hpp"
@@ -167,52 +168,100 @@ public:
     checksumBlob.clear();
   }
 
+  /**
+   * The columns read from each row of the queries on the archive job tables
+   */
+  static constexpr rdbms::RowSchema kColumns {
+    "JOB_ID",
+    "REPACK_REQUEST_ID",
+    "ARCHIVE_REQUEST_ID",
+    "REQUEST_JOB_COUNT",
+    "MOUNT_ID",
+    "STATUS",
+    "TAPE_POOL",
+    "MOUNT_POLICY",
+    "PRIORITY",
+    "MIN_ARCHIVE_REQUEST_AGE",
+    "ARCHIVE_FILE_ID",
+    "SIZE_IN_BYTES",
+    "COPY_NB",
+    "START_TIME",
+    "CHECKSUMBLOB",
+    "CREATION_TIME",
+    "DISK_INSTANCE",
+    "DISK_FILE_ID",
+    "DISK_FILE_OWNER_UID",
+    "DISK_FILE_GID",
+    "DISK_FILE_PATH",
+    "ARCHIVE_REPORT_URL",
+    "ARCHIVE_ERROR_REPORT_URL",
+    "REQUESTER_NAME",
+    "REQUESTER_GROUP",
+    "SRC_URL",
+    "STORAGE_CLASS",
+    "IS_REPORTING",
+    "VID",
+    "DRIVE",
+    "HOST",
+    "MOUNT_TYPE",
+    "LOGICAL_LIBRARY",
+    "FAILURE_LOG",
+    "REPORT_FAILURE_LOG",
+    "LAST_MOUNT_WITH_FAILURE",
+    "RETRIES_WITHIN_MOUNT",
+    "MAX_RETRIES_WITHIN_MOUNT",
+    "TOTAL_RETRIES",
+    "MAX_REPORT_RETRIES",
+    "MAX_TOTAL_RETRIES",
+    "TOTAL_REPORT_RETRIES"};
+
   ArchiveJobQueueRow& operator=(const rdbms::Rset& rset) {
-    jobId = rset.columnUint64NoOpt("JOB_ID");
-    if (rset.columnExists("REPACK_REQUEST_ID")) {
-      repackRequestId = rset.columnUint64NoOpt("REPACK_REQUEST_ID");
+    const auto row = rset.columns<kColumns>();
+    jobId = row.columnUint64("JOB_ID");
+    if (row.columnExists("REPACK_REQUEST_ID")) {
+      repackRequestId = row.columnUint64("REPACK_REQUEST_ID");
     }
-    reqId = rset.columnUint64NoOpt("ARCHIVE_REQUEST_ID");
-    reqJobCount = rset.columnUint32NoOpt("REQUEST_JOB_COUNT");
-    mountId = rset.columnOptionalUint64("MOUNT_ID");
-    status = from_string<ArchiveJobStatus>(rset.columnStringNoOpt("STATUS"));
-    tapePool = rset.columnStringNoOpt("TAPE_POOL");
-    mountPolicy = rset.columnStringNoOpt("MOUNT_POLICY");
-    priority = rset.columnUint16NoOpt("PRIORITY");
-    minArchiveRequestAge = rset.columnUint32NoOpt("MIN_ARCHIVE_REQUEST_AGE");
-    archiveFileID = rset.columnUint64NoOpt("ARCHIVE_FILE_ID");
-    fileSize = rset.columnUint64NoOpt("SIZE_IN_BYTES");
-    copyNb = rset.columnUint16NoOpt("COPY_NB");
-    startTime = rset.columnUint64NoOpt("START_TIME");
-    auto blob_view = rset.columnBlobView("CHECKSUMBLOB");
+    reqId = row.columnUint64("ARCHIVE_REQUEST_ID");
+    reqJobCount = row.columnUint32("REQUEST_JOB_COUNT");
+    mountId = row.columnOptionalUint64("MOUNT_ID");
+    status = from_string<ArchiveJobStatus>(row.columnString("STATUS"));
+    tapePool = row.columnString("TAPE_POOL");
+    mountPolicy = row.columnString("MOUNT_POLICY");
+    priority = row.columnUint16("PRIORITY");
+    minArchiveRequestAge = row.columnUint32("MIN_ARCHIVE_REQUEST_AGE");
+    archiveFileID = row.columnUint64("ARCHIVE_FILE_ID");
+    fileSize = row.columnUint64("SIZE_IN_BYTES");
+    copyNb = row.columnUint16("COPY_NB");
+    startTime = row.columnUint64("START_TIME");
+    auto blob_view = row.columnBlobView("CHECKSUMBLOB");
     checksumBlob.deserialize(blob_view->data(), blob_view->size());
-    creationTime = rset.columnUint64NoOpt("CREATION_TIME");
-    diskInstance = rset.columnStringNoOpt("DISK_INSTANCE");
-    diskFileId = rset.columnStringNoOpt("DISK_FILE_ID");
-    diskFileInfoOwnerUid = rset.columnUint32NoOpt("DISK_FILE_OWNER_UID");
-    diskFileInfoGid = rset.columnUint32NoOpt("DISK_FILE_GID");
-    diskFileInfoPath = rset.columnStringNoOpt("DISK_FILE_PATH");
-    archiveReportURL = rset.columnStringNoOpt("ARCHIVE_REPORT_URL");
-    archiveErrorReportURL = rset.columnStringNoOpt("ARCHIVE_ERROR_REPORT_URL");
-    requesterName = rset.columnStringNoOpt("REQUESTER_NAME");
-    requesterGroup = rset.columnStringNoOpt("REQUESTER_GROUP");
-    srcUrl = rset.columnStringNoOpt("SRC_URL");
-    storageClass = rset.columnStringNoOpt("STORAGE_CLASS");
-    isReporting = rset.columnBoolNoOpt("IS_REPORTING");
-    vid = rset.columnStringNoOpt("VID");
-    drive = rset.columnStringNoOpt("DRIVE");
-    host = rset.columnStringNoOpt("HOST");
-    mount_type = rset.columnStringNoOpt("MOUNT_TYPE");
-    logical_library = rset.columnStringNoOpt("LOGICAL_LIBRARY");
-    failureLogs = std::move(rset.columnOptionalString("FAILURE_LOG"));
-    reportFailureLogs = std::move(rset.columnOptionalString("REPORT_FAILURE_LOG"));
-    lastMountWithFailure = rset.columnUint32NoOpt("LAST_MOUNT_WITH_FAILURE");
-    retriesWithinMount = rset.columnUint16NoOpt("RETRIES_WITHIN_MOUNT");
-    maxRetriesWithinMount = rset.columnUint16NoOpt("MAX_RETRIES_WITHIN_MOUNT");
-    totalRetries = rset.columnUint16NoOpt("TOTAL_RETRIES");
-    maxReportRetries = rset.columnUint16NoOpt("MAX_REPORT_RETRIES");
-    maxTotalRetries = rset.columnUint16NoOpt("MAX_TOTAL_RETRIES");
-    totalReportRetries = rset.columnUint16NoOpt("TOTAL_REPORT_RETRIES");
+    creationTime = row.columnUint64("CREATION_TIME");
+    diskInstance = row.columnString("DISK_INSTANCE");
+    diskFileId = row.columnString("DISK_FILE_ID");
+    diskFileInfoOwnerUid = row.columnUint32("DISK_FILE_OWNER_UID");
+    diskFileInfoGid = row.columnUint32("DISK_FILE_GID");
+    diskFileInfoPath = row.columnString("DISK_FILE_PATH");
+    archiveReportURL = row.columnString("ARCHIVE_REPORT_URL");
+    archiveErrorReportURL = row.columnString("ARCHIVE_ERROR_REPORT_URL");
+    requesterName = row.columnString("REQUESTER_NAME");
+    requesterGroup = row.columnString("REQUESTER_GROUP");
+    srcUrl = row.columnString("SRC_URL");
+    storageClass = row.columnString("STORAGE_CLASS");
+    isReporting = row.columnBool("IS_REPORTING");
+    vid = row.columnString("VID");
+    drive = row.columnString("DRIVE");
+    host = row.columnString("HOST");
+    mount_type = row.columnString("MOUNT_TYPE");
+    logical_library = row.columnString("LOGICAL_LIBRARY");
+    failureLogs = row.columnOptionalString("FAILURE_LOG");
+    reportFailureLogs = row.columnOptionalString("REPORT_FAILURE_LOG");
+    lastMountWithFailure = row.columnUint32("LAST_MOUNT_WITH_FAILURE");
+    retriesWithinMount = row.columnUint16("RETRIES_WITHIN_MOUNT");
+    maxRetriesWithinMount = row.columnUint16("MAX_RETRIES_WITHIN_MOUNT");
+    totalRetries = row.columnUint16("TOTAL_RETRIES");
+    maxReportRetries = row.columnUint16("MAX_REPORT_RETRIES");
+    maxTotalRetries = row.columnUint16("MAX_TOTAL_RETRIES");
+    totalReportRetries = row.columnUint16("TOTAL_REPORT_RETRIES");
     return *this;
   }
 
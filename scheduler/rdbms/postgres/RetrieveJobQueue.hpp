@@ -9,6 +9,7 @@
 #include "common/log/LogContext.hpp"
 #include "rdbms/Conn.hpp"
 #include "rdbms/NullDbValue.hpp"
+#include "rdbms/RowSchema.hpp"
 #include "scheduler/SchedulerDatabase.hpp"
 #include "scheduler/rdbms/postgres/Enums.hpp"
 #include "scheduler/rdbms/postgres/Transaction.hpp"
@@ -186,32 +187,98 @@ public:
     checksumBlob.clear();
   }
 
+  /**
+   * The columns read from each row of the queries on the retrieve job tables
+   */
+  static constexpr rdbms::RowSchema kColumns {
+    "JOB_ID",
+    "RETRIEVE_REQUEST_ID",
+    "REPACK_REQUEST_ID",
+    "REPACK_REARCHIVE_COPY_NBS",
+    "REPACK_REARCHIVE_TAPE_POOLS",
+    "REQUEST_JOB_COUNT",
+    "MOUNT_ID",
+    "STATUS",
+    "TAPE_POOL",
+    "MOUNT_POLICY",
+    "PRIORITY",
+    "MIN_RETRIEVE_REQUEST_AGE",
+    "COPY_NB",
+    "FSEQ",
+    "BLOCK_ID",
+    "ALTERNATE_FSEQS",
+    "ALTERNATE_BLOCK_IDS",
+    "START_TIME",
+    "RETRIEVE_REPORT_URL",
+    "RETRIEVE_ERROR_REPORT_URL",
+    "REQUESTER_NAME",
+    "REQUESTER_GROUP",
+    "DST_URL",
+    "RETRIES_WITHIN_MOUNT",
+    "TOTAL_RETRIES",
+    "LAST_MOUNT_WITH_FAILURE",
+    "MAX_TOTAL_RETRIES",
+    "MAX_RETRIES_WITHIN_MOUNT",
+    "MAX_REPORT_RETRIES",
+    "TOTAL_REPORT_RETRIES",
+    "FAILURE_LOG",
+    "REPORT_FAILURE_LOG",
+    "IS_VERIFY_ONLY",
+    "IS_REPORTING",
+    "VID",
+    "ALTERNATE_VIDS",
+    "ALTERNATE_COPY_NBS",
+    "DRIVE",
+    "HOST",
+    "LOGICAL_LIBRARY",
+    "ACTIVITY",
+    "SRR_USERNAME",
+    "SRR_HOST",
+    "SRR_TIME",
+    "SRR_MOUNT_POLICY",
+    "SRR_ACTIVITY",
+    "LIFECYCLE_CREATION_TIME",
+    "LIFECYCLE_FIRST_SELECTED_TIME",
+    "LIFECYCLE_COMPLETED_TIME",
+    "DISK_SYSTEM_NAME",
+    "ARCHIVE_FILE_ID",
+    "SIZE_IN_BYTES",
+    "CHECKSUMBLOB",
+    "CREATION_TIME",
+    "DISK_INSTANCE",
+    "DISK_FILE_ID",
+    "DISK_FILE_OWNER_UID",
+    "DISK_FILE_GID",
+    "DISK_FILE_PATH",
+    "STORAGE_CLASS"};
+
   RetrieveJobQueueRow& operator=(const rdbms::Rset& rset) {
-    jobId = rset.columnUint64NoOpt("JOB_ID");
-    retrieveRequestId = rset.columnUint64NoOpt("RETRIEVE_REQUEST_ID");
-    if (rset.columnExists("REPACK_REQUEST_ID")) {
-      repackRequestId = rset.columnUint64NoOpt("REPACK_REQUEST_ID");
+    const auto row = rset.columns<kColumns>();
+    jobId = row.columnUint64("JOB_ID");
+    retrieveRequestId = row.columnUint64("RETRIEVE_REQUEST_ID");
+    if (row.columnExists("REPACK_REQUEST_ID")) {
+      repackRequestId = row.columnUint64("REPACK_REQUEST_ID");
     }
-    if (rset.columnExists("REPACK_REARCHIVE_COPY_NBS")) {
-      rearchiveCopyNbs = rset.columnOptionalString("REPACK_REARCHIVE_COPY_NBS");
+    if (row.columnExists("REPACK_REARCHIVE_COPY_NBS")) {
+      rearchiveCopyNbs = row.columnOptionalString("REPACK_REARCHIVE_COPY_NBS");
     }
-    if (rset.columnExists("REPACK_REARCHIVE_TAPE_POOLS")) {
-      rearchiveTapePools = rset.columnOptionalString("REPACK_REARCHIVE_TAPE_POOLS");
+    if (row.columnExists("REPACK_REARCHIVE_TAPE_POOLS")) {
+      rearchiveTapePools = row.columnOptionalString("REPACK_REARCHIVE_TAPE_POOLS");
     }
-    reqJobCount = rset.columnUint32NoOpt("REQUEST_JOB_COUNT");
-    mountId = rset.columnOptionalUint64("MOUNT_ID");
-    status = from_string<RetrieveJobStatus>(rset.columnStringNoOpt("STATUS"));
-    tapePool = rset.columnStringNoOpt("TAPE_POOL");
-    mountPolicy = rset.columnStringNoOpt("MOUNT_POLICY");
-    priority = rset.columnUint32NoOpt("PRIORITY");
-    minRetrieveRequestAge = rset.columnUint32NoOpt("MIN_RETRIEVE_REQUEST_AGE");
-    copyNb = rset.columnUint8NoOpt("COPY_NB");
-    fSeq = rset.columnUint64NoOpt("FSEQ");
-    blockId = rset.columnUint64NoOpt("BLOCK_ID");
-    alternateFSeq = rset.columnStringNoOpt("ALTERNATE_FSEQS");
-    alternateBlockId = rset.columnStringNoOpt("ALTERNATE_BLOCK_IDS");
-    startTime = rset.columnUint64NoOpt("START_TIME");
-    retrieveReportURL = rset.columnStringNoOpt("RETRIEVE_REPORT_URL");
+    reqJobCount = row.columnUint32("REQUEST_JOB_COUNT");
+    mountId = row.columnOptionalUint64("MOUNT_ID");
+    status = from_string<RetrieveJobStatus>(row.columnString("STATUS"));
+    tapePool = row.columnString("TAPE_POOL");
+    mountPolicy = row.columnString("MOUNT_POLICY");
+    priority = row.columnUint32("PRIORITY");
+    minRetrieveRequestAge = row.columnUint32("MIN_RETRIEVE_REQUEST_AGE");
+    copyNb = row.columnUint8("COPY_NB");
+    fSeq = row.columnUint64("FSEQ");
+    blockId = row.columnUint64("BLOCK_ID");
+    alternateFSeq = row.columnString("ALTERNATE_FSEQS");
+    alternateBlockId = row.columnString("ALTERNATE_BLOCK_IDS");
+    startTime = row.columnUint64("START_TIME");
+    retrieveReportURL = row.columnString("RETRIEVE_REPORT_URL");
     // The following is necessary value translation as the current rdbms API
     // does not allow to bind and save an empty string [""], only nullptr or value are allowed.
     // The disk reporter factory requires at minimum empty string or a "null:" as a string,
@@ -222,59 +289,54 @@ public:
     if (retrieveReportURL == "NOT_PROVIDED") {
       retrieveReportURL = "";
     }
-    retrieveErrorReportURL = rset.columnStringNoOpt("RETRIEVE_ERROR_REPORT_URL");
+    retrieveErrorReportURL = row.columnString("RETRIEVE_ERROR_REPORT_URL");
     if (retrieveErrorReportURL == "NOT_PROVIDED") {
       retrieveErrorReportURL = "";
     }
-    requesterName = rset.columnStringNoOpt("REQUESTER_NAME");
-    requesterGroup = rset.columnStringNoOpt("REQUESTER_GROUP");
-    dstURL = rset.columnStringNoOpt("DST_URL");
-    retriesWithinMount = rset.columnUint32NoOpt("RETRIES_WITHIN_MOUNT");
-    totalRetries = rset.columnUint32NoOpt("TOTAL_RETRIES");
-    lastMountWithFailure = rset.columnUint64NoOpt("LAST_MOUNT_WITH_FAILURE");
-    maxTotalRetries = rset.columnUint32NoOpt("MAX_TOTAL_RETRIES");
-    maxRetriesWithinMount = rset.columnUint32NoOpt("MAX_RETRIES_WITHIN_MOUNT");
-    maxReportRetries = rset.columnUint32NoOpt("MAX_REPORT_RETRIES");
-    totalReportRetries = rset.columnUint32NoOpt("TOTAL_REPORT_RETRIES");
-    failureLogs = rset.columnOptionalString("FAILURE_LOG");
-    reportFailureLogs = rset.columnOptionalString("REPORT_FAILURE_LOG");
-    isVerifyOnly = rset.columnBoolNoOpt("IS_VERIFY_ONLY");
-    isReporting = rset.columnBoolNoOpt("IS_REPORTING");
-    vid = rset.columnStringNoOpt("VID");
-    alternateVids = rset.columnStringNoOpt("ALTERNATE_VIDS");
-    alternateCopyNbs = rset.columnStringNoOpt("ALTERNATE_COPY_NBS");
-    drive = rset.columnStringNoOpt("DRIVE");
-    host = rset.columnStringNoOpt("HOST");
-    logical_library = rset.columnStringNoOpt("LOGICAL_LIBRARY");
-    activity = rset.columnOptionalString("ACTIVITY");
-    srrUsername = rset.columnStringNoOpt("SRR_USERNAME");
-    srrHost = rset.columnStringNoOpt("SRR_HOST");
-    srrTime = rset.columnUint64NoOpt("SRR_TIME");
-    srrMountPolicy = rset.columnStringNoOpt("SRR_MOUNT_POLICY");
-    srrActivity = rset.columnStringNoOpt("SRR_ACTIVITY");
-
-    lifecycleTimings_creation_time = rset.columnUint64NoOpt("LIFECYCLE_CREATION_TIME");
-    lifecycleTimings_first_selected_time = rset.columnUint64NoOpt("LIFECYCLE_FIRST_SELECTED_TIME");
-    lifecycleTimings_completed_time = rset.columnUint64NoOpt("LIFECYCLE_COMPLETED_TIME");
-
-    diskSystemName = rset.columnOptionalString("DISK_SYSTEM_NAME");
-
-    archiveFileID = rset.columnUint64NoOpt("ARCHIVE_FILE_ID");
-    fileSize = rset.columnUint64NoOpt("SIZE_IN_BYTES");
-    auto blob_view = rset.columnBlobView("CHECKSUMBLOB");
+    requesterName = row.columnString("REQUESTER_NAME");
+    requesterGroup = row.columnString("REQUESTER_GROUP");
+    dstURL = row.columnString("DST_URL");
+    retriesWithinMount = row.columnUint32("RETRIES_WITHIN_MOUNT");
+    totalRetries = row.columnUint32("TOTAL_RETRIES");
+    lastMountWithFailure = row.columnUint64("LAST_MOUNT_WITH_FAILURE");
+    maxTotalRetries = row.columnUint32("MAX_TOTAL_RETRIES");
+    maxRetriesWithinMount = row.columnUint32("MAX_RETRIES_WITHIN_MOUNT");
+    maxReportRetries = row.columnUint32("MAX_REPORT_RETRIES");
+    totalReportRetries = row.columnUint32("TOTAL_REPORT_RETRIES");
+    failureLogs = row.columnOptionalString("FAILURE_LOG");
+    reportFailureLogs = row.columnOptionalString("REPORT_FAILURE_LOG");
+    isVerifyOnly = row.columnBool("IS_VERIFY_ONLY");
+    isReporting = row.columnBool("IS_REPORTING");
+    vid = row.columnString("VID");
+    alternateVids = row.columnString("ALTERNATE_VIDS");
+    alternateCopyNbs = row.columnString("ALTERNATE_COPY_NBS");
+    drive = row.columnString("DRIVE");
+    host = row.columnString("HOST");
+    logical_library = row.columnString("LOGICAL_LIBRARY");
+    activity = row.columnOptionalString("ACTIVITY");
+    srrUsername = row.columnString("SRR_USERNAME");
+    srrHost = row.columnString("SRR_HOST");
+    srrTime = row.columnUint64("SRR_TIME");
+    srrMountPolicy = row.columnString("SRR_MOUNT_POLICY");
+    srrActivity = row.columnString("SRR_ACTIVITY");
+
+    lifecycleTimings_creation_time = row.columnUint64("LIFECYCLE_CREATION_TIME");
+    lifecycleTimings_first_selected_time = row.columnUint64("LIFECYCLE_FIRST_SELECTED_TIME");
+    lifecycleTimings_completed_time = row.columnUint64("LIFECYCLE_COMPLETED_TIME");
+
+    diskSystemName = row.columnOptionalString("DISK_SYSTEM_NAME");
+
+    archiveFileID = row.columnUint64("ARCHIVE_FILE_ID");
+    fileSize = row.columnUint64("SIZE_IN_BYTES");
+    auto blob_view = row.columnBlobView("CHECKSUMBLOB");
     checksumBlob.deserialize(blob_view->data(), blob_view->size());
-    creationTime = rset.columnUint64NoOpt("CREATION_TIME");
-    diskInstance = rset.columnStringNoOpt("DISK_INSTANCE");
-    diskFileId = rset.columnStringNoOpt("DISK_FILE_ID");
-    diskFileInfoOwnerUid = rset.columnUint32NoOpt("DISK_FILE_OWNER_UID");
-    diskFileInfoGid = rset.columnUint32NoOpt("DISK_FILE_GID");
-    diskFileInfoPath = rset.columnStringNoOpt("DISK_FILE_PATH");
-    storageClass = rset.columnStringNoOpt("STORAGE_CLASS");
-
-    fSeq = rset.columnUint64NoOpt("FSEQ");
-    blockId = rset.columnUint64NoOpt("BLOCK_ID");
-    alternateFSeq = rset.columnStringNoOpt("ALTERNATE_FSEQS");
-    alternateBlockId = rset.columnStringNoOpt("ALTERNATE_BLOCK_IDS");
+    creationTime = row.columnUint64("CREATION_TIME");
+    diskInstance = row.columnString("DISK_INSTANCE");
+    diskFileId = row.columnString("DISK_FILE_ID");
+    diskFileInfoOwnerUid = row.columnUint32("DISK_FILE_OWNER_UID");
+    diskFileInfoGid = row.columnUint32("DISK_FILE_GID");
+    diskFileInfoPath = row.columnString("DISK_FILE_PATH");
+    storageClass = row.columnString("STORAGE_CLASS");
 
     return *this;
   }
@@ -37,7 +37,8 @@ public:
   reportJobsBatchTransferred(std::queue<std::unique_ptr<cta::ArchiveJob>>& successfulArchiveJobs,
                              std::queue<cta::catalogue::TapeItemWritten>& skippedFiles,
                              std::queue<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>>& failedToReportArchiveJobs,
-                             cta::log::LogContext& logContext) override {
+                             cta::log::LogContext& logContext,
+                             CatalogueUpdateTurn* catalogueUpdateTurn = nullptr) override {
     bool catalogue_updated = false;
     try {
       std::set<cta::catalogue::TapeItemWrittenPointer> tapeItemsWritten;
@@ -59,7 +60,20 @@ public:
         skippedFiles.pop();
         tapeItemsWritten.emplace(tiwup.release());
       }
-      m_catalogue.TapeFile()->filesWrittenToTape(tapeItemsWritten);
+      if (catalogueUpdateTurn) {
+        catalogueUpdateTurn->wait();
+      }
+      try {
+        m_catalogue.TapeFile()->filesWrittenToTape(tapeItemsWritten);
+      } catch (...) {
+        if (catalogueUpdateTurn) {
+          catalogueUpdateTurn->release();
+        }
+        throw;
+      }
+      if (catalogueUpdateTurn) {
+        catalogueUpdateTurn->release();
+      }
       catalogue_updated = true;
       for (auto& job : validatedSuccessfulArchiveJobs) {
         auto* maj = dynamic_cast<MockArchiveJob*>(job.get());
@@ -21,6 +21,7 @@
 #include "taped/session/DriveSessionTracker.hpp"
 #include "taped/session/Session.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <set>
 #include <signal.h>
@@ -991,7 +992,8 @@ std::shared_ptr<cta::catalogue::Catalogue> DriveHandler::createCatalogue(const s
   params.add("processName", processName);
   m_lc.log(log::DEBUG, "In DriveHandler::createCatalogue(): will get catalogue login information.");
   const cta::rdbms::Login catalogueLogin = cta::rdbms::Login::parseFile(m_tapedConfig.fileCatalogConfigFile.value());
-  const uint64_t nbConns = 1;
+  // Each concurrently reported archive batch needs its own connection
+  const uint64_t nbConns = std::max(m_tapedConfig.archiveMaxInFlightFlushReports.value(), 1U);
   const uint64_t nbArchiveFileListingConns = 0;
   m_lc.log(log::DEBUG, "In DriveHandler::createCatalogue(): will connect to catalogue.");
   auto catalogueFactory =
@@ -1072,8 +1074,13 @@ DriveHandler::executeDataTransferSession(IScheduler* scheduler, tape::daemon::Ta
   dataTransferConfig.bulkRequestRecallMaxFiles = m_tapedConfig.retrieveFetchBytesFiles.value().maxFiles;
   dataTransferConfig.maxBytesBeforeFlush = m_tapedConfig.archiveFlushBytesFiles.value().maxBytes;
   dataTransferConfig.maxFilesBeforeFlush = m_tapedConfig.archiveFlushBytesFiles.value().maxFiles;
+  dataTransferConfig.maxInFlightFlushReports = m_tapedConfig.archiveMaxInFlightFlushReports.value();
   dataTransferConfig.nbBufs = m_tapedConfig.bufferCount.value();
   dataTransferConfig.nbDiskThreads = m_tapedConfig.nbDiskThreads.value();
+  dataTransferConfig.minNbDiskThreads = m_tapedConfig.minNbDiskThreads.value();
+  dataTransferConfig.useLocalDiskDirectIO = (m_tapedConfig.useLocalDiskDirectIO.value() == "yes");
+  dataTransferConfig.sessionTraceDirectory = m_tapedConfig.sessionTraceDirectory.value();
+  dataTransferConfig.sessionTraceMaxEvents = m_tapedConfig.sessionTraceMaxEvents.value();
   dataTransferConfig.useLbp = true;
   dataTransferConfig.useRAO = (m_tapedConfig.useRAO.value() == "yes");
   dataTransferConfig.raoLtoAlgorithm = m_tapedConfig.raoLtoAlgorithm.value();
@@ -239,11 +239,17 @@ TapedConfiguration TapedConfiguration::createFromConfigPath(const std::string& d
   ret.archiveFetchBytesFiles.setFromConfigurationFile(cf, driveTapedConfigPath);
   ret.archiveDismountPolicy.setFromConfigurationFile(cf, driveTapedConfigPath);
   ret.archiveFlushBytesFiles.setFromConfigurationFile(cf, driveTapedConfigPath);
+  ret.archiveMaxInFlightFlushReports.setFromConfigurationFile(cf, driveTapedConfigPath);
   ret.retrieveFetchBytesFiles.setFromConfigurationFile(cf, driveTapedConfigPath);
   // Mount criteria
   ret.mountCriteria.setFromConfigurationFile(cf, driveTapedConfigPath);
   // Disk file access parameters
   ret.nbDiskThreads.setFromConfigurationFile(cf, driveTapedConfigPath);
+  ret.minNbDiskThreads.setFromConfigurationFile(cf, driveTapedConfigPath);
+  ret.useLocalDiskDirectIO.setFromConfigurationFile(cf, driveTapedConfigPath);
+  // Session I/O tracing
+  ret.sessionTraceDirectory.setFromConfigurationFile(cf, driveTapedConfigPath);
+  ret.sessionTraceMaxEvents.setFromConfigurationFile(cf, driveTapedConfigPath);
   //RAO
   ret.useRAO.setFromConfigurationFile(cf, driveTapedConfigPath);
   ret.raoLtoAlgorithm.setFromConfigurationFile(cf, driveTapedConfigPath);
@@ -310,11 +316,16 @@ TapedConfiguration TapedConfiguration::createFromConfigPath(const std::string& d
   ret.archiveFetchBytesFiles.log(log);
   ret.archiveDismountPolicy.log(log);
   ret.archiveFlushBytesFiles.log(log);
+  ret.archiveMaxInFlightFlushReports.log(log);
   ret.retrieveFetchBytesFiles.log(log);
 
   ret.mountCriteria.log(log);
 
   ret.nbDiskThreads.log(log);
+  ret.minNbDiskThreads.log(log);
+  ret.useLocalDiskDirectIO.log(log);
+  ret.sessionTraceDirectory.log(log);
+  ret.sessionTraceMaxEvents.log(log);
   ret.useRAO.log(log);
 
   ret.wdIdleSessionTimer.log(log);
@@ -107,6 +107,11 @@ struct TapedConfiguration {
     {32L * 1000 * 1000 * 1000, 200},
     "Compile time default"
   };
+  /// The maximum number of flushed archive batches being reported concurrently
+  cta::SourcedParameter<uint32_t> archiveMaxInFlightFlushReports {"taped",
+                                                                  "ArchiveMaxInFlightFlushReports",
+                                                                  1,
+                                                                  "Compile time default"};
   /// The fetch and report size for retrieve requests
   cta::SourcedParameter<FetchReportOrFlushLimits> retrieveFetchBytesFiles {
     "taped",
@@ -135,6 +140,20 @@ struct TapedConfiguration {
   //----------------------------------------------------------------------------
   /// Number of disk threads. This is the number of parallel file transfers.
   cta::SourcedParameter<uint64_t> nbDiskThreads {"taped", "NbDiskThreads", 10, "Compile time default"};
+  /// Initial and minimum number of working disk threads. 0 to always use NbDiskThreads.
+  cta::SourcedParameter<uint64_t> minNbDiskThreads {"taped", "MinNbDiskThreads", 0, "Compile time default"};
+  /// Usage of direct I/O when writing recalled files to a local disk buffer
+  cta::SourcedParameter<std::string> useLocalDiskDirectIO {"taped", "UseLocalDiskDirectIO", "no", "Compile time default"};
+  //----------------------------------------------------------------------------
+  // Session I/O tracing
+  //----------------------------------------------------------------------------
+  /// Directory where the I/O trace of each data transfer session is written. Empty to disable tracing.
+  cta::SourcedParameter<std::string> sessionTraceDirectory {"taped", "SessionTraceDirectory", "", "Compile time default"};
+  /// Maximum number of events kept in the I/O trace of a session (40 bytes each)
+  cta::SourcedParameter<uint64_t> sessionTraceMaxEvents {"taped",
+                                                         "SessionTraceMaxEvents",
+                                                         1024 * 1024,
+                                                         "Compile time default"};
   //----------------------------------------------------------------------------
   // Recommended Access Order usage
   //----------------------------------------------------------------------------
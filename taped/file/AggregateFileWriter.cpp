@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "AggregateFileWriter.hpp"
+
+#include "Exceptions.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace cta::tape::tapeFile {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+AggregateFileWriter::AggregateFileWriter(WriteSession& ws, const cta::ArchiveJob& firstMember, const size_t blockSize)
+    : m_fileWriter(ws, firstMember, blockSize) {}
+
+//------------------------------------------------------------------------------
+// startMember
+//------------------------------------------------------------------------------
+uint64_t AggregateFileWriter::startMember(uint64_t archiveFileId) {
+  if (!m_members.empty()) {
+    checkCurrentMemberNotEmpty();
+  }
+  AggregateMember member;
+  member.archiveFileId = archiveFileId;
+  member.blockOffset = m_blockCount;
+  m_members.push_back(member);
+  m_currentMemberEnded = false;
+  return member.blockOffset;
+}
+
+//------------------------------------------------------------------------------
+// write
+//------------------------------------------------------------------------------
+void AggregateFileWriter::write(const void* data, const size_t size) {
+  if (m_members.empty()) {
+    throw cta::exception::Exception("In AggregateFileWriter::write(): no member started");
+  }
+  if (!size) {
+    return;
+  }
+  if (m_currentMemberEnded || size > getBlockSize()) {
+    std::ostringstream err;
+    err << "In AggregateFileWriter::write(): only the last block of a member can be shorter than the block size:"
+        << " archiveFileId=" << m_members.back().archiveFileId << " size=" << size << " blockSize=" << getBlockSize();
+    throw cta::exception::Exception(err.str());
+  }
+  m_fileWriter.write(data, size);
+  m_blockCount++;
+  m_members.back().blockCount++;
+  m_members.back().size += size;
+  m_currentMemberEnded = size < getBlockSize();
+}
+
+//------------------------------------------------------------------------------
+// close
+//------------------------------------------------------------------------------
+void AggregateFileWriter::close() {
+  if (m_members.empty()) {
+    throw ZeroFileWritten();
+  }
+  checkCurrentMemberNotEmpty();
+  const std::string index = AggregateIndex::serialize(m_members);
+  for (size_t offset = 0; offset < index.size(); offset += getBlockSize()) {
+    m_fileWriter.write(index.data() + offset, std::min(getBlockSize(), index.size() - offset));
+  }
+  m_fileWriter.close();
+}
+
+//------------------------------------------------------------------------------
+// checkCurrentMemberNotEmpty
+//------------------------------------------------------------------------------
+void AggregateFileWriter::checkCurrentMemberNotEmpty() const {
+  if (!m_members.back().size) {
+    throw ZeroFileWritten();
+  }
+}
+
+}  // namespace cta::tape::tapeFile
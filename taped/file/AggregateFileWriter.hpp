@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "AggregateIndex.hpp"
+#include "FileWriter.hpp"
+
+#include <vector>
+
+namespace cta::tape::tapeFile {
+
+/**
+ * Writes many small archive files as the members of a single tape file, so that the
+ * labels, file marks and positioning of each tape file are paid once per aggregate
+ * instead of once per archive file.
+ *
+ * The aggregate is a regular tape file (HDR1/HDR2/UHL1 labelled with the archive file
+ * ID of the first member and the fSeq of the aggregate). Each member starts on a new
+ * block and only its last block may be short, so that a member can be located from
+ * the block offset recorded in its TapeFile::aggregateBlockOffset and read without
+ * knowing the other members. The AggregateIndex listing all the members is written
+ * after the last member, before the trailer labels.
+ */
+class AggregateFileWriter {
+public:
+  /**
+   * Constructor. Writes the headers of the aggregate.
+   * @param ws The session to be bound to
+   * @param firstMember The first archive file of the aggregate, which provides the fSeq
+   * and the file ID written in the headers
+   * @param blockSize The size of the blocks of the aggregate
+   */
+  AggregateFileWriter(WriteSession& ws, const cta::ArchiveJob& firstMember, size_t blockSize);
+
+  /**
+   * Starts a new member. The previous member, if any, is complete.
+   * @param archiveFileId The archive file ID of the new member
+   * @return the block offset of the new member within the aggregate
+   */
+  uint64_t startMember(uint64_t archiveFileId);
+
+  /**
+   * Writes a block of the current member. All blocks but the last one of a member must
+   * have the block size of the aggregate.
+   * @param data Buffer to copy the data from
+   * @param size Size of the buffer
+   */
+  void write(const void* data, size_t size);
+
+  /**
+   * Writes the index, then closes the aggregate by writing its trailers.
+   * HAS TO BE CALLED EXPLICITLY
+   */
+  void close();
+
+  /**
+   * @return the members written so far
+   */
+  const std::vector<AggregateMember>& getMembers() const { return m_members; }
+
+  /**
+   * @return the block id of the first header block of the aggregate
+   */
+  uint32_t getBlockId() const { return m_fileWriter.getBlockId(); }
+
+  /**
+   * @return the block size of the aggregate
+   */
+  size_t getBlockSize() const { return m_fileWriter.getBlockSize(); }
+
+  /**
+   * @return the LBP access mode
+   */
+  const std::string& getLBPMode() const { return m_fileWriter.getLBPMode(); }
+
+private:
+  /**
+   * Throws if the current member is empty
+   */
+  void checkCurrentMemberNotEmpty() const;
+
+  /** The writer of the underlying tape file */
+  FileWriter m_fileWriter;
+
+  /** The members written so far, the last one being the current one */
+  std::vector<AggregateMember> m_members;
+
+  /** Number of data blocks written so far */
+  uint64_t m_blockCount = 0;
+
+  /** Set when a short block ended the current member */
+  bool m_currentMemberEnded = false;
+};
+
+}  // namespace cta::tape::tapeFile
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "AggregateIndex.hpp"
+
+#include "Exceptions.hpp"
+
+#include <sstream>
+
+namespace cta::tape::tapeFile {
+
+namespace {
+
+constexpr size_t kMagicSize = sizeof(AggregateIndex::kMagic) - 1;
+constexpr size_t kHeaderSize = kMagicSize + 4 + 4 + 8;
+constexpr size_t kMemberSize = 4 * 8;
+
+//------------------------------------------------------------------------------
+// append
+//------------------------------------------------------------------------------
+void append(std::string& buffer, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; i++) {
+    buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+//------------------------------------------------------------------------------
+// extract
+//------------------------------------------------------------------------------
+uint64_t extract(const std::string& buffer, size_t& offset, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < bytes; i++) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer[offset + i])) << (8 * i);
+  }
+  offset += bytes;
+  return value;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// serialize
+//------------------------------------------------------------------------------
+std::string AggregateIndex::serialize(const std::vector<AggregateMember>& members) {
+  std::string buffer(kMagic, kMagicSize);
+  buffer.reserve(kHeaderSize + members.size() * kMemberSize);
+  append(buffer, kVersion, 4);
+  append(buffer, 0, 4);
+  append(buffer, members.size(), 8);
+  for (const auto& member : members) {
+    append(buffer, member.archiveFileId, 8);
+    append(buffer, member.blockOffset, 8);
+    append(buffer, member.blockCount, 8);
+    append(buffer, member.size, 8);
+  }
+  return buffer;
+}
+
+//------------------------------------------------------------------------------
+// deserialize
+//------------------------------------------------------------------------------
+std::vector<AggregateMember> AggregateIndex::deserialize(const std::string& buffer) {
+  if (buffer.size() < kHeaderSize || buffer.compare(0, kMagicSize, kMagic) != 0) {
+    throw TapeFormatError("In AggregateIndex::deserialize(): no aggregate index found");
+  }
+  size_t offset = kMagicSize;
+  const uint64_t version = extract(buffer, offset, 4);
+  if (version != kVersion) {
+    std::ostringstream err;
+    err << "In AggregateIndex::deserialize(): unsupported aggregate index version " << version;
+    throw TapeFormatError(err.str());
+  }
+  extract(buffer, offset, 4);
+  const uint64_t memberCount = extract(buffer, offset, 8);
+  if (memberCount > (buffer.size() - kHeaderSize) / kMemberSize) {
+    std::ostringstream err;
+    err << "In AggregateIndex::deserialize(): truncated aggregate index: memberCount=" << memberCount
+        << " indexSize=" << buffer.size();
+    throw TapeFormatError(err.str());
+  }
+  std::vector<AggregateMember> members(memberCount);
+  for (auto& member : members) {
+    member.archiveFileId = extract(buffer, offset, 8);
+    member.blockOffset = extract(buffer, offset, 8);
+    member.blockCount = extract(buffer, offset, 8);
+    member.size = extract(buffer, offset, 8);
+  }
+  return members;
+}
+
+}  // namespace cta::tape::tapeFile
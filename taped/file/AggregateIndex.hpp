@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace cta::tape::tapeFile {
+
+/**
+ * Location of one archive file within an aggregate tape file
+ */
+struct AggregateMember {
+  /** Archive file ID of the member */
+  uint64_t archiveFileId = 0;
+  /** Offset of the first block of the member, in blocks, from the first data block of the aggregate */
+  uint64_t blockOffset = 0;
+  /** Number of blocks of the member. All of them are full blocks, except the last one */
+  uint64_t blockCount = 0;
+  /** Size of the member in bytes */
+  uint64_t size = 0;
+
+  bool operator==(const AggregateMember& rhs) const = default;
+};
+
+/**
+ * The index written after the last member of an aggregate tape file, so that the
+ * content of the tape can be listed without the catalogue.
+ *
+ * Layout (integers are little endian):
+ *   "CTAAGGR1", version (u32), reserved (u32), member count (u64),
+ *   then for each member: archive file ID, block offset, block count, size (u64 each).
+ */
+class AggregateIndex {
+public:
+  /**
+   * @return the binary representation of the index of the given members
+   */
+  static std::string serialize(const std::vector<AggregateMember>& members);
+
+  /**
+   * Parses an index written by serialize()
+   * @throw TapeFormatError if the buffer does not contain a valid index
+   */
+  static std::vector<AggregateMember> deserialize(const std::string& buffer);
+
+  /**
+   * @return the number of data blocks of the given size needed to store a file of the given size
+   */
+  static uint64_t blockCount(uint64_t size, uint64_t blockSize) { return (size + blockSize - 1) / blockSize; }
+
+  static constexpr char kMagic[] = "CTAAGGR1";
+  static constexpr uint32_t kVersion = 1;
+};
+
+}  // namespace cta::tape::tapeFile
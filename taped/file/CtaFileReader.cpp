@@ -5,6 +5,7 @@
 
 #include "CtaFileReader.hpp"
 
+#include "AggregateIndex.hpp"
 #include "CtaReadSession.hpp"
 #include "HeaderChecker.hpp"
 #include "Structures.hpp"
@@ -27,6 +28,11 @@ void CtaFileReader::positionByFseq(const cta::RetrieveJob& fileToRecall) {
   // and allow next call to position to discover we failed half way
   m_session.setCurrentFilePart(PartOfFile::HeaderProcessing);
 
+  if (fileToRecall.selectedTapeFile().aggregateBlockOffset) {
+    throw cta::exception::InvalidArgument(
+      "In CtaFileReader::positionByFseq(): members of aggregate tape files can only be positioned by block id");
+  }
+
   if (fileToRecall.selectedTapeFile().fSeq < 1) {
     std::ostringstream err;
     err << "Unexpected fileId in FileReader::position with fSeq expected >=1, got: "
@@ -54,6 +60,11 @@ void CtaFileReader::positionByBlockID(const cta::RetrieveJob& fileToRecall) {
     throw cta::exception::Exception(ex_str.str());
   }
 
+  if (fileToRecall.selectedTapeFile().aggregateBlockOffset) {
+    positionToAggregateMember(fileToRecall);
+    return;
+  }
+
   const uint32_t destinationBlock = getBlockIDTarget(fileToRecall);
   const bool skipLocate = m_session.getCurrentFilePart() == PartOfFile::Header
                           && m_session.getCurrentFseq() == fileToRecall.selectedTapeFile().fSeq
@@ -66,6 +77,41 @@ void CtaFileReader::positionByBlockID(const cta::RetrieveJob& fileToRecall) {
   checkHeaders(fileToRecall);
 }
 
+void CtaFileReader::positionToAggregateMember(const cta::RetrieveJob& fileToRecall) {
+  const auto& tapeFile = fileToRecall.selectedTapeFile();
+  const uint32_t headerBlock = getBlockIDTarget(fileToRecall);
+  // The payload starts after HDR1, HDR2, UHL1 and a file mark
+  const uint64_t memberBlock = headerBlock + 4 + *tapeFile.aggregateBlockOffset;
+  if (memberBlock > std::numeric_limits<uint32_t>::max()) {
+    std::ostringstream ex_str;
+    ex_str << "[CtaFileReader::positionToAggregateMember] - Block id larger than the supported uint32_t limit: "
+           << memberBlock;
+    throw cta::exception::Exception(ex_str.str());
+  }
+
+  const bool continuesAggregate = m_session.getCurrentFilePart() == PartOfFile::AggregateMemberBoundary
+                                  && m_session.getCurrentFseq() == tapeFile.fSeq
+                                  && m_session.isCurrentBlockId(static_cast<uint32_t>(memberBlock));
+  if (continuesAggregate) {
+    // The previous reader stopped right before this member: the headers were checked already
+    m_currentBlockSize = m_session.getCurrentBlockSize();
+  } else {
+    const bool skipLocate = m_session.getCurrentFilePart() == PartOfFile::Header
+                            && m_session.getCurrentFseq() == tapeFile.fSeq
+                            && m_session.isCurrentBlockId(headerBlock);
+    m_session.setCurrentFilePart(PartOfFile::HeaderProcessing);
+    if (!skipLocate) {
+      locateBlockID(headerBlock);
+    }
+    checkHeaders(fileToRecall);
+    if (*tapeFile.aggregateBlockOffset) {
+      locateBlockID(static_cast<uint32_t>(memberBlock));
+    }
+  }
+  m_session.setCurrentFilePart(PartOfFile::Payload);
+  m_remainingMemberBlocks = AggregateIndex::blockCount(fileToRecall.archiveFile.fileSize, m_currentBlockSize);
+}
+
 void CtaFileReader::moveToFirstHeaderBlock() {
   // special case: we can rewind the tape to be faster
   // (TODO: in the future we could also think of a threshold above
@@ -113,6 +159,22 @@ size_t CtaFileReader::readNextDataBlock(void* data, const size_t size) {
   if (size != m_currentBlockSize) {
     throw WrongBlockSize();
   }
+  if (m_remainingMemberBlocks) {
+    // The end of a member of an aggregate tape file is given by its size, not by a file mark
+    if (!*m_remainingMemberBlocks) {
+      throw EndOfFile();
+    }
+    const size_t bytes_read = m_session.m_drive.readBlock(data, size);
+    if (!bytes_read) {
+      m_session.setCorrupted();
+      throw TapeFormatError("[CtaFileReader::readNextDataBlock] - Unexpected end of aggregate tape file");
+    }
+    m_session.advanceCurrentBlockId();
+    if (!--*m_remainingMemberBlocks) {
+      m_session.setCurrentFilePart(PartOfFile::AggregateMemberBoundary);
+    }
+    return bytes_read;
+  }
   size_t bytes_read = m_session.m_drive.readBlock(data, size);
   m_session.advanceCurrentBlockId();
   // end of file reached! we will keep on reading until we have read the file mark at the end of the trailers
@@ -200,13 +262,19 @@ void CtaFileReader::checkHeaders(const cta::RetrieveJob& fileToRecall) {
   }
 
   // headers are valid here, let's see if they contain the right info, i.e. are we in the correct place?
-  HeaderChecker::checkHDR1(hdr1, fileToRecall, m_session.getVolumeInfo());
+  if (fileToRecall.selectedTapeFile().aggregateBlockOffset) {
+    // The headers of an aggregate carry the file ID of its first member only
+    HeaderChecker::checkAggregateHDR1(hdr1, m_session.getVolumeInfo());
+  } else {
+    HeaderChecker::checkHDR1(hdr1, fileToRecall, m_session.getVolumeInfo());
+  }
   // we disregard hdr2 on purpose as it contains no useful information, we now check the fSeq in uhl1
   // (hdr1 also contains fSeq info but it is modulo 10000, therefore useless)
   HeaderChecker::checkUHL1(uhl1, fileToRecall);
   // now that we are all happy with the information contained within the
   // headers, we finally get the block size for our file (provided it has a reasonable value)
   setBlockSize(uhl1);
+  m_session.setCurrentBlockSize(m_currentBlockSize);
 }
 
 }  // namespace cta::tape::tapeFile
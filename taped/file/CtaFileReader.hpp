@@ -9,6 +9,7 @@
 #include "FileReader.hpp"
 
 #include <memory>
+#include <optional>
 
 namespace cta::tape::tapeFile {
 
@@ -36,12 +37,24 @@ private:
   void positionByFseq(const cta::RetrieveJob& fileToRecall) override;
   void positionByBlockID(const cta::RetrieveJob& fileToRecall) override;
 
+  /**
+    * Positions the tape at the first block of a member of an aggregate tape file. The headers
+    * of the aggregate are checked, unless the previous reader stopped right before this member.
+    * @param fileToRecall: the member to read, whose tape file has an aggregateBlockOffset
+    */
+  void positionToAggregateMember(const cta::RetrieveJob& fileToRecall);
+
   void moveToFirstHeaderBlock();
   void moveReaderByFSeqDelta(const int64_t fSeq_delta);
   uint32_t getBlockIDTarget(const cta::RetrieveJob& fileToRecall) const;
   void locateBlockID(uint32_t destinationBlock);
   void checkHeaders(const cta::RetrieveJob& fileToRecall);
   void checkTrailers();
+
+  /**
+    * Number of blocks left to read when reading a member of an aggregate tape file
+    */
+  std::optional<uint64_t> m_remainingMemberBlocks;
 };
 
 }  // namespace cta::tape::tapeFile
@@ -31,7 +31,8 @@ FileReader::~FileReader() noexcept {
   if (cta::PositioningMethod::ByFSeq == m_positionCommandCode && m_session.getCurrentFilePart() != PartOfFile::Header) {
     m_session.setCorrupted();
   } else if (cta::PositioningMethod::ByBlock == m_positionCommandCode
-             && m_session.getCurrentFilePart() != PartOfFile::Header) {
+             && m_session.getCurrentFilePart() != PartOfFile::Header
+             && m_session.getCurrentFilePart() != PartOfFile::AggregateMemberBoundary) {
     m_session.invalidateCurrentBlockId();
   }
   m_session.release();
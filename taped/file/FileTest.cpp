@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include "AggregateFileWriter.hpp"
+#include "AggregateIndex.hpp"
 #include "FileReader.hpp"
 #include "FileReaderFactory.hpp"
 #include "FileWriter.hpp"
@@ -23,8 +25,10 @@
 #include "taped/system/Wrapper.hpp"
 #include "tests/TempFile.hpp"
 
+#include <cstring>
 #include <gtest/gtest.h>
 #include <memory>
+#include <new>
 #include <vector>
 
 namespace unitTests {
@@ -307,6 +311,89 @@ TEST_F(ctaTapeFileTest, locatesWhenBlockIdDoesNotMatchTrackedPosition) {
   ASSERT_EQ(m_drive.getBlockIdPositioningCount(), 1);
 }
 
+TEST_F(ctaTapeFileTest, canWriteAndReadAggregateMembers) {
+  m_volInfo.labelFormat = cta::common::dataStructures::Label::Format::CTA;
+  const size_t blockSize = 16;
+  const std::vector<std::string> contents {"A member spanning two blocks",  // 28 bytes: 2 blocks
+                                           "Exactly 16 bytes",
+                                           "Last"};
+  std::vector<uint64_t> offsets;
+  uint32_t aggregateBlockId = 0;
+  {
+    const auto writeSession = std::make_unique<cta::tape::tapeFile::WriteSession>(m_drive, m_volInfo, 0, true, false);
+    cta::tape::tapeFile::AggregateFileWriter writer(*writeSession, m_fileToMigrate, blockSize);
+    aggregateBlockId = writer.getBlockId();
+    for (size_t i = 0; i < contents.size(); i++) {
+      offsets.push_back(writer.startMember(i + 1));
+      for (size_t offset = 0; offset < contents[i].size(); offset += blockSize) {
+        writer.write(contents[i].data() + offset, std::min(blockSize, contents[i].size() - offset));
+      }
+    }
+    // Only the last block of a member can be short
+    ASSERT_THROW(writer.write("x", 1), cta::exception::Exception);
+    writer.close();
+    ASSERT_EQ(3, writer.getMembers().size());
+    ASSERT_EQ(2, writer.getMembers()[0].blockCount);
+    ASSERT_EQ(28, writer.getMembers()[0].size);
+  }
+  ASSERT_EQ(std::vector<uint64_t>({0, 2, 3}), offsets);
+
+  const auto readSession = cta::tape::tapeFile::ReadSessionFactory::create(m_drive, m_volInfo, false);
+  auto readMember = [&](size_t i) {
+    TestingRetrieveJob job;
+    job.selectedCopyNb = 1;
+    cta::common::dataStructures::TapeFile tf;
+    tf.fSeq = 1;
+    tf.copyNb = 1;
+    tf.blockId = aggregateBlockId;
+    tf.aggregateBlockOffset = offsets[i];
+    job.archiveFile.tapeFiles.push_back(tf);
+    job.archiveFile.fileSize = contents[i].size();
+    job.retrieveRequest.archiveFileID = i + 1;
+    const auto reader = cta::tape::tapeFile::FileReaderFactory::create(*readSession, job);
+    std::vector<char> block(reader->getBlockSize());
+    std::string data;
+    try {
+      while (true) {
+        const size_t bytesRead = reader->readNextDataBlock(block.data(), block.size());
+        data.append(block.data(), bytesRead);
+      }
+    } catch (cta::tape::tapeFile::EndOfFile&) {}
+    return data;
+  };
+
+  // Sequential members are read without any locate
+  for (size_t i = 0; i < contents.size(); i++) {
+    ASSERT_EQ(contents[i], readMember(i));
+  }
+  ASSERT_EQ(m_drive.getBlockIdPositioningCount(), 0);
+
+  // Going back to a member checks the aggregate headers then locates the member
+  ASSERT_EQ(contents[1], readMember(1));
+  ASSERT_EQ(m_drive.getBlockIdPositioningCount(), 2);
+}
+
+TEST(ctaTapeAggregateIndex, serializeAndDeserialize) {
+  std::vector<cta::tape::tapeFile::AggregateMember> members(2);
+  members[0].archiveFileId = 0x1234567890;
+  members[0].blockCount = 3;
+  members[0].size = 600000;
+  members[1].archiveFileId = 42;
+  members[1].blockOffset = 3;
+  members[1].blockCount = 1;
+  members[1].size = 1;
+  const std::string index = cta::tape::tapeFile::AggregateIndex::serialize(members);
+  ASSERT_EQ(24 + 2 * 32, index.size());
+  ASSERT_EQ(members, cta::tape::tapeFile::AggregateIndex::deserialize(index));
+
+  ASSERT_THROW(cta::tape::tapeFile::AggregateIndex::deserialize("not an index"),
+               cta::tape::tapeFile::TapeFormatError);
+  ASSERT_THROW(cta::tape::tapeFile::AggregateIndex::deserialize(index.substr(0, index.size() - 1)),
+               cta::tape::tapeFile::TapeFormatError);
+  ASSERT_EQ(3, cta::tape::tapeFile::AggregateIndex::blockCount(600000, 262144));
+  ASSERT_EQ(1, cta::tape::tapeFile::AggregateIndex::blockCount(262144, 262144));
+}
+
 INSTANTIATE_TEST_CASE_P(FormatLabelsParam,
                         ctaTapeFileTest,
                         ::testing::Values(cta::common::dataStructures::Label::Format::CTA
@@ -347,6 +434,35 @@ TEST(ctaTapeDiskFile, canWriteAndReadDisk) {
   delete[] data2;
 }
 
+TEST(ctaTapeDiskFile, canWriteDiskWithDirectIO) {
+  // Two aligned blocks followed by an unaligned tail, as written by a recall of a file
+  const size_t alignedSize = 2 * cta::disk::kDirectIOAlignment;
+  const size_t tailSize = 1000;
+  auto* data = static_cast<char*>(::operator new[](alignedSize, std::align_val_t(cta::disk::kDirectIOAlignment)));
+  for (size_t i = 0; i < alignedSize; i++) {
+    data[i] = static_cast<char>(i % 251);
+  }
+  cta::disk::DiskFileFactory fileFactory(0, true);
+  TempFile destinationFile;
+  {
+    std::unique_ptr<cta::disk::WriteFile> wf(fileFactory.createWriteFile(destinationFile.path()));
+    wf->write(data, alignedSize);
+    wf->write(data, tailSize);
+    wf->close();
+  }
+  std::unique_ptr<cta::disk::ReadFile> dst(fileFactory.createReadFile(destinationFile.path()));
+  ASSERT_EQ(alignedSize + tailSize, dst->size());
+  std::vector<char> readBack(alignedSize + tailSize);
+  size_t readSize = 0;
+  while (size_t res = dst->read(readBack.data() + readSize, readBack.size() - readSize)) {
+    readSize += res;
+  }
+  ASSERT_EQ(alignedSize + tailSize, readSize);
+  ASSERT_EQ(0, memcmp(readBack.data(), data, alignedSize));
+  ASSERT_EQ(0, memcmp(readBack.data() + alignedSize, data, tailSize));
+  ::operator delete[](data, std::align_val_t(cta::disk::kDirectIOAlignment));
+}
+
 TEST(ctaDirectoryTests, directoryExist) {
   cta::disk::LocalDirectory dir("/tmp/");
   ASSERT_TRUE(dir.exist());
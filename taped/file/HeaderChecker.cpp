@@ -80,6 +80,15 @@ void HeaderChecker::checkHDR1(const HDR1& hdr1, const RetrieveJob& filetoRecall,
   }
 }
 
+void HeaderChecker::checkAggregateHDR1(const HDR1& hdr1, const daemon::VolumeInfo& volInfo) {
+  if (hdr1.getVSN().compare(volInfo.vid)) {
+    std::ostringstream ex_str;
+    ex_str << "[HeaderChecker::checkAggregateHDR1] - Wrong volume ID info found in hdr1: " << hdr1.getVSN()
+           << ". Wanted: " << volInfo.vid;
+    throw TapeFormatError(ex_str.str());
+  }
+}
+
 void HeaderChecker::checkUHL1(const UHL1& uhl1, const cta::RetrieveJob& fileToRecall) {
   if (!checkHeaderNumericalField(uhl1.getfSeq(), fileToRecall.selectedTapeFile().fSeq, HeaderBase::decimal)) {
     std::ostringstream ex_str;
@@ -43,6 +43,13 @@ public:
     */
   static void checkHDR1(const HDR1& hdr1, const cta::RetrieveJob& filetoRecall, const daemon::VolumeInfo& volInfo);
 
+  /**
+    * Checks the hdr1 of an aggregate tape file, which carries the file ID of its first member only
+    * @param hdr1: the hdr1 header of the aggregate
+    * @param volInfo: the volume information of the tape in the drive
+    */
+  static void checkAggregateHDR1(const HDR1& hdr1, const daemon::VolumeInfo& volInfo);
+
   /**
     * Checks the uhl1
     * @param uhl1: the uhl1 header of the current file
@@ -20,7 +20,11 @@ class DriveInterface;
 
 namespace tapeFile {
 
-enum class PartOfFile { Header, HeaderProcessing, Payload, Trailer };
+/**
+  * Where the session stands within the current tape file. AggregateMemberBoundary means the
+  * payload of an aggregate tape file was read up to the first block of its next member.
+  */
+enum class PartOfFile { Header, HeaderProcessing, Payload, AggregateMemberBoundary, Trailer };
 
 /**
   * Class keeping track of a whole tape read session over an AUL formatted
@@ -95,6 +99,10 @@ public:
 
   inline bool isCurrentBlockId(uint32_t blockId) const { return m_blockId && *m_blockId == blockId; }
 
+  inline void setCurrentBlockSize(size_t blockSize) { m_blockSize = blockSize; }
+
+  inline size_t getCurrentBlockSize() const { return m_blockSize; }
+
   inline const daemon::VolumeInfo& getVolumeInfo() const { return m_volInfo; }
 
   inline void setCurrentFilePart(const PartOfFile& currentFilePart) { m_currentFilePart = currentFilePart; }
@@ -143,6 +151,12 @@ protected:
     */
   std::optional<uint32_t> m_blockId;
 
+  /**
+    * Block size of the current file, as found in its headers. Allows reading the next member
+    * of an aggregate tape file without going back to its headers.
+    */
+  size_t m_blockSize = 0;
+
   /**
     * Part of the file we are reading
     */
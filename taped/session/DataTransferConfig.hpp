@@ -62,11 +62,36 @@ struct DataTransferConfig {
    */
   uint64_t maxFilesBeforeFlush = 0;
 
+  /**
+   * Maximum number of flushed batches of archive jobs being reported concurrently
+   */
+  uint32_t maxInFlightFlushReports = 1;
+
   /**
    * Number of disk I/O threads
    */
   uint32_t nbDiskThreads = 0;
 
+  /**
+   * Initial and minimum number of working disk I/O threads (0 for a fixed number of nbDiskThreads)
+   */
+  uint32_t minNbDiskThreads = 0;
+
+  /**
+   * Whether to write recalled files to local disk buffers with direct I/O
+   */
+  bool useLocalDiskDirectIO = false;
+
+  /**
+   * Directory where the I/O trace of each session is written (empty string for no tracing)
+   */
+  std::string sessionTraceDirectory;
+
+  /**
+   * Maximum number of events kept in the I/O trace of a session
+   */
+  uint64_t sessionTraceMaxEvents = 0;
+
   /**
    * Timeout for XRoot functions
    *
@@ -33,6 +33,7 @@
 
 #include <google/protobuf/stubs/common.h>
 #include <memory>
+#include <sstream>
 #include <string>
 
 //------------------------------------------------------------------------------
@@ -291,7 +292,9 @@ cta::tape::daemon::DataTransferSession::executeRead(cta::log::LogContext& logCon
                                    reportPacker,
                                    watchDog,
                                    logContext,
-                                   m_dataTransferConfig.xrootTimeout);
+                                   m_dataTransferConfig.xrootTimeout,
+                                   m_dataTransferConfig.useLocalDiskDirectIO,
+                                   m_dataTransferConfig.minNbDiskThreads);
     RecallTaskInjector taskInjector(memoryManager,
                                     readSingleThread,
                                     threadPool,
@@ -341,6 +344,9 @@ cta::tape::daemon::DataTransferSession::executeRead(cta::log::LogContext& logCon
     //only mount the tape if we can confirm that we will do some work, otherwise do an empty mount
     if (fetchResult && reservationResult) {
       // We got something to recall. Time to start the machinery
+      const auto tracer = createTracer();
+      readSingleThread.setTracer(tracer.get());
+      threadPool.setTracer(tracer.get());
       readSingleThread.setWaitForInstructionsTime(timer.secs());
       watchDog.startThread();
       readSingleThread.startThreads();
@@ -356,6 +362,7 @@ cta::tape::daemon::DataTransferSession::executeRead(cta::log::LogContext& logCon
       reportPacker.waitThread();
       reporter.waitThreads();
       watchDog.stopAndWaitThread();
+      dumpTrace(tracer.get(), logContext);
 
       // If the disk thread finished the last, it leaves the drive in DrainingToDisk state
       // Return the drive back to UP state
@@ -458,7 +465,7 @@ cta::tape::daemon::DataTransferSession::executeWrite(cta::log::LogContext& logCo
     //dereferencing configLine is safe, because if configLine were not valid,
     //then findDrive would have return nullptr and we would have not end up there
     MigrationMemoryManager memoryManager(m_dataTransferConfig.nbBufs, m_dataTransferConfig.bufsz, logContext);
-    MigrationReportPacker reportPacker(archiveMount, logContext);
+    MigrationReportPacker reportPacker(archiveMount, logContext, m_dataTransferConfig.maxInFlightFlushReports);
     MigrationWatchDog watchDog(15,
                                m_dataTransferConfig.wdNoBlockMoveMaxSecs,
                                m_initialProcess,
@@ -486,7 +493,8 @@ cta::tape::daemon::DataTransferSession::executeWrite(cta::log::LogContext& logCo
                                   m_dataTransferConfig.bulkRequestMigrationMaxBytes,
                                   watchDog,
                                   logContext,
-                                  m_dataTransferConfig.xrootTimeout);
+                                  m_dataTransferConfig.xrootTimeout,
+                                  m_dataTransferConfig.minNbDiskThreads);
 
     MigrationTaskInjector taskInjector(memoryManager,
                                        threadPool,
@@ -509,6 +517,9 @@ cta::tape::daemon::DataTransferSession::executeWrite(cta::log::LogContext& logCo
       writeSingleThread.setlastFseq(firstFseqFromClient - 1);
 
       // We have something to do: start the session by starting all the threads.
+      const auto tracer = createTracer();
+      writeSingleThread.setTracer(tracer.get());
+      threadPool.setTracer(tracer.get());
       memoryManager.startThreads();
       threadPool.startThreads();
       watchDog.startThread();
@@ -525,6 +536,7 @@ cta::tape::daemon::DataTransferSession::executeWrite(cta::log::LogContext& logCo
       reportPacker.waitThread();
       reporter.waitThreads();
       watchDog.stopAndWaitThread();
+      dumpTrace(tracer.get(), logContext);
 
       return writeSingleThread.getHardwareStatus();
     } else {
@@ -652,6 +664,40 @@ cta::tape::drive::DriveInterface* cta::tape::daemon::DataTransferSession::findDr
   }
 }
 
+//------------------------------------------------------------------------------
+//DataTransferSession::createTracer
+//------------------------------------------------------------------------------
+std::unique_ptr<cta::tape::daemon::SessionTracer> cta::tape::daemon::DataTransferSession::createTracer() const {
+  if (m_dataTransferConfig.sessionTraceDirectory.empty()) {
+    return nullptr;
+  }
+  std::ostringstream label;
+  label << "drive=" << m_driveInfo.driveName << " tapeVid=" << m_volInfo.vid << " mountId=" << m_volInfo.mountId
+        << " mountType=" << toCamelCaseString(m_volInfo.mountType);
+  return std::make_unique<SessionTracer>(label.str(), m_dataTransferConfig.sessionTraceMaxEvents);
+}
+
+//------------------------------------------------------------------------------
+//DataTransferSession::dumpTrace
+//------------------------------------------------------------------------------
+void cta::tape::daemon::DataTransferSession::dumpTrace(const SessionTracer* tracer,
+                                                       cta::log::LogContext& logContext) const {
+  if (!tracer) {
+    return;
+  }
+  const std::string path = m_dataTransferConfig.sessionTraceDirectory + "/cta-taped-" + m_driveInfo.driveName + "-"
+                           + m_volInfo.vid + "-" + m_volInfo.mountId + ".trace";
+  cta::log::ScopedParamContainer params(logContext);
+  params.add("traceFile", path);
+  try {
+    tracer->dumpToFile(path);
+    logContext.log(cta::log::INFO, "In DataTransferSession::dumpTrace(): wrote session I/O trace");
+  } catch (cta::exception::Exception& ex) {
+    params.add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
+    logContext.log(cta::log::WARNING, "In DataTransferSession::dumpTrace(): failed to write session I/O trace");
+  }
+}
+
 //------------------------------------------------------------------------------
 // Get drive down with reason
 //------------------------------------------------------------------------------
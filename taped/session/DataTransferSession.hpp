@@ -7,6 +7,7 @@
 
 #include "DataTransferConfig.hpp"
 #include "Session.hpp"
+#include "SessionTracer.hpp"
 #include "TapeSingleThreadInterface.hpp"
 #include "common/log/LogContext.hpp"
 #include "common/log/Logger.hpp"
@@ -109,6 +110,18 @@ private:
   /** sub-part of execute for a label session */
   EndOfSessionAction executeLabel(cta::log::LogContext& logContext, cta::LabelMount* labelMount) const;
 
+  /**
+   * Creates the tracer of the session I/O operations
+   * @return the tracer, or nullptr if no trace directory is configured
+   */
+  std::unique_ptr<SessionTracer> createTracer() const;
+
+  /**
+   * Writes the trace of the session in the trace directory. Failures are logged and otherwise ignored:
+   * tracing must not affect the outcome of the session.
+   */
+  void dumpTrace(const SessionTracer* tracer, cta::log::LogContext& logContext) const;
+
   /** Reference to the MediaChangerFacade, allowing the mounting of the tape
    * by the library. It will be used exclusively by the tape thread. */
   cta::mediachanger::MediaChangerFacade& m_mediaChanger;
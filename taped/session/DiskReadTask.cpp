@@ -7,12 +7,34 @@
 
 #include "TransferTaskTracker.hpp"
 #include "common/log/LogContext.hpp"
+#include "common/log/LogSchema.hpp"
 #include "common/semconv/Attributes.hpp"
 #include "common/telemetry/metrics/instruments/TapedInstruments.hpp"
 #include "common/utils/Timer.hpp"
 
 namespace cta::tape::daemon {
 
+namespace {
+/**
+ * Statistics logged for each file read from disk
+ */
+using DiskReadStatsLog = log::LogSchema<log::Field<"readWriteTime", double>,
+                                        log::Field<"checksumingTime", double>,
+                                        log::Field<"waitFreeMemoryTime", double>,
+                                        log::Field<"waitDataTime", double>,
+                                        log::Field<"waitReportingTime", double>,
+                                        log::Field<"checkingErrorTime", double>,
+                                        log::Field<"openingTime", double>,
+                                        log::Field<"transferTime", double>,
+                                        log::Field<"totalTime", double>,
+                                        log::Field<"dataVolume", uint64_t>,
+                                        log::Field<"globalPayloadTransferSpeedMBps", double>,
+                                        log::Field<"diskPerformanceMBps", double>,
+                                        log::Field<"openRWCloseToTransferTimeRatio", double>,
+                                        log::Field<"fileId", uint64_t>,
+                                        log::Field<"path", std::string>>;
+}  // namespace
+
 //------------------------------------------------------------------------------
 // constructor
 //------------------------------------------------------------------------------
@@ -34,7 +56,8 @@ DiskReadTask::DiskReadTask(DataConsumer& destination,
 void DiskReadTask::execute(cta::log::LogContext& lc,
                            cta::disk::DiskFileFactory& fileFactory,
                            MigrationWatchDog& watchdog,
-                           const int threadID) {
+                           const int threadID,
+                           const SessionTracer::Lane& trace) {
   [[maybe_unused]] TransferTaskTracker transferTaskTracker(cta::semconv::attr::CtaIoDirectionValues::kRead,
                                                            cta::semconv::attr::CtaIoMediumValues::kDisk);
   using cta::log::LogContext;
@@ -44,6 +67,7 @@ void DiskReadTask::execute(cta::log::LogContext& lc,
   cta::utils::Timer totalTime(localTime);
   size_t blockId = 0;
   size_t migratingFileSize = m_archiveJob->archiveFile.fileSize;
+  const uint64_t fSeq = m_archiveJob->tapeFile.fSeq;
   MemBlock* mb = nullptr;
   // This out-of-try-catch variables allows us to record the stage of the
   // process we're in, and to count the error if it occurs.
@@ -66,7 +90,7 @@ void DiskReadTask::execute(cta::log::LogContext& lc,
     }
     currentErrorToCount = "";
 
-    m_stats.openingTime += localTime.secs(cta::utils::Timer::resetCounter);
+    m_stats.openingTime += trace.span(TraceEventType::DiskOpen, localTime, fSeq);
 
     LogContext::ScopedParam sp(lc, Param("fileId", m_archiveJob->archiveFile.archiveFileID));
     lc.log(cta::log::INFO, "Opened disk file for read");
@@ -78,7 +102,7 @@ void DiskReadTask::execute(cta::log::LogContext& lc,
       checkMigrationFailing();
 
       mb = m_nextTask.getFreeBlock();
-      m_stats.waitFreeMemoryTime += localTime.secs(cta::utils::Timer::resetCounter);
+      m_stats.waitFreeMemoryTime += trace.span(TraceEventType::WaitFreeMemory, localTime, fSeq);
 
       //set metadata and read the data
       mb->m_fileid = m_archiveJob->archiveFile.archiveFileID;
@@ -86,7 +110,7 @@ void DiskReadTask::execute(cta::log::LogContext& lc,
 
       currentErrorToCount = "Error_diskRead";
       migratingFileSize -= mb->m_payload.read(*sourceFile);
-      m_stats.readWriteTime += localTime.secs(cta::utils::Timer::resetCounter);
+      m_stats.readWriteTime += trace.span(TraceEventType::DiskRead, localTime, fSeq, mb->m_payload.size());
 
       m_stats.dataVolume += mb->m_payload.size();
 
@@ -205,28 +229,27 @@ void DiskReadTask::circulateAllBlocks(size_t fromBlockId, MemBlock* mb) {
 // logWithStat
 //------------------------------------------------------------------------------
 void DiskReadTask::logWithStat(int level, std::string_view msg, cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("readWriteTime", m_stats.readWriteTime)
-    .add("checksumingTime", m_stats.checksumingTime)
-    .add("waitFreeMemoryTime", m_stats.waitFreeMemoryTime)
-    .add("waitDataTime", m_stats.waitDataTime)
-    .add("waitReportingTime", m_stats.waitReportingTime)
-    .add("checkingErrorTime", m_stats.checkingErrorTime)
-    .add("openingTime", m_stats.openingTime)
-    .add("transferTime", m_stats.transferTime)
-    .add("totalTime", m_stats.totalTime)
-    .add("dataVolume", m_stats.dataVolume)
-    .add("globalPayloadTransferSpeedMBps",
-         m_stats.totalTime ? 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.totalTime : 0)
-    .add("diskPerformanceMBps",
-         m_stats.transferTime ? 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.transferTime : 0)
-    .add("openRWCloseToTransferTimeRatio",
-         m_stats.transferTime ?
-           (m_stats.openingTime + m_stats.readWriteTime + m_stats.closingTime) / m_stats.transferTime :
-           0.0)
-    .add("fileId", m_archiveJobCachedInfo.fileId)
-    .add("path", m_archiveJobCachedInfo.remotePath);
-  lc.log(level, msg);
+  DiskReadStatsLog::log(
+    lc,
+    level,
+    msg,
+    m_stats.readWriteTime,
+    m_stats.checksumingTime,
+    m_stats.waitFreeMemoryTime,
+    m_stats.waitDataTime,
+    m_stats.waitReportingTime,
+    m_stats.checkingErrorTime,
+    m_stats.openingTime,
+    m_stats.transferTime,
+    m_stats.totalTime,
+    m_stats.dataVolume,
+    m_stats.totalTime ? 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.totalTime : 0,
+    m_stats.transferTime ? 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.transferTime : 0,
+    m_stats.transferTime ?
+      (m_stats.openingTime + m_stats.readWriteTime + m_stats.closingTime) / m_stats.transferTime :
+      0.0,
+    m_archiveJobCachedInfo.fileId,
+    m_archiveJobCachedInfo.remotePath);
 }
 
 const DiskStats& DiskReadTask::getTaskStats() const {
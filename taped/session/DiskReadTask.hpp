@@ -9,6 +9,7 @@
 #include "DataPipeline.hpp"
 #include "DiskStats.hpp"
 #include "ErrorFlag.hpp"
+#include "SessionTracer.hpp"
 #include "TaskWatchDog.hpp"
 #include "common/log/LogContext.hpp"
 #include "common/process/threading/AtomicFlag.hpp"
@@ -28,8 +29,11 @@ public:
                size_t numberOfBlock,
                cta::threading::AtomicFlag& errorFlag);
 
-  void
-  execute(cta::log::LogContext& lc, cta::disk::DiskFileFactory& fileFactory, MigrationWatchDog& watchdog, int threadID);
+  void execute(cta::log::LogContext& lc,
+               cta::disk::DiskFileFactory& fileFactory,
+               MigrationWatchDog& watchdog,
+               int threadID,
+               const SessionTracer::Lane& trace = SessionTracer::Lane());
 
   /**
    * Return the stats of the tasks
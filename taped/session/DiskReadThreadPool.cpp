@@ -21,10 +21,12 @@ DiskReadThreadPool::DiskReadThreadPool(int nbThread,
                                        uint64_t maxBytesReq,
                                        cta::tape::daemon::MigrationWatchDog& migrationWatchDog,
                                        const cta::log::LogContext& lc,
-                                       uint16_t xrootTimeout)
+                                       uint16_t xrootTimeout,
+                                       int minNbThread)
     : m_xrootTimeout(xrootTimeout),
       m_watchdog(migrationWatchDog),
       m_lc(lc),
+      m_sizer(minNbThread > 0 ? minNbThread : nbThread, nbThread),
       m_maxFilesReq(maxFilesReq),
       m_maxBytesReq(maxBytesReq) {
   for (int i = 0; i < nbThread; i++) {
@@ -53,6 +55,8 @@ void DiskReadThreadPool::startThreads() {
   for (std::vector<DiskReadWorkerThread*>::iterator i = m_threads.begin(); i != m_threads.end(); ++i) {
     (*i)->start();
   }
+  cta::log::ScopedParamContainer params(m_lc);
+  params.add("workingThreadCount", m_sizer.getTarget());
   m_lc.log(cta::log::INFO, "All the DiskReadWorkerThreads are started");
 }
 
@@ -77,6 +81,8 @@ void DiskReadThreadPool::push(DiskReadTask* t) {
 // DiskReadThreadPool::finish
 //------------------------------------------------------------------------------
 void DiskReadThreadPool::finish() {
+  /* Parked threads need to run to consume their endOfSession */
+  m_sizer.release();
   /* Insert one endOfSession per thread */
   for (size_t i = 0; i < m_threads.size(); i++) {
     m_tasks.push(nullptr);
@@ -142,16 +148,24 @@ void DiskReadThreadPool::DiskReadWorkerThread::run() {
   logParams.add("thread", "DiskRead").add("threadID", m_threadID);
   m_lc.log(cta::log::DEBUG, "Starting DiskReadWorkerThread");
 
+  const SessionTracer::Lane trace(m_parent.m_tracer, "DiskRead-" + std::to_string(m_threadID));
   std::unique_ptr<DiskReadTask> task;
   cta::utils::Timer localTime;
   cta::utils::Timer totalTime;
 
   while (1) {
+    m_parent.m_sizer.waitUntilWorking(m_threadID);
     task.reset(m_parent.popAndRequestMore(m_lc));
-    m_threadStat.waitInstructionsTime += localTime.secs(cta::utils::Timer::resetCounter);
+    m_threadStat.waitInstructionsTime += trace.span(TraceEventType::WaitInstructions, localTime);
     if (nullptr != task.get()) {
-      task->execute(m_lc, m_diskFileFactory, m_parent.m_watchdog, m_threadID);
+      task->execute(m_lc, m_diskFileFactory, m_parent.m_watchdog, m_threadID, trace);
       m_threadStat += task->getTaskStats();
+      if (m_parent.m_sizer.isElastic()) {
+        // The drive starves when the tape thread waits for the data we read
+        m_parent.m_sizer.addTaskWaitTime(task->getTaskStats().waitFreeMemoryTime,
+                                         m_parent.m_watchdog.getStats().waitDataTime,
+                                         m_lc);
+      }
     } else {
       break;
     }
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "DiskReadTask.hpp"
+#include "DiskThreadPoolSizer.hpp"
 #include "TaskWatchDog.hpp"
 #include "common/log/LogContext.hpp"
 #include "common/process/threading/BlockingQueue.hpp"
@@ -25,18 +26,21 @@ public:
   /**
    * The constructor creates the threads for the pool, but does not start them.
    *
-   * @param nbThread    Number of thread for reading files
+   * @param nbThread    Number of thread for reading files (maximum number of working threads)
    * @param maxFilesReq Maximum number of files we might require within a single request to the task injector
    * @param maxBytesReq Maximum number of bytes we might require within a single request a single request
    *                    to the task injector
    * @param lc          Log context for logging purpose
+   * @param minNbThread Number of working threads at the beginning of the session. The pool
+   *                    grows up to nbThread when the drive starves. 0 means a fixed size pool.
    */
   DiskReadThreadPool(int nbThread,
                      uint64_t maxFilesReq,
                      uint64_t maxBytesReq,
                      MigrationWatchDog& migrationWatchDog,
                      const cta::log::LogContext& lc,
-                     uint16_t xrootTimeout);
+                     uint16_t xrootTimeout,
+                     int minNbThread = 0);
 
   /**
    * Destructor.
@@ -83,6 +87,13 @@ public:
    */
   void setTaskInjector(MigrationTaskInjector* injector) { m_injector = injector; }
 
+  /**
+   * Sets the tracer recording the operations of the disk threads.
+   * This function MUST be called before starting the threads.
+   * @param tracer The session tracer, or nullptr to disable tracing
+   */
+  void setTracer(SessionTracer* tracer) { m_tracer = tracer; }
+
 private:
   /**
    * When the last thread finish, we log all m_pooldStat members + message
@@ -194,6 +205,13 @@ private:
    * termination signaling */
   MigrationTaskInjector* m_injector;
 
+  /** Tracer of the session I/O operations (nullptr if tracing is disabled) */
+  SessionTracer* m_tracer = nullptr;
+
+  /** Decides how many threads take tasks, based on the time they wait for free memory
+   * and on the time the tape thread waits for data */
+  DiskThreadPoolSizer m_sizer;
+
   /** The maximum number of files we ask per request. This value is also used as
    * a threshold (half of it, indeed) to trigger the request for more work.
    * Another request for more work is also triggered when the task FIFO gets empty.*/
@@ -27,6 +27,9 @@ struct DiskStats {
   /** Cumulated time spent calling read/write methods on the disk client */
   double readWriteTime = 0;
 
+  /** Cumulated CPU time consumed by the thread while calling read/write methods on the disk client */
+  double readWriteCpuTime = 0;
+
   /** Cumulated time spent waiting for data blocks. */
   double waitDataTime = 0;
 
@@ -67,6 +70,7 @@ struct DiskStats {
     closingTime += other.closingTime;
     checksumingTime += other.checksumingTime;
     readWriteTime += other.readWriteTime;
+    readWriteCpuTime += other.readWriteCpuTime;
     waitDataTime += other.waitDataTime;
     waitFreeMemoryTime += other.waitFreeMemoryTime;
     waitInstructionsTime += other.waitInstructionsTime;
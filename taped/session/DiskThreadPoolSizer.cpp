@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "DiskThreadPoolSizer.hpp"
+
+#include "common/process/threading/MutexLocker.hpp"
+
+#include <algorithm>
+
+namespace cta::tape::daemon {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+DiskThreadPoolSizer::DiskThreadPoolSizer(uint32_t minThreads, uint32_t maxThreads, double evaluationPeriod)
+    : m_minThreads(std::clamp(minThreads, 1U, std::max(maxThreads, 1U))),
+      m_maxThreads(std::max(maxThreads, 1U)),
+      m_evaluationPeriod(evaluationPeriod),
+      m_target(m_minThreads) {}
+
+//------------------------------------------------------------------------------
+// waitUntilWorking
+//------------------------------------------------------------------------------
+void DiskThreadPoolSizer::waitUntilWorking(uint32_t threadID) {
+  cta::threading::MutexLocker locker(m_mutex);
+  while (!m_released && threadID >= m_target) {
+    m_condVar.wait(locker);
+  }
+}
+
+//------------------------------------------------------------------------------
+// release
+//------------------------------------------------------------------------------
+void DiskThreadPoolSizer::release() {
+  cta::threading::MutexLocker locker(m_mutex);
+  m_released = true;
+  m_condVar.broadcast();
+}
+
+//------------------------------------------------------------------------------
+// getTarget
+//------------------------------------------------------------------------------
+uint32_t DiskThreadPoolSizer::getTarget() {
+  cta::threading::MutexLocker locker(m_mutex);
+  return m_target;
+}
+
+//------------------------------------------------------------------------------
+// nextTarget
+//------------------------------------------------------------------------------
+uint32_t DiskThreadPoolSizer::nextTarget(uint32_t current, double diskWaitRatio, double driveStarvationRatio) const {
+  if (driveStarvationRatio > kDriveStarvationThreshold && diskWaitRatio < kDiskBusyThreshold) {
+    return std::min(current + 1, m_maxThreads);
+  }
+  if (driveStarvationRatio <= kDriveStarvationThreshold && diskWaitRatio > kDiskIdleThreshold) {
+    return std::max(current - 1, m_minThreads);
+  }
+  return current;
+}
+
+//------------------------------------------------------------------------------
+// addTaskWaitTime
+//------------------------------------------------------------------------------
+void DiskThreadPoolSizer::addTaskWaitTime(double diskWaitTime, double driveStarvedTime, cta::log::LogContext& lc) {
+  if (!isElastic()) {
+    return;
+  }
+  cta::threading::MutexLocker locker(m_mutex);
+  m_periodDiskWaitTime += diskWaitTime;
+  const double elapsed = m_periodTimer.secs();
+  if (m_released || elapsed < m_evaluationPeriod) {
+    return;
+  }
+  const double diskWaitRatio = m_periodDiskWaitTime / (elapsed * m_target);
+  const double driveStarvationRatio = (driveStarvedTime - m_periodStartDriveStarvedTime) / elapsed;
+  const uint32_t target = nextTarget(m_target, diskWaitRatio, driveStarvationRatio);
+  if (target != m_target) {
+    cta::log::ScopedParamContainer params(lc);
+    params.add("previousThreadCount", m_target)
+      .add("threadCount", target)
+      .add("diskWaitRatio", diskWaitRatio)
+      .add("driveStarvationRatio", driveStarvationRatio);
+    lc.log(cta::log::INFO, "In DiskThreadPoolSizer::addTaskWaitTime(): adjusted the number of working disk threads");
+    const bool grown = target > m_target;
+    m_target = target;
+    if (grown) {
+      m_condVar.broadcast();
+    }
+  }
+  m_periodDiskWaitTime = 0;
+  m_periodStartDriveStarvedTime = driveStarvedTime;
+  m_periodTimer.reset();
+}
+
+}  // namespace cta::tape::daemon
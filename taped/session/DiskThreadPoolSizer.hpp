@@ -0,0 +1,118 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/log/LogContext.hpp"
+#include "common/process/threading/CondVar.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "common/utils/Timer.hpp"
+
+#include <stdint.h>
+
+namespace cta::tape::daemon {
+
+/**
+ * Decides how many threads of a disk thread pool should be working.
+ *
+ * The pool creates its maximum number of threads, but only the threads with an ID
+ * below the current target take tasks; the others are parked. Once per evaluation
+ * period, the sizer compares the time the disk threads spent waiting on the tape
+ * side of the data pipeline (waitDataTime for recalls, waitFreeMemoryTime for
+ * migrations) with the time the drive spent starving (the tape thread waiting for
+ * data or for free memory):
+ *  - if the drive starves while the working disk threads are busy, one thread is added;
+ *  - if the disk threads mostly wait for the tape while the drive does not starve, one
+ *    thread is retired.
+ * Small files therefore get more parallel opens, while large files do not hold more
+ * threads and memory blocks than the drive can consume.
+ */
+class DiskThreadPoolSizer {
+public:
+  /**
+   * Constructor
+   * @param minThreads The number of working threads at the beginning of the session,
+   * and the minimum number of working threads
+   * @param maxThreads The maximum number of working threads (number of threads in the pool)
+   * @param evaluationPeriod The minimum time between two evaluations, in seconds
+   */
+  DiskThreadPoolSizer(uint32_t minThreads, uint32_t maxThreads, double evaluationPeriod = kEvaluationPeriod);
+
+  /**
+   * Blocks the calling thread while it is parked
+   * @param threadID The sequential ID of the thread in its pool
+   */
+  void waitUntilWorking(uint32_t threadID);
+
+  /**
+   * Unparks all the threads for good, so that they can consume the end of session markers
+   */
+  void release();
+
+  /**
+   * Accounts for the disk wait time of a finished task and re-evaluates the number of
+   * working threads if the evaluation period has elapsed.
+   * @param diskWaitTime The time the task spent waiting on the tape side of the pipeline
+   * @param driveStarvedTime The cumulated time the drive spent starving since the
+   * beginning of the session
+   * @param lc Log context used to log the changes of size
+   */
+  void addTaskWaitTime(double diskWaitTime, double driveStarvedTime, cta::log::LogContext& lc);
+
+  /**
+   * @return true if the number of working threads can change during the session
+   */
+  bool isElastic() const { return m_minThreads < m_maxThreads; }
+
+  /**
+   * @return the current number of working threads
+   */
+  uint32_t getTarget();
+
+  /**
+   * The sizing policy
+   * @param current The current number of working threads
+   * @param diskWaitRatio The fraction of the time the working disk threads spent waiting for the tape
+   * @param driveStarvationRatio The fraction of the time the drive spent starving
+   * @return the new number of working threads, within [minThreads, maxThreads]
+   */
+  uint32_t nextTarget(uint32_t current, double diskWaitRatio, double driveStarvationRatio) const;
+
+  /** Default evaluation period, in seconds */
+  static constexpr double kEvaluationPeriod = 2.0;
+
+  /** The drive is considered starving above this fraction of the period */
+  static constexpr double kDriveStarvationThreshold = 0.05;
+
+  /** The disk threads are considered saturated below this waiting fraction */
+  static constexpr double kDiskBusyThreshold = 0.1;
+
+  /** The disk threads are considered oversized above this waiting fraction */
+  static constexpr double kDiskIdleThreshold = 0.5;
+
+private:
+  const uint32_t m_minThreads;
+  const uint32_t m_maxThreads;
+  const double m_evaluationPeriod;
+
+  /** Protects all the members below */
+  cta::threading::Mutex m_mutex;
+
+  /** Signalled when the target grows or the threads are released */
+  cta::threading::CondVar m_condVar;
+
+  uint32_t m_target;
+  bool m_released = false;
+
+  /** Disk wait time accumulated during the current evaluation period */
+  double m_periodDiskWaitTime = 0;
+
+  /** Value of the cumulated drive starvation time at the beginning of the current evaluation period */
+  double m_periodStartDriveStarvedTime = 0;
+
+  cta::utils::Timer m_periodTimer;
+};
+
+}  // namespace cta::tape::daemon
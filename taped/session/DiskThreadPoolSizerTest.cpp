@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "DiskThreadPoolSizer.hpp"
+
+#include "common/log/StringLogger.hpp"
+#include "common/process/threading/Thread.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+
+namespace unitTests {
+using cta::tape::daemon::DiskThreadPoolSizer;
+
+TEST(cta_tape_daemon_DiskThreadPoolSizer, fixedSize) {
+  DiskThreadPoolSizer sizer(4, 4);
+  ASSERT_FALSE(sizer.isElastic());
+  ASSERT_EQ(4, sizer.getTarget());
+}
+
+TEST(cta_tape_daemon_DiskThreadPoolSizer, policy) {
+  const DiskThreadPoolSizer sizer(2, 4);
+  ASSERT_TRUE(sizer.isElastic());
+  // Drive starving, disk threads busy: grow
+  ASSERT_EQ(3, sizer.nextTarget(2, 0.0, 0.5));
+  ASSERT_EQ(4, sizer.nextTarget(4, 0.0, 0.5));
+  // Drive starving, disk threads waiting for the tape: memory bound, no change
+  ASSERT_EQ(3, sizer.nextTarget(3, 0.3, 0.5));
+  // Drive streaming, disk threads mostly waiting: shrink
+  ASSERT_EQ(2, sizer.nextTarget(3, 0.9, 0.0));
+  ASSERT_EQ(2, sizer.nextTarget(2, 0.9, 0.0));
+  // Drive streaming, disk threads busy: no change
+  ASSERT_EQ(3, sizer.nextTarget(3, 0.0, 0.0));
+}
+
+TEST(cta_tape_daemon_DiskThreadPoolSizer, growsWhenDriveStarves) {
+  cta::log::StringLogger log("dummy", "unitTest", cta::log::DEBUG);
+  cta::log::LogContext lc(log);
+  DiskThreadPoolSizer sizer(1, 3, 0.0);
+  ASSERT_EQ(1, sizer.getTarget());
+  double driveStarvedTime = 0;
+  for (uint32_t expected = 2; expected <= 3; expected++) {
+    ::usleep(10000);
+    driveStarvedTime += 1.0;
+    sizer.addTaskWaitTime(0.0, driveStarvedTime, lc);
+    ASSERT_EQ(expected, sizer.getTarget());
+  }
+  ::usleep(10000);
+  sizer.addTaskWaitTime(0.0, driveStarvedTime + 1.0, lc);
+  ASSERT_EQ(3, sizer.getTarget());
+  // The drive does not starve anymore and the disk threads wait for it
+  ::usleep(10000);
+  sizer.addTaskWaitTime(10.0, driveStarvedTime + 1.0, lc);
+  ASSERT_EQ(2, sizer.getTarget());
+  ASSERT_NE(std::string::npos, log.getLog().find("adjusted the number of working disk threads"));
+}
+
+namespace {
+class ParkedThread : private cta::threading::Thread {
+public:
+  ParkedThread(DiskThreadPoolSizer& sizer, uint32_t threadID) : m_sizer(sizer), m_threadID(threadID) {}
+
+  void start() { cta::threading::Thread::start(); }
+
+  void wait() { cta::threading::Thread::wait(); }
+
+  std::atomic<bool> m_working = false;
+
+private:
+  void run() override {
+    m_sizer.waitUntilWorking(m_threadID);
+    m_working = true;
+  }
+
+  DiskThreadPoolSizer& m_sizer;
+  const uint32_t m_threadID;
+};
+}  // namespace
+
+TEST(cta_tape_daemon_DiskThreadPoolSizer, parksAndReleasesThreads) {
+  cta::log::StringLogger log("dummy", "unitTest", cta::log::DEBUG);
+  cta::log::LogContext lc(log);
+  DiskThreadPoolSizer sizer(1, 3, 0.0);
+  ParkedThread first(sizer, 0);
+  ParkedThread second(sizer, 1);
+  ParkedThread third(sizer, 2);
+  first.start();
+  second.start();
+  third.start();
+  first.wait();
+  ASSERT_TRUE(first.m_working);
+
+  // Growing to 2 threads unparks the second thread only
+  ::usleep(10000);
+  sizer.addTaskWaitTime(0.0, 1.0, lc);
+  second.wait();
+  ASSERT_TRUE(second.m_working);
+  ::usleep(10000);
+  ASSERT_FALSE(third.m_working);
+
+  // The end of session releases everyone
+  sizer.release();
+  third.wait();
+  ASSERT_TRUE(third.m_working);
+}
+
+}  // namespace unitTests
@@ -9,12 +9,48 @@
 #include "MemBlock.hpp"
 #include "TransferTaskTracker.hpp"
 #include "common/log/LogContext.hpp"
+#include "common/log/LogSchema.hpp"
 #include "common/semconv/Attributes.hpp"
 #include "common/telemetry/metrics/instruments/TapedInstruments.hpp"
 #include "common/utils/Timer.hpp"
 
+#include <time.h>
+
 namespace cta::tape::daemon {
 
+namespace {
+/**
+ * CPU time consumed by the calling thread, in seconds
+ */
+double threadCpuTime() {
+  struct timespec ts;
+  if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts)) {
+    return 0;
+  }
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Statistics logged for each file written to disk
+ */
+using DiskWriteStatsLog = log::LogSchema<log::Field<"readWriteTime", double>,
+                                         log::Field<"readWriteCpuTime", double>,
+                                         log::Field<"checksumingTime", double>,
+                                         log::Field<"waitDataTime", double>,
+                                         log::Field<"waitReportingTime", double>,
+                                         log::Field<"checkingErrorTime", double>,
+                                         log::Field<"openingTime", double>,
+                                         log::Field<"closingTime", double>,
+                                         log::Field<"transferTime", double>,
+                                         log::Field<"totalTime", double>,
+                                         log::Field<"dataVolume", uint64_t>,
+                                         log::Field<"globalPayloadTransferSpeedMBps", double>,
+                                         log::Field<"diskPerformanceMBps", double>,
+                                         log::Field<"openRWCloseToTransferTimeRatio", double>,
+                                         log::Field<"fileId", uint64_t>,
+                                         log::Field<"dstURL", std::string>>;
+}  // namespace
+
 //------------------------------------------------------------------------------
 // constructor
 //------------------------------------------------------------------------------
@@ -29,7 +65,8 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
                             cta::log::LogContext& lc,
                             cta::disk::DiskFileFactory& fileFactory,
                             RecallWatchDog& watchdog,
-                            int threadID) {
+                            int threadID,
+                            const SessionTracer::Lane& trace) {
   [[maybe_unused]] TransferTaskTracker transferTaskTracer(cta::semconv::attr::CtaIoDirectionValues::kWrite,
                                                           cta::semconv::attr::CtaIoMediumValues::kDisk);
   using cta::log::LogContext;
@@ -43,6 +80,7 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
     .add("fSeq", m_retrieveJob->selectedTapeFile().fSeq);
   m_stats.dstURL = m_retrieveJob->retrieveRequest.dstURL;
   m_stats.fileId = m_retrieveJob->retrieveRequest.archiveFileID;
+  const uint64_t fSeq = m_retrieveJob->selectedTapeFile().fSeq;
   // This out-of-try-catch variables allows us to record the stage of the
   // process we're in, and to count the error if it occurs.
   // We will not record errors for an empty string. This will allow us to
@@ -59,7 +97,7 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
     unsigned long checksum = Payload::zeroAdler32();
     while (true) {
       if (MemBlock* const mb = m_fifo.pop()) {
-        m_stats.waitDataTime += localTime.secs(cta::utils::Timer::resetCounter);
+        m_stats.waitDataTime += trace.span(TraceEventType::WaitData, localTime, fSeq);
         AutoReleaseBlock<RecallMemoryManager> releaser(mb, m_memManager);
         if (mb->isVerifyOnly()) {
           // For verifyOnly, there is no disk file to write. Ignore the memory block and continue.
@@ -85,7 +123,7 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
           writeFile.reset(fileFactory.createWriteFile(m_retrieveJob->retrieveRequest.dstURL));
           URLcontext.add("actualURL", writeFile->URL());
           lc.log(cta::log::INFO, "Opened disk file for writing");
-          m_stats.openingTime += localTime.secs(cta::utils::Timer::resetCounter);
+          m_stats.openingTime += trace.span(TraceEventType::DiskOpen, localTime, fSeq);
           watchdog.addParameter(
             cta::log::Param("stillOpenFileForThread" + std::to_string((long long) threadID), writeFile->URL()));
         }
@@ -94,12 +132,14 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
         currentErrorToCount = "Error_diskWrite";
         m_stats.dataVolume += mb->m_payload.size();
         if (mb->m_payload.size()) {
+          const double cpuTimeBeforeWrite = threadCpuTime();
           mb->m_payload.write(*writeFile);
+          m_stats.readWriteCpuTime += threadCpuTime() - cpuTimeBeforeWrite;
         }
-        m_stats.readWriteTime += localTime.secs(cta::utils::Timer::resetCounter);
+        m_stats.readWriteTime += trace.span(TraceEventType::DiskWrite, localTime, fSeq, mb->m_payload.size());
 
         checksum = mb->m_payload.adler32(checksum);
-        m_stats.checksumingTime += localTime.secs(cta::utils::Timer::resetCounter);
+        m_stats.checksumingTime += trace.span(TraceEventType::Checksum, localTime, fSeq, mb->m_payload.size());
         currentErrorToCount = "";
 
         blockId++;
@@ -113,7 +153,7 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
         //silent data loss
         currentErrorToCount = "Error_diskCloseAfterWrite";
         writeFile->close();
-        m_stats.closingTime += localTime.secs(cta::utils::Timer::resetCounter);
+        m_stats.closingTime += trace.span(TraceEventType::DiskClose, localTime, fSeq);
         m_stats.filesCount++;
         break;
       }
@@ -126,7 +166,7 @@ bool DiskWriteTask::execute(RecallReportPacker& reporter,
       m_retrieveJob->transferredChecksumValue = cs.str();
     }
     reporter.reportCompletedJob(std::move(m_retrieveJob), lc);
-    m_stats.waitReportingTime += localTime.secs(cta::utils::Timer::resetCounter);
+    m_stats.waitReportingTime += trace.span(TraceEventType::Report, localTime, fSeq);
     m_stats.transferTime = transferTime.secs();
     m_stats.totalTime = totalTime.secs();
     logWithStat(cta::log::INFO,
@@ -255,28 +295,28 @@ const DiskStats& DiskWriteTask::getTaskStats() const {
 // logWithStat
 //------------------------------------------------------------------------------
 void DiskWriteTask::logWithStat(int level, std::string_view msg, cta::log::LogContext& lc) const {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("readWriteTime", m_stats.readWriteTime)
-    .add("checksumingTime", m_stats.checksumingTime)
-    .add("waitDataTime", m_stats.waitDataTime)
-    .add("waitReportingTime", m_stats.waitReportingTime)
-    .add("checkingErrorTime", m_stats.checkingErrorTime)
-    .add("openingTime", m_stats.openingTime)
-    .add("closingTime", m_stats.closingTime)
-    .add("transferTime", m_stats.transferTime)
-    .add("totalTime", m_stats.totalTime)
-    .add("dataVolume", m_stats.dataVolume)
-    .add("globalPayloadTransferSpeedMBps",
-         m_stats.totalTime == 0.0 ? 0.0 : 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.totalTime)
-    .add("diskPerformanceMBps",
-         m_stats.transferTime == 0.0 ? 0.0 : 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.transferTime)
-    .add("openRWCloseToTransferTimeRatio",
-         m_stats.transferTime == 0.0 ?
-           0.0 :
-           (m_stats.openingTime + m_stats.readWriteTime + m_stats.closingTime) / m_stats.transferTime)
-    .add("fileId", m_stats.fileId)
-    .add("dstURL", m_stats.dstURL);
-  lc.log(level, msg);
+  DiskWriteStatsLog::log(
+    lc,
+    level,
+    msg,
+    m_stats.readWriteTime,
+    m_stats.readWriteCpuTime,
+    m_stats.checksumingTime,
+    m_stats.waitDataTime,
+    m_stats.waitReportingTime,
+    m_stats.checkingErrorTime,
+    m_stats.openingTime,
+    m_stats.closingTime,
+    m_stats.transferTime,
+    m_stats.totalTime,
+    m_stats.dataVolume,
+    m_stats.totalTime == 0.0 ? 0.0 : 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.totalTime,
+    m_stats.transferTime == 0.0 ? 0.0 : 1.0 * m_stats.dataVolume / 1000 / 1000 / m_stats.transferTime,
+    m_stats.transferTime == 0.0 ?
+      0.0 :
+      (m_stats.openingTime + m_stats.readWriteTime + m_stats.closingTime) / m_stats.transferTime,
+    m_stats.fileId,
+    m_stats.dstURL);
 }
 
 }  // namespace cta::tape::daemon
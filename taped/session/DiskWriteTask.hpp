@@ -10,6 +10,7 @@
 #include "DiskStats.hpp"
 #include "RecallMemoryManager.hpp"
 #include "RecallReportPacker.hpp"
+#include "SessionTracer.hpp"
 #include "TaskWatchDog.hpp"
 #include "taped/file/FileWriter.hpp"
 
@@ -41,7 +42,8 @@ public:
                        cta::log::LogContext& lc,
                        cta::disk::DiskFileFactory& fileFactory,
                        RecallWatchDog& watchdog,
-                       int threadID);
+                       int threadID,
+                       const SessionTracer::Lane& trace = SessionTracer::Lane());
 
   /**
    * Allows client code to return a reusable memory block. Should not been called
@@ -21,8 +21,12 @@ DiskWriteThreadPool::DiskWriteThreadPool(int nbThread,
                                          RecallReportPacker& report,
                                          RecallWatchDog& recallWatchDog,
                                          const cta::log::LogContext& lc,
-                                         uint16_t xrootTimeout)
+                                         uint16_t xrootTimeout,
+                                         bool localDirectIO,
+                                         int minNbThread)
     : m_xrootTimeout(xrootTimeout),
+      m_localDirectIO(localDirectIO),
+      m_sizer(minNbThread > 0 ? minNbThread : nbThread, nbThread),
       m_reporter(report),
       m_watchdog(recallWatchDog),
       m_lc(lc) {
@@ -55,6 +59,8 @@ void DiskWriteThreadPool::startThreads() {
   for (const auto& m_thread : m_threads) {
     m_thread->start();
   }
+  cta::log::ScopedParamContainer params(m_lc);
+  params.add("workingThreadCount", m_sizer.getTarget());
   m_lc.log(cta::log::INFO, "Starting threads in DiskWriteThreadPool::DiskWriteThreadPool");
 }
 
@@ -86,6 +92,8 @@ void DiskWriteThreadPool::push(DiskWriteTask* t) {
 //------------------------------------------------------------------------------
 void DiskWriteThreadPool::finish() {
   cta::threading::MutexLocker ml(m_pusherProtection);
+  // Parked threads need to run to consume their end of session marker
+  m_sizer.release();
   for (size_t i = 0; i < m_threads.size(); i++) {
     m_tasks.push(nullptr);
   }
@@ -106,6 +114,9 @@ void DiskWriteThreadPool::logWithStat(int level, const std::string& message) {
   m_pooldStat.totalTime = m_totalTime.secs();
   cta::log::ScopedParamContainer params(m_lc);
   params.add("poolReadWriteTime", m_pooldStat.readWriteTime)
+    .add("poolReadWriteCpuTime", m_pooldStat.readWriteCpuTime)
+    .add("poolReadWriteCpuSecsPerGB",
+         m_pooldStat.dataVolume ? m_pooldStat.readWriteCpuTime * 1000 * 1000 * 1000 / m_pooldStat.dataVolume : 0.0)
     .add("poolChecksumingTime", m_pooldStat.checksumingTime)
     .add("poolWaitDataTime", m_pooldStat.waitDataTime)
     .add("poolWaitReportingTime", m_pooldStat.waitReportingTime)
@@ -134,26 +145,35 @@ void DiskWriteThreadPool::DiskWriteWorkerThread::run() {
   logParams.add("thread", "DiskWrite").add("threadID", m_threadID);
   m_lc.log(cta::log::INFO, "Starting DiskWriteWorkerThread");
 
+  const SessionTracer::Lane trace(m_parentThreadPool.m_tracer, "DiskWrite-" + std::to_string(m_threadID));
   std::unique_ptr<DiskWriteTask> task;
   cta::utils::Timer localTime;
   cta::utils::Timer totalTime(localTime);
 
   while (true) {
+    m_parentThreadPool.m_sizer.waitUntilWorking(m_threadID);
     task.reset(m_parentThreadPool.m_tasks.pop());
-    m_threadStat.waitInstructionsTime += localTime.secs(cta::utils::Timer::resetCounter);
+    m_threadStat.waitInstructionsTime += trace.span(TraceEventType::WaitInstructions, localTime);
     if (nullptr != task) {
       if (false
           == task->execute(m_parentThreadPool.m_reporter,
                            m_lc,
                            m_diskFileFactory,
                            m_parentThreadPool.m_watchdog,
-                           m_threadID)) {
+                           m_threadID,
+                           trace)) {
         ++m_parentThreadPool.m_failedWriteCount;
         cta::log::ScopedParamContainer params(m_lc);
         params.add("errorCount", m_parentThreadPool.m_failedWriteCount);
         m_lc.log(cta::log::ERR, "Task failed: counting another error for this session");
       }
       m_threadStat += task->getTaskStats();
+      if (m_parentThreadPool.m_sizer.isElastic()) {
+        // The drive starves when the tape thread waits for memory we have not emptied yet
+        m_parentThreadPool.m_sizer.addTaskWaitTime(task->getTaskStats().waitDataTime,
+                                                   m_parentThreadPool.m_watchdog.getStats().waitFreeMemoryTime,
+                                                   m_lc);
+      }
     }  //end of task!=nullptr
     else {
       m_lc.log(cta::log::DEBUG, "DiskWriteWorkerThread exiting: no more work");
@@ -191,6 +211,7 @@ void DiskWriteThreadPool::DiskWriteWorkerThread::run() {
 void DiskWriteThreadPool::DiskWriteWorkerThread::logWithStat(int level, const std::string& msg) {
   cta::log::ScopedParamContainer params(m_lc);
   params.add("threadReadWriteTime", m_threadStat.readWriteTime)
+    .add("threadReadWriteCpuTime", m_threadStat.readWriteCpuTime)
     .add("threadChecksumingTime", m_threadStat.checksumingTime)
     .add("threadWaitDataTime", m_threadStat.waitDataTime)
     .add("threadWaitReportingTime", m_threadStat.waitReportingTime)
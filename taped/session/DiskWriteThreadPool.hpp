@@ -6,8 +6,10 @@
 #pragma once
 
 #include "DiskStats.hpp"
+#include "DiskThreadPoolSizer.hpp"
 #include "DiskWriteTask.hpp"
 #include "RecallReportPacker.hpp"
+#include "SessionTracer.hpp"
 #include "TaskWatchDog.hpp"
 #include "common/log/LogContext.hpp"
 #include "common/process/threading/BlockingQueue.hpp"
@@ -32,18 +34,24 @@ public:
   /**
    * We create the thread structures here, but they do not get started yet.
    *
-   * @param nbThread     Fixed number of threads in the pool
+   * @param nbThread     Number of threads in the pool (maximum number of working threads)
    * @param reportPacker Reference to a previously-created recall report packer,
    *                     to which the tasks will report their results
    * @param lc           Reference to a log context object that will be copied at construction time
    *                     (and then copied further for each thread). There will be no side-effect on
    *                     the caller's logs.
+   * @param xrootTimeout Timeout for XRoot functions
+   * @param localDirectIO Whether local disk files are written with direct I/O
+   * @param minNbThread  Number of working threads at the beginning of the session. The pool
+   *                     grows up to nbThread when the drive starves. 0 means a fixed size pool.
    */
   DiskWriteThreadPool(int nbThread,
                       RecallReportPacker& reportPacker,
                       RecallWatchDog& recallWatchDog,
                       const cta::log::LogContext& lc,
-                      uint16_t xrootTimeout);
+                      uint16_t xrootTimeout,
+                      bool localDirectIO = false,
+                      int minNbThread = 0);
 
   /**
    * Destructor: we suppose the threads are no running (waitThreads() should
@@ -75,6 +83,13 @@ public:
    */
   void finish();
 
+  /**
+   * Sets the tracer recording the operations of the disk threads.
+   * This function MUST be called before starting the threads.
+   * @param tracer The session tracer, or nullptr to disable tracing
+   */
+  void setTracer(SessionTracer* tracer) { m_tracer = tracer; }
+
 private:
   /** Running counter active threads, used to determine which thread is the last */
   std::atomic<int> m_nbActiveThread = 0;
@@ -90,7 +105,7 @@ private:
         : m_threadID(manager.m_nbActiveThread++),
           m_parentThreadPool(manager),
           m_lc(m_parentThreadPool.m_lc),
-          m_diskFileFactory(manager.m_xrootTimeout) {
+          m_diskFileFactory(manager.m_xrootTimeout, manager.m_localDirectIO) {
       // This thread id will remain for the rest of the thread's lifetime
       // (and also context's lifetime), so no need for a scoper
       m_lc.push(cta::log::Param("threadID", m_threadID));
@@ -168,7 +183,23 @@ protected:
    */
   uint16_t m_xrootTimeout;
 
+  /**
+   * Parameter: direct I/O for local disk files
+   */
+  bool m_localDirectIO;
+
+  /**
+   * Tracer of the session I/O operations (nullptr if tracing is disabled)
+   */
+  SessionTracer* m_tracer = nullptr;
+
 private:
+  /**
+   * Decides how many threads take tasks, based on the time they wait for data
+   * and on the time the tape thread waits for free memory
+   */
+  DiskThreadPoolSizer m_sizer;
+
   /**
    * Aggregate all threads' stats
    */
@@ -8,10 +8,12 @@
 #include "TaskWatchDog.hpp"
 #include "catalogue/TapeFileWritten.hpp"
 #include "common/exception/NoSuchObject.hpp"
+#include "common/log/LogSchema.hpp"
 #include "common/utils/Timer.hpp"
 #include "common/utils/utils.hpp"
 #include "taped/drive/DriveInterface.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <memory>
 #include <numeric>
@@ -21,13 +23,29 @@ using cta::log::Param;
 
 namespace cta::tape::daemon {
 
+namespace {
+/**
+ * Logged when a report is pushed, for each file and at the end of the session
+ */
+using ReportPushedLog = log::LogSchema<log::Field<"type", std::string_view>>;
+}  // namespace
+
 //------------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------------
-MigrationReportPacker::MigrationReportPacker(cta::ArchiveMount* archiveMount, const cta::log::LogContext& lc)
+MigrationReportPacker::MigrationReportPacker(cta::ArchiveMount* archiveMount,
+                                             const cta::log::LogContext& lc,
+                                             uint32_t maxInFlightFlushReports)
     : ReportPackerInterface<detail::Migration>(lc),
       m_workerThread(*this),
-      m_archiveMount(archiveMount) {}
+      m_maxInFlightFlushReports(std::max(maxInFlightFlushReports, 1U)),
+      m_archiveMount(archiveMount) {
+  if (m_maxInFlightFlushReports > 1) {
+    for (uint32_t i = 0; i < m_maxInFlightFlushReports; i++) {
+      m_flushReporterThreads.emplace_back(std::make_unique<FlushReporterThread>(*this));
+    }
+  }
+}
 
 //------------------------------------------------------------------------------
 //Destructor
@@ -48,15 +66,41 @@ MigrationReportPacker::~MigrationReportPacker() {
   } catch (...) {}
 }
 
+//------------------------------------------------------------------------------
+//startThreads
+//------------------------------------------------------------------------------
+void MigrationReportPacker::startThreads() {
+  for (auto& thread : m_flushReporterThreads) {
+    thread->start();
+  }
+  m_workerThread.start();
+}
+
+//------------------------------------------------------------------------------
+//waitThread
+//------------------------------------------------------------------------------
+void MigrationReportPacker::waitThread() {
+  m_workerThread.wait();
+  // The worker thread will not dispatch any more batch: let the reporter threads
+  // finish the in-flight ones and stop.
+  for (size_t i = 0; i < m_flushReporterThreads.size(); i++) {
+    m_flushBatches.push(nullptr);
+  }
+  for (auto& thread : m_flushReporterThreads) {
+    thread->wait();
+  }
+}
+
 //------------------------------------------------------------------------------
 //reportCompletedJob
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportCompletedJob(std::unique_ptr<cta::ArchiveJob> successfulArchiveJob,
                                                cta::log::LogContext& lc) {
   auto rep = std::make_unique<ReportSuccessful>(std::move(successfulArchiveJob));
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportSuccessful");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportCompletedJob(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportCompletedJob(), pushing a report.",
+                       "ReportSuccessful");
   cta::threading::MutexLocker ml(m_producterProtection);
   m_fifo.push(std::move(rep));
 }
@@ -69,9 +113,10 @@ void MigrationReportPacker::reportSkippedJob(std::unique_ptr<cta::ArchiveJob> sk
                                              cta::log::LogContext& lc) {
   std::string failureLog = cta::utils::getCurrentLocalTime() + " " + cta::utils::getShortHostname() + " " + failure;
   auto rep = std::make_unique<ReportSkipped>(std::move(skippedArchiveJob), failureLog);
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportSkipped");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportSkippedJob(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportSkippedJob(), pushing a report.",
+                       "ReportSkipped");
   cta::threading::MutexLocker ml(m_producterProtection);
   m_fifo.push(std::move(rep));
 }
@@ -85,9 +130,10 @@ void MigrationReportPacker::reportFailedJob(std::unique_ptr<cta::ArchiveJob> fai
   std::string failureLog =
     cta::utils::getCurrentLocalTime() + " " + cta::utils::getShortHostname() + " " + ex.getMessageValue();
   auto rep = std::make_unique<ReportError>(std::move(failedArchiveJob), failureLog);
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportError");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportFailedJob(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportFailedJob(), pushing a report.",
+                       "ReportError");
   cta::threading::MutexLocker ml(m_producterProtection);
   m_fifo.push(std::move(rep));
 }
@@ -96,9 +142,10 @@ void MigrationReportPacker::reportFailedJob(std::unique_ptr<cta::ArchiveJob> fai
 //reportFlush
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportFlush(const drive::compressionStats& compressStats, cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportFlush");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportFlush(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportFlush(), pushing a report.",
+                       "ReportFlush");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportFlush>(compressStats);
   m_fifo.push(std::move(rep));
@@ -108,9 +155,10 @@ void MigrationReportPacker::reportFlush(const drive::compressionStats& compressS
 //reportTapeFull
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportTapeFull(cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportTapeFull");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportTapeFull(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportTapeFull(), pushing a report.",
+                       "ReportTapeFull");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportTapeFull>();
   m_fifo.push(std::move(rep));
@@ -120,11 +168,12 @@ void MigrationReportPacker::reportTapeFull(cta::log::LogContext& lc) {
 //reportErrorLastBatch
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportLastBatchError(const cta::exception::Exception& ex, cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
   std::string failureLog =
     cta::utils::getCurrentLocalTime() + " " + cta::utils::getShortHostname() + " " + ex.getMessageValue();
-  params.add("type", "ReportLastBatchError");
-  lc.log(cta::log::INFO, "In MigrationReportPacker::reportLastBatchError(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::INFO,
+                       "In MigrationReportPacker::reportLastBatchError(), pushing a report.",
+                       "ReportLastBatchError");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportLastBatchError>(failureLog);
   m_fifo.push(std::move(rep));
@@ -134,9 +183,10 @@ void MigrationReportPacker::reportLastBatchError(const cta::exception::Exception
 //reportEndOfSession
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportEndOfSession(cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportEndofSession");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportEndOfSession(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportEndOfSession(), pushing a report.",
+                       "ReportEndofSession");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportEndofSession>();
   m_fifo.push(std::move(rep));
@@ -148,9 +198,10 @@ void MigrationReportPacker::reportEndOfSession(cta::log::LogContext& lc) {
 void MigrationReportPacker::reportEndOfSessionWithErrors(const std::string& msg,
                                                          bool isTapeFull,
                                                          cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportEndofSessionWithErrors");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportEndOfSessionWithErrors(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportEndOfSessionWithErrors(), pushing a report.",
+                       "ReportEndofSessionWithErrors");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportEndofSessionWithErrors>(msg, isTapeFull);
   m_fifo.push(std::move(rep));
@@ -160,9 +211,10 @@ void MigrationReportPacker::reportEndOfSessionWithErrors(const std::string& msg,
 //reportTestGoingToEnd
 //------------------------------------------------------------------------------
 void MigrationReportPacker::reportTestGoingToEnd(cta::log::LogContext& lc) {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("type", "ReportTestGoingToEnd");
-  lc.log(cta::log::DEBUG, "In MigrationReportPacker::reportTestGoingToEnd(), pushing a report.");
+  ReportPushedLog::log(lc,
+                       cta::log::DEBUG,
+                       "In MigrationReportPacker::reportTestGoingToEnd(), pushing a report.",
+                       "ReportTestGoingToEnd");
   cta::threading::MutexLocker ml(m_producterProtection);
   auto rep = std::make_unique<ReportTestGoingToEnd>();
   m_fifo.push(std::move(rep));
@@ -313,71 +365,13 @@ void MigrationReportPacker::ReportFlush::execute(MigrationReportPacker& reportPa
                             "Received a flush report from tape, but had no file to report to client. Doing nothing.");
       return;
     }
-    std::queue<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>> failedToReportArchiveJobs;
-    try {
-      cta::utils::Timer t;
-      cta::log::ScopedParamContainer params(reportPacker.m_lc);
-      params.add("successfulBatchSize", reportPacker.m_successfulArchiveJobs.size());
-      reportPacker.m_archiveMount->reportJobsBatchTransferred(reportPacker.m_successfulArchiveJobs,
-                                                              reportPacker.m_skippedFiles,
-                                                              failedToReportArchiveJobs,
-                                                              reportPacker.m_lc);
-      params.add("reportJobsBatchTime", t.secs()).add("failedToReportBatchSize", failedToReportArchiveJobs.size());
-      reportPacker.m_lc.log(
-        cta::log::INFO,
-        "In MigrationReportPacker::ReportFlush::execute(): successfully reported batch of archive jobs to disk.");
-    } catch (const cta::ArchiveMount::FailedReportCatalogueUpdate& ex) {
-      while (!failedToReportArchiveJobs.empty()) {
-        auto archiveJob = std::move(failedToReportArchiveJobs.front());
-        try {
-          archiveJob->failTransfer(ex.getMessageValue(), reportPacker.m_lc);
-        } catch (const cta::exception::NoSuchObject&) {
-          cta::log::ScopedParamContainer params(reportPacker.m_lc);
-          params.add("fileId", archiveJob->archiveFile.archiveFileID)
-            .add("latestError", archiveJob->latestError)
-            .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
-          reportPacker.m_lc.log(cta::log::WARNING,
-                                "In MigrationReportPacker::ReportFlush::execute(): failed to failTransfer for the "
-                                "archive job because it does not exist in the objectstore.");
-        } catch (const cta::exception::Exception&) {
-          //If the failTransfer method fails, we can't do anything about it
-          cta::log::ScopedParamContainer params(reportPacker.m_lc);
-          params.add("fileId", archiveJob->archiveFile.archiveFileID)
-            .add("latestError", archiveJob->latestError)
-            .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
-          reportPacker.m_lc.log(cta::log::WARNING,
-                                "In MigrationReportPacker::ReportFlush::execute(): failed to failTransfer for the "
-                                "archive job because of CTA exception.");
-        }
-        failedToReportArchiveJobs.pop();
-      }
-      throw;
-    } catch (const cta::ArchiveMount::FailedReportMoveToQueue& ex) {
-      while (!failedToReportArchiveJobs.empty()) {
-        auto archiveJob = std::move(failedToReportArchiveJobs.front());
-        try {
-          archiveJob->failReport(ex.getMessageValue(), reportPacker.m_lc);
-        } catch (const cta::exception::NoSuchObject&) {
-          cta::log::ScopedParamContainer params(reportPacker.m_lc);
-          params.add("fileId", archiveJob->archiveFile.archiveFileID)
-            .add("latestError", archiveJob->latestError)
-            .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
-          reportPacker.m_lc.log(cta::log::WARNING,
-                                "In MigrationReportPacker::ReportFlush::execute(): failed to failReport for the "
-                                "archive job because it does not exist in the objectstore.");
-        } catch (const cta::exception::Exception&) {
-          //If the failReport method fails, we can't do anything about it
-          cta::log::ScopedParamContainer params(reportPacker.m_lc);
-          params.add("fileId", archiveJob->archiveFile.archiveFileID)
-            .add("latestError", archiveJob->latestError)
-            .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
-          reportPacker.m_lc.log(cta::log::WARNING,
-                                "In MigrationReportPacker::ReportFlush::execute(): failed to failReport for the "
-                                "archive job because of CTA exception.");
-        }
-        failedToReportArchiveJobs.pop();
-      }
-      throw;
+    if (reportPacker.m_maxInFlightFlushReports > 1) {
+      reportPacker.dispatchFlushedBatch();
+    } else {
+      reportPacker.reportFlushedBatch(reportPacker.m_successfulArchiveJobs,
+                                      reportPacker.m_skippedFiles,
+                                      nullptr,
+                                      reportPacker.m_lc);
     }
   } else {
     // This is an abnormal situation: we should never flush after an error!
@@ -385,6 +379,206 @@ void MigrationReportPacker::ReportFlush::execute(MigrationReportPacker& reportPa
   }
 }
 
+//------------------------------------------------------------------------------
+//reportFlushedBatch
+//------------------------------------------------------------------------------
+void MigrationReportPacker::reportFlushedBatch(std::queue<std::unique_ptr<cta::ArchiveJob>>& successfulArchiveJobs,
+                                               std::queue<cta::catalogue::TapeItemWritten>& skippedFiles,
+                                               cta::ArchiveMount::CatalogueUpdateTurn* catalogueUpdateTurn,
+                                               cta::log::LogContext& lc) {
+  std::queue<std::unique_ptr<cta::SchedulerDatabase::ArchiveJob>> failedToReportArchiveJobs;
+  try {
+    cta::utils::Timer t;
+    cta::log::ScopedParamContainer params(lc);
+    params.add("successfulBatchSize", successfulArchiveJobs.size());
+    m_archiveMount->reportJobsBatchTransferred(successfulArchiveJobs,
+                                               skippedFiles,
+                                               failedToReportArchiveJobs,
+                                               lc,
+                                               catalogueUpdateTurn);
+    params.add("reportJobsBatchTime", t.secs()).add("failedToReportBatchSize", failedToReportArchiveJobs.size());
+    lc.log(cta::log::INFO,
+           "In MigrationReportPacker::reportFlushedBatch(): successfully reported batch of archive jobs to disk.");
+  } catch (const cta::ArchiveMount::FailedReportCatalogueUpdate& ex) {
+    while (!failedToReportArchiveJobs.empty()) {
+      auto archiveJob = std::move(failedToReportArchiveJobs.front());
+      try {
+        archiveJob->failTransfer(ex.getMessageValue(), lc);
+      } catch (const cta::exception::NoSuchObject&) {
+        cta::log::ScopedParamContainer params(lc);
+        params.add("fileId", archiveJob->archiveFile.archiveFileID)
+          .add("latestError", archiveJob->latestError)
+          .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
+        lc.log(cta::log::WARNING,
+               "In MigrationReportPacker::reportFlushedBatch(): failed to failTransfer for the "
+               "archive job because it does not exist in the objectstore.");
+      } catch (const cta::exception::Exception&) {
+        //If the failTransfer method fails, we can't do anything about it
+        cta::log::ScopedParamContainer params(lc);
+        params.add("fileId", archiveJob->archiveFile.archiveFileID)
+          .add("latestError", archiveJob->latestError)
+          .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
+        lc.log(cta::log::WARNING,
+               "In MigrationReportPacker::reportFlushedBatch(): failed to failTransfer for the "
+               "archive job because of CTA exception.");
+      }
+      failedToReportArchiveJobs.pop();
+    }
+    throw;
+  } catch (const cta::ArchiveMount::FailedReportMoveToQueue& ex) {
+    while (!failedToReportArchiveJobs.empty()) {
+      auto archiveJob = std::move(failedToReportArchiveJobs.front());
+      try {
+        archiveJob->failReport(ex.getMessageValue(), lc);
+      } catch (const cta::exception::NoSuchObject&) {
+        cta::log::ScopedParamContainer params(lc);
+        params.add("fileId", archiveJob->archiveFile.archiveFileID)
+          .add("latestError", archiveJob->latestError)
+          .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
+        lc.log(cta::log::WARNING,
+               "In MigrationReportPacker::reportFlushedBatch(): failed to failReport for the "
+               "archive job because it does not exist in the objectstore.");
+      } catch (const cta::exception::Exception&) {
+        //If the failReport method fails, we can't do anything about it
+        cta::log::ScopedParamContainer params(lc);
+        params.add("fileId", archiveJob->archiveFile.archiveFileID)
+          .add("latestError", archiveJob->latestError)
+          .add(cta::semconv::log::exceptionMessage, ex.getMessageValue());
+        lc.log(cta::log::WARNING,
+               "In MigrationReportPacker::reportFlushedBatch(): failed to failReport for the "
+               "archive job because of CTA exception.");
+      }
+      failedToReportArchiveJobs.pop();
+    }
+    throw;
+  }
+}
+
+//------------------------------------------------------------------------------
+//dispatchFlushedBatch
+//------------------------------------------------------------------------------
+void MigrationReportPacker::dispatchFlushedBatch() {
+  auto batch = std::make_unique<FlushBatch>();
+  uint32_t inFlightFlushReports;
+  {
+    cta::threading::MutexLocker ml(m_flushMutex);
+    while (m_inFlightFlushReports >= m_maxInFlightFlushReports && !m_flushReportFailed) {
+      m_flushCondVar.wait(ml);
+    }
+    if (m_flushReportFailed) {
+      throw cta::exception::Exception(
+        "In MigrationReportPacker::dispatchFlushedBatch(): a previous batch of archive jobs failed to be reported");
+    }
+    inFlightFlushReports = ++m_inFlightFlushReports;
+    batch->sequenceNumber = m_nextFlushSequenceNumber++;
+  }
+  std::swap(batch->successfulArchiveJobs, m_successfulArchiveJobs);
+  std::swap(batch->skippedFiles, m_skippedFiles);
+  cta::log::ScopedParamContainer params(m_lc);
+  params.add("successfulBatchSize", batch->successfulArchiveJobs.size())
+    .add("skippedBatchSize", batch->skippedFiles.size())
+    .add("flushSequenceNumber", batch->sequenceNumber)
+    .add("inFlightFlushReports", inFlightFlushReports);
+  m_lc.log(cta::log::DEBUG, "In MigrationReportPacker::dispatchFlushedBatch(): dispatching batch of archive jobs.");
+  m_flushBatches.push(std::move(batch));
+}
+
+//------------------------------------------------------------------------------
+//waitForInFlightFlushReports
+//------------------------------------------------------------------------------
+void MigrationReportPacker::waitForInFlightFlushReports() {
+  cta::threading::MutexLocker ml(m_flushMutex);
+  while (m_inFlightFlushReports) {
+    m_flushCondVar.wait(ml);
+  }
+  if (m_flushReportFailed) {
+    throw cta::exception::Exception(
+      "In MigrationReportPacker::waitForInFlightFlushReports(): a batch of archive jobs failed to be reported");
+  }
+}
+
+//------------------------------------------------------------------------------
+//FlushCatalogueTurn::~FlushCatalogueTurn
+//------------------------------------------------------------------------------
+MigrationReportPacker::FlushCatalogueTurn::~FlushCatalogueTurn() {
+  try {
+    if (!m_released) {
+      if (!m_waited) {
+        wait();
+      }
+      release();
+    }
+  } catch (...) {}
+}
+
+//------------------------------------------------------------------------------
+//FlushCatalogueTurn::wait
+//------------------------------------------------------------------------------
+void MigrationReportPacker::FlushCatalogueTurn::wait() {
+  cta::threading::MutexLocker ml(m_parent.m_flushMutex);
+  while (m_parent.m_catalogueTurn != m_sequenceNumber) {
+    m_parent.m_flushCondVar.wait(ml);
+  }
+  m_waited = true;
+}
+
+//------------------------------------------------------------------------------
+//FlushCatalogueTurn::release
+//------------------------------------------------------------------------------
+void MigrationReportPacker::FlushCatalogueTurn::release() {
+  cta::threading::MutexLocker ml(m_parent.m_flushMutex);
+  m_parent.m_catalogueTurn = m_sequenceNumber + 1;
+  m_released = true;
+  m_parent.m_flushCondVar.broadcast();
+}
+
+//------------------------------------------------------------------------------
+//FlushReporterThread::run
+//------------------------------------------------------------------------------
+void MigrationReportPacker::FlushReporterThread::run() {
+  // Create our own log context for the new thread.
+  cta::log::LogContext lc = m_parent.m_lc;
+  lc.push(cta::log::Param("thread", "FlushReporter"));
+  while (true) {
+    std::unique_ptr<FlushBatch> batch = m_parent.m_flushBatches.pop();
+    if (!batch) {
+      break;
+    }
+    bool failed = false;
+    cta::log::ScopedParamContainer params(lc);
+    params.add("flushSequenceNumber", batch->sequenceNumber);
+    try {
+      // The turn is handed over to the next batch at the latest when going out of scope
+      FlushCatalogueTurn turn(m_parent, batch->sequenceNumber);
+      m_parent.reportFlushedBatch(batch->successfulArchiveJobs, batch->skippedFiles, &turn, lc);
+    } catch (const cta::exception::Exception& e) {
+      cta::log::ScopedParamContainer exParams(lc);
+      exParams.add(cta::semconv::log::exceptionMessage, e.getMessageValue());
+      lc.log(cta::log::ERR,
+             "In MigrationReportPacker::FlushReporterThread::run(): Received a CTA exception while reporting a batch "
+             "of archive jobs.");
+      failed = true;
+    } catch (const std::exception& e) {
+      cta::log::ScopedParamContainer exParams(lc);
+      exParams.add(cta::semconv::log::exceptionMessage, e.what());
+      lc.log(cta::log::ERR,
+             "In MigrationReportPacker::FlushReporterThread::run(): Received a standard exception while reporting a "
+             "batch of archive jobs.");
+      failed = true;
+    }
+    if (failed && m_parent.m_watchdog) {
+      m_parent.m_watchdog->addToErrorCount("Error_reporting");
+      m_parent.m_watchdog->addParameter(cta::log::Param("status", "failure"));
+    }
+    cta::threading::MutexLocker ml(m_parent.m_flushMutex);
+    m_parent.m_inFlightFlushReports--;
+    if (failed) {
+      m_parent.m_flushReportFailed = true;
+    }
+    m_parent.m_flushCondVar.broadcast();
+  }
+}
+
 //------------------------------------------------------------------------------
 //reportTapeFull()::execute
 //------------------------------------------------------------------------------
@@ -397,6 +591,7 @@ void MigrationReportPacker::ReportTapeFull::execute(MigrationReportPacker& repor
 //------------------------------------------------------------------------------
 void MigrationReportPacker::ReportEndofSession::execute(MigrationReportPacker& reportPacker) {
   reportPacker.m_continue = false;
+  reportPacker.waitForInFlightFlushReports();
   reportPacker.m_lc.log(cta::log::DEBUG,
                         "In MigrationReportPacker::ReportEndofSession::execute(): reporting session complete.");
   reportPacker.m_archiveMount->complete();
@@ -430,6 +625,7 @@ void MigrationReportPacker::ReportEndofSession::execute(MigrationReportPacker& r
 //------------------------------------------------------------------------------
 void MigrationReportPacker::ReportEndofSessionWithErrors::execute(MigrationReportPacker& reportPacker) {
   reportPacker.m_continue = false;
+  reportPacker.waitForInFlightFlushReports();
   reportPacker.m_lc.log(
     cta::log::DEBUG,
     "In MigrationReportPacker::ReportEndofSessionWithErrors::execute(): reporting session complete.");
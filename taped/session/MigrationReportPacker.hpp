@@ -7,6 +7,7 @@
 
 #include "ReportPackerInterface.hpp"
 #include "common/process/threading/BlockingQueue.hpp"
+#include "common/process/threading/CondVar.hpp"
 #include "scheduler/ArchiveJob.hpp"
 #include "scheduler/ArchiveMount.hpp"
 #include "taped/drive/DriveInterface.hpp"
@@ -14,6 +15,7 @@
 #include <list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cta::tape::daemon {
 
@@ -22,8 +24,12 @@ public:
   /**
    * @param tg The client who is asking for a migration of his files
    * and to whom we have to report to the status of the operations.
+   * @param maxInFlightFlushReports The maximum number of flushed batches being reported
+   * concurrently. With 1 (the default) batches are reported synchronously by the worker thread.
    */
-  MigrationReportPacker(cta::ArchiveMount* archiveMount, const cta::log::LogContext& lc);
+  MigrationReportPacker(cta::ArchiveMount* archiveMount,
+                        const cta::log::LogContext& lc,
+                        uint32_t maxInFlightFlushReports = 1);
 
   ~MigrationReportPacker() override;
 
@@ -112,9 +118,9 @@ public:
    */
   virtual void reportEndOfSessionWithErrors(const std::string& msg, bool isTapeFull, cta::log::LogContext& lc);
 
-  void startThreads() { m_workerThread.start(); }
+  void startThreads();
 
-  void waitThread() { m_workerThread.wait(); }
+  void waitThread();
 
 private:
   class Report {
@@ -158,6 +164,7 @@ private:
 
     void execute(MigrationReportPacker& reportPacker) override {
       reportPacker.m_continue = false;
+      reportPacker.waitForInFlightFlushReports();
       reportPacker.m_lc.log(cta::log::DEBUG,
                             "In MigrationReportPacker::ReportTestGoingToEnd::execute(): Reporting session complete.");
       reportPacker.m_archiveMount->complete();
@@ -254,6 +261,118 @@ private:
     void run() override;
   } m_workerThread;
 
+  /**
+   * A flushed batch of jobs handed over by the worker thread to the flush reporter threads
+   */
+  struct FlushBatch {
+    /**
+     * Rank of the batch in the session, used to update the catalogue in fSeq order
+     */
+    uint64_t sequenceNumber = 0;
+    std::queue<std::unique_ptr<cta::ArchiveJob>> successfulArchiveJobs;
+    std::queue<cta::catalogue::TapeItemWritten> skippedFiles;
+  };
+
+  /**
+   * Lets the batch with a given sequence number update the catalogue only once all the
+   * previous batches of the session did so.
+   */
+  class FlushCatalogueTurn : public cta::ArchiveMount::CatalogueUpdateTurn {
+    MigrationReportPacker& m_parent;
+    uint64_t m_sequenceNumber;
+    bool m_waited = false;
+    bool m_released = false;
+
+  public:
+    FlushCatalogueTurn(MigrationReportPacker& parent, uint64_t sequenceNumber)
+        : m_parent(parent),
+          m_sequenceNumber(sequenceNumber) {}
+
+    /**
+     * Hands the turn over to the next batch if the reporting of this one failed before reaching
+     * the catalogue
+     */
+    ~FlushCatalogueTurn() override;
+
+    void wait() override;
+
+    void release() override;
+  };
+
+  class FlushReporterThread : public cta::threading::Thread {
+    MigrationReportPacker& m_parent;
+
+  public:
+    explicit FlushReporterThread(MigrationReportPacker& parent) : m_parent(parent) {}
+
+    void run() override;
+  };
+
+  /**
+   * Reports a flushed batch to the archive mount, failing the jobs which could not be reported.
+   * Executed by the worker thread in synchronous mode and by the flush reporter threads otherwise.
+   */
+  void reportFlushedBatch(std::queue<std::unique_ptr<cta::ArchiveJob>>& successfulArchiveJobs,
+                          std::queue<cta::catalogue::TapeItemWritten>& skippedFiles,
+                          cta::ArchiveMount::CatalogueUpdateTurn* catalogueUpdateTurn,
+                          cta::log::LogContext& lc);
+
+  /**
+   * Hands the current batch over to the flush reporter threads, blocking while the in-flight
+   * window is full
+   */
+  void dispatchFlushedBatch();
+
+  /**
+   * Blocks until all the dispatched batches have been reported. Throws if any of them failed.
+   */
+  void waitForInFlightFlushReports();
+
+  /**
+   * Maximum number of flushed batches being reported concurrently
+   */
+  const uint32_t m_maxInFlightFlushReports;
+
+  /**
+   * The threads reporting the flushed batches when m_maxInFlightFlushReports > 1
+   */
+  std::vector<std::unique_ptr<FlushReporterThread>> m_flushReporterThreads;
+
+  /**
+   * The flushed batches waiting for a reporter thread. A null batch stops a reporter thread.
+   */
+  cta::threading::BlockingQueue<std::unique_ptr<FlushBatch>> m_flushBatches;
+
+  /**
+   * Protects the in-flight and catalogue turn bookkeeping below
+   */
+  cta::threading::Mutex m_flushMutex;
+
+  /**
+   * Signalled when a batch completes or when the catalogue turn changes
+   */
+  cta::threading::CondVar m_flushCondVar;
+
+  /**
+   * The number of dispatched batches not yet fully reported
+   */
+  uint32_t m_inFlightFlushReports = 0;
+
+  /**
+   * The sequence number of the next batch to be dispatched
+   */
+  uint64_t m_nextFlushSequenceNumber = 0;
+
+  /**
+   * The sequence number of the batch allowed to update the catalogue
+   */
+  uint64_t m_catalogueTurn = 0;
+
+  /**
+   * Set when the reporting of a dispatched batch failed
+   */
+  bool m_flushReportFailed = false;
+
   /**
    * m_fifo is holding all the report waiting to be processed
    */
@@ -254,6 +254,100 @@ TEST_F(cta_tape_daemon_MigrationReportPackerTest, MigrationReportPackerNominal)
   ASSERT_EQ(1, job2completes);
 }
 
+TEST_F(cta_tape_daemon_MigrationReportPackerTest, MigrationReportPackerConcurrentFlushes) {
+  cta::MockArchiveMount tam(*m_catalogue);
+
+  const std::string vid1 = "VTEST001";
+  const std::string mediaType = "media_type";
+  const std::string logicalLibraryName = "logical_library_name";
+  const std::string tapePoolName = "tape_pool_name";
+  cta::common::dataStructures::VirtualOrganization vo = getDefaultVo();
+  const auto di = getDefaultDiskInstance();
+  cta::common::dataStructures::SecurityIdentity admin =
+    cta::common::dataStructures::SecurityIdentity("admin", "localhost");
+  m_catalogue->DiskInstance()->createDiskInstance(admin, di.name, di.comment);
+  m_catalogue->VO()->createVirtualOrganization(admin, vo);
+  m_catalogue->LogicalLibrary()->createLogicalLibrary(admin,
+                                                      logicalLibraryName,
+                                                      false,
+                                                      std::nullopt,
+                                                      "Create logical library");
+  m_catalogue->TapePool()->createTapePool(admin,
+                                          tapePoolName,
+                                          vo.name,
+                                          2,
+                                          "encryption_key_name",
+                                          std::vector<std::string>(),
+                                          "Create tape pool");
+  createMediaType(mediaType);
+  {
+    cta::catalogue::CreateTapeAttributes tape;
+    tape.vid = vid1;
+    tape.mediaType = mediaType;
+    tape.vendor = "vendor";
+    tape.logicalLibraryName = logicalLibraryName;
+    tape.tapePoolName = tapePoolName;
+    tape.full = false;
+    tape.comment = "Create tape";
+    tape.state = cta::common::dataStructures::Tape::DISABLED;
+    tape.stateReason = "Test";
+    m_catalogue->Tape()->createTape(admin, tape);
+  }
+  cta::common::dataStructures::StorageClass storageClass;
+  storageClass.name = "storage_class";
+  storageClass.nbCopies = 1;
+  storageClass.vo.name = vo.name;
+  storageClass.comment = "Create storage class";
+  m_catalogue->StorageClass()->createStorageClass(admin, storageClass);
+
+  cta::log::StringLogger log("dummy", "cta_tape_daemon_MigrationReportPackerConcurrentFlushes", cta::log::DEBUG);
+  cta::log::LogContext lc(log);
+  const uint32_t maxInFlightFlushReports = 3;
+  daemon::MigrationReportPacker mrp(&tam, lc, maxInFlightFlushReports);
+  mrp.startThreads();
+
+  // One flushed batch per file: the batches are reported concurrently but have to reach the
+  // catalogue in fSeq order.
+  const uint64_t nbFiles = 8;
+  std::vector<int> completes(nbFiles, 0);
+  std::vector<int> failures(nbFiles, 0);
+  for (uint64_t i = 0; i < nbFiles; i++) {
+    std::unique_ptr<cta::ArchiveJob> job(new MockArchiveJobExternalStats(tam, *m_catalogue, completes[i], failures[i]));
+    job->archiveFile.archiveFileID = i + 1;
+    job->archiveFile.diskInstance = di.name;
+    job->archiveFile.diskFileId = "diskFileId" + std::to_string(i + 1);
+    job->archiveFile.diskFileInfo.path = "filePath" + std::to_string(i + 1);
+    job->archiveFile.diskFileInfo.owner_uid = TEST_USER_1;
+    job->archiveFile.diskFileInfo.gid = TEST_GROUP_1;
+    job->archiveFile.fileSize = 1024;
+    job->archiveFile.checksumBlob.insert(
+      cta::checksum::MD5,
+      cta::checksum::ChecksumBlob::HexToByteArray("b170288bf1f61b26a648358866f4d6c6"));
+    job->archiveFile.storageClass = "storage_class";
+    job->tapeFile.vid = vid1;
+    job->tapeFile.fSeq = i + 1;
+    job->tapeFile.blockId = 256 * (i + 1);
+    job->tapeFile.fileSize = 768;
+    job->tapeFile.copyNb = 1;
+    job->tapeFile.checksumBlob.insert(cta::checksum::MD5,
+                                      cta::checksum::ChecksumBlob::HexToByteArray("b170288bf1f61b26a648358866f4d6c6"));
+    mrp.reportCompletedJob(std::move(job), lc);
+    mrp.reportFlush(drive::compressionStats(), lc);
+  }
+  mrp.reportEndOfSession(lc);
+  mrp.reportTestGoingToEnd(lc);
+  mrp.waitThread();
+
+  std::string temp = log.getLog();
+  ASSERT_EQ(std::string::npos, temp.find("Received a CTA exception"));
+  ASSERT_EQ(1, tam.completes);
+  for (uint64_t i = 0; i < nbFiles; i++) {
+    ASSERT_EQ(1, completes[i]);
+    ASSERT_EQ(0, failures[i]);
+  }
+  ASSERT_EQ(nbFiles, m_catalogue->Tape()->getTapesByVid(vid1).at(vid1).lastFSeq);
+}
+
 TEST_F(cta_tape_daemon_MigrationReportPackerTest, MigrationReportPackerFailure) {
   cta::MockArchiveMount tam(*m_catalogue);
 
@@ -12,6 +12,7 @@
 #include "taped/file/FileReader.hpp"
 #include "taped/file/FileWriter.hpp"
 
+#include <new>
 #include <zlib.h>
 
 namespace cta::tape::daemon {
@@ -19,6 +20,8 @@ namespace cta::tape::daemon {
 /**
  * Class managing a fixed size payload buffer. Some member functions also
  * allow read
+ * The buffer is aligned for direct I/O, so that the tape driver and local
+ * disk files opened with O_DIRECT can transfer it without intermediate copies.
  * @param capacity Size of the payload buffer in bytes
  */
 class Payload {
@@ -27,7 +30,8 @@ class Payload {
 
 public:
   explicit Payload(uint32_t capacity)
-      : m_data(new(std::nothrow) unsigned char[capacity]),
+      : m_data(static_cast<unsigned char*>(
+          ::operator new[](capacity, std::align_val_t(cta::disk::kDirectIOAlignment), std::nothrow))),
         m_totalCapacity(capacity),
         m_size(0) {
     if (nullptr == m_data) {
@@ -35,7 +39,7 @@ public:
     }
   }
 
-  ~Payload() { delete[] m_data; }
+  ~Payload() { ::operator delete[](m_data, std::align_val_t(cta::disk::kDirectIOAlignment)); }
 
   /** Amount of data present in the payload buffer */
   size_t size() const { return m_size; }
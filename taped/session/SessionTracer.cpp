@@ -0,0 +1,370 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "SessionTracer.hpp"
+
+#include "common/process/threading/MutexLocker.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+namespace cta::tape::daemon {
+
+namespace {
+/**
+ * Magic number at the beginning of binary trace files
+ */
+constexpr char kTraceMagic[8] = {'C', 'T', 'A', 'T', 'R', 'A', 'C', 'E'};
+
+/**
+ * Version of the binary trace format
+ */
+constexpr uint32_t kTraceVersion = 1;
+
+/**
+ * Upper bound of the string lengths accepted when reading a trace, to detect corrupted files early
+ */
+constexpr uint32_t kMaxTraceStringLength = 64 * 1024;
+
+template<typename T>
+void writeValue(std::ostream& os, T value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writeString(std::ostream& os, const std::string& str) {
+  writeValue<uint32_t>(os, str.size());
+  os.write(str.data(), str.size());
+}
+
+template<typename T>
+T readValue(std::istream& is) {
+  T value;
+  if (!is.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+    throw BadTraceFile("In readBinaryTrace(): unexpected end of trace");
+  }
+  return value;
+}
+
+std::string readString(std::istream& is) {
+  const auto length = readValue<uint32_t>(is);
+  if (length > kMaxTraceStringLength) {
+    throw BadTraceFile("In readBinaryTrace(): string too long in trace: " + std::to_string(length));
+  }
+  std::string str(length, '\0');
+  if (!is.read(str.data(), length)) {
+    throw BadTraceFile("In readBinaryTrace(): unexpected end of trace");
+  }
+  return str;
+}
+
+/**
+ * Writes a string as a JSON string literal
+ */
+void writeJsonString(std::ostream& os, const std::string& str) {
+  os << '"';
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+/**
+ * @return the Chrome trace category of an event type
+ */
+const char* category(TraceEventType type) {
+  switch (type) {
+    case TraceEventType::DiskOpen:
+    case TraceEventType::DiskRead:
+    case TraceEventType::DiskWrite:
+    case TraceEventType::DiskClose:
+      return "disk";
+    case TraceEventType::WaitInstructions:
+    case TraceEventType::WaitData:
+    case TraceEventType::WaitFreeMemory:
+      return "wait";
+    default:
+      return "tape";
+  }
+}
+}  // namespace
+
+//------------------------------------------------------------------------------
+// toString
+//------------------------------------------------------------------------------
+const char* toString(TraceEventType type) {
+  switch (type) {
+    case TraceEventType::Mount:
+      return "Mount";
+    case TraceEventType::Position:
+      return "Position";
+    case TraceEventType::WaitInstructions:
+      return "WaitInstructions";
+    case TraceEventType::WaitData:
+      return "WaitData";
+    case TraceEventType::WaitFreeMemory:
+      return "WaitFreeMemory";
+    case TraceEventType::Checksum:
+      return "Checksum";
+    case TraceEventType::TapeFileOpen:
+      return "TapeFileOpen";
+    case TraceEventType::TapeRead:
+      return "TapeRead";
+    case TraceEventType::TapeWrite:
+      return "TapeWrite";
+    case TraceEventType::TapeFileClose:
+      return "TapeFileClose";
+    case TraceEventType::Flush:
+      return "Flush";
+    case TraceEventType::Report:
+      return "Report";
+    case TraceEventType::DiskOpen:
+      return "DiskOpen";
+    case TraceEventType::DiskRead:
+      return "DiskRead";
+    case TraceEventType::DiskWrite:
+      return "DiskWrite";
+    case TraceEventType::DiskClose:
+      return "DiskClose";
+    default:
+      return "Unknown";
+  }
+}
+
+//------------------------------------------------------------------------------
+// writeBinaryTrace
+//------------------------------------------------------------------------------
+void writeBinaryTrace(const SessionTrace& trace, std::ostream& os) {
+  // All the integers are written in host byte order (little-endian on the supported platforms)
+  os.write(kTraceMagic, sizeof(kTraceMagic));
+  writeValue<uint32_t>(os, kTraceVersion);
+  writeValue<uint32_t>(os, trace.lanes.size());
+  writeValue<uint64_t>(os, trace.events.size());
+  writeValue<uint64_t>(os, trace.droppedEvents);
+  writeString(os, trace.label);
+  for (const auto& lane : trace.lanes) {
+    writeString(os, lane);
+  }
+  for (const auto& event : trace.events) {
+    writeValue<uint64_t>(os, event.startNs);
+    writeValue<uint64_t>(os, event.durationNs);
+    writeValue<uint64_t>(os, event.fSeq);
+    writeValue<uint64_t>(os, event.bytes);
+    writeValue<uint16_t>(os, static_cast<uint16_t>(event.type));
+    writeValue<uint16_t>(os, event.lane);
+    writeValue<uint32_t>(os, event.reserved);
+  }
+}
+
+//------------------------------------------------------------------------------
+// readBinaryTrace
+//------------------------------------------------------------------------------
+SessionTrace readBinaryTrace(std::istream& is) {
+  char magic[sizeof(kTraceMagic)];
+  if (!is.read(magic, sizeof(magic)) || std::memcmp(magic, kTraceMagic, sizeof(magic)) != 0) {
+    throw BadTraceFile("In readBinaryTrace(): not a CTA session trace");
+  }
+  if (const auto version = readValue<uint32_t>(is); version != kTraceVersion) {
+    throw BadTraceFile("In readBinaryTrace(): unsupported trace version: " + std::to_string(version));
+  }
+  SessionTrace trace;
+  const auto laneCount = readValue<uint32_t>(is);
+  const auto eventCount = readValue<uint64_t>(is);
+  trace.droppedEvents = readValue<uint64_t>(is);
+  trace.label = readString(is);
+  if (laneCount > std::numeric_limits<uint16_t>::max() + 1U) {
+    throw BadTraceFile("In readBinaryTrace(): too many lanes in trace: " + std::to_string(laneCount));
+  }
+  for (uint32_t i = 0; i < laneCount; i++) {
+    trace.lanes.emplace_back(readString(is));
+  }
+  for (uint64_t i = 0; i < eventCount; i++) {
+    TraceEvent event;
+    event.startNs = readValue<uint64_t>(is);
+    event.durationNs = readValue<uint64_t>(is);
+    event.fSeq = readValue<uint64_t>(is);
+    event.bytes = readValue<uint64_t>(is);
+    const auto type = readValue<uint16_t>(is);
+    event.lane = readValue<uint16_t>(is);
+    event.reserved = readValue<uint32_t>(is);
+    if (type >= kTraceEventTypeCount || event.lane >= laneCount) {
+      throw BadTraceFile("In readBinaryTrace(): invalid event number " + std::to_string(i));
+    }
+    event.type = static_cast<TraceEventType>(type);
+    trace.events.push_back(event);
+  }
+  return trace;
+}
+
+//------------------------------------------------------------------------------
+// writeChromeTrace
+//------------------------------------------------------------------------------
+void writeChromeTrace(const SessionTrace& trace, std::ostream& os) {
+  os << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"label\":";
+  writeJsonString(os, trace.label);
+  os << ",\"droppedEvents\":" << trace.droppedEvents << "},\"traceEvents\":[";
+  bool first = true;
+  // One metadata event per lane, so that the viewers show the thread names
+  for (size_t lane = 0; lane < trace.lanes.size(); lane++) {
+    os << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << lane
+       << ",\"args\":{\"name\":";
+    writeJsonString(os, trace.lanes[lane]);
+    os << "}}";
+    first = false;
+  }
+  // Timestamps are in microseconds in the Chrome trace format
+  os << std::fixed << std::setprecision(3);
+  for (const auto& event : trace.events) {
+    os << (first ? "" : ",") << "\n{\"name\":\"" << toString(event.type) << "\",\"cat\":\"" << category(event.type)
+       << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.lane << ",\"ts\":" << event.startNs / 1000.0
+       << ",\"dur\":" << event.durationNs / 1000.0 << ",\"args\":{\"fSeq\":" << event.fSeq
+       << ",\"bytes\":" << event.bytes << "}}";
+    first = false;
+  }
+  os << "\n]}\n";
+}
+
+//------------------------------------------------------------------------------
+// SessionTracer::Lane constructor
+//------------------------------------------------------------------------------
+SessionTracer::Lane::Lane(SessionTracer* tracer, const std::string& name) : m_tracer(tracer) {
+  if (m_tracer) {
+    m_id = m_tracer->addLane(name);
+  }
+}
+
+//------------------------------------------------------------------------------
+// SessionTracer::Lane::span
+//------------------------------------------------------------------------------
+double SessionTracer::Lane::span(TraceEventType type, cta::utils::Timer& timer, uint64_t fSeq, uint64_t bytes) const {
+  const double secs = timer.secs(cta::utils::Timer::resetCounter);
+  if (m_tracer) {
+    m_tracer->record(m_id, type, secs, fSeq, bytes);
+  }
+  return secs;
+}
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+SessionTracer::SessionTracer(const std::string& label, size_t capacity)
+    : m_label(label),
+      m_origin(std::chrono::steady_clock::now()),
+      m_slots(std::max<size_t>(capacity, 1)) {}
+
+//------------------------------------------------------------------------------
+// Slot::lock
+//------------------------------------------------------------------------------
+void SessionTracer::Slot::lock() const {
+  while (busy.test_and_set(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Slot::unlock
+//------------------------------------------------------------------------------
+void SessionTracer::Slot::unlock() const {
+  busy.clear(std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// nowNs
+//------------------------------------------------------------------------------
+uint64_t SessionTracer::nowNs() const {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin).count();
+}
+
+//------------------------------------------------------------------------------
+// addLane
+//------------------------------------------------------------------------------
+uint16_t SessionTracer::addLane(const std::string& name) {
+  cta::threading::MutexLocker ml(m_lanesMutex);
+  if (m_lanes.size() > std::numeric_limits<uint16_t>::max()) {
+    throw cta::exception::Exception("In SessionTracer::addLane(): too many lanes");
+  }
+  m_lanes.push_back(name);
+  return m_lanes.size() - 1;
+}
+
+//------------------------------------------------------------------------------
+// record
+//------------------------------------------------------------------------------
+void SessionTracer::record(uint16_t lane, TraceEventType type, double durationSecs, uint64_t fSeq, uint64_t bytes) {
+  const uint64_t endNs = nowNs();
+  const auto durationNs = std::min(static_cast<uint64_t>(durationSecs * 1e9), endNs);
+  // Claim a slot: the ring buffer overwrites the oldest events once full
+  const uint64_t index = m_recorded.fetch_add(1, std::memory_order_relaxed);
+  Slot& slot = m_slots[index % m_slots.size()];
+  std::lock_guard lock(slot);
+  TraceEvent& event = slot.event;
+  event.startNs = endNs - durationNs;
+  event.durationNs = durationNs;
+  event.fSeq = fSeq;
+  event.bytes = bytes;
+  event.type = type;
+  event.lane = lane;
+}
+
+//------------------------------------------------------------------------------
+// snapshot
+//------------------------------------------------------------------------------
+SessionTrace SessionTracer::snapshot() const {
+  SessionTrace trace;
+  trace.label = m_label;
+  {
+    cta::threading::MutexLocker ml(m_lanesMutex);
+    trace.lanes = m_lanes;
+  }
+  const uint64_t recorded = m_recorded.load();
+  const uint64_t kept = std::min<uint64_t>(recorded, m_slots.size());
+  trace.droppedEvents = recorded - kept;
+  trace.events.reserve(kept);
+  for (uint64_t i = 0; i < kept; i++) {
+    std::lock_guard lock(m_slots[i]);
+    trace.events.push_back(m_slots[i].event);
+  }
+  // Events are recorded when they end: order them by start time for the readers
+  std::stable_sort(trace.events.begin(), trace.events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+    return a.startNs < b.startNs;
+  });
+  return trace;
+}
+
+//------------------------------------------------------------------------------
+// dumpToFile
+//------------------------------------------------------------------------------
+void SessionTracer::dumpToFile(const std::string& path) const {
+  std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw cta::exception::Exception("In SessionTracer::dumpToFile(): failed to create " + path);
+  }
+  writeBinaryTrace(snapshot(), file);
+  file.close();
+  if (!file) {
+    throw cta::exception::Exception("In SessionTracer::dumpToFile(): failed to write " + path);
+  }
+}
+
+}  // namespace cta::tape::daemon
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/exception/Exception.hpp"
+#include "common/process/threading/Mutex.hpp"
+#include "common/utils/Timer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace cta::tape::daemon {
+
+/**
+ * The kinds of operations recorded in a session trace
+ */
+enum class TraceEventType : uint16_t {
+  Mount,             ///< Tape mount and drive ready
+  Position,          ///< Positioning of the tape (session start or before reading a file)
+  WaitInstructions,  ///< Thread waiting for the next task
+  WaitData,          ///< Consumer waiting for a memory block with data
+  WaitFreeMemory,    ///< Producer waiting for a free memory block
+  Checksum,          ///< Checksum computation of a memory block
+  TapeFileOpen,      ///< Opening of a tape file (header labels)
+  TapeRead,          ///< Reading of data from the drive
+  TapeWrite,         ///< Writing of data to the drive
+  TapeFileClose,     ///< Closing of a tape file (trailer labels and tape mark)
+  Flush,             ///< Synchronous flush of the drive buffer
+  Report,            ///< Reporting of a finished file
+  DiskOpen,          ///< Opening of a disk file
+  DiskRead,          ///< Reading of data from a disk file
+  DiskWrite,         ///< Writing of data to a disk file
+  DiskClose          ///< Closing of a disk file
+};
+
+/**
+ * Number of values of TraceEventType
+ */
+constexpr uint16_t kTraceEventTypeCount = static_cast<uint16_t>(TraceEventType::DiskClose) + 1;
+
+/**
+ * @return the name of a trace event type
+ */
+const char* toString(TraceEventType type);
+
+/**
+ * One timed operation of a session thread. Times are in nanoseconds since the start of the session.
+ */
+struct TraceEvent {
+  uint64_t startNs = 0;
+  uint64_t durationNs = 0;
+  uint64_t fSeq = 0;
+  uint64_t bytes = 0;
+  TraceEventType type = TraceEventType::Mount;
+  uint16_t lane = 0;
+  uint32_t reserved = 0;
+};
+
+/**
+ * The content of a session trace, as snapshotted at the end of the session or read back from a trace file
+ */
+struct SessionTrace {
+  /** Free-form description of the session (drive, tape, mount id) */
+  std::string label;
+
+  /** Names of the lanes (one per traced thread), indexed by TraceEvent::lane */
+  std::vector<std::string> lanes;
+
+  /** Recorded events, sorted by start time */
+  std::vector<TraceEvent> events;
+
+  /** Number of events overwritten because the ring buffer was full */
+  uint64_t droppedEvents = 0;
+};
+
+CTA_GENERATE_EXCEPTION_CLASS(BadTraceFile);
+
+/**
+ * Writes a session trace in the compact binary trace format
+ */
+void writeBinaryTrace(const SessionTrace& trace, std::ostream& os);
+
+/**
+ * Reads a session trace written by writeBinaryTrace()
+ * @throw BadTraceFile if the stream does not contain a valid trace
+ */
+SessionTrace readBinaryTrace(std::istream& is);
+
+/**
+ * Writes a session trace in the Chrome trace event format, which can be loaded in chrome://tracing or Perfetto
+ */
+void writeChromeTrace(const SessionTrace& trace, std::ostream& os);
+
+/**
+ * Low overhead tracer of the I/O operations of a data transfer session.
+ *
+ * Each session thread registers a lane and records its operations (waits, tape and disk I/O, checksums,
+ * flushes, positioning) into a fixed size ring buffer shared by all the threads. Recording an event is an
+ * atomic increment and a copy into a slot under the slot's own spin lock, so that tracing can stay enabled in
+ * production. When the buffer is full the oldest events are overwritten. The trace is snapshotted and dumped
+ * after all the threads of the session are joined.
+ */
+class SessionTracer {
+public:
+  /**
+   * The handle used by a thread to record its events. A default constructed lane records nothing, which
+   * allows the session code to trace unconditionally.
+   */
+  class Lane {
+  public:
+    Lane() = default;
+
+    /**
+     * Registers a new lane in the tracer
+     * @param tracer The tracer to record into, or nullptr if tracing is disabled
+     * @param name The name of the lane (typically the name of the thread)
+     */
+    Lane(SessionTracer* tracer, const std::string& name);
+
+    /**
+     * Records an operation that ended now and started when the timer was last reset, and resets the timer.
+     * This mirrors the timer.secs(cta::utils::Timer::resetCounter) idiom used to accumulate session stats.
+     * @return the duration of the operation in seconds
+     */
+    double span(TraceEventType type, cta::utils::Timer& timer, uint64_t fSeq = 0, uint64_t bytes = 0) const;
+
+    /**
+     * @return true if the lane records events
+     */
+    explicit operator bool() const { return m_tracer != nullptr; }
+
+  private:
+    SessionTracer* m_tracer = nullptr;
+    uint16_t m_id = 0;
+  };
+
+  /**
+   * Constructor
+   * @param label Free-form description of the session
+   * @param capacity Maximum number of events kept in the ring buffer
+   */
+  SessionTracer(const std::string& label, size_t capacity);
+
+  /**
+   * Records an event which ended now
+   */
+  void record(uint16_t lane, TraceEventType type, double durationSecs, uint64_t fSeq, uint64_t bytes);
+
+  /**
+   * @return a copy of the recorded events, oldest first. Meant to be called once the traced threads are done:
+   * the events recorded while the snapshot is taken may or may not be part of it.
+   */
+  SessionTrace snapshot() const;
+
+  /**
+   * Writes the binary trace to a file
+   * @param path The path of the file to create
+   */
+  void dumpToFile(const std::string& path) const;
+
+private:
+  /**
+   * @return the number of nanoseconds since the creation of the tracer
+   */
+  uint64_t nowNs() const;
+
+  /**
+   * Registers a lane and returns its index
+   */
+  uint16_t addLane(const std::string& name);
+
+  /**
+   * A slot of the ring buffer. Its lock is held while the event is written or copied, so that an event being
+   * overwritten on wraparound is never read half written. The lock is only contended when the ring buffer
+   * wraps around while the slot is being written or copied.
+   */
+  struct Slot {
+    mutable std::atomic_flag busy;
+    TraceEvent event;
+
+    void lock() const;
+    void unlock() const;
+  };
+
+  const std::string m_label;
+  const std::chrono::steady_clock::time_point m_origin;
+  std::vector<Slot> m_slots;
+
+  /** Total number of events recorded, including the overwritten ones */
+  std::atomic<uint64_t> m_recorded {0};
+
+  /** Protects m_lanes */
+  mutable cta::threading::Mutex m_lanesMutex;
+  std::vector<std::string> m_lanes;
+};
+
+}  // namespace cta::tape::daemon
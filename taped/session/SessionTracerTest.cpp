@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "SessionTracer.hpp"
+
+#include "common/process/threading/Thread.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <unistd.h>
+#include <vector>
+
+namespace unitTests {
+using cta::tape::daemon::SessionTrace;
+using cta::tape::daemon::SessionTracer;
+using cta::tape::daemon::TraceEventType;
+
+TEST(cta_tape_daemon_SessionTracer, disabledLaneOnlyMeasures) {
+  const SessionTracer::Lane lane;
+  ASSERT_FALSE(lane);
+  cta::utils::Timer timer;
+  ASSERT_LE(0.0, lane.span(TraceEventType::TapeWrite, timer, 1, 1000));
+}
+
+TEST(cta_tape_daemon_SessionTracer, recordsEventsPerLane) {
+  SessionTracer tracer("test session", 100);
+  const SessionTracer::Lane tapeLane(&tracer, "TapeWrite");
+  const SessionTracer::Lane diskLane(&tracer, "DiskRead-0");
+  ASSERT_TRUE(tapeLane);
+  cta::utils::Timer timer;
+  // Events are timestamped with a microsecond resolution: keep them apart
+  ::usleep(1000);
+  diskLane.span(TraceEventType::DiskRead, timer, 1, 4096);
+  ::usleep(1000);
+  tapeLane.span(TraceEventType::WaitData, timer, 1);
+  ::usleep(1000);
+  tapeLane.span(TraceEventType::TapeWrite, timer, 1, 4096);
+
+  const SessionTrace trace = tracer.snapshot();
+  ASSERT_EQ("test session", trace.label);
+  ASSERT_EQ(std::vector<std::string>({"TapeWrite", "DiskRead-0"}), trace.lanes);
+  ASSERT_EQ(0, trace.droppedEvents);
+  ASSERT_EQ(3, trace.events.size());
+  ASSERT_EQ(TraceEventType::DiskRead, trace.events[0].type);
+  ASSERT_EQ(1, trace.events[0].lane);
+  ASSERT_EQ(4096, trace.events[0].bytes);
+  ASSERT_EQ(TraceEventType::WaitData, trace.events[1].type);
+  ASSERT_EQ(TraceEventType::TapeWrite, trace.events[2].type);
+  ASSERT_EQ(0, trace.events[2].lane);
+  for (size_t i = 1; i < trace.events.size(); i++) {
+    ASSERT_LE(trace.events[i - 1].startNs, trace.events[i].startNs);
+  }
+}
+
+TEST(cta_tape_daemon_SessionTracer, ringBufferKeepsNewestEvents) {
+  SessionTracer tracer("test session", 4);
+  const SessionTracer::Lane lane(&tracer, "TapeRead");
+  cta::utils::Timer timer;
+  for (uint64_t fSeq = 1; fSeq <= 10; fSeq++) {
+    lane.span(TraceEventType::TapeRead, timer, fSeq, fSeq * 10);
+  }
+  const SessionTrace trace = tracer.snapshot();
+  ASSERT_EQ(6, trace.droppedEvents);
+  ASSERT_EQ(4, trace.events.size());
+  for (uint64_t i = 0; i < 4; i++) {
+    ASSERT_EQ(7 + i, trace.events[i].fSeq);
+  }
+}
+
+namespace {
+class TracingThread : private cta::threading::Thread {
+public:
+  TracingThread(SessionTracer& tracer, const std::string& name, uint64_t eventCount)
+      : m_lane(&tracer, name),
+        m_eventCount(eventCount) {}
+
+  void start() { cta::threading::Thread::start(); }
+
+  void wait() { cta::threading::Thread::wait(); }
+
+private:
+  void run() override {
+    cta::utils::Timer timer;
+    for (uint64_t i = 0; i < m_eventCount; i++) {
+      m_lane.span(TraceEventType::DiskWrite, timer, i, 1);
+    }
+  }
+
+  const SessionTracer::Lane m_lane;
+  const uint64_t m_eventCount;
+};
+}  // namespace
+
+TEST(cta_tape_daemon_SessionTracer, concurrentLanes) {
+  const uint64_t threadCount = 4;
+  const uint64_t eventsPerThread = 1000;
+  SessionTracer tracer("test session", threadCount * eventsPerThread);
+  std::vector<std::unique_ptr<TracingThread>> threads;
+  for (uint64_t i = 0; i < threadCount; i++) {
+    threads.emplace_back(std::make_unique<TracingThread>(tracer, "DiskWrite-" + std::to_string(i), eventsPerThread));
+  }
+  for (auto& thread : threads) {
+    thread->start();
+  }
+  for (auto& thread : threads) {
+    thread->wait();
+  }
+  const SessionTrace trace = tracer.snapshot();
+  ASSERT_EQ(threadCount, trace.lanes.size());
+  ASSERT_EQ(threadCount * eventsPerThread, trace.events.size());
+  std::vector<uint64_t> eventsPerLane(threadCount, 0);
+  for (const auto& event : trace.events) {
+    ASSERT_LT(event.lane, threadCount);
+    eventsPerLane[event.lane]++;
+  }
+  for (const auto count : eventsPerLane) {
+    ASSERT_EQ(eventsPerThread, count);
+  }
+}
+
+TEST(cta_tape_daemon_SessionTracer, snapshotWhileRingBufferWrapsAround) {
+  const uint64_t threadCount = 4;
+  const uint64_t eventsPerThread = 20000;
+  // Far fewer slots than events, so that the slots are overwritten while they are copied
+  SessionTracer tracer("test session", 16);
+  std::vector<std::unique_ptr<TracingThread>> threads;
+  for (uint64_t i = 0; i < threadCount; i++) {
+    threads.emplace_back(std::make_unique<TracingThread>(tracer, "DiskWrite-" + std::to_string(i), eventsPerThread));
+  }
+  for (auto& thread : threads) {
+    thread->start();
+  }
+  for (int i = 0; i < 100; i++) {
+    const SessionTrace trace = tracer.snapshot();
+    ASSERT_GE(16, trace.events.size());
+    for (const auto& event : trace.events) {
+      // A slot claimed but not written yet still holds a default event
+      if (event.bytes == 0) {
+        continue;
+      }
+      ASSERT_EQ(TraceEventType::DiskWrite, event.type);
+      ASSERT_EQ(1, event.bytes);
+      ASSERT_LT(event.lane, threadCount);
+      ASSERT_LT(event.fSeq, eventsPerThread);
+    }
+  }
+  for (auto& thread : threads) {
+    thread->wait();
+  }
+  const SessionTrace trace = tracer.snapshot();
+  ASSERT_EQ(16, trace.events.size());
+  ASSERT_EQ(threadCount * eventsPerThread - 16, trace.droppedEvents);
+}
+
+TEST(cta_tape_daemon_SessionTracer, binaryRoundTrip) {
+  SessionTracer tracer("drive=D1 tapeVid=V00001", 10);
+  const SessionTracer::Lane lane(&tracer, "TapeWrite");
+  cta::utils::Timer timer;
+  lane.span(TraceEventType::Position, timer, 5);
+  lane.span(TraceEventType::Flush, timer, 0, 1000000);
+  const SessionTrace trace = tracer.snapshot();
+
+  std::stringstream buffer;
+  cta::tape::daemon::writeBinaryTrace(trace, buffer);
+  const SessionTrace readBack = cta::tape::daemon::readBinaryTrace(buffer);
+  ASSERT_EQ(trace.label, readBack.label);
+  ASSERT_EQ(trace.lanes, readBack.lanes);
+  ASSERT_EQ(trace.droppedEvents, readBack.droppedEvents);
+  ASSERT_EQ(trace.events.size(), readBack.events.size());
+  for (size_t i = 0; i < trace.events.size(); i++) {
+    ASSERT_EQ(trace.events[i].startNs, readBack.events[i].startNs);
+    ASSERT_EQ(trace.events[i].durationNs, readBack.events[i].durationNs);
+    ASSERT_EQ(trace.events[i].fSeq, readBack.events[i].fSeq);
+    ASSERT_EQ(trace.events[i].bytes, readBack.events[i].bytes);
+    ASSERT_EQ(trace.events[i].type, readBack.events[i].type);
+    ASSERT_EQ(trace.events[i].lane, readBack.events[i].lane);
+  }
+}
+
+TEST(cta_tape_daemon_SessionTracer, rejectsBadTraces) {
+  std::stringstream notATrace("This is not a trace");
+  ASSERT_THROW(cta::tape::daemon::readBinaryTrace(notATrace), cta::tape::daemon::BadTraceFile);
+
+  SessionTracer tracer("test session", 10);
+  const SessionTracer::Lane lane(&tracer, "TapeWrite");
+  cta::utils::Timer timer;
+  lane.span(TraceEventType::TapeWrite, timer, 1, 100);
+  std::stringstream buffer;
+  cta::tape::daemon::writeBinaryTrace(tracer.snapshot(), buffer);
+  std::string truncated = buffer.str();
+  truncated.resize(truncated.size() - 1);
+  std::stringstream truncatedTrace(truncated);
+  ASSERT_THROW(cta::tape::daemon::readBinaryTrace(truncatedTrace), cta::tape::daemon::BadTraceFile);
+}
+
+TEST(cta_tape_daemon_SessionTracer, chromeTraceFormat) {
+  SessionTracer tracer("drive \"D1\"", 10);
+  const SessionTracer::Lane lane(&tracer, "TapeRead");
+  cta::utils::Timer timer;
+  lane.span(TraceEventType::TapeRead, timer, 3, 262144);
+
+  std::ostringstream json;
+  cta::tape::daemon::writeChromeTrace(tracer.snapshot(), json);
+  const std::string output = json.str();
+  ASSERT_NE(std::string::npos, output.find("\"label\":\"drive \\\"D1\\\"\""));
+  ASSERT_NE(std::string::npos, output.find("\"args\":{\"name\":\"TapeRead\"}"));
+  ASSERT_NE(std::string::npos, output.find("\"name\":\"TapeRead\",\"cat\":\"tape\",\"ph\":\"X\""));
+  ASSERT_NE(std::string::npos, output.find("\"args\":{\"fSeq\":3,\"bytes\":262144}"));
+}
+
+}  // namespace unitTests
@@ -252,6 +252,7 @@ std::unique_ptr<cta::tape::tapeFile::ReadSession> cta::tape::daemon::TapeReadSin
 void cta::tape::daemon::TapeReadSingleThread::run() {
   cta::log::ScopedParamContainer threadGlobalParams(m_logContext);
   threadGlobalParams.add("thread", "TapeRead");
+  m_trace = SessionTracer::Lane(m_tracer, "TapeRead");
   cta::utils::Timer timer, totalTimer;
   // This out-of-try-catch variables allows us to record the stage of the
   // process we're in, and to count the error if it occurs.
@@ -312,7 +313,7 @@ void cta::tape::daemon::TapeReadSingleThread::run() {
       double tapeLoadTime = tapeLoadTimer.secs();
       currentErrorToCount = "Error_checkingTapeAlert";
       logTapeAlerts();
-      m_stats.mountTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_stats.mountTime += m_trace.span(TraceEventType::Mount, timer);
       {
         cta::log::ScopedParamContainer scoped(m_logContext);
         scoped.add("mountTime", m_stats.mountTime);
@@ -353,7 +354,7 @@ void cta::tape::daemon::TapeReadSingleThread::run() {
       // Then we have to initialise the tape read session
       currentErrorToCount = "Error_tapesCheckLabelBeforeReading";
       auto readSession = openReadSession();
-      m_stats.positionTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_stats.positionTime += m_trace.span(TraceEventType::Position, timer);
       // and then report
       {
         cta::log::ScopedParamContainer scoped(m_logContext);
@@ -402,14 +403,14 @@ void cta::tape::daemon::TapeReadSingleThread::run() {
       while (true) {
         // get a task
         task.reset(popAndRequestMoreJobs());
-        m_stats.waitInstructionsTime += timer.secs(cta::utils::Timer::resetCounter);
+        m_stats.waitInstructionsTime += m_trace.span(TraceEventType::WaitInstructions, timer);
         // If we reached the end
         if (nullptr == task) {
           m_logContext.log(cta::log::DEBUG, "No more files to read from tape");
           break;
         }
         // This can lead the session being marked as corrupt, so we test it in the while loop
-        task->execute(*readSession, m_logContext, m_watchdog, m_stats, timer);
+        task->execute(*readSession, m_logContext, m_watchdog, m_stats, timer, m_trace);
         // Transmit the statistics to the watchdog thread
         m_watchdog.updateStatsWithoutDeliveryTime(m_stats);
         // The session could have been corrupted (failed positioning)
@@ -503,6 +504,7 @@ void cta::tape::daemon::TapeReadSingleThread::logWithStat(int level,
     .add("positionTime", m_stats.positionTime)
     .add("waitInstructionsTime", m_stats.waitInstructionsTime)
     .add("readWriteTime", m_stats.readWriteTime)
+    .add("checksumingTime", m_stats.checksumingTime)
     .add("waitFreeMemoryTime", m_stats.waitFreeMemoryTime)
     .add("waitReportingTime", m_stats.waitReportingTime)
     .add("unloadTime", m_stats.unloadTime)
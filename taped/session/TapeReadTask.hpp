@@ -9,6 +9,7 @@
 #include "DataConsumer.hpp"
 #include "DataPipeline.hpp"
 #include "RecallMemoryManager.hpp"
+#include "SessionTracer.hpp"
 #include "TapeSessionStats.hpp"
 #include "TaskWatchDog.hpp"
 #include "TransferTaskTracker.hpp"
@@ -39,6 +40,7 @@ public:
   /**
      * @param rs the read session holding all we need to be able to read from the tape
      * @param lc the log context for .. logging purpose
+     * @param trace the trace lane of the tape thread
      * The actual function that will do the job.
      * The main loop is :
      * Acquire a free memory block from the memory manager , fill it, push it
@@ -47,7 +49,8 @@ public:
                cta::log::LogContext& lc,
                RecallWatchDog& watchdog,
                TapeSessionStats& stats,
-               cta::utils::Timer& timer) {
+               cta::utils::Timer& timer,
+               const SessionTracer::Lane& trace = SessionTracer::Lane()) {
     [[maybe_unused]] TransferTaskTracker transferTaskTracer(cta::semconv::attr::CtaIoDirectionValues::kRead,
                                                             cta::semconv::attr::CtaIoMediumValues::kTape);
 
@@ -55,6 +58,7 @@ public:
 
     const bool isRepack = m_retrieveJob->m_dbJob->isRepack;
     const bool isVerifyOnly = m_retrieveJob->retrieveRequest.isVerifyOnly;
+    const uint64_t fSeq = m_retrieveJob->selectedTapeFile().fSeq;
     // Set the common context for all the coming logs (file info)
     cta::log::ScopedParamContainer params(lc);
     params.add("fileId", m_retrieveJob->archiveFile.archiveFileID)
@@ -91,7 +95,7 @@ public:
       localStats.headerVolume += TapeSessionStats::headerVolumePerFile;
 
       lc.log(cta::log::INFO, "Successfully positioned for reading");
-      localStats.positionTime += timer.secs(cta::utils::Timer::resetCounter);
+      localStats.positionTime += trace.span(TraceEventType::Position, timer, fSeq);
       watchdog.notifyBeginNewJob(m_retrieveJob->archiveFile.archiveFileID, m_retrieveJob->selectedTapeFile().fSeq);
       localStats.waitReportingTime += timer.secs(cta::utils::Timer::resetCounter);
       currentErrorToCount = "Error_tapeReadData";
@@ -100,7 +104,7 @@ public:
       while (stillReading) {
         // Get a memory block and add information to its metadata
         mb = m_mm.getFreeBlock();
-        localStats.waitFreeMemoryTime += timer.secs(cta::utils::Timer::resetCounter);
+        localStats.waitFreeMemoryTime += trace.span(TraceEventType::WaitFreeMemory, timer, fSeq);
 
         mb->m_fSeq = m_retrieveJob->selectedTapeFile().fSeq;
         mb->m_fileBlock = fileBlock++;
@@ -119,8 +123,9 @@ public:
           // append() signaled the end of the file.
           stillReading = false;
         }
+        localStats.readWriteTime += trace.span(TraceEventType::TapeRead, timer, fSeq, mb->m_payload.size());
         checksum_adler32 = mb->m_payload.adler32(checksum_adler32);
-        localStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+        localStats.checksumingTime += trace.span(TraceEventType::Checksum, timer, fSeq, mb->m_payload.size());
         auto blockSize = mb->m_payload.size();
         localStats.dataVolume += blockSize;
         if (isRepack) {
@@ -160,6 +165,7 @@ public:
       }
       params.add("positionTime", localStats.positionTime)
         .add("readWriteTime", localStats.readWriteTime)
+        .add("checksumingTime", localStats.checksumingTime)
         .add("waitFreeMemoryTime", localStats.waitFreeMemoryTime)
         .add("waitReportingTime", localStats.waitReportingTime)
         .add("transferTime", localStats.transferTime())
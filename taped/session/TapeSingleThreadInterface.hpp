@@ -12,6 +12,7 @@
 
 #include "EncryptionControl.hpp"
 #include "Session.hpp"
+#include "SessionTracer.hpp"
 #include "TapeSessionStats.hpp"
 #include "VolumeInfo.hpp"
 #include "common/log/LogContext.hpp"
@@ -77,6 +78,12 @@ protected:
   /** Tape load timeout after which the mount is considered failed. */
   uint32_t m_tapeLoadTimeout;
 
+  /** Tracer of the session I/O operations (nullptr if tracing is disabled) */
+  SessionTracer* m_tracer = nullptr;
+
+  /** Trace lane of the tape thread, registered when the thread starts */
+  SessionTracer::Lane m_trace;
+
   /**
    * Try to mount the tape for read-only access, get an exception if it fails
    */
@@ -255,6 +262,13 @@ public:
    */
   virtual void setWaitForInstructionsTime(double secs) { m_stats.waitInstructionsTime = secs; }
 
+  /**
+   * Sets the tracer recording the operations of the tape thread.
+   * This function MUST be called before starting the thread.
+   * @param tracer The session tracer, or nullptr to disable tracing
+   */
+  void setTracer(SessionTracer* tracer) { m_tracer = tracer; }
+
   virtual cta::tape::drive::DriveInterface* getDriveReference() { return &m_drive; }
 
   /**
@@ -223,7 +223,7 @@ void cta::tape::daemon::TapeWriteSingleThread::tapeFlush(const std::string& mess
                                                          uint64_t files,
                                                          cta::utils::Timer& timer) {
   m_drive.flush();
-  double flushTime = timer.secs(cta::utils::Timer::resetCounter);
+  double flushTime = m_trace.span(TraceEventType::Flush, timer, 0, bytes);
   cta::log::ScopedParamContainer params(m_logContext);
   params.add("files", files).add("bytes", bytes).add("flushTime", flushTime);
   m_logContext.log(cta::log::INFO, message);
@@ -275,6 +275,7 @@ void cta::tape::daemon::TapeWriteSingleThread::isTapeWritable() const {
 void cta::tape::daemon::TapeWriteSingleThread::run() {
   cta::log::ScopedParamContainer threadGlobalParams(m_logContext);
   threadGlobalParams.add("thread", "TapeWrite");
+  m_trace = SessionTracer::Lane(m_tracer, "TapeWrite");
   cta::utils::Timer timer, totalTimer;
   // This out-of-try-catch variables allows us to record the stage of the
   // process we're in, and to count the error if it occurs.
@@ -336,7 +337,7 @@ void cta::tape::daemon::TapeWriteSingleThread::run() {
       currentErrorToCount = "Error_tapeNotWriteable";
       isTapeWritable();
 
-      m_stats.mountTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_stats.mountTime += m_trace.span(TraceEventType::Mount, timer);
       {
         cta::log::ScopedParamContainer scoped(m_logContext);
         scoped.add("mountTime", m_stats.mountTime);
@@ -373,7 +374,7 @@ void cta::tape::daemon::TapeWriteSingleThread::run() {
       // Then we have to initialize the tape write session
       currentErrorToCount = "Error_tapePositionForWrite";
       auto writeSession = openWriteSession();
-      m_stats.positionTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_stats.positionTime += m_trace.span(TraceEventType::Position, timer, m_lastFseq);
       //and then report
       {
         cta::log::ScopedParamContainer scoped(m_logContext);
@@ -419,7 +420,7 @@ void cta::tape::daemon::TapeWriteSingleThread::run() {
       while (true) {
         //get a task
         task.reset(m_tasks.pop());
-        m_stats.waitInstructionsTime += timer.secs(cta::utils::Timer::resetCounter);
+        m_stats.waitInstructionsTime += m_trace.span(TraceEventType::WaitInstructions, timer);
         // If we reached the end
         if (nullptr == task) {
           //we flush without asking
@@ -429,7 +430,7 @@ void cta::tape::daemon::TapeWriteSingleThread::run() {
           m_logContext.log(cta::log::DEBUG, "writing data to tape has finished");
           break;
         }
-        task->execute(*writeSession, m_reportPacker, m_watchdog, m_logContext, timer);
+        task->execute(*writeSession, m_reportPacker, m_watchdog, m_logContext, timer, m_trace);
         // Add the tasks counts to the session's
         m_stats.add(task->getTaskStats());
         // Transmit the statistics to the watchdog thread
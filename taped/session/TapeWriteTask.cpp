@@ -16,6 +16,7 @@
 #include "TransferTaskTracker.hpp"
 #include "common/exception/Errnum.hpp"
 #include "common/exception/Exception.hpp"
+#include "common/log/LogSchema.hpp"
 #include "common/semconv/Attributes.hpp"
 #include "common/telemetry/metrics/instruments/TapedInstruments.hpp"
 
@@ -24,6 +25,27 @@
 
 namespace cta::tape::daemon {
 
+namespace {
+/**
+ * Statistics logged for each file written to tape
+ */
+using TapeWriteStatsLog = log::LogSchema<log::Field<"readWriteTime", double>,
+                                         log::Field<"checksumingTime", double>,
+                                         log::Field<"waitDataTime", double>,
+                                         log::Field<"waitReportingTime", double>,
+                                         log::Field<"transferTime", double>,
+                                         log::Field<"totalTime", double>,
+                                         log::Field<"dataVolume", uint64_t>,
+                                         log::Field<"headerVolume", uint64_t>,
+                                         log::Field<"driveTransferSpeedMBps", double>,
+                                         log::Field<"payloadTransferSpeedMBps", double>,
+                                         log::Field<"fileSize", uint64_t>,
+                                         log::Field<"fileId", uint64_t>,
+                                         log::Field<"fSeq", uint64_t>,
+                                         log::Field<"reconciliationTime", time_t>,
+                                         log::Field<"LBPMode", std::string>>;
+}  // namespace
+
 //------------------------------------------------------------------------------
 // Constructor
 //------------------------------------------------------------------------------
@@ -60,7 +82,8 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
                             MigrationReportPacker& reportPacker,
                             MigrationWatchDog& watchdog,
                             cta::log::LogContext& lc,
-                            cta::utils::Timer& timer) {
+                            cta::utils::Timer& timer,
+                            const SessionTracer::Lane& trace) {
   [[maybe_unused]] TransferTaskTracker transferTaskTracer(cta::semconv::attr::CtaIoDirectionValues::kWrite,
                                                           cta::semconv::attr::CtaIoMediumValues::kTape);
   using cta::log::LogContext;
@@ -78,6 +101,7 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
   cta::utils::Timer localTime;
   unsigned long ckSum = Payload::zeroAdler32();
   uint64_t memBlockId = 0;
+  const uint64_t fSeq = m_tapeFile.fSeq;
 
   // This out-of-try-catch variables allows us to record the stage of the
   // process we're in, and to count the error if it occurs.
@@ -91,14 +115,14 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
     watchdog.notifyBeginNewJob(m_archiveJob->archiveFile.archiveFileID, m_archiveJob->tapeFile.fSeq);
     std::unique_ptr<cta::tape::tapeFile::FileWriter> output(openFileWriter(session, lc));
     m_LBPMode = output->getLBPMode();
-    m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+    m_taskStats.readWriteTime += trace.span(TraceEventType::TapeFileOpen, timer, fSeq);
     m_taskStats.headerVolume += TapeSessionStats::headerVolumePerFile;
     // We are not error sources here until we actually write.
     currentErrorToCount = "";
     bool firstBlock = true;
     while (!m_fifo.finished()) {
       MemBlock* const mb = m_fifo.popDataBlock();
-      m_taskStats.waitDataTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_taskStats.waitDataTime += trace.span(TraceEventType::WaitData, timer, fSeq);
       AutoReleaseBlock<MigrationMemoryManager> releaser(mb, m_memManager);
 
       // Special treatment for 1st block. If disk failed to provide anything, we can skip the file
@@ -108,7 +132,7 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
         currentErrorToCount = "Error_tapeWriteData";
         const char blank[] = "This file intentionally left blank: leaving placeholder after failing to read from disk.";
         output->write(blank, sizeof(blank));
-        m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+        m_taskStats.readWriteTime += trace.span(TraceEventType::TapeWrite, timer, fSeq, sizeof(blank));
         watchdog.notify(sizeof(blank));
         currentErrorToCount = "Error_tapeWriteTrailer";
         output->close();
@@ -122,12 +146,12 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
       checkErrors(mb, memBlockId, lc);
 
       ckSum = mb->m_payload.adler32(ckSum);
-      m_taskStats.checksumingTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_taskStats.checksumingTime += trace.span(TraceEventType::Checksum, timer, fSeq, mb->m_payload.size());
       currentErrorToCount = "Error_tapeWriteData";
       mb->m_payload.write(*output);
       currentErrorToCount = "";
 
-      m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_taskStats.readWriteTime += trace.span(TraceEventType::TapeWrite, timer, fSeq, mb->m_payload.size());
       m_taskStats.dataVolume += mb->m_payload.size();
       watchdog.notify(mb->m_payload.size());
       ++memBlockId;
@@ -139,7 +163,7 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
       currentErrorToCount = "Error_tapeWriteData";
       const char blank[] = "This file intentionally left blank: zero-length file cannot be recorded to tape.";
       output->write(blank, sizeof(blank));
-      m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+      m_taskStats.readWriteTime += trace.span(TraceEventType::TapeWrite, timer, fSeq, sizeof(blank));
       watchdog.notify(sizeof(blank));
       currentErrorToCount = "Error_tapeWriteTrailer";
       output->close();
@@ -153,7 +177,7 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
     currentErrorToCount = "Error_tapeWriteTrailer";
     output->close();
     currentErrorToCount = "";
-    m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+    m_taskStats.readWriteTime += trace.span(TraceEventType::TapeFileClose, timer, fSeq);
     m_taskStats.headerVolume += TapeSessionStats::trailerVolumePerFile;
     m_taskStats.filesCount++;
     // Record the fSeq in the tape session
@@ -162,7 +186,7 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
     m_archiveJob->tapeFile.fileSize = m_taskStats.dataVolume;
     m_archiveJob->tapeFile.blockId = output->getBlockId();
     reportPacker.reportCompletedJob(std::move(m_archiveJob), lc);
-    m_taskStats.waitReportingTime += timer.secs(cta::utils::Timer::resetCounter);
+    m_taskStats.waitReportingTime += trace.span(TraceEventType::Report, timer, fSeq);
     m_taskStats.totalTime = localTime.secs();
     // Log the successful transfer
     logWithStats(cta::log::INFO, "File successfully transmitted to drive", lc);
@@ -195,13 +219,13 @@ void TapeWriteTask::execute(cta::tape::tapeFile::WriteSession& session,
     // the write session->
     circulateMemBlocks();
     watchdog.addToErrorCount("Info_fileSkipped");
-    m_taskStats.readWriteTime += timer.secs(cta::utils::Timer::resetCounter);
+    m_taskStats.readWriteTime += trace.span(TraceEventType::TapeFileClose, timer, fSeq);
     m_taskStats.headerVolume += TapeSessionStats::trailerVolumePerFile;
     m_taskStats.filesCount++;
     // Record the fSeq in the tape session
     session.reportWrittenFSeq(m_archiveJob->tapeFile.fSeq);
     reportPacker.reportSkippedJob(std::move(m_archiveJob), s, lc);
-    m_taskStats.waitReportingTime += timer.secs(cta::utils::Timer::resetCounter);
+    m_taskStats.waitReportingTime += trace.span(TraceEventType::Report, timer, fSeq);
     m_taskStats.totalTime = localTime.secs();
     // Log the successful transfer
     logWithStats(cta::log::INFO, "Left placeholder on tape after skipping unreadable file.", lc);
@@ -386,28 +410,27 @@ void TapeWriteTask::circulateMemBlocks() {
 }
 
 void TapeWriteTask::logWithStats(int level, const std::string& msg, cta::log::LogContext& lc) const {
-  cta::log::ScopedParamContainer params(lc);
-  params.add("readWriteTime", m_taskStats.readWriteTime)
-    .add("checksumingTime", m_taskStats.checksumingTime)
-    .add("waitDataTime", m_taskStats.waitDataTime)
-    .add("waitReportingTime", m_taskStats.waitReportingTime)
-    .add("transferTime", m_taskStats.transferTime())
-    .add("totalTime", m_taskStats.totalTime)
-    .add("dataVolume", m_taskStats.dataVolume)
-    .add("headerVolume", m_taskStats.headerVolume)
-    .add("driveTransferSpeedMBps",
-         m_taskStats.totalTime ?
-           1.0 * (m_taskStats.dataVolume + m_taskStats.headerVolume) / 1000 / 1000 / m_taskStats.totalTime :
-           0.0)
-    .add("payloadTransferSpeedMBps",
-         m_taskStats.totalTime ? 1.0 * m_taskStats.dataVolume / 1000 / 1000 / m_taskStats.totalTime : 0.0)
-    .add("fileSize", m_archiveFile.fileSize)
-    .add("fileId", m_archiveFile.archiveFileID)
-    .add("fSeq", m_tapeFile.fSeq)
-    .add("reconciliationTime", m_archiveFile.reconciliationTime)
-    .add("LBPMode", m_LBPMode);
-
-  lc.log(level, msg);
+  TapeWriteStatsLog::log(
+    lc,
+    level,
+    msg,
+    m_taskStats.readWriteTime,
+    m_taskStats.checksumingTime,
+    m_taskStats.waitDataTime,
+    m_taskStats.waitReportingTime,
+    m_taskStats.transferTime(),
+    m_taskStats.totalTime,
+    m_taskStats.dataVolume,
+    m_taskStats.headerVolume,
+    m_taskStats.totalTime ?
+      1.0 * (m_taskStats.dataVolume + m_taskStats.headerVolume) / 1000 / 1000 / m_taskStats.totalTime :
+      0.0,
+    m_taskStats.totalTime ? 1.0 * m_taskStats.dataVolume / 1000 / 1000 / m_taskStats.totalTime : 0.0,
+    m_archiveFile.fileSize,
+    m_archiveFile.archiveFileID,
+    m_tapeFile.fSeq,
+    m_archiveFile.reconciliationTime,
+    m_LBPMode);
 }
 
 //------------------------------------------------------------------------------
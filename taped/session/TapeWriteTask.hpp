@@ -8,6 +8,7 @@
 #include "DataConsumer.hpp"
 #include "DataPipeline.hpp"
 #include "MigrationMemoryManager.hpp"
+#include "SessionTracer.hpp"
 #include "TapeSessionStats.hpp"
 #include "TapeWriteSingleThread.hpp"
 #include "TaskWatchDog.hpp"
@@ -62,12 +63,14 @@ public:
    * @param reportPacker For reporting success of or failure of the task
    * @param lc For logging
    * @param timer
+   * @param trace The trace lane of the tape thread
    */
   virtual void execute(cta::tape::tapeFile::WriteSession& session,
                        MigrationReportPacker& reportPacker,
                        MigrationWatchDog& watchdog,
                        cta::log::LogContext& lc,
-                       cta::utils::Timer& timer);
+                       cta::utils::Timer& timer,
+                       const SessionTracer::Lane& trace = SessionTracer::Lane());
 
 private:
   /** Utility class used in execute()'s implementation*/
@@ -383,6 +383,15 @@ public:
     m_statsSet = true;
   }
 
+  /**
+   * @return a copy of the statistics last pushed by the tape thread. Used by
+   * the disk thread pools to detect a starving drive.
+   */
+  TapeSessionStats getStats() {
+    cta::threading::MutexLocker locker(m_mutex);
+    return m_stats;
+  }
+
   /**
    * update the tapeThreadTimer, allowing logging a "best estimate" total time
    * in case of crash. If the provided stats in updateStats has a non-zero total
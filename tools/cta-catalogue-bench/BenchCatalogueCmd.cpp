@@ -0,0 +1,407 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "BenchCatalogueCmd.hpp"
+
+#include "BenchCatalogueCmdLineArgs.hpp"
+#include "catalogue/Catalogue.hpp"
+#include "catalogue/CatalogueFactory.hpp"
+#include "catalogue/CatalogueFactoryFactory.hpp"
+#include "catalogue/CreateMountPolicyAttributes.hpp"
+#include "catalogue/CreateTapeAttributes.hpp"
+#include "catalogue/MediaType.hpp"
+#include "catalogue/TapeFileSearchCriteria.hpp"
+#include "catalogue/TapeFileWritten.hpp"
+#include "catalogue/TapeForWriting.hpp"
+#include "catalogue/TapeItemWrittenPointer.hpp"
+#include "catalogue/TapeSearchCriteria.hpp"
+#include "common/dataStructures/ArchiveFileSummary.hpp"
+#include "common/dataStructures/ArchiveRouteType.hpp"
+#include "common/dataStructures/DeleteArchiveRequest.hpp"
+#include "common/dataStructures/RequesterIdentity.hpp"
+#include "common/dataStructures/RetrieveFileQueueCriteria.hpp"
+#include "common/dataStructures/SecurityIdentity.hpp"
+#include "common/dataStructures/StorageClass.hpp"
+#include "common/dataStructures/VirtualOrganization.hpp"
+#include "common/exception/Exception.hpp"
+#include "common/log/DummyLogger.hpp"
+#include "common/log/LogContext.hpp"
+#include "common/utils/Timer.hpp"
+#include "rdbms/Login.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <vector>
+
+namespace cta::catalogue {
+
+namespace {
+
+const std::string kDiskInstance = "bench_disk_instance";
+const std::string kVo = "bench_vo";
+const std::string kMediaType = "bench_media_type";
+const std::string kLogicalLibrary = "bench_logical_library";
+const std::string kStorageClass = "bench_storage_class";
+const std::string kMountPolicy = "bench_mount_policy";
+const std::string kTapeDrive = "bench_drive";
+const common::dataStructures::RequesterIdentity kRequester("bench_user", "bench_group");
+const uint64_t kFileSize = 1000 * 1000 * 1000;
+
+/**
+ * Returns the name of the tape pool of the specified copy.
+ */
+std::string getTapePoolName(const uint64_t copyNb) {
+  return "bench_tape_pool_" + std::to_string(copyNb);
+}
+
+/**
+ * Returns the VID of the tape with the specified index.
+ */
+std::string getVid(const uint64_t tapeIndex) {
+  std::ostringstream vid;
+  vid << "B" << std::setfill('0') << std::setw(5) << tapeIndex;
+  return vid.str();
+}
+
+/**
+ * Returns the event of having written the specified copy of an archive file.
+ */
+std::unique_ptr<TapeFileWritten> makeTapeFileWritten(const uint64_t archiveFileId,
+                                                     const uint64_t copyNb,
+                                                     const std::string& vid,
+                                                     const uint64_t fSeq) {
+  auto fileWritten = std::make_unique<TapeFileWritten>();
+  fileWritten->archiveFileId = archiveFileId;
+  fileWritten->diskInstance = kDiskInstance;
+  fileWritten->diskFileId = std::to_string(archiveFileId);
+  fileWritten->diskFilePath = "/bench/file" + std::to_string(archiveFileId);
+  fileWritten->diskFileOwnerUid = 1000;
+  fileWritten->diskFileGid = 1000;
+  fileWritten->size = kFileSize;
+  fileWritten->checksumBlob.insert(checksum::ADLER32, static_cast<uint32_t>(archiveFileId));
+  fileWritten->storageClassName = kStorageClass;
+  fileWritten->vid = vid;
+  fileWritten->fSeq = fSeq;
+  fileWritten->blockId = fSeq * 100;
+  fileWritten->copyNb = copyNb;
+  fileWritten->tapeDrive = kTapeDrive;
+  return fileWritten;
+}
+
+}  // anonymous namespace
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+BenchCatalogueCmd::BenchCatalogueCmd(std::istream& inStream, std::ostream& outStream, std::ostream& errStream)
+    : CmdLineTool(inStream, outStream, errStream) {}
+
+//------------------------------------------------------------------------------
+// exceptionThrowingMain
+//------------------------------------------------------------------------------
+int BenchCatalogueCmd::exceptionThrowingMain(const int argc, char* const* const argv) {
+  const BenchCatalogueCmdLineArgs cmdLineArgs(argc, argv);
+
+  if (cmdLineArgs.help) {
+    printUsage(m_out);
+    return 0;
+  }
+
+  const rdbms::Login dbLogin = rdbms::Login::parseFile(cmdLineArgs.dbConfigPath);
+  const uint64_t nbDbConns = 1;
+  const uint64_t nbArchiveFileListingDbConns = 1;
+  log::DummyLogger dummyLog("dummy", "dummy");
+  auto catalogueFactory = CatalogueFactoryFactory::create(dummyLog, dbLogin, nbDbConns, nbArchiveFileListingDbConns);
+
+  if (!cmdLineArgs.skipPopulate) {
+    // The dataset is populated by its own catalogue object so that archive
+    // file identifiers can be fetched in blocks without affecting the
+    // measurement of checkAndGetNextArchiveFileId()
+    auto catalogue = catalogueFactory->create();
+    catalogue->ArchiveFile()->setArchiveFileIdBlockSize(cmdLineArgs.batchSize);
+    createDatasetConfiguration(*catalogue, cmdLineArgs);
+    populateDataset(*catalogue, cmdLineArgs);
+  }
+
+  auto catalogue = catalogueFactory->create();
+  log::LogContext lc(dummyLog);
+  runBenchmarks(*catalogue, cmdLineArgs, lc);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// printUsage
+//------------------------------------------------------------------------------
+void BenchCatalogueCmd::printUsage(std::ostream& os) {
+  BenchCatalogueCmdLineArgs::printUsage(os);
+}
+
+//------------------------------------------------------------------------------
+// createDatasetConfiguration
+//------------------------------------------------------------------------------
+void BenchCatalogueCmd::createDatasetConfiguration(Catalogue& catalogue, const BenchCatalogueCmdLineArgs& cmdLineArgs) {
+  const common::dataStructures::SecurityIdentity admin(getUsername(), getHostname());
+  const std::string comment = "Created by cta-catalogue-bench";
+
+  catalogue.DiskInstance()->createDiskInstance(admin, kDiskInstance, comment);
+
+  common::dataStructures::VirtualOrganization vo;
+  vo.name = kVo;
+  vo.comment = comment;
+  vo.readMaxDrives = 1;
+  vo.writeMaxDrives = 1;
+  vo.maxFileSize = 0;
+  vo.diskInstanceName = kDiskInstance;
+  vo.isRepackVo = false;
+  catalogue.VO()->createVirtualOrganization(admin, vo);
+
+  MediaType mediaType;
+  mediaType.name = kMediaType;
+  mediaType.capacityInBytes = (uint64_t) 20 * 1000 * 1000 * 1000 * 1000;
+  mediaType.cartridge = "cartridge";
+  mediaType.comment = comment;
+  catalogue.MediaType()->createMediaType(admin, mediaType);
+
+  catalogue.LogicalLibrary()->createLogicalLibrary(admin, kLogicalLibrary, false, std::nullopt, comment);
+
+  common::dataStructures::StorageClass storageClass;
+  storageClass.name = kStorageClass;
+  storageClass.nbCopies = cmdLineArgs.nbCopies;
+  storageClass.vo.name = kVo;
+  storageClass.comment = comment;
+  catalogue.StorageClass()->createStorageClass(admin, storageClass);
+
+  for (uint64_t copyNb = 1; copyNb <= cmdLineArgs.nbCopies; copyNb++) {
+    catalogue.TapePool()->createTapePool(admin, getTapePoolName(copyNb), kVo, 0, std::nullopt, {}, comment);
+    catalogue.ArchiveRoute()->createArchiveRoute(admin,
+                                                 kStorageClass,
+                                                 copyNb,
+                                                 common::dataStructures::ArchiveRouteType::DEFAULT,
+                                                 getTapePoolName(copyNb),
+                                                 comment);
+  }
+
+  CreateMountPolicyAttributes mountPolicy;
+  mountPolicy.name = kMountPolicy;
+  mountPolicy.archivePriority = 1;
+  mountPolicy.minArchiveRequestAge = 0;
+  mountPolicy.retrievePriority = 1;
+  mountPolicy.minRetrieveRequestAge = 0;
+  mountPolicy.comment = comment;
+  catalogue.MountPolicy()->createMountPolicy(admin, mountPolicy);
+  catalogue.RequesterMountRule()->createRequesterMountRule(admin,
+                                                           kMountPolicy,
+                                                           kDiskInstance,
+                                                           kRequester.name,
+                                                           comment);
+
+  const uint64_t nbTapesPerPool = cmdLineArgs.nbTapes / cmdLineArgs.nbCopies;
+  for (uint64_t tapeIndex = 0; tapeIndex < nbTapesPerPool * cmdLineArgs.nbCopies; tapeIndex++) {
+    CreateTapeAttributes tape;
+    tape.vid = getVid(tapeIndex);
+    tape.mediaType = kMediaType;
+    tape.vendor = "vendor";
+    tape.logicalLibraryName = kLogicalLibrary;
+    tape.tapePoolName = getTapePoolName(tapeIndex / nbTapesPerPool + 1);
+    tape.full = false;
+    tape.state = common::dataStructures::Tape::ACTIVE;
+    tape.comment = comment;
+    catalogue.Tape()->createTape(admin, tape);
+  }
+  m_out << "Created " << nbTapesPerPool * cmdLineArgs.nbCopies << " tapes in " << cmdLineArgs.nbCopies
+        << " tape pools" << std::endl;
+}
+
+//------------------------------------------------------------------------------
+// populateDataset
+//------------------------------------------------------------------------------
+void BenchCatalogueCmd::populateDataset(Catalogue& catalogue, const BenchCatalogueCmdLineArgs& cmdLineArgs) {
+  const uint64_t nbTapesPerPool = cmdLineArgs.nbTapes / cmdLineArgs.nbCopies;
+  const uint64_t nbFilesPerTape = (cmdLineArgs.nbFiles + nbTapesPerPool - 1) / nbTapesPerPool;
+  const uint64_t progressStep = std::max<uint64_t>(1, cmdLineArgs.nbFiles / 10);
+
+  // One set of events per copy, each of them written to a single tape
+  std::vector<std::set<TapeItemWrittenPointer>> events(cmdLineArgs.nbCopies);
+  auto flushEvents = [&catalogue, &events]() {
+    for (auto& copyEvents : events) {
+      catalogue.TapeFile()->filesWrittenToTape(copyEvents);
+      copyEvents.clear();
+    }
+  };
+
+  utils::Timer timer;
+  for (uint64_t fileIndex = 0; fileIndex < cmdLineArgs.nbFiles; fileIndex++) {
+    const uint64_t tapeIndexInPool = fileIndex / nbFilesPerTape;
+    const uint64_t fSeq = fileIndex % nbFilesPerTape + 1;
+    if (1 == fSeq || events.front().size() == cmdLineArgs.batchSize) {
+      flushEvents();
+    }
+
+    const uint64_t archiveFileId =
+      catalogue.ArchiveFile()->checkAndGetNextArchiveFileId(kDiskInstance, kStorageClass, kRequester);
+    for (uint64_t copyNb = 1; copyNb <= cmdLineArgs.nbCopies; copyNb++) {
+      const std::string vid = getVid((copyNb - 1) * nbTapesPerPool + tapeIndexInPool);
+      events[copyNb - 1].emplace(makeTapeFileWritten(archiveFileId, copyNb, vid, fSeq).release());
+    }
+
+    if (0 == (fileIndex + 1) % progressStep) {
+      m_out << "Populated " << fileIndex + 1 << "/" << cmdLineArgs.nbFiles << " files in " << std::fixed
+            << std::setprecision(1) << timer.secs() << " seconds" << std::endl;
+    }
+  }
+  flushEvents();
+}
+
+//------------------------------------------------------------------------------
+// runBenchmarks
+//------------------------------------------------------------------------------
+void BenchCatalogueCmd::runBenchmarks(Catalogue& catalogue,
+                                      const BenchCatalogueCmdLineArgs& cmdLineArgs,
+                                      log::LogContext& lc) {
+  const uint64_t nbOperations = cmdLineArgs.nbOperations;
+  const uint64_t nbCopies = catalogue.StorageClass()->getStorageClass(kStorageClass).nbCopies;
+
+  TapeSearchCriteria tapeSearchCriteria;
+  tapeSearchCriteria.logicalLibrary = kLogicalLibrary;
+  auto tapes = catalogue.Tape()->getTapes(tapeSearchCriteria);
+  std::sort(tapes.begin(), tapes.end(), [](const auto& lhs, const auto& rhs) { return lhs.vid < rhs.vid; });
+  std::erase_if(tapes, [](const auto& tape) { return 0 == tape.lastFSeq; });
+  if (tapes.empty()) {
+    throw exception::Exception("The catalogue does not contain any file of the synthetic dataset");
+  }
+
+  // The files of the dataset are sampled with a fixed seed so that two runs
+  // against the same dataset are comparable
+  std::mt19937_64 randomEngine(12345);
+  std::uniform_int_distribution<size_t> tapeDistribution(0, tapes.size() - 1);
+  auto getRandomTapeFile = [&tapes, &tapeDistribution, &randomEngine]() {
+    const auto& tape = tapes.at(tapeDistribution(randomEngine));
+    std::uniform_int_distribution<uint64_t> fSeqDistribution(1, tape.lastFSeq);
+    return std::make_pair(tape.vid, fSeqDistribution(randomEngine));
+  };
+
+  std::vector<uint64_t> sampledArchiveFileIds;
+  for (uint64_t i = 0; i < 10 * nbOperations && sampledArchiveFileIds.size() < nbOperations; i++) {
+    const auto [vid, fSeq] = getRandomTapeFile();
+    for (const auto& archiveFile : catalogue.ArchiveFile()->getFilesForRepack(vid, fSeq, 1)) {
+      sampledArchiveFileIds.push_back(archiveFile.archiveFileID);
+    }
+  }
+  if (sampledArchiveFileIds.empty()) {
+    throw exception::Exception("Failed to sample the archive files of the synthetic dataset");
+  }
+
+  m_out << std::left << std::setw(32) << "operation" << std::right << std::setw(10) << "calls" << std::setw(12)
+        << "calls/s" << std::setw(10) << "p50(ms)" << std::setw(10) << "p90(ms)" << std::setw(10) << "p99(ms)"
+        << std::setw(10) << "max(ms)" << std::endl;
+
+  measure("getTapesForWriting", nbOperations, [&catalogue](const uint64_t) {
+    catalogue.Tape()->getTapesForWriting(kLogicalLibrary);
+  });
+
+  std::vector<uint64_t> newArchiveFileIds;
+  measure("checkAndGetNextArchiveFileId", nbOperations, [&catalogue, &newArchiveFileIds](const uint64_t) {
+    newArchiveFileIds.push_back(
+      catalogue.ArchiveFile()->checkAndGetNextArchiveFileId(kDiskInstance, kStorageClass, kRequester));
+  });
+
+  // The new files are appended to the last tape of each tape pool in batches
+  std::map<uint64_t, common::dataStructures::Tape> copyNbToLastTape;
+  for (uint64_t copyNb = 1; copyNb <= nbCopies; copyNb++) {
+    TapeSearchCriteria poolSearchCriteria;
+    poolSearchCriteria.tapePool = getTapePoolName(copyNb);
+    for (const auto& tape : catalogue.Tape()->getTapes(poolSearchCriteria)) {
+      if (!copyNbToLastTape.contains(copyNb) || copyNbToLastTape.at(copyNb).vid < tape.vid) {
+        copyNbToLastTape[copyNb] = tape;
+      }
+    }
+  }
+  std::vector<std::set<TapeItemWrittenPointer>> batches;
+  for (uint64_t batchStart = 0; batchStart < newArchiveFileIds.size(); batchStart += cmdLineArgs.batchSize) {
+    const uint64_t batchEnd = std::min<uint64_t>(batchStart + cmdLineArgs.batchSize, newArchiveFileIds.size());
+    for (auto& [copyNb, tape] : copyNbToLastTape) {
+      auto& batch = batches.emplace_back();
+      for (uint64_t i = batchStart; i < batchEnd; i++) {
+        tape.lastFSeq++;
+        batch.emplace(makeTapeFileWritten(newArchiveFileIds.at(i), copyNb, tape.vid, tape.lastFSeq).release());
+      }
+    }
+  }
+  measure("filesWrittenToTape(batch)", batches.size(), [&catalogue, &batches](const uint64_t callIndex) {
+    catalogue.TapeFile()->filesWrittenToTape(batches.at(callIndex));
+  });
+
+  measure("prepareToRetrieveFile",
+          nbOperations,
+          [&catalogue, &sampledArchiveFileIds, &lc](const uint64_t callIndex) {
+            const uint64_t archiveFileId = sampledArchiveFileIds.at(callIndex % sampledArchiveFileIds.size());
+            catalogue.TapeFile()->prepareToRetrieveFile(kDiskInstance, archiveFileId, kRequester, std::nullopt, lc);
+          });
+
+  measure("getFilesForRepack(batch)",
+          nbOperations,
+          [&catalogue, &getRandomTapeFile, &cmdLineArgs](const uint64_t) {
+            const auto [vid, fSeq] = getRandomTapeFile();
+            catalogue.ArchiveFile()->getFilesForRepack(vid, fSeq, cmdLineArgs.batchSize);
+          });
+
+  measure("getTapeFileSummary(vid)", nbOperations, [&catalogue, &getRandomTapeFile](const uint64_t) {
+    TapeFileSearchCriteria searchCriteria;
+    searchCriteria.vid = getRandomTapeFile().first;
+    catalogue.ArchiveFile()->getTapeFileSummary(searchCriteria);
+  });
+
+  std::vector<common::dataStructures::DeleteArchiveRequest> deleteRequests;
+  for (const auto archiveFileId : newArchiveFileIds) {
+    auto& request = deleteRequests.emplace_back();
+    request.requester = kRequester;
+    request.archiveFileID = archiveFileId;
+    request.diskFileId = std::to_string(archiveFileId);
+    request.diskFilePath = "/bench/file" + std::to_string(archiveFileId);
+    request.diskInstance = kDiskInstance;
+    request.archiveFile = catalogue.ArchiveFile()->getArchiveFileById(archiveFileId);
+  }
+  measure("moveArchiveFileToRecycleLog",
+          deleteRequests.size(),
+          [&catalogue, &deleteRequests, &lc](const uint64_t callIndex) {
+            catalogue.ArchiveFile()->moveArchiveFileToRecycleLog(deleteRequests.at(callIndex), lc);
+          });
+}
+
+//------------------------------------------------------------------------------
+// measure
+//------------------------------------------------------------------------------
+void BenchCatalogueCmd::measure(const std::string& operationName,
+                                const uint64_t nbCalls,
+                                const std::function<void(const uint64_t callIndex)>& operation) {
+  std::vector<double> latenciesMsecs;
+  latenciesMsecs.reserve(nbCalls);
+  utils::Timer totalTimer;
+  for (uint64_t callIndex = 0; callIndex < nbCalls; callIndex++) {
+    utils::Timer callTimer;
+    operation(callIndex);
+    latenciesMsecs.push_back(callTimer.msecs());
+  }
+  const double totalSecs = totalTimer.secs();
+
+  if (latenciesMsecs.empty()) {
+    return;
+  }
+  std::sort(latenciesMsecs.begin(), latenciesMsecs.end());
+  auto percentile = [&latenciesMsecs](const double p) {
+    return latenciesMsecs.at(static_cast<size_t>(p * static_cast<double>(latenciesMsecs.size() - 1)));
+  };
+  m_out << std::left << std::setw(32) << operationName << std::right << std::setw(10) << nbCalls << std::fixed
+        << std::setprecision(1) << std::setw(12) << (totalSecs > 0 ? nbCalls / totalSecs : 0)
+        << std::setprecision(3) << std::setw(10) << percentile(0.5) << std::setw(10) << percentile(0.9)
+        << std::setw(10) << percentile(0.99) << std::setw(10) << latenciesMsecs.back() << std::endl;
+}
+
+}  // namespace cta::catalogue
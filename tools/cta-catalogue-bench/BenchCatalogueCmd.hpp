@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "catalogue/CmdLineTool.hpp"
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+
+namespace cta {
+
+namespace log {
+class LogContext;
+}
+
+namespace catalogue {
+
+class Catalogue;
+struct BenchCatalogueCmdLineArgs;
+
+/**
+ * Command-line tool that measures the throughput and the latency of the hot
+ * operations of the catalogue against a synthetic dataset.
+ *
+ * The purpose of this tool is to evaluate schema and index changes at a
+ * realistic scale before they are deployed in production.  The tool creates
+ * its own disk instance, virtual organization, storage class, tape pools and
+ * tapes, all of them prefixed with "bench", and populates the catalogue with
+ * archive files in the same way as the tape servers do.  It must therefore
+ * never be run against a production catalogue.
+ */
+class BenchCatalogueCmd : public CmdLineTool {
+public:
+  /**
+   * Constructor.
+   *
+   * @param inStream Standard input stream.
+   * @param outStream Standard output stream.
+   * @param errStream Standard error stream.
+   */
+  BenchCatalogueCmd(std::istream& inStream, std::ostream& outStream, std::ostream& errStream);
+
+private:
+  /**
+   * An exception throwing version of main().
+   *
+   * @param argc The number of command-line arguments including the program name.
+   * @param argv The command-line arguments.
+   * @return The exit value of the program.
+   */
+  int exceptionThrowingMain(const int argc, char* const* const argv) override;
+
+  /**
+   * Prints the usage message of the command-line tool.
+   *
+   * @param os The output stream to which the usage message is to be printed.
+   */
+  void printUsage(std::ostream& os) override;
+
+  /**
+   * Creates the disk instance, virtual organization, storage class, tape
+   * pools, archive routes, mount policy and tapes of the synthetic dataset.
+   *
+   * @param catalogue The catalogue.
+   * @param cmdLineArgs The command-line arguments.
+   */
+  void createDatasetConfiguration(Catalogue& catalogue, const BenchCatalogueCmdLineArgs& cmdLineArgs);
+
+  /**
+   * Populates the catalogue with the archive files of the synthetic dataset.
+   * Each copy of a file is written to a different tape pool and the tapes of
+   * a pool are filled one after the other.
+   *
+   * @param catalogue The catalogue.
+   * @param cmdLineArgs The command-line arguments.
+   */
+  void populateDataset(Catalogue& catalogue, const BenchCatalogueCmdLineArgs& cmdLineArgs);
+
+  /**
+   * Measures the hot operations of the catalogue against the synthetic
+   * dataset and prints the results.  The files archived while measuring are
+   * moved to the recycle log when measuring deletions, so that the dataset
+   * can be reused by the next run.
+   *
+   * @param catalogue The catalogue.
+   * @param cmdLineArgs The command-line arguments.
+   * @param lc The log context.
+   */
+  void runBenchmarks(Catalogue& catalogue, const BenchCatalogueCmdLineArgs& cmdLineArgs, log::LogContext& lc);
+
+  /**
+   * Calls the specified operation the specified number of times and prints
+   * its throughput and latency percentiles.
+   *
+   * @param operationName The name of the operation as printed.
+   * @param nbCalls The number of times the operation is called.
+   * @param operation The operation which is given the index of the call.
+   */
+  void measure(const std::string& operationName,
+               const uint64_t nbCalls,
+               const std::function<void(const uint64_t callIndex)>& operation);
+};
+
+}  // namespace catalogue
+}  // namespace cta
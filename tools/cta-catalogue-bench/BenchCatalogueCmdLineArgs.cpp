@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "BenchCatalogueCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+#include "common/utils/utils.hpp"
+
+#include <getopt.h>
+#include <ostream>
+
+namespace cta::catalogue {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+BenchCatalogueCmdLineArgs::BenchCatalogueCmdLineArgs(const int argc, char* const* const argv) {
+  static struct option longopts[] = {
+    {"batch-size",    required_argument, nullptr, 'b'},
+    {"copies",        required_argument, nullptr, 'c'},
+    {"files",         required_argument, nullptr, 'f'},
+    {"help",          no_argument,       nullptr, 'h'},
+    {"operations",    required_argument, nullptr, 'n'},
+    {"skip-populate", no_argument,       nullptr, 's'},
+    {"tapes",         required_argument, nullptr, 't'},
+    {nullptr,         0,                 nullptr, 0  }
+  };
+
+  // Prevent getopt() from printing an error message if it does not recognize
+  // an option character
+  opterr = 0;
+
+  for (int opt = 0; (opt = getopt_long(argc, argv, ":b:c:f:hn:st:", longopts, nullptr)) != -1;) {
+    switch (opt) {
+      case 'b':
+        batchSize = utils::toUint64(optarg);
+        break;
+      case 'c':
+        nbCopies = utils::toUint64(optarg);
+        break;
+      case 'f':
+        nbFiles = utils::toUint64(optarg);
+        break;
+      case 'h':
+        help = true;
+        break;
+      case 'n':
+        nbOperations = utils::toUint64(optarg);
+        break;
+      case 's':
+        skipPopulate = true;
+        break;
+      case 't':
+        nbTapes = utils::toUint64(optarg);
+        break;
+      case ':':  // Missing parameter
+      {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "The -" << (char) optopt << " option requires a parameter";
+        throw ex;
+      }
+      case '?':  // Unknown option
+      {
+        exception::CommandLineNotParsed ex;
+        if (0 == optopt) {
+          ex.getMessage() << "Unknown command-line option";
+        } else {
+          ex.getMessage() << "Unknown command-line option: -" << (char) optopt;
+        }
+        throw ex;
+      }
+      default: {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "getopt_long returned the following unknown value: 0x" << std::hex << opt;
+        throw ex;
+      }
+    }  // switch(opt)
+  }  // while getopt_long()
+
+  // There is no need to continue parsing when the help option is set
+  if (help) {
+    return;
+  }
+
+  if (0 == nbFiles || 0 == nbCopies || 0 == batchSize || 0 == nbOperations) {
+    throw exception::CommandLineNotParsed(
+      "The number of files, copies and operations and the batch size must be greater than 0");
+  }
+
+  if (nbTapes < nbCopies) {
+    exception::CommandLineNotParsed ex;
+    ex.getMessage() << "The number of tapes must be at least the number of copies: tapes=" << nbTapes
+                    << " copies=" << nbCopies;
+    throw ex;
+  }
+
+  // Calculate the number of non-option ARGV-elements
+  // Check the number of arguments
+  if (const int nbArgs = argc - optind; nbArgs != 1) {
+    exception::CommandLineNotParsed ex;
+    ex.getMessage() << "Wrong number of command-line arguments: expected=1 actual=" << nbArgs;
+    throw ex;
+  }
+
+  dbConfigPath = argv[optind];
+}
+
+//------------------------------------------------------------------------------
+// printUsage
+//------------------------------------------------------------------------------
+void BenchCatalogueCmdLineArgs::printUsage(std::ostream& os) {
+  os << "Usage:" << std::endl
+     << "    cta-catalogue-bench databaseConnectionFile [options]" << std::endl
+     << "Where:" << std::endl
+     << "    databaseConnectionFile" << std::endl
+     << "        The path to the file containing the connection details of the CTA" << std::endl
+     << "        catalogue database.  The catalogue must not be used in production." << std::endl
+     << "Options:" << std::endl
+     << "    -f,--files <nbFiles>" << std::endl
+     << "        The number of archive files of the synthetic dataset (default 100000)" << std::endl
+     << "    -t,--tapes <nbTapes>" << std::endl
+     << "        The number of tapes of the synthetic dataset, rounded down to a" << std::endl
+     << "        multiple of the number of copies (default 100)" << std::endl
+     << "    -c,--copies <nbCopies>" << std::endl
+     << "        The number of tape copies of each archive file (default 2)" << std::endl
+     << "    -b,--batch-size <batchSize>" << std::endl
+     << "        The number of files written to tape per call to filesWrittenToTape" << std::endl
+     << "        (default 500)" << std::endl
+     << "    -n,--operations <nbOperations>" << std::endl
+     << "        The number of times each measured operation is called (default 1000)" << std::endl
+     << "    -s,--skip-populate" << std::endl
+     << "        Reuse the dataset populated by a previous run instead of populating" << std::endl
+     << "        the catalogue, the numbers of files, tapes and copies are then ignored" << std::endl
+     << "    -h,--help" << std::endl
+     << "        Prints this usage message" << std::endl;
+}
+
+}  // namespace cta::catalogue
@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+namespace cta::catalogue {
+
+/**
+ * Structure to store the command-line arguments of the command-line tool
+ * named cta-catalogue-bench.
+ */
+struct BenchCatalogueCmdLineArgs {
+  /**
+   * True if the usage message should be printed.
+   */
+  bool help = false;
+
+  /**
+   * Path to the file containing the connection details of the catalogue
+   * database.
+   */
+  std::string dbConfigPath;
+
+  /**
+   * The number of archive files of the synthetic dataset.
+   */
+  uint64_t nbFiles = 100000;
+
+  /**
+   * The number of tapes of the synthetic dataset.
+   */
+  uint64_t nbTapes = 100;
+
+  /**
+   * The number of tape copies of each archive file.
+   */
+  uint64_t nbCopies = 2;
+
+  /**
+   * The number of files written to tape per call to filesWrittenToTape().
+   */
+  uint64_t batchSize = 500;
+
+  /**
+   * The number of times each measured operation is called.
+   */
+  uint64_t nbOperations = 1000;
+
+  /**
+   * True if the dataset populated by a previous run should be reused.
+   */
+  bool skipPopulate = false;
+
+  /**
+   * Constructor that parses the specified command-line arguments.
+   *
+   * @param argc The number of command-line arguments including the name of the
+   * executable.
+   * @param argv The vector of command-line arguments.
+   */
+  BenchCatalogueCmdLineArgs(const int argc, char* const* const argv);
+
+  /**
+   * Prints the usage message of the command-line tool.
+   *
+   * @param os The output stream to which the usage message is to be printed.
+   */
+  static void printUsage(std::ostream& os);
+};
+
+}  // namespace cta::catalogue
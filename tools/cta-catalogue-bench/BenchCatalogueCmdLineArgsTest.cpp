@@ -0,0 +1,217 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "BenchCatalogueCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+
+#include <gtest/gtest.h>
+#include <list>
+
+namespace unitTests {
+
+class cta_catalogue_BenchCatalogueCmdLineArgsTest : public ::testing::Test {
+protected:
+  struct Argcv {
+    int argc;
+    char** argv;
+
+    Argcv() : argc(0), argv(nullptr) {}
+  };
+
+  using ArgcvVect = std::vector<Argcv*>;
+  ArgcvVect m_args;
+
+  /**
+   * Creates a duplicate string using the new operator.
+   */
+  char* dupString(const std::string& str) {
+    const int len = str.size();
+    char* copy = new char[len + 1];
+    std::copy(str.begin(), str.end(), copy);
+    copy[len] = '\0';
+    return copy;
+  }
+
+  void SetUp() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+  }
+
+  void TearDown() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+
+    for (ArgcvVect::const_iterator itor = m_args.begin(); itor != m_args.end(); itor++) {
+      for (int i = 0; i < (*itor)->argc; i++) {
+        delete[] (*itor)->argv[i];
+      }
+      delete[] (*itor)->argv;
+      delete *itor;
+    }
+  }
+};
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, help_short) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("-h");
+  args->argv[2] = nullptr;
+
+  BenchCatalogueCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_TRUE(cmdLine.help);
+  ASSERT_TRUE(cmdLine.dbConfigPath.empty());
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, help_long) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("--help");
+  args->argv[2] = nullptr;
+
+  BenchCatalogueCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_TRUE(cmdLine.help);
+  ASSERT_TRUE(cmdLine.dbConfigPath.empty());
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, dbConfigPath_only) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("dbConfigPath");
+  args->argv[2] = nullptr;
+
+  BenchCatalogueCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("dbConfigPath"), cmdLine.dbConfigPath);
+  ASSERT_EQ(100000, cmdLine.nbFiles);
+  ASSERT_EQ(100, cmdLine.nbTapes);
+  ASSERT_EQ(2, cmdLine.nbCopies);
+  ASSERT_EQ(500, cmdLine.batchSize);
+  ASSERT_EQ(1000, cmdLine.nbOperations);
+  ASSERT_FALSE(cmdLine.skipPopulate);
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, all_long_args) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 13;
+  args->argv = new char*[14];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("--files");
+  args->argv[2] = dupString("100000000");
+  args->argv[3] = dupString("--tapes");
+  args->argv[4] = dupString("100000");
+  args->argv[5] = dupString("--copies");
+  args->argv[6] = dupString("3");
+  args->argv[7] = dupString("--batch-size");
+  args->argv[8] = dupString("1000");
+  args->argv[9] = dupString("--operations");
+  args->argv[10] = dupString("10");
+  args->argv[11] = dupString("--skip-populate");
+  args->argv[12] = dupString("dbConfigPath");
+  args->argv[13] = nullptr;
+
+  BenchCatalogueCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("dbConfigPath"), cmdLine.dbConfigPath);
+  ASSERT_EQ(100000000, cmdLine.nbFiles);
+  ASSERT_EQ(100000, cmdLine.nbTapes);
+  ASSERT_EQ(3, cmdLine.nbCopies);
+  ASSERT_EQ(1000, cmdLine.batchSize);
+  ASSERT_EQ(10, cmdLine.nbOperations);
+  ASSERT_TRUE(cmdLine.skipPopulate);
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, all_short_args) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 13;
+  args->argv = new char*[14];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("-f");
+  args->argv[2] = dupString("100000000");
+  args->argv[3] = dupString("-t");
+  args->argv[4] = dupString("100000");
+  args->argv[5] = dupString("-c");
+  args->argv[6] = dupString("3");
+  args->argv[7] = dupString("-b");
+  args->argv[8] = dupString("1000");
+  args->argv[9] = dupString("-n");
+  args->argv[10] = dupString("10");
+  args->argv[11] = dupString("-s");
+  args->argv[12] = dupString("dbConfigPath");
+  args->argv[13] = nullptr;
+
+  BenchCatalogueCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("dbConfigPath"), cmdLine.dbConfigPath);
+  ASSERT_EQ(100000000, cmdLine.nbFiles);
+  ASSERT_EQ(100000, cmdLine.nbTapes);
+  ASSERT_EQ(3, cmdLine.nbCopies);
+  ASSERT_EQ(1000, cmdLine.batchSize);
+  ASSERT_EQ(10, cmdLine.nbOperations);
+  ASSERT_TRUE(cmdLine.skipPopulate);
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, fewer_tapes_than_copies) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 6;
+  args->argv = new char*[7];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("--tapes");
+  args->argv[2] = dupString("1");
+  args->argv[3] = dupString("--copies");
+  args->argv[4] = dupString("2");
+  args->argv[5] = dupString("dbConfigPath");
+  args->argv[6] = nullptr;
+
+  ASSERT_THROW(BenchCatalogueCmdLineArgs(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+TEST_F(cta_catalogue_BenchCatalogueCmdLineArgsTest, zero_operations) {
+  using namespace cta::catalogue;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 4;
+  args->argv = new char*[5];
+  args->argv[0] = dupString("cta-catalogue-bench");
+  args->argv[1] = dupString("--operations");
+  args->argv[2] = dupString("0");
+  args->argv[3] = dupString("dbConfigPath");
+  args->argv[4] = nullptr;
+
+  ASSERT_THROW(BenchCatalogueCmdLineArgs(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+}  // namespace unitTests
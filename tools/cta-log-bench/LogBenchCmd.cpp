@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "LogBenchCmd.hpp"
+
+#include "LogBenchCmdLineArgs.hpp"
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+#include "common/log/AsyncFileLogger.hpp"
+#include "common/log/FileLogger.hpp"
+#include "common/log/LogContext.hpp"
+#include "common/log/StdoutLogger.hpp"
+#include "common/utils/Timer.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace cta::log {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+LogBenchCmd::LogBenchCmd(std::ostream& outStream, std::ostream& errStream) : m_out(outStream), m_err(errStream) {}
+
+//------------------------------------------------------------------------------
+// mainImpl
+//------------------------------------------------------------------------------
+int LogBenchCmd::mainImpl(const int argc, char* const* const argv) {
+  bool cmdLineNotParsed = false;
+  std::string errorMessage;
+
+  try {
+    return exceptionThrowingMain(argc, argv);
+  } catch (exception::CommandLineNotParsed& ue) {
+    errorMessage = ue.getMessage().str();
+    cmdLineNotParsed = true;
+  } catch (exception::Exception& ex) {
+    errorMessage = ex.getMessage().str();
+  } catch (std::exception& se) {
+    errorMessage = se.what();
+  } catch (...) {
+    errorMessage = "An unknown exception was thrown";
+  }
+
+  // Reaching this point means the command has failed, an exception was throw
+  // and errorMessage has been set accordingly
+  m_err << "Aborting: " << errorMessage << std::endl;
+  if (cmdLineNotParsed) {
+    m_err << std::endl;
+    LogBenchCmdLineArgs::printUsage(m_err);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+// exceptionThrowingMain
+//------------------------------------------------------------------------------
+int LogBenchCmd::exceptionThrowingMain(const int argc, char* const* const argv) {
+  const LogBenchCmdLineArgs cmdLineArgs(argc, argv);
+
+  if (cmdLineArgs.help) {
+    LogBenchCmdLineArgs::printUsage(m_out);
+    return 0;
+  }
+
+  const std::string pid = std::to_string(getpid());
+  m_out << "threads=" << cmdLineArgs.nbThreads << " messagesPerThread=" << cmdLineArgs.nbMessages
+        << " params=" << cmdLineArgs.nbParams << " format=" << cmdLineArgs.logFormat << std::endl;
+  m_out << std::left << std::setw(16) << "logger" << std::right << std::setw(12) << "messages" << std::setw(12)
+        << "seconds" << std::setw(14) << "messages/s" << std::setw(12) << "MB/s" << std::endl;
+
+  {
+    const std::string logFilePath = cmdLineArgs.logDir + "/cta-log-bench-file." + pid + ".log";
+    FileLogger logger("localhost", "cta-log-bench", logFilePath, DEBUG);
+    logger.setLogFormat(cmdLineArgs.logFormat);
+    measure("FileLogger", logFilePath, logger, [] {}, cmdLineArgs);
+  }
+
+  {
+    const std::string logFilePath = cmdLineArgs.logDir + "/cta-log-bench-async." + pid + ".log";
+    AsyncFileLogger logger("localhost", "cta-log-bench", logFilePath, DEBUG);
+    logger.setLogFormat(cmdLineArgs.logFormat);
+    measure("AsyncFileLogger", logFilePath, logger, [&logger] { logger.flush(); }, cmdLineArgs);
+  }
+
+  {
+    // The standard output is redirected to a file so that the terminal does not limit the throughput
+    const std::string logFilePath = cmdLineArgs.logDir + "/cta-log-bench-stdout." + pid + ".log";
+    std::ofstream logFile(logFilePath);
+    auto* const stdoutBuf = std::cout.rdbuf(logFile.rdbuf());
+    // The standard output is restored before the results are printed
+    const auto restoreStdout = [stdoutBuf] {
+      std::cout.flush();
+      std::cout.rdbuf(stdoutBuf);
+    };
+    try {
+      StdoutLogger logger("localhost", "cta-log-bench");
+      logger.setLogFormat(cmdLineArgs.logFormat);
+      measure("StdoutLogger", logFilePath, logger, restoreStdout, cmdLineArgs);
+    } catch (...) {
+      restoreStdout();
+      throw;
+    }
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// measure
+//------------------------------------------------------------------------------
+void LogBenchCmd::measure(const std::string& loggerName,
+                          const std::string& logFilePath,
+                          Logger& logger,
+                          const std::function<void()>& flush,
+                          const LogBenchCmdLineArgs& cmdLineArgs) {
+  utils::Timer t;
+  std::vector<std::thread> threads;
+  for (uint64_t threadNb = 0; threadNb < cmdLineArgs.nbThreads; threadNb++) {
+    threads.emplace_back([&logger, &cmdLineArgs, threadNb] {
+      LogContext lc(logger);
+      ScopedParamContainer params(lc);
+      params.add("threadNb", threadNb);
+      // Mix the parameter types found in the CTA logs
+      for (uint64_t paramNb = 1; paramNb < cmdLineArgs.nbParams; paramNb++) {
+        const std::string name = "param" + std::to_string(paramNb);
+        switch (paramNb % 3) {
+          case 0:
+            params.add(name, "value" + std::to_string(paramNb));
+            break;
+          case 1:
+            params.add(name, paramNb * 1000);
+            break;
+          default:
+            params.add(name, paramNb / 3.0);
+        }
+      }
+      for (uint64_t msgNb = 0; msgNb < cmdLineArgs.nbMessages; msgNb++) {
+        lc.log(INFO, "Benchmark message");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  flush();
+  const double elapsedSecs = t.secs();
+
+  struct stat logFileStat;
+  const double logFileMB = 0 == ::stat(logFilePath.c_str(), &logFileStat) ? logFileStat.st_size / 1e6 : 0;
+  ::unlink(logFilePath.c_str());
+
+  const uint64_t nbMessages = cmdLineArgs.nbThreads * cmdLineArgs.nbMessages;
+  m_out << std::left << std::setw(16) << loggerName << std::right << std::setw(12) << nbMessages << std::setw(12)
+        << std::fixed << std::setprecision(3) << elapsedSecs << std::setw(14) << std::setprecision(0)
+        << nbMessages / elapsedSecs << std::setw(12) << std::setprecision(1) << logFileMB / elapsedSecs << std::endl;
+}
+
+}  // namespace cta::log
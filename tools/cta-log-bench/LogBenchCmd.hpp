@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace cta::log {
+
+class Logger;
+struct LogBenchCmdLineArgs;
+
+/**
+ * Command-line tool that measures the number of messages per second that the
+ * loggers of the CTA logging system can write when several threads log at the
+ * same time.
+ *
+ * The same workload is run against the FileLogger, the AsyncFileLogger and the
+ * StdoutLogger, whose standard output is redirected to a file.  Each thread
+ * logs through its own LogContext holding the requested number of parameters,
+ * in the same way as the CTA daemons do.
+ */
+class LogBenchCmd {
+public:
+  /**
+   * Constructor.
+   *
+   * @param outStream Standard output stream.
+   * @param errStream Standard error stream.
+   */
+  LogBenchCmd(std::ostream& outStream, std::ostream& errStream);
+
+  /**
+   * The object's implementation of main() that should be called from the main()
+   * of the program.
+   *
+   * @param argc The number of command-line arguments including the program name.
+   * @param argv The command-line arguments.
+   * @return The exit value of the program.
+   */
+  int mainImpl(const int argc, char* const* const argv);
+
+private:
+  /**
+   * An exception throwing version of main().
+   *
+   * @param argc The number of command-line arguments including the program name.
+   * @param argv The command-line arguments.
+   * @return The exit value of the program.
+   */
+  int exceptionThrowingMain(const int argc, char* const* const argv);
+
+  /**
+   * Logs the messages of the benchmark from the requested number of threads
+   * and prints the throughput of the logger.
+   *
+   * @param loggerName The name of the logger as printed.
+   * @param logFilePath The file written by the logger, deleted afterwards.
+   * @param logger The logger.
+   * @param flush Called once all the messages have been logged, to wait until
+   * they have been written and before printing the results.
+   * @param cmdLineArgs The command-line arguments.
+   */
+  void measure(const std::string& loggerName,
+               const std::string& logFilePath,
+               Logger& logger,
+               const std::function<void()>& flush,
+               const LogBenchCmdLineArgs& cmdLineArgs);
+
+  /**
+   * Standard output stream.
+   */
+  std::ostream& m_out;
+
+  /**
+   * Standard error stream.
+   */
+  std::ostream& m_err;
+};
+
+}  // namespace cta::log
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "LogBenchCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+#include "common/utils/utils.hpp"
+
+#include <getopt.h>
+#include <ostream>
+
+namespace cta::log {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+LogBenchCmdLineArgs::LogBenchCmdLineArgs(const int argc, char* const* const argv) {
+  static struct option longopts[] = {
+    {"dir",      required_argument, nullptr, 'd'},
+    {"format",   required_argument, nullptr, 'f'},
+    {"help",     no_argument,       nullptr, 'h'},
+    {"messages", required_argument, nullptr, 'n'},
+    {"params",   required_argument, nullptr, 'p'},
+    {"threads",  required_argument, nullptr, 't'},
+    {nullptr,    0,                 nullptr, 0  }
+  };
+
+  // Prevent getopt() from printing an error message if it does not recognize
+  // an option character
+  opterr = 0;
+
+  for (int opt = 0; (opt = getopt_long(argc, argv, ":d:f:hn:p:t:", longopts, nullptr)) != -1;) {
+    switch (opt) {
+      case 'd':
+        logDir = optarg;
+        break;
+      case 'f':
+        logFormat = optarg;
+        break;
+      case 'h':
+        help = true;
+        break;
+      case 'n':
+        nbMessages = utils::toUint64(optarg);
+        break;
+      case 'p':
+        nbParams = utils::toUint64(optarg);
+        break;
+      case 't':
+        nbThreads = utils::toUint64(optarg);
+        break;
+      case ':':  // Missing parameter
+      {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "The -" << (char) optopt << " option requires a parameter";
+        throw ex;
+      }
+      case '?':  // Unknown option
+      {
+        exception::CommandLineNotParsed ex;
+        if (0 == optopt) {
+          ex.getMessage() << "Unknown command-line option";
+        } else {
+          ex.getMessage() << "Unknown command-line option: -" << (char) optopt;
+        }
+        throw ex;
+      }
+      default: {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "getopt_long returned the following unknown value: 0x" << std::hex << opt;
+        throw ex;
+      }
+    }  // switch(opt)
+  }  // while getopt_long()
+
+  // There is no need to continue parsing when the help option is set
+  if (help) {
+    return;
+  }
+
+  if (0 == nbThreads || 0 == nbMessages) {
+    throw exception::CommandLineNotParsed("The number of threads and messages must be greater than 0");
+  }
+
+  if (logFormat != "default" && logFormat != "json") {
+    throw exception::CommandLineNotParsed("The log format must be default or json: format=" + logFormat);
+  }
+
+  // Check the number of arguments
+  if (const int nbArgs = argc - optind; nbArgs != 0) {
+    exception::CommandLineNotParsed ex;
+    ex.getMessage() << "Wrong number of command-line arguments: expected=0 actual=" << nbArgs;
+    throw ex;
+  }
+}
+
+//------------------------------------------------------------------------------
+// printUsage
+//------------------------------------------------------------------------------
+void LogBenchCmdLineArgs::printUsage(std::ostream& os) {
+  os << "Usage:" << std::endl
+     << "    cta-log-bench [options]" << std::endl
+     << "Options:" << std::endl
+     << "    -t,--threads <nbThreads>" << std::endl
+     << "        The number of logging threads (default 4)" << std::endl
+     << "    -n,--messages <nbMessages>" << std::endl
+     << "        The number of messages logged by each thread (default 100000)" << std::endl
+     << "    -p,--params <nbParams>" << std::endl
+     << "        The number of parameters of each message (default 5)" << std::endl
+     << "    -f,--format <default|json>" << std::endl
+     << "        The log format (default json)" << std::endl
+     << "    -d,--dir <logDir>" << std::endl
+     << "        The directory in which the log files are written and then deleted" << std::endl
+     << "        (default /tmp)" << std::endl
+     << "    -h,--help" << std::endl
+     << "        Prints this usage message" << std::endl;
+}
+
+}  // namespace cta::log
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+namespace cta::log {
+
+/**
+ * Structure to store the command-line arguments of the command-line tool
+ * named cta-log-bench.
+ */
+struct LogBenchCmdLineArgs {
+  /**
+   * True if the usage message should be printed.
+   */
+  bool help = false;
+
+  /**
+   * The number of logging threads.
+   */
+  uint64_t nbThreads = 4;
+
+  /**
+   * The number of messages logged by each thread.
+   */
+  uint64_t nbMessages = 100000;
+
+  /**
+   * The number of parameters of each message.
+   */
+  uint64_t nbParams = 5;
+
+  /**
+   * The log format, default or json.
+   */
+  std::string logFormat = "json";
+
+  /**
+   * The directory in which the log files are written.
+   */
+  std::string logDir = "/tmp";
+
+  /**
+   * Constructor that parses the specified command-line arguments.
+   *
+   * @param argc The number of command-line arguments including the name of the
+   * executable.
+   * @param argv The vector of command-line arguments.
+   */
+  LogBenchCmdLineArgs(const int argc, char* const* const argv);
+
+  /**
+   * Prints the usage message of the command-line tool.
+   *
+   * @param os The output stream to which the usage message is to be printed.
+   */
+  static void printUsage(std::ostream& os);
+};
+
+}  // namespace cta::log
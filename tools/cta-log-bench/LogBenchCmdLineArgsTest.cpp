@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "LogBenchCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+
+#include <gtest/gtest.h>
+#include <list>
+
+namespace unitTests {
+
+class cta_log_LogBenchCmdLineArgsTest : public ::testing::Test {
+protected:
+  struct Argcv {
+    int argc;
+    char** argv;
+
+    Argcv() : argc(0), argv(nullptr) {}
+  };
+
+  using ArgcvVect = std::vector<Argcv*>;
+  ArgcvVect m_args;
+
+  /**
+   * Creates a duplicate string using the new operator.
+   */
+  char* dupString(const std::string& str) {
+    const int len = str.size();
+    char* copy = new char[len + 1];
+    std::copy(str.begin(), str.end(), copy);
+    copy[len] = '\0';
+    return copy;
+  }
+
+  void SetUp() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+  }
+
+  void TearDown() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+
+    for (ArgcvVect::const_iterator itor = m_args.begin(); itor != m_args.end(); itor++) {
+      for (int i = 0; i < (*itor)->argc; i++) {
+        delete[] (*itor)->argv[i];
+      }
+      delete[] (*itor)->argv;
+      delete *itor;
+    }
+  }
+};
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, help_short) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = dupString("-h");
+  args->argv[2] = nullptr;
+
+  LogBenchCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_TRUE(cmdLine.help);
+}
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, defaults) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 1;
+  args->argv = new char*[2];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = nullptr;
+
+  LogBenchCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(4, cmdLine.nbThreads);
+  ASSERT_EQ(100000, cmdLine.nbMessages);
+  ASSERT_EQ(5, cmdLine.nbParams);
+  ASSERT_EQ(std::string("json"), cmdLine.logFormat);
+  ASSERT_EQ(std::string("/tmp"), cmdLine.logDir);
+}
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, all_long_options) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 11;
+  args->argv = new char*[12];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = dupString("--threads");
+  args->argv[2] = dupString("8");
+  args->argv[3] = dupString("--messages");
+  args->argv[4] = dupString("1000");
+  args->argv[5] = dupString("--params");
+  args->argv[6] = dupString("0");
+  args->argv[7] = dupString("--format");
+  args->argv[8] = dupString("default");
+  args->argv[9] = dupString("--dir");
+  args->argv[10] = dupString("/var/tmp");
+  args->argv[11] = nullptr;
+
+  LogBenchCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(8, cmdLine.nbThreads);
+  ASSERT_EQ(1000, cmdLine.nbMessages);
+  ASSERT_EQ(0, cmdLine.nbParams);
+  ASSERT_EQ(std::string("default"), cmdLine.logFormat);
+  ASSERT_EQ(std::string("/var/tmp"), cmdLine.logDir);
+}
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, invalid_format) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 3;
+  args->argv = new char*[4];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = dupString("-f");
+  args->argv[2] = dupString("xml");
+  args->argv[3] = nullptr;
+
+  ASSERT_THROW(LogBenchCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, zero_threads) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 3;
+  args->argv = new char*[4];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = dupString("-t");
+  args->argv[2] = dupString("0");
+  args->argv[3] = nullptr;
+
+  ASSERT_THROW(LogBenchCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+TEST_F(cta_log_LogBenchCmdLineArgsTest, unexpected_argument) {
+  using namespace cta::log;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-log-bench");
+  args->argv[1] = dupString("extra");
+  args->argv[2] = nullptr;
+
+  ASSERT_THROW(LogBenchCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+}  // namespace unitTests
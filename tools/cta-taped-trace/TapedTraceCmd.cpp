@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "TapedTraceCmd.hpp"
+
+#include "TapedTraceCmdLineArgs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <vector>
+
+namespace cta::tape::trace {
+
+namespace {
+
+using daemon::SessionTrace;
+using daemon::TraceEvent;
+using daemon::TraceEventType;
+
+constexpr double kNsPerSec = 1e9;
+constexpr double kNsPerMs = 1e6;
+
+/**
+ * Durations of the events of one type in one group of lanes
+ */
+struct TypeStats {
+  std::vector<uint64_t> durationsNs;
+  uint64_t totalNs = 0;
+  uint64_t bytes = 0;
+};
+
+/**
+ * An interruption of the tape data stream
+ */
+struct Gap {
+  uint64_t startNs = 0;
+  uint64_t durationNs = 0;
+  uint64_t fSeq = 0;
+  TraceEventType cause = TraceEventType::WaitInstructions;
+};
+
+//------------------------------------------------------------------------------
+// laneGroup
+//------------------------------------------------------------------------------
+std::string laneGroup(const std::string& laneName) {
+  return laneName.substr(0, laneName.find('-'));
+}
+
+//------------------------------------------------------------------------------
+// isTapeData
+//------------------------------------------------------------------------------
+bool isTapeData(TraceEventType type) {
+  return type == TraceEventType::TapeRead || type == TraceEventType::TapeWrite;
+}
+
+//------------------------------------------------------------------------------
+// percentileMs
+//------------------------------------------------------------------------------
+double percentileMs(const std::vector<uint64_t>& sortedNs, double percentile) {
+  if (sortedNs.empty()) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(percentile * static_cast<double>(sortedNs.size() - 1) + 0.5);
+  return static_cast<double>(sortedNs[index]) / kNsPerMs;
+}
+
+//------------------------------------------------------------------------------
+// mbPerSec
+//------------------------------------------------------------------------------
+double mbPerSec(uint64_t bytes, uint64_t durationNs) {
+  return durationNs ? static_cast<double>(bytes) / 1e6 / (static_cast<double>(durationNs) / kNsPerSec) : 0;
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+// exceptionThrowingMain
+//------------------------------------------------------------------------------
+int TapedTraceCmd::exceptionThrowingMain(const int argc, char* const* const argv) {
+  const TapedTraceCmdLineArgs cmdLineArgs(argc, argv);
+
+  if (cmdLineArgs.help) {
+    printUsage(m_out);
+    return 0;
+  }
+
+  std::ifstream traceFile(cmdLineArgs.traceFile, std::ios::binary);
+  if (!traceFile) {
+    throw exception::Exception("Failed to open " + cmdLineArgs.traceFile);
+  }
+  const SessionTrace trace = daemon::readBinaryTrace(traceFile);
+
+  if (!cmdLineArgs.chromeTraceFile.empty()) {
+    std::ofstream chromeFile(cmdLineArgs.chromeTraceFile);
+    daemon::writeChromeTrace(trace, chromeFile);
+    chromeFile.close();
+    if (!chromeFile) {
+      throw exception::Exception("Failed to write " + cmdLineArgs.chromeTraceFile);
+    }
+  }
+
+  uint64_t lastEndNs = 0;
+  for (const auto& event : trace.events) {
+    lastEndNs = std::max(lastEndNs, event.startNs + event.durationNs);
+  }
+  const uint64_t traceSpanNs = trace.events.empty() ? 0 : lastEndNs - trace.events.front().startNs;
+
+  m_out << "Session: " << trace.label << std::endl
+        << "Traced time: " << std::fixed << std::setprecision(3) << traceSpanNs / kNsPerSec << " s"
+        << "  events: " << trace.events.size() << "  dropped: " << trace.droppedEvents << std::endl;
+  if (trace.droppedEvents) {
+    m_out << "Warning: the oldest events were overwritten, increase SessionTraceMaxEvents for a full trace"
+          << std::endl;
+  }
+  m_out << std::endl;
+
+  printLaneSummary(trace);
+  printTapeStreaming(trace, cmdLineArgs);
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+// printUsage
+//------------------------------------------------------------------------------
+void TapedTraceCmd::printUsage(std::ostream& os) {
+  TapedTraceCmdLineArgs::printUsage(os);
+}
+
+//------------------------------------------------------------------------------
+// printLaneSummary
+//------------------------------------------------------------------------------
+void TapedTraceCmd::printLaneSummary(const SessionTrace& trace) {
+  // Group name -> (number of lanes, per type stats)
+  std::map<std::string, std::pair<uint64_t, std::array<TypeStats, daemon::kTraceEventTypeCount>>> groups;
+  for (const auto& lane : trace.lanes) {
+    groups[laneGroup(lane)].first++;
+  }
+  for (const auto& event : trace.events) {
+    auto& stats = groups[laneGroup(trace.lanes[event.lane])].second[static_cast<uint16_t>(event.type)];
+    stats.durationsNs.push_back(event.durationNs);
+    stats.totalNs += event.durationNs;
+    stats.bytes += event.bytes;
+  }
+
+  for (auto& [group, groupStats] : groups) {
+    auto& [laneCount, typeStats] = groupStats;
+    uint64_t groupNs = 0;
+    for (const auto& stats : typeStats) {
+      groupNs += stats.totalNs;
+    }
+    m_out << group << " (" << laneCount << (laneCount > 1 ? " threads)" : " thread)") << std::endl
+          << "  " << std::left << std::setw(18) << "operation" << std::right << std::setw(10) << "count"
+          << std::setw(12) << "total(s)" << std::setw(8) << "share" << std::setw(11) << "mean(ms)"
+          << std::setw(11) << "p50(ms)" << std::setw(11) << "p99(ms)" << std::setw(11) << "max(ms)"
+          << std::setw(10) << "MB/s" << std::endl;
+    for (uint16_t type = 0; type < daemon::kTraceEventTypeCount; type++) {
+      auto& stats = typeStats[type];
+      if (stats.durationsNs.empty()) {
+        continue;
+      }
+      std::sort(stats.durationsNs.begin(), stats.durationsNs.end());
+      m_out << "  " << std::left << std::setw(18) << daemon::toString(static_cast<TraceEventType>(type))
+            << std::right << std::setw(10) << stats.durationsNs.size() << std::setw(12) << std::setprecision(3)
+            << stats.totalNs / kNsPerSec << std::setw(7) << std::setprecision(1)
+            << (groupNs ? 100.0 * stats.totalNs / groupNs : 0) << "%" << std::setprecision(3) << std::setw(11)
+            << stats.totalNs / kNsPerMs / stats.durationsNs.size() << std::setw(11)
+            << percentileMs(stats.durationsNs, 0.5) << std::setw(11) << percentileMs(stats.durationsNs, 0.99)
+            << std::setw(11) << stats.durationsNs.back() / kNsPerMs << std::setw(10) << std::setprecision(1);
+      if (stats.bytes) {
+        m_out << mbPerSec(stats.bytes, stats.totalNs);
+      } else {
+        m_out << "-";
+      }
+      m_out << std::endl;
+    }
+    m_out << std::endl;
+  }
+}
+
+//------------------------------------------------------------------------------
+// printTapeStreaming
+//------------------------------------------------------------------------------
+void TapedTraceCmd::printTapeStreaming(const SessionTrace& trace, const TapedTraceCmdLineArgs& cmdLineArgs) {
+  const uint64_t thresholdNs = cmdLineArgs.gapThresholdMs * 1000 * 1000;
+  for (uint16_t lane = 0; lane < trace.lanes.size(); lane++) {
+    std::vector<const TraceEvent*> laneEvents;
+    for (const auto& event : trace.events) {
+      if (event.lane == lane) {
+        laneEvents.push_back(&event);
+      }
+    }
+    if (std::none_of(laneEvents.begin(), laneEvents.end(), [](const TraceEvent* e) { return isTapeData(e->type); })) {
+      continue;
+    }
+
+    // Walk the lane between consecutive data transfers: whatever the thread did in between kept the drive
+    // from streaming. The longest operation of the interruption is reported as its cause.
+    std::vector<Gap> gaps;
+    uint64_t dataNs = 0;
+    uint64_t dataBytes = 0;
+    uint64_t firstDataStartNs = 0;
+    uint64_t lastDataEndNs = 0;
+    const TraceEvent* previousData = nullptr;
+    const TraceEvent* longest = nullptr;
+    for (const auto* event : laneEvents) {
+      if (!isTapeData(event->type)) {
+        if (previousData && (!longest || event->durationNs > longest->durationNs)) {
+          longest = event;
+        }
+        continue;
+      }
+      if (previousData) {
+        const uint64_t previousEndNs = previousData->startNs + previousData->durationNs;
+        if (event->startNs > previousEndNs && event->startNs - previousEndNs >= thresholdNs) {
+          Gap gap;
+          gap.startNs = previousEndNs;
+          gap.durationNs = event->startNs - previousEndNs;
+          gap.fSeq = event->fSeq;
+          gap.cause = longest ? longest->type : TraceEventType::WaitInstructions;
+          gaps.push_back(gap);
+        }
+      } else {
+        firstDataStartNs = event->startNs;
+      }
+      dataNs += event->durationNs;
+      dataBytes += event->bytes;
+      lastDataEndNs = event->startNs + event->durationNs;
+      previousData = event;
+      longest = nullptr;
+    }
+
+    const uint64_t streamNs = lastDataEndNs - firstDataStartNs;
+    uint64_t gapsNs = 0;
+    std::map<TraceEventType, std::pair<uint64_t, uint64_t>> byCause;
+    for (const auto& gap : gaps) {
+      gapsNs += gap.durationNs;
+      byCause[gap.cause].first++;
+      byCause[gap.cause].second += gap.durationNs;
+    }
+
+    m_out << "Tape streaming (" << trace.lanes[lane] << ")" << std::endl
+          << "  data transferred: " << std::setprecision(1) << dataBytes / 1e6 << " MB" << std::endl
+          << "  drive throughput while transferring: " << mbPerSec(dataBytes, dataNs) << " MB/s" << std::endl
+          << "  effective throughput: " << mbPerSec(dataBytes, streamNs) << " MB/s" << std::endl
+          << "  interruptions over " << cmdLineArgs.gapThresholdMs << " ms: " << gaps.size() << " totalling "
+          << std::setprecision(3) << gapsNs / kNsPerSec << " s ("
+          << std::setprecision(1) << (streamNs ? 100.0 * gapsNs / streamNs : 0) << "% of the transfer)"
+          << std::endl;
+    for (const auto& [cause, countAndNs] : byCause) {
+      m_out << "    " << std::left << std::setw(18) << daemon::toString(cause) << std::right << std::setw(8)
+            << countAndNs.first << std::setw(12) << std::setprecision(3) << countAndNs.second / kNsPerSec << " s"
+            << std::endl;
+    }
+
+    std::sort(gaps.begin(), gaps.end(), [](const Gap& a, const Gap& b) { return a.durationNs > b.durationNs; });
+    if (gaps.size() > cmdLineArgs.topGaps) {
+      gaps.resize(cmdLineArgs.topGaps);
+    }
+    if (!gaps.empty()) {
+      m_out << "  longest interruptions:" << std::endl
+            << "    " << std::setw(12) << "offset(s)" << std::setw(12) << "fSeq" << std::setw(12) << "length(ms)"
+            << "  cause" << std::endl;
+      for (const auto& gap : gaps) {
+        m_out << "    " << std::setw(12) << std::setprecision(3) << gap.startNs / kNsPerSec << std::setw(12)
+              << gap.fSeq << std::setw(12) << gap.durationNs / kNsPerMs << "  " << daemon::toString(gap.cause)
+              << std::endl;
+      }
+    }
+    m_out << std::endl;
+  }
+}
+
+}  // namespace cta::tape::trace
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "common/CmdLineTool.hpp"
+#include "taped/session/SessionTracer.hpp"
+
+namespace cta::tape::trace {
+
+struct TapedTraceCmdLineArgs;
+
+/**
+ * Command-line tool analysing the session traces written by cta-taped when SessionTraceDirectory is set.
+ *
+ * It summarises where the time of each thread went, and explains the interruptions of the tape data
+ * stream (disk starvation, blocked memory, flushes, positioning) which prevent the drive from streaming.
+ */
+class TapedTraceCmd : public common::CmdLineTool {
+public:
+  /**
+   * Constructor
+   *
+   * @param inStream Standard input stream
+   * @param outStream Standard output stream
+   * @param errStream Standard error stream
+   */
+  TapedTraceCmd(std::istream& inStream, std::ostream& outStream, std::ostream& errStream)
+      : CmdLineTool(inStream, outStream, errStream) {}
+
+  /**
+   * Destructor
+   */
+  ~TapedTraceCmd() final = default;
+
+private:
+  /**
+   * An exception throwing version of main().
+   *
+   * @param argc The number of command-line arguments including the program name.
+   * @param argv The command-line arguments.
+   * @return The exit value of the program.
+   */
+  int exceptionThrowingMain(const int argc, char* const* const argv) override;
+
+  /**
+   * Prints the usage message of the command-line tool.
+   *
+   * @param os The output stream to which the usage message is to be printed.
+   */
+  void printUsage(std::ostream& os) override;
+
+  /**
+   * Prints the time spent in each kind of operation, per group of lanes (the disk threads of a session
+   * are grouped together).
+   */
+  void printLaneSummary(const daemon::SessionTrace& trace);
+
+  /**
+   * Prints the interruptions of the tape data stream longer than the threshold, with their likely cause.
+   */
+  void printTapeStreaming(const daemon::SessionTrace& trace, const TapedTraceCmdLineArgs& cmdLineArgs);
+};
+
+}  // namespace cta::tape::trace
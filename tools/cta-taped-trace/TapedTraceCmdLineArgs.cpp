@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "TapedTraceCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/utils/StringConversions.hpp"
+
+#include <getopt.h>
+#include <ostream>
+
+namespace cta::tape::trace {
+
+//------------------------------------------------------------------------------
+// constructor
+//------------------------------------------------------------------------------
+TapedTraceCmdLineArgs::TapedTraceCmdLineArgs(const int argc, char* const* const argv) {
+  static struct option longopts[] = {
+    {"chrome", required_argument, nullptr, 'c'},
+    {"gap",    required_argument, nullptr, 'g'},
+    {"top",    required_argument, nullptr, 't'},
+    {"help",   no_argument,       nullptr, 'h'},
+    {nullptr,  0,                 nullptr, 0  }
+  };
+
+  // Prevent getopt() from printing an error message if it does not recognize
+  // an option character
+  opterr = 0;
+
+  for (int opt = 0; (opt = getopt_long(argc, argv, ":c:g:t:h", longopts, nullptr)) != -1;) {
+    switch (opt) {
+      case 'c':
+        chromeTraceFile = optarg;
+        break;
+      case 'g':
+        gapThresholdMs = utils::toUint64(optarg);
+        break;
+      case 't':
+        topGaps = utils::toUint64(optarg);
+        break;
+      case 'h':
+        help = true;
+        break;
+      case ':':  // Missing parameter
+      {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "The -" << (char) optopt << " option requires a parameter";
+        throw ex;
+      }
+      case '?':  // Unknown option
+      {
+        exception::CommandLineNotParsed ex;
+        if (0 == optopt) {
+          ex.getMessage() << "Unknown command-line option";
+        } else {
+          ex.getMessage() << "Unknown command-line option: -" << (char) optopt;
+        }
+        throw ex;
+      }
+      default: {
+        exception::CommandLineNotParsed ex;
+        ex.getMessage() << "getopt_long returned the following unknown value: 0x" << std::hex << opt;
+        throw ex;
+      }
+    }  // switch(opt)
+  }  // while getopt_long()
+
+  // There is no need to continue parsing when the help option is set
+  if (help) {
+    return;
+  }
+
+  // Check the number of arguments
+  if (const int nbArgs = argc - optind; nbArgs != 1) {
+    exception::CommandLineNotParsed ex;
+    ex.getMessage() << "Wrong number of command-line arguments: expected=1 actual=" << nbArgs;
+    throw ex;
+  }
+
+  traceFile = argv[optind];
+}
+
+//------------------------------------------------------------------------------
+// printUsage
+//------------------------------------------------------------------------------
+void TapedTraceCmdLineArgs::printUsage(std::ostream& os) {
+  os << "Usage:" << std::endl
+     << "    cta-taped-trace traceFile [options]" << std::endl
+     << "Where:" << std::endl
+     << "    traceFile" << std::endl
+     << "        The path to a session trace file written by cta-taped." << std::endl
+     << "Options:" << std::endl
+     << "    -c,--chrome file" << std::endl
+     << "        Also converts the trace to the Chrome trace event format, which can be" << std::endl
+     << "        opened with chrome://tracing or https://ui.perfetto.dev" << std::endl
+     << "    -g,--gap milliseconds" << std::endl
+     << "        Minimum duration of the interruptions of the tape data stream to report" << std::endl
+     << "        (default 100)" << std::endl
+     << "    -t,--top count" << std::endl
+     << "        Number of longest interruptions of the tape data stream to list (default 10)" << std::endl
+     << "    -h,--help" << std::endl
+     << "        Prints this usage message" << std::endl;
+}
+
+}  // namespace cta::tape::trace
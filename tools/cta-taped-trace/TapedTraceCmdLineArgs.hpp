@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+namespace cta::tape::trace {
+
+/**
+ * Structure to store the command-line arguments of the command-line tool
+ * named cta-taped-trace.
+ */
+struct TapedTraceCmdLineArgs {
+  /**
+   * True if the usage message should be printed.
+   */
+  bool help = false;
+
+  /**
+   * Path to the session trace file written by cta-taped.
+   */
+  std::string traceFile;
+
+  /**
+   * Path of the Chrome trace file to write (empty string for none).
+   */
+  std::string chromeTraceFile;
+
+  /**
+   * Minimum duration of an interruption of the tape data stream to be reported, in milliseconds.
+   */
+  uint64_t gapThresholdMs = 100;
+
+  /**
+   * Number of longest interruptions of the tape data stream to list.
+   */
+  uint64_t topGaps = 10;
+
+  /**
+   * Constructor that parses the specified command-line arguments.
+   *
+   * @param argc The number of command-line arguments including the name of the
+   * executable.
+   * @param argv The vector of command-line arguments.
+   */
+  TapedTraceCmdLineArgs(const int argc, char* const* const argv);
+
+  /**
+   * Prints the usage message of the command-line tool.
+   *
+   * @param os The output stream to which the usage message is to be printed.
+   */
+  static void printUsage(std::ostream& os);
+};
+
+}  // namespace cta::tape::trace
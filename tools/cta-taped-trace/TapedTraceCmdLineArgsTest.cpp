@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "TapedTraceCmdLineArgs.hpp"
+
+#include "common/exception/CommandLineNotParsed.hpp"
+#include "common/exception/Exception.hpp"
+
+#include <getopt.h>
+#include <gtest/gtest.h>
+#include <list>
+
+namespace unitTests {
+
+class cta_tape_trace_TapedTraceCmdLineArgsTest : public ::testing::Test {
+protected:
+  struct Argcv {
+    int argc;
+    char** argv;
+
+    Argcv() : argc(0), argv(nullptr) {}
+  };
+
+  using ArgcvVect = std::vector<Argcv*>;
+  ArgcvVect m_args;
+
+  /**
+   * Creates a duplicate string using the new operator.
+   */
+  char* dupString(const std::string& str) {
+    const int len = str.size();
+    char* copy = new char[len + 1];
+    std::copy(str.begin(), str.end(), copy);
+    copy[len] = '\0';
+    return copy;
+  }
+
+  void SetUp() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+  }
+
+  void TearDown() override {
+    // Allow getopt_long to be called again
+    optind = 0;
+
+    for (ArgcvVect::const_iterator itor = m_args.begin(); itor != m_args.end(); itor++) {
+      for (int i = 0; i < (*itor)->argc; i++) {
+        delete[] (*itor)->argv[i];
+      }
+      delete[] (*itor)->argv;
+      delete *itor;
+    }
+  }
+};
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, help_short) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("-h");
+  args->argv[2] = nullptr;
+
+  TapedTraceCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_TRUE(cmdLine.help);
+  ASSERT_TRUE(cmdLine.traceFile.empty());
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, help_long) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("--help");
+  args->argv[2] = nullptr;
+
+  TapedTraceCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_TRUE(cmdLine.help);
+  ASSERT_TRUE(cmdLine.traceFile.empty());
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, traceFile_only) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 2;
+  args->argv = new char*[3];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("/var/log/cta/session.trace");
+  args->argv[2] = nullptr;
+
+  TapedTraceCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("/var/log/cta/session.trace"), cmdLine.traceFile);
+  ASSERT_TRUE(cmdLine.chromeTraceFile.empty());
+  ASSERT_EQ(100, cmdLine.gapThresholdMs);
+  ASSERT_EQ(10, cmdLine.topGaps);
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, all_long_args) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 8;
+  args->argv = new char*[9];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("--chrome");
+  args->argv[2] = dupString("/tmp/session.json");
+  args->argv[3] = dupString("--gap");
+  args->argv[4] = dupString("250");
+  args->argv[5] = dupString("--top");
+  args->argv[6] = dupString("3");
+  args->argv[7] = dupString("/var/log/cta/session.trace");
+  args->argv[8] = nullptr;
+
+  TapedTraceCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("/var/log/cta/session.trace"), cmdLine.traceFile);
+  ASSERT_EQ(std::string("/tmp/session.json"), cmdLine.chromeTraceFile);
+  ASSERT_EQ(250, cmdLine.gapThresholdMs);
+  ASSERT_EQ(3, cmdLine.topGaps);
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, all_short_args) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 8;
+  args->argv = new char*[9];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("-c");
+  args->argv[2] = dupString("/tmp/session.json");
+  args->argv[3] = dupString("-g");
+  args->argv[4] = dupString("250");
+  args->argv[5] = dupString("-t");
+  args->argv[6] = dupString("3");
+  args->argv[7] = dupString("/var/log/cta/session.trace");
+  args->argv[8] = nullptr;
+
+  TapedTraceCmdLineArgs cmdLine(args->argc, args->argv);
+
+  ASSERT_FALSE(cmdLine.help);
+  ASSERT_EQ(std::string("/var/log/cta/session.trace"), cmdLine.traceFile);
+  ASSERT_EQ(std::string("/tmp/session.json"), cmdLine.chromeTraceFile);
+  ASSERT_EQ(250, cmdLine.gapThresholdMs);
+  ASSERT_EQ(3, cmdLine.topGaps);
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, missing_traceFile) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 3;
+  args->argv = new char*[4];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("-g");
+  args->argv[2] = dupString("250");
+  args->argv[3] = nullptr;
+
+  ASSERT_THROW(TapedTraceCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, missing_option_parameter) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 3;
+  args->argv = new char*[4];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("/var/log/cta/session.trace");
+  args->argv[2] = dupString("--top");
+  args->argv[3] = nullptr;
+
+  ASSERT_THROW(TapedTraceCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::CommandLineNotParsed);
+}
+
+TEST_F(cta_tape_trace_TapedTraceCmdLineArgsTest, non_numeric_gap) {
+  using namespace cta::tape::trace;
+
+  Argcv* args = new Argcv();
+  m_args.push_back(args);
+  args->argc = 4;
+  args->argv = new char*[5];
+  args->argv[0] = dupString("cta-taped-trace");
+  args->argv[1] = dupString("-g");
+  args->argv[2] = dupString("fast");
+  args->argv[3] = dupString("/var/log/cta/session.trace");
+  args->argv[4] = nullptr;
+
+  ASSERT_THROW(TapedTraceCmdLineArgs cmdLine(args->argc, args->argv), cta::exception::Exception);
+}
+
+}  // namespace unitTests
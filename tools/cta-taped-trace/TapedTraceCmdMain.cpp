@@ -0,0 +1,16 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "TapedTraceCmd.hpp"
+
+#include <iostream>
+
+//------------------------------------------------------------------------------
+// main
+//------------------------------------------------------------------------------
+int main(const int argc, char* const* const argv) {
+  cta::tape::trace::TapedTraceCmd cmd(std::cin, std::cout, std::cerr);
+  return cmd.mainImpl(argc, argv);
+}
@@ -50,6 +50,7 @@ AdminCmdStream::AdminCmdStream(const frontend::FrontendService& frontendService,
 
 xrd::Response AdminCmdStream::process() {
   RequestTracker requestTracker("ADMIN_STREAMING", "admin");
+  requestTracker.addPhaseTime(RequestTracker::Phase::Auth, m_authMsecs);
   xrd::Response response;
 
   utils::Timer t;
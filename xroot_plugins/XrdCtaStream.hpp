@@ -5,9 +5,10 @@
 
 #pragma once
 
+#include "XrdCtaStreamBuffer.hpp"
 #include "frontend/common/CtaAdminResponseStream.hpp"
 
-#include <XrdSsiPbOStreamBuffer.hpp>
+#include <XrdSsiPbLog.hpp>
 #include <catalogue/Catalogue.hpp>
 #include <scheduler/Scheduler.hpp>
 
@@ -15,6 +16,12 @@ namespace cta::xrd {
 
 /*!
  * Virtual stream object
+ *
+ * The records of the response stream are encoded directly into buffers which are reused once XRootD SSI has sent
+ * them, and into the same Data record, so that streaming a long listing neither allocates a buffer for each call to
+ * GetBuff() nor a record for each item. The items are only read from the response stream when XRootD SSI asks for
+ * the next buffer, so a slow client slows down the reading of the catalogue instead of making the frontend buffer the
+ * response.
  */
 class XrdCtaStream : public XrdSsiStream {
 public:
@@ -24,7 +31,8 @@ public:
       : XrdSsiStream(XrdSsiStream::isActive),
         m_catalogue(catalogue),
         m_scheduler(scheduler),
-        m_stream(std::move(stream)) {
+        m_stream(std::move(stream)),
+        m_bufferPool(std::make_shared<StreamBufferPool>(MAX_FREE_BUFFERS)) {
     XrdSsiPb::Log::Msg(XrdSsiPb::Log::DEBUG, LOG_SUFFIX, "XrdCtaStream() constructor");
   }
 
@@ -52,18 +60,18 @@ public:
   Buffer* GetBuff(XrdSsiErrInfo& eInfo, int& dlen, bool& last) override {
     XrdSsiPb::Log::Msg(XrdSsiPb::Log::DEBUG, LOG_SUFFIX, "GetBuff(): XrdSsi buffer fill request (", dlen, " bytes)");
 
-    std::unique_ptr<XrdSsiPb::OStreamBuffer<Data>> streambuf;
+    std::unique_ptr<StreamBuffer> streambuf;
 
     try {
-      if (isDone()) {
+      if (!m_hasPendingRecord && isDone()) {
         // Nothing more to send, close the stream
         last = true;
         return nullptr;
       }
 
-      streambuf = std::make_unique<XrdSsiPb::OStreamBuffer<Data>>(dlen);
+      streambuf = m_bufferPool->getBuffer(dlen > 0 ? dlen : DEFAULT_BUFFER_SIZE);
 
-      dlen = fillBuffer(streambuf.get());
+      dlen = fillBuffer(*streambuf);
 
       XrdSsiPb::Log::Msg(XrdSsiPb::Log::DEBUG,
                          LOG_SUFFIX,
@@ -102,17 +110,25 @@ private:
 
   /*!
    * Fills the stream buffer
+   *
+   * A record which does not fit in the buffer is kept in m_record and sent first in the next buffer.
    */
-  virtual int fillBuffer(XrdSsiPb::OStreamBuffer<Data>* streambuf) {
+  virtual int fillBuffer(StreamBuffer& streambuf) {
     if (!m_stream) {
       throw cta::exception::Exception("Unable to call fillBuffer, as stream has not been initialised!");
     }
 
-    for (bool is_buffer_full = false; !m_stream->isDone() && !is_buffer_full;) {
-      Data record = m_stream->next();
-      is_buffer_full = streambuf->Push(record);
+    while (m_hasPendingRecord || !m_stream->isDone()) {
+      if (!m_hasPendingRecord) {
+        m_stream->fillNext(m_record);
+        m_hasPendingRecord = true;
+      }
+      if (!streambuf.push(m_record)) {
+        break;
+      }
+      m_hasPendingRecord = false;
     }
-    return streambuf->Size();
+    return streambuf.size();
   }
 
 protected:
@@ -122,6 +138,12 @@ protected:
 
 private:
   static constexpr const char* const LOG_SUFFIX = "XrdCtaStream";  //!< Identifier for log messages
+  static constexpr size_t MAX_FREE_BUFFERS = 2;                    //!< Number of sent buffers kept for reuse
+  static constexpr int DEFAULT_BUFFER_SIZE = 1024 * 1024;          //!< Buffer size if XRootD SSI gives no hint
+
+  std::shared_ptr<StreamBufferPool> m_bufferPool;  //!< The buffers of the stream, shared with the buffers being sent
+  Data m_record;                                   //!< The record reused for all the items of the response stream
+  bool m_hasPendingRecord = false;                 //!< True if m_record has been filled but not sent yet
 };
 
 }  // namespace cta::xrd
@@ -0,0 +1,166 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <XrdSsi/XrdSsiStream.hh>
+#include <cstdint>
+#include <google/protobuf/io/coded_stream.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cta_frontend.pb.h"
+
+namespace cta::xrd {
+
+class StreamBufferPool;
+
+/*!
+ * Buffer of an XRootD SSI stream, filled with Data records
+ *
+ * The records are encoded in place, each one preceded by its size as a 32-bit little-endian integer, which is the
+ * framing expected by the XrdSsiPb stream buffers of the client. When XRootD SSI recycles the buffer once it has been
+ * sent, the buffer is returned to the pool it comes from to be filled again, rather than being freed.
+ */
+class StreamBuffer : public XrdSsiStream::Buffer {
+public:
+  /*!
+   * Constructor
+   *
+   * @param pool        The pool to which the buffer is returned when it is recycled
+   * @param capacity    The number of bytes which can be written to the buffer
+   */
+  StreamBuffer(const std::weak_ptr<StreamBufferPool>& pool, size_t capacity) : m_pool(pool) { reset(capacity); }
+
+  ~StreamBuffer() override = default;
+
+  StreamBuffer(const StreamBuffer&) = delete;
+  StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+  /*!
+   * Empties the buffer and makes sure that at least the specified number of bytes can be written to it
+   */
+  void reset(size_t capacity);
+
+  /*!
+   * Appends a record to the buffer
+   *
+   * A record which does not fit in the remaining space is not written, unless the buffer is empty: the buffer is then
+   * enlarged so that each record can be sent, whatever its size.
+   *
+   * @param record    The record
+   * @return          false if the buffer does not have enough space left for the record
+   */
+  bool push(const Data& record);
+
+  /*!
+   * The number of bytes written to the buffer
+   */
+  int size() const { return static_cast<int>(m_size); }
+
+  /*!
+   * Called by XRootD SSI once the buffer has been sent
+   */
+  void Recycle() override;
+
+private:
+  std::weak_ptr<StreamBufferPool> m_pool;  //!< The pool of the buffer, which may be destroyed before the buffer
+  std::unique_ptr<char[]> m_storage;       //!< The memory of the buffer, pointed to by data
+  size_t m_capacity = 0;                   //!< The size of m_storage
+  size_t m_size = 0;                       //!< The number of bytes written to the buffer
+};
+
+/*!
+ * Pool of the buffers of an XRootD SSI stream
+ *
+ * XRootD SSI asks for the next buffer of an active stream only once the client is ready for it, and the buffers are
+ * recycled once sent. Reusing them bounds the memory of the stream to a few buffers, whatever the number of records
+ * it returns, and saves the allocation of a new buffer each time.
+ */
+class StreamBufferPool : public std::enable_shared_from_this<StreamBufferPool> {
+public:
+  /*!
+   * Constructor
+   *
+   * @param maxFreeBuffers    The maximum number of buffers kept for reuse, the others are freed when recycled
+   */
+  explicit StreamBufferPool(size_t maxFreeBuffers) : m_maxFreeBuffers(maxFreeBuffers) {}
+
+  /*!
+   * Returns an empty buffer of at least the specified capacity, reusing a recycled buffer if any
+   */
+  std::unique_ptr<StreamBuffer> getBuffer(size_t capacity);
+
+  /*!
+   * Keeps a recycled buffer for reuse, or frees it if enough buffers are kept already
+   */
+  void recycle(std::unique_ptr<StreamBuffer> buffer);
+
+private:
+  const size_t m_maxFreeBuffers;                             //!< The maximum number of buffers kept for reuse
+  std::mutex m_mutex;                                        //!< Protects m_freeBuffers, recycled by XRootD threads
+  std::vector<std::unique_ptr<StreamBuffer>> m_freeBuffers;  //!< The buffers kept for reuse
+};
+
+inline void StreamBuffer::reset(size_t capacity) {
+  if (capacity > m_capacity) {
+    // Not value-initialised: the records overwrite the memory anyway
+    m_storage.reset(new char[capacity]);
+    m_capacity = capacity;
+    data = m_storage.get();
+  }
+  m_size = 0;
+  next = nullptr;
+}
+
+inline bool StreamBuffer::push(const Data& record) {
+  // The size computed here is cached in the record and reused to serialise it
+  const size_t recordSize = record.ByteSizeLong();
+  const size_t size = sizeof(uint32_t) + recordSize;
+  if (m_size + size > m_capacity) {
+    if (m_size > 0) {
+      return false;
+    }
+    reset(size);
+  }
+  auto* ptr = reinterpret_cast<uint8_t*>(data + m_size);
+  ptr = google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(static_cast<uint32_t>(recordSize), ptr);
+  record.SerializeWithCachedSizesToArray(ptr);
+  m_size += size;
+  return true;
+}
+
+inline void StreamBuffer::Recycle() {
+  std::unique_ptr<StreamBuffer> self(this);
+  if (auto pool = m_pool.lock()) {
+    pool->recycle(std::move(self));
+  }
+}
+
+inline std::unique_ptr<StreamBuffer> StreamBufferPool::getBuffer(size_t capacity) {
+  std::unique_ptr<StreamBuffer> buffer;
+  {
+    std::lock_guard lock(m_mutex);
+    if (!m_freeBuffers.empty()) {
+      buffer = std::move(m_freeBuffers.back());
+      m_freeBuffers.pop_back();
+    }
+  }
+  if (!buffer) {
+    return std::make_unique<StreamBuffer>(weak_from_this(), capacity);
+  }
+  buffer->reset(capacity);
+  return buffer;
+}
+
+inline void StreamBufferPool::recycle(std::unique_ptr<StreamBuffer> buffer) {
+  std::lock_guard lock(m_mutex);
+  if (m_freeBuffers.size() < m_maxFreeBuffers) {
+    m_freeBuffers.push_back(std::move(buffer));
+  }
+}
+
+}  // namespace cta::xrd
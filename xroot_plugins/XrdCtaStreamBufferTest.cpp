@@ -0,0 +1,147 @@
+/*
+ * SPDX-FileCopyrightText: 2026 CERN
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "xroot_plugins/XrdCtaStreamBuffer.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace unitTests {
+
+namespace {
+using cta::xrd::Data;
+using cta::xrd::StreamBuffer;
+using cta::xrd::StreamBufferPool;
+
+Data makeRecord(const std::string& instanceName) {
+  Data record;
+  record.mutable_version_item()->set_instance_name(instanceName);
+  return record;
+}
+
+/**
+ * Decodes the records of a buffer as the XrdSsiPb client does: a 32-bit little-endian size before each record
+ */
+std::vector<std::string> decodeRecords(const StreamBuffer& buffer) {
+  std::vector<std::string> instanceNames;
+  const auto* ptr = reinterpret_cast<const uint8_t*>(buffer.data);
+  const auto* const end = ptr + buffer.size();
+  while (ptr < end) {
+    EXPECT_LE(ptr + sizeof(uint32_t), end);
+    const uint32_t recordSize = static_cast<uint32_t>(ptr[0]) | static_cast<uint32_t>(ptr[1]) << 8
+                                | static_cast<uint32_t>(ptr[2]) << 16 | static_cast<uint32_t>(ptr[3]) << 24;
+    ptr += sizeof(uint32_t);
+    EXPECT_LE(ptr + recordSize, end);
+    Data record;
+    EXPECT_TRUE(record.ParseFromArray(ptr, static_cast<int>(recordSize)));
+    instanceNames.push_back(record.version_item().instance_name());
+    ptr += recordSize;
+  }
+  return instanceNames;
+}
+
+// Buffers are handed over to XRootD SSI as raw pointers, which recycles them once sent
+void sendBuffer(std::unique_ptr<StreamBuffer> buffer) {
+  buffer.release()->Recycle();
+}
+}  // namespace
+
+TEST(cta_xrd_StreamBuffer, recordsArePrecededByTheirLittleEndianSize) {
+  auto pool = std::make_shared<StreamBufferPool>(1);
+  auto buffer = pool->getBuffer(1024);
+  ASSERT_EQ(0, buffer->size());
+
+  const Data record = makeRecord(std::string(300, 'a'));
+  const size_t recordSize = record.ByteSizeLong();
+  // Larger than 255 bytes so that the byte order of the size matters
+  ASSERT_LT(255U, recordSize);
+  ASSERT_TRUE(buffer->push(record));
+  ASSERT_TRUE(buffer->push(makeRecord("instance")));
+
+  const auto* bytes = reinterpret_cast<const uint8_t*>(buffer->data);
+  ASSERT_EQ(recordSize & 0xFF, bytes[0]);
+  ASSERT_EQ((recordSize >> 8) & 0xFF, bytes[1]);
+  ASSERT_EQ(0, bytes[2]);
+  ASSERT_EQ(0, bytes[3]);
+  ASSERT_EQ(2 * sizeof(uint32_t) + recordSize + makeRecord("instance").ByteSizeLong(),
+            static_cast<size_t>(buffer->size()));
+  ASSERT_EQ(std::vector<std::string>({std::string(300, 'a'), "instance"}), decodeRecords(*buffer));
+  sendBuffer(std::move(buffer));
+}
+
+TEST(cta_xrd_StreamBuffer, recordWhichDoesNotFitIsCarriedIntoTheNextBuffer) {
+  auto pool = std::make_shared<StreamBufferPool>(1);
+  const Data record = makeRecord("instance0");
+  // Room for two records and a half
+  const size_t capacity = 5 * (sizeof(uint32_t) + record.ByteSizeLong()) / 2;
+
+  std::vector<std::string> received;
+  std::vector<std::vector<std::string>> bufferRecords;
+  size_t next = 0;
+  const size_t nbRecords = 7;
+  while (next < nbRecords) {
+    auto buffer = pool->getBuffer(capacity);
+    // As XrdCtaStream does, the record which did not fit is pushed first into the next buffer
+    while (next < nbRecords && buffer->push(makeRecord("instance" + std::to_string(next)))) {
+      next++;
+    }
+    ASSERT_LE(static_cast<size_t>(buffer->size()), capacity);
+    bufferRecords.push_back(decodeRecords(*buffer));
+    received.insert(received.end(), bufferRecords.back().begin(), bufferRecords.back().end());
+    sendBuffer(std::move(buffer));
+  }
+
+  ASSERT_EQ(4U, bufferRecords.size());
+  ASSERT_EQ(std::vector<std::string>({"instance0", "instance1"}), bufferRecords[0]);
+  ASSERT_EQ(std::vector<std::string>({"instance2", "instance3"}), bufferRecords[1]);
+  ASSERT_EQ(std::vector<std::string>({"instance6"}), bufferRecords[3]);
+  ASSERT_EQ(nbRecords, received.size());
+  for (size_t i = 0; i < nbRecords; i++) {
+    ASSERT_EQ("instance" + std::to_string(i), received[i]);
+  }
+}
+
+TEST(cta_xrd_StreamBuffer, emptyBufferGrowsForLargeRecord) {
+  auto pool = std::make_shared<StreamBufferPool>(1);
+  auto buffer = pool->getBuffer(16);
+  const std::string largeName(100, 'x');
+
+  ASSERT_TRUE(buffer->push(makeRecord(largeName)));
+  // Once the buffer holds a record it does not grow any more
+  ASSERT_FALSE(buffer->push(makeRecord("instance")));
+  ASSERT_EQ(std::vector<std::string>({largeName}), decodeRecords(*buffer));
+  sendBuffer(std::move(buffer));
+}
+
+TEST(cta_xrd_StreamBufferPool, recycledBuffersAreReusedEmpty) {
+  auto pool = std::make_shared<StreamBufferPool>(1);
+  auto buffer = pool->getBuffer(64);
+  ASSERT_TRUE(buffer->push(makeRecord("instance")));
+  const StreamBuffer* const sentBuffer = buffer.get();
+  sendBuffer(std::move(buffer));
+
+  auto first = pool->getBuffer(64);
+  ASSERT_EQ(sentBuffer, first.get());
+  ASSERT_EQ(0, first->size());
+  // Only one buffer is kept for reuse
+  auto second = pool->getBuffer(64);
+  ASSERT_NE(first.get(), second.get());
+  sendBuffer(std::move(first));
+  sendBuffer(std::move(second));
+}
+
+TEST(cta_xrd_StreamBufferPool, buffersCanOutliveThePool) {
+  auto pool = std::make_shared<StreamBufferPool>(1);
+  auto buffer = pool->getBuffer(64);
+  ASSERT_TRUE(buffer->push(makeRecord("instance")));
+  pool.reset();
+  // The buffer is freed rather than returned to the destroyed pool
+  sendBuffer(std::move(buffer));
+}
+
+}  // namespace unitTests
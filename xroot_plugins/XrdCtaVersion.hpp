@@ -45,7 +45,7 @@ private:
   /*!
    * Fill the buffer
    */
-  int fillBuffer(XrdSsiPb::OStreamBuffer<Data>* streambuf) final;
+  int fillBuffer(StreamBuffer& streambuf) final;
 
   /*!
    * Only one item is sent so isDone = true
@@ -76,7 +76,7 @@ inline VersionStream::VersionStream(const frontend::AdminCmdStream& requestMsg,
   }
 }
 
-inline int VersionStream::fillBuffer(XrdSsiPb::OStreamBuffer<Data>* streambuf) {
+inline int VersionStream::fillBuffer(StreamBuffer& streambuf) {
   m_is_done = true;
   Data record;
   auto version = record.mutable_version_item();
@@ -91,9 +91,9 @@ inline int VersionStream::fillBuffer(XrdSsiPb::OStreamBuffer<Data>* streambuf) {
   version->set_is_upgrading(m_is_upgrading);
   version->set_scheduler_backend_name(m_schedulerBackendName.value_or(""));
   version->set_instance_name(m_instanceName);
-  streambuf->Push(record);
+  streambuf.push(record);
 
-  return streambuf->Size();
+  return streambuf.size();
 }
 
 }  // namespace cta::xrd